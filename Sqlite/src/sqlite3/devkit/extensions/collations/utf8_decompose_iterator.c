@@ -14,7 +14,8 @@ static void Utf8DecomposeIterator_advanceToNextInputChar(Utf8DecomposeIterator*
         return;
     }
 
-    if (!UnicharDecompose(self->currentChar, &self->currentCharDecomposition, &self->decompositionLen))
+    if (!UnicharNormalize(self->currentChar, UnicharNormDecompose,
+            &self->currentCharDecomposition, &self->decompositionLen))
     {
         self->currentCharDecomposition = &self->currentChar;
         self->decompositionLen = 1;
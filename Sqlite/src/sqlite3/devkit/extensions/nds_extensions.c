@@ -6,6 +6,10 @@
     #include "collations/nds_collations_impl.h"
 #endif
 
+#ifdef HAVE_NDS_TOKENIZER
+    #include "tokenizer/nds_highlight.h"
+#endif
+
 int nds_extensions_init(sqlite3* p_db)
 {
     int r = SQLITE_OK;
@@ -18,5 +22,10 @@ int nds_extensions_init(sqlite3* p_db)
         r = RegisterNDSCollations(p_db);
 #endif
 
+#ifdef HAVE_NDS_TOKENIZER
+    if (r == SQLITE_OK)
+        r = RegisterNdsHighlight(p_db);
+#endif
+
     return r;
 }
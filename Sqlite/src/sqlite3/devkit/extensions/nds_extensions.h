@@ -11,6 +11,13 @@ extern "C"
 /**
  * The function registers all NDS extensions.
  *
+ * With the tokenizer, this includes the nds_highlight(TEXT, QUERY, OPTION...) SQL function: it
+ * tokenizes TEXT with an ndsunicode61 tokenizer created with the OPTIONs (those of the FTS table)
+ * and returns the byte ranges of TEXT matching the terms of QUERY, the MATCH expression ("term*"
+ * matches a prefix), as a blob of little-endian 32-bit offset pairs (start, end), in order and
+ * merged. The ranges of CJK matches cover whole characters. The tokenizers are kept by the
+ * connection and the terms of QUERY for the rows of a statement.
+ *
  * \param p_db The pointer to database for which to register the extensions.
  *
  * \return Returns SQLITE_OK in case of success, otherwise returns SQLite error code.
@@ -73,12 +80,210 @@ int nds_extensions_init(sqlite3* p_db);
 #ifdef HAVE_NDS_TOKENIZER
     /* ndsunicode61 tokenizer */
 
+    #ifdef _WIN32
+        #if defined(NDS_TOKENIZER_EXPORT)
+            #define NDS_TOKENIZER_API __declspec(dllexport)
+        #elif defined(NDS_TOKENIZER_IMPORT)
+            #define NDS_TOKENIZER_API __declspec(dllimport)
+        #else
+            #define NDS_TOKENIZER_API
+        #endif
+    #else
+        #ifdef __GNUC__
+            #define NDS_TOKENIZER_API __attribute__((visibility("default")))
+        #else
+            #define NDS_TOKENIZER_API
+        #endif
+    #endif
+
     /**
      * Get a pointer to the ndsunicode61 tokenizer module.
      *
      * \note This function is not exported, it's expected to be only called from within nds sqlite.
      */
     void sqlite3Fts3NdsUnicodeTokenizer(sqlite3_tokenizer_module const**ppModule);
+
+    /**
+     * Caller-provided output of nds_tokenize_batch(), as a structure of arrays.
+     *
+     * All per-token arrays must have room for token_capacity entries. The arrays start_offset,
+     * end_offset, position and input_index may be NULL if the values are not needed.
+     */
+    typedef struct
+    {
+        char* token_data;            /**< Arena receiving the bytes of the tokens (not nul-terminated). */
+        int   token_data_capacity;   /**< Size of token_data in bytes. */
+        int   token_capacity;        /**< Number of entries of each per-token array. */
+        int   query_mode;            /**< Nonzero to tokenize the inputs as phrases of MATCH expressions, 0 as documents. */
+
+        int*  token_data_offset;     /**< Per token: offset of its bytes in token_data. */
+        int*  token_len;             /**< Per token: length of the token in bytes. */
+        int*  start_offset;          /**< Per token: byte offset of the token in its input. */
+        int*  end_offset;            /**< Per token: byte offset just past the token in its input. */
+        int*  position;              /**< Per token: position of the token in its input (from 0). */
+        int*  input_index;           /**< Per token: index of the input the token comes from. */
+
+        int   token_count;           /**< Output: number of tokens stored. */
+        int   token_data_size;       /**< Output: number of bytes of token_data used. */
+        int   input_count_done;      /**< Output: number of inputs whose tokens are all stored. */
+    } nds_token_batch;
+
+    /**
+     * Tokenize one or more buffers with the ndsunicode61 tokenizer in a single call.
+     *
+     * This runs the same code as the FTS cursor interface (xOpen/xNext/xClose) and returns the
+     * same tokens, offsets and positions, but without a callback per token. With query_mode set
+     * to 0 in the batch, the tokens are those FTS indexes for a row, whether or not input_lens is
+     * given; otherwise they are those of a phrase of a MATCH expression, without the terms that
+     * some options (edge_ngrams, cjk_ngram=1,2, pinyin, hangul_choseong, phone_numbers) add to
+     * documents only.
+     *
+     * Only complete inputs are stored: if the output arrays or the arena get full, the tokens of
+     * the input being processed are dropped and SQLITE_FULL is returned. The caller can then
+     * consume the output and call the function again with the remaining inputs, starting at
+     * input_count_done.
+     *
+     * \param[in] tokenizer   Tokenizer created by the xCreate() method of the module returned by
+     *                        sqlite3Fts3NdsUnicodeTokenizer().
+     * \param[in] inputs      Array of input_count pointers to utf8-encoded buffers.
+     * \param[in] input_lens  Array of input_count lengths (in bytes) of the buffers, or NULL if
+     *                        all buffers are nul-terminated. A negative length means the buffer
+     *                        is nul-terminated.
+     * \param[in] input_count Number of buffers to tokenize.
+     * \param[in,out] batch   Output storage, see nds_token_batch.
+     *
+     * \return SQLITE_OK if all inputs have been tokenized, SQLITE_FULL if the output storage
+     * got full, another SQLite error code otherwise.
+     */
+    NDS_TOKENIZER_API int nds_tokenize_batch(sqlite3_tokenizer* tokenizer, char const* const* inputs,
+                                             int const* input_lens, int input_count, nds_token_batch* batch);
+
+    /**
+     * Counters of a cache of a tokenizer, see the token_cache and query_cache options.
+     */
+    typedef struct
+    {
+        sqlite3_uint64 hits;         /**< Number of lookups that found an entry. */
+        sqlite3_uint64 misses;       /**< Number of lookups that didn't. */
+        int            entry_count;  /**< Number of cached tokens (or queries). */
+        int            capacity;     /**< Maximum number of entries, 0 if the cache is disabled. */
+    } nds_token_cache_stats;
+
+    /**
+     * Retrieve the counters of the token cache of a tokenizer.
+     *
+     * The hit rate is hits / (hits + misses). Tokens made of ASCII characters only are not looked
+     * up and not counted. All counters are zero when the cache is disabled.
+     *
+     * \param[in]  tokenizer Tokenizer created by the xCreate() method of the module returned by
+     *                       sqlite3Fts3NdsUnicodeTokenizer().
+     * \param[out] stats     Receives the counters.
+     *
+     * \return SQLITE_OK when operation succeeded, an error code otherwise.
+     */
+    NDS_TOKENIZER_API int nds_tokenizer_cache_stats(sqlite3_tokenizer* tokenizer, nds_token_cache_stats* stats);
+
+    /**
+     * Retrieve the counters of the query cache of a tokenizer.
+     *
+     * Each text FTS passes with its length (a MATCH expression, the part of it FTS hasn't parsed
+     * yet, or a phrase of it) is looked up once. A text is only cached once it has been seen
+     * before, and the lookup of a text seen for the first time is not counted, so that the rows
+     * FTS tokenizes for snippet() and offsets(), which come with their length too, don't dilute
+     * the hit rate. All
+     * counters are zero when the cache is disabled.
+     *
+     * \param[in]  tokenizer Tokenizer created by the xCreate() method of the module returned by
+     *                       sqlite3Fts3NdsUnicodeTokenizer().
+     * \param[out] stats     Receives the counters.
+     *
+     * \return SQLITE_OK when operation succeeded, an error code otherwise.
+     */
+    NDS_TOKENIZER_API int nds_tokenizer_query_cache_stats(sqlite3_tokenizer* tokenizer, nds_token_cache_stats* stats);
+
+    /**
+     * Worker threads tokenizing the rows of an FTS table ahead of their insertion.
+     *
+     * FTS tokenizes the rows it inserts in the thread running the INSERT. To spread this over
+     * several cores, the table is created with the ndsreplay tokenizer (see nds_replay_register()),
+     * which takes the ndsunicode61 options and the name of a builder:
+     *
+     *     CREATE VIRTUAL TABLE poi USING fts4(name, address, tokenize=ndsreplay "replay=load" "remove_diacritics=0");
+     *
+     * The loader creates a builder of that name with the same options, submits the non-NULL
+     * columns of a batch of rows, in column order, and then inserts the rows in the same order.
+     * While the rows are inserted, the workers tokenize the following ones. When FTS tokenizes a
+     * submitted text, the precomputed tokens are returned (replayed); any other text, including
+     * all texts once the builder has been destroyed, is tokenized as by ndsunicode61. The index
+     * is the same either way.
+     *
+     * The tokenizer looks the builder up when FTS creates it, the first time a connection uses the
+     * table, so the builder must be created before that.
+     */
+    struct tagNdsReplayBuilder;
+    typedef struct tagNdsReplayBuilder nds_replay_builder;
+
+    /**
+     * Register the ndsreplay tokenizer with a database connection.
+     *
+     * This uses the fts3_tokenizer() SQL function, so it must be called once the connection is
+     * open, on every connection using a table with the ndsreplay tokenizer.
+     *
+     * \return SQLITE_OK when operation succeeded, an error code otherwise.
+     */
+    NDS_TOKENIZER_API int nds_replay_register(sqlite3* db);
+
+    /**
+     * Counters of a builder, see nds_replay_get_stats().
+     */
+    typedef struct
+    {
+        sqlite3_uint64 replayed;   /**< Number of texts whose precomputed tokens were returned. */
+        sqlite3_uint64 tokenized;  /**< Number of texts the tokenizers using the builder tokenized themselves. */
+        sqlite3_uint64 dropped;    /**< Number of submitted texts that FTS passed over. */
+    } nds_replay_stats;
+
+    /**
+     * Create a builder and start its workers.
+     *
+     * \param[in]  name         Name of the builder, given by the replay option of the tokenizer.
+     * \param[in]  argc         Number of ndsunicode61 options.
+     * \param[in]  argv         The ndsunicode61 options, as given to the tokenizer (in the same
+     *                          order, without the replay option).
+     * \param[in]  thread_count Number of worker threads.
+     * \param[out] builder      Receives the builder.
+     *
+     * \return SQLITE_OK when operation succeeded, SQLITE_ERROR if another builder has the same name,
+     * another error code otherwise.
+     */
+    NDS_TOKENIZER_API int nds_replay_builder_create(const char* name, int argc, char const* const* argv,
+                                                    int thread_count, nds_replay_builder** builder);
+
+    /**
+     * Submit the text of a column of a row to be tokenized by the workers.
+     *
+     * \param[in] builder The builder.
+     * \param[in] docid   Docid of the row, the columns of a row are submitted one after the other.
+     * \param[in] text    The utf8-encoded text, copied by the function.
+     * \param[in] len     Length of the text in bytes, or a negative value if it's nul-terminated.
+     *
+     * \return SQLITE_OK when operation succeeded, an error code otherwise.
+     */
+    NDS_TOKENIZER_API int nds_replay_submit(nds_replay_builder* builder, sqlite3_int64 docid, const char* text, int len);
+
+    /**
+     * Retrieve the counters of a builder.
+     *
+     * \return SQLITE_OK when operation succeeded, an error code otherwise.
+     */
+    NDS_TOKENIZER_API int nds_replay_get_stats(nds_replay_builder* builder, nds_replay_stats* stats);
+
+    /**
+     * Destroy a builder, releasing the texts that have not been replayed.
+     *
+     * The workers are stopped once the last tokenizer using the builder has been destroyed.
+     */
+    NDS_TOKENIZER_API void nds_replay_builder_destroy(nds_replay_builder* builder);
 #endif /* HAVE_NDS_TOKENIZER */
 
 #ifdef __cplusplus
@@ -17,6 +17,8 @@
 #endif
 #ifdef HAVE_NDS_TOKENIZER
     #include "test_ndsunicode61_tokenizer.h"
+    #include "test_ndsreplay_tokenizer.h"
+    #include "test_nds_highlight.h"
 #endif
 
 struct TestEntry
@@ -43,6 +45,10 @@ static const TestEntry Tests[] =
         { "TestUnicharDecompose_fullwidthLatin", TestUnicharDecompose_fullwidthLatin },
         { "TestUnicharDecompose_fullwidthDigit", TestUnicharDecompose_fullwidthDigit },
         { "TestUnicharDecompose_fullwidthSymbol", TestUnicharDecompose_fullwidthSymbol },
+        { "TestUnicharNormalize_unchanged", TestUnicharNormalize_unchanged },
+        { "TestUnicharNormalize_latin", TestUnicharNormalize_latin },
+        { "TestUnicharNormalize_combiningMark", TestUnicharNormalize_combiningMark },
+        { "TestUnicharNormalize_kana", TestUnicharNormalize_kana },
 #ifdef HAVE_NDS_COLLATIONS
         { "Utf8DecomposeIterator", TestUtf8DecomposeIterator },
         { "Utf8DecomposeIterator_NullArgs", TestUtf8DecomposeIterator_NullArgs },
@@ -71,6 +77,29 @@ static const TestEntry Tests[] =
         { "NdsUnicode61Tokenizer_mixed", TestNdsUnicode61Tokenizer_mixed },
         { "NdsUnicode61Tokenizer_tokencharsSeparators", TestNdsUnicode61Tokenizer_tokencharsSeparators },
         { "NdsUnicode61Tokenizer_ideographicSpace", TestNdsUnicode61Tokenizer_ideographicSpace },
+        { "NdsUnicode61Tokenizer_longToken", TestNdsUnicode61Tokenizer_longToken },
+        { "NdsUnicode61Tokenizer_nonAsciiExceptions", TestNdsUnicode61Tokenizer_nonAsciiExceptions },
+        { "NdsUnicode61Tokenizer_cursorReuse", TestNdsUnicode61Tokenizer_cursorReuse },
+        { "NdsUnicode61Tokenizer_batch", TestNdsUnicode61Tokenizer_batch },
+        { "NdsUnicode61Tokenizer_edgeNgrams", TestNdsUnicode61Tokenizer_edgeNgrams },
+        { "NdsUnicode61Tokenizer_cjkNgram", TestNdsUnicode61Tokenizer_cjkNgram },
+        { "NdsUnicode61Tokenizer_queryBigramCover", TestNdsUnicode61Tokenizer_queryBigramCover },
+        { "NdsUnicode61Tokenizer_dictionarySegmentation", TestNdsUnicode61Tokenizer_dictionarySegmentation },
+        { "NdsUnicode61Tokenizer_kanaFold", TestNdsUnicode61Tokenizer_kanaFold },
+        { "NdsUnicode61Tokenizer_pinyin", TestNdsUnicode61Tokenizer_pinyin },
+        { "NdsUnicode61Tokenizer_hangulChoseong", TestNdsUnicode61Tokenizer_hangulChoseong },
+        { "NdsUnicode61Tokenizer_phoneNumbers", TestNdsUnicode61Tokenizer_phoneNumbers },
+        { "NdsUnicode61Tokenizer_extraEdgeNgrams", TestNdsUnicode61Tokenizer_extraEdgeNgrams },
+        { "NdsUnicode61Tokenizer_tokenCache", TestNdsUnicode61Tokenizer_tokenCache },
+        { "NdsUnicode61Tokenizer_queryCache", TestNdsUnicode61Tokenizer_queryCache },
+        { "NdsUnicode61Tokenizer_languageid", TestNdsUnicode61Tokenizer_languageid },
+        { "NdsUnicode61Tokenizer_substitutionPrefix", TestNdsUnicode61Tokenizer_substitutionPrefix },
+        { "NdsUnicode61Tokenizer_integrityCheck", TestNdsUnicode61Tokenizer_integrityCheck },
+        { "NdsReplayTokenizer_replay", TestNdsReplayTokenizer_replay },
+        { "NdsReplayTokenizer_options", TestNdsReplayTokenizer_options },
+        { "NdsReplayTokenizer_documentOptions", TestNdsReplayTokenizer_documentOptions },
+        { "NdsHighlight_ranges", TestNdsHighlight_ranges },
+        { "NdsHighlight_errors", TestNdsHighlight_errors },
 #endif
 };
 static const unsigned TestCount = sizeof(Tests)/sizeof(Tests[0]);
@@ -0,0 +1,116 @@
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+
+#include "test_nds_highlight.h"
+#include "extensions_test.h"
+
+#include "../nds_extensions.h"
+#include "../utils/nds_extension_macros.h"
+
+namespace
+{
+    /**
+     * Decode the blob returned by nds_highlight() as "start-end;" pairs.
+     */
+    std::string Ranges(sqlite3_stmt* stmt)
+    {
+        const unsigned char* blob = static_cast<const unsigned char*>(sqlite3_column_blob(stmt, 0));
+        const int size = sqlite3_column_bytes(stmt, 0);
+        std::string ranges;
+
+        if (sqlite3_column_type(stmt, 0) == SQLITE_NULL)
+            return "NULL";
+
+        EXPECT_EQ(0, size % 8);
+        for (int i = 0; i + 8 <= size; i += 8)
+        {
+            char range[32];
+            const unsigned start = blob[i] | (blob[i + 1] << 8) | (blob[i + 2] << 16) | (blob[i + 3] << 24);
+            const unsigned end = blob[i + 4] | (blob[i + 5] << 8) | (blob[i + 6] << 16) | (blob[i + 7] << 24);
+            sprintf(range, "%u-%u;", start, end);
+            ranges.append(range);
+        }
+
+        return ranges;
+    }
+}
+
+void TestNdsHighlight_ranges()
+{
+    // U+65E5 U+672C U+8A9E, Caf<U+00E9>
+    static const char* ROWS[] = {
+            "Main Road \xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e road",
+            "Roadway Caf\xc3\xa9",
+            NULL,
+            "Nothing here",
+    };
+
+    static const struct
+    {
+        const char* query;
+        const char* ranges[ARRAY_SIZE(ROWS)];
+    } TESTS[] =
+    {
+            // whole tokens only, diacritics removed as in the index
+            { "road cafe", { "5-9;20-24;", "8-13;", "NULL", "" } },
+            // a prefix, and the bigram of the last two characters covering both of them
+            { "ro* \xe6\x9c\xac\xe8\xaa\x9e", { "5-9;13-19;20-24;", "0-7;", "NULL", "" } },
+            // overlapping bigrams are merged, operators are not terms
+            { "\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e OR here", { "10-19;", "", "NULL", "8-12;" } },
+            { "", { "", "", "NULL", "" } },
+    };
+
+    sqlite3* db = NULL;
+    EXPECT_EQ(SQLITE_OK, sqlite3_open(":memory:", &db));
+    EXPECT_EQ(SQLITE_OK, nds_extensions_init(db));
+    EXPECT_EQ(SQLITE_OK, sqlite3_exec(db, "CREATE TABLE t(text)", NULL, NULL, NULL));
+
+    sqlite3_stmt* insert = NULL;
+    EXPECT_EQ(SQLITE_OK, sqlite3_prepare_v2(db, "INSERT INTO t VALUES(?)", -1, &insert, NULL));
+    for (size_t i = 0; i < ARRAY_SIZE(ROWS); ++i)
+    {
+        sqlite3_bind_text(insert, 1, ROWS[i], -1, SQLITE_STATIC);
+        EXPECT_EQ(SQLITE_DONE, sqlite3_step(insert));
+        sqlite3_reset(insert);
+    }
+    sqlite3_finalize(insert);
+
+    // the query is a parameter, as when the statement is run again for each keystroke
+    sqlite3_stmt* select = NULL;
+    EXPECT_EQ(SQLITE_OK, sqlite3_prepare_v2(db,
+            "SELECT nds_highlight(text, ?, 'remove_diacritics=1') FROM t ORDER BY rowid", -1, &select, NULL));
+    for (size_t i = 0; i < ARRAY_SIZE(TESTS); ++i)
+    {
+        sqlite3_bind_text(select, 1, TESTS[i].query, -1, SQLITE_STATIC);
+        for (size_t row = 0; row < ARRAY_SIZE(ROWS); ++row)
+        {
+            EXPECT_EQ(SQLITE_ROW, sqlite3_step(select));
+            EXPECT_EQ(std::string(TESTS[i].ranges[row]), Ranges(select));
+        }
+        EXPECT_EQ(SQLITE_DONE, sqlite3_step(select));
+        sqlite3_reset(select);
+    }
+    sqlite3_finalize(select);
+
+    EXPECT_EQ(SQLITE_OK, sqlite3_close(db));
+}
+
+void TestNdsHighlight_errors()
+{
+    static const char* INVALID[] = {
+            "SELECT nds_highlight('Road')",
+            "SELECT nds_highlight('Road', 'road', 'unknown=1')",
+            "SELECT nds_highlight('Road', 'road', NULL)",
+    };
+
+    sqlite3* db = NULL;
+    EXPECT_EQ(SQLITE_OK, sqlite3_open(":memory:", &db));
+    EXPECT_EQ(SQLITE_OK, nds_extensions_init(db));
+
+    for (size_t i = 0; i < ARRAY_SIZE(INVALID); ++i)
+        EXPECT_EQ(SQLITE_ERROR, sqlite3_exec(db, INVALID[i], NULL, NULL, NULL));
+
+    EXPECT_EQ(SQLITE_OK, sqlite3_close(db));
+}
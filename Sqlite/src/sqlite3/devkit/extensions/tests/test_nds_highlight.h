@@ -0,0 +1,7 @@
+#ifndef TEST_NDS_HIGHLIGHT_H
+#define TEST_NDS_HIGHLIGHT_H
+
+void TestNdsHighlight_ranges();
+void TestNdsHighlight_errors();
+
+#endif // TEST_NDS_HIGHLIGHT_H
@@ -0,0 +1,259 @@
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+
+#include "test_ndsreplay_tokenizer.h"
+#include "extensions_test.h"
+
+#include "../tokenizer/nds_replay.h"
+#include "../tokenizer/nds_unicode61.h"
+#include "../utils/nds_extension_macros.h"
+
+namespace
+{
+    /**
+     * Tokenize a text as FTS does when it indexes a row, and return the tokens (with their offsets
+     * and positions) as a string.
+     */
+    std::string Tokenize(sqlite3_tokenizer* tokenizer, const char* text)
+    {
+        sqlite3_tokenizer_cursor* cursor = NULL;
+        std::string tokens;
+        const char* token;
+        int nBytes;
+        int startOffset;
+        int endOffset;
+        int position;
+
+        EXPECT_EQ(SQLITE_OK, tokenizer->pModule->xOpen(tokenizer, text, -1, &cursor));
+        cursor->pTokenizer = tokenizer;
+        while (tokenizer->pModule->xNext(cursor, &token, &nBytes, &startOffset, &endOffset, &position) == SQLITE_OK)
+        {
+            char numbers[64];
+            sprintf(numbers, " %d-%d@%d;", startOffset, endOffset, position);
+            tokens.append(token, nBytes);
+            tokens.append(numbers);
+        }
+        EXPECT_EQ(SQLITE_OK, tokenizer->pModule->xClose(cursor));
+
+        return tokens;
+    }
+
+    sqlite3_tokenizer* CreateTokenizer(sqlite3_tokenizer_module const* module, int argc, char const* const* argv)
+    {
+        sqlite3_tokenizer* tokenizer = NULL;
+        EXPECT_EQ(SQLITE_OK, module->xCreate(argc, argv, &tokenizer));
+        tokenizer->pModule = module;
+        return tokenizer;
+    }
+
+    /**
+     * Return the rows of an fts4aux table (term, column, documents, occurrences) as a string.
+     */
+    std::string Terms(sqlite3* db, const char* auxTable)
+    {
+        const std::string sql = std::string("SELECT term, col, documents, occurrences FROM ") + auxTable;
+        sqlite3_stmt* stmt = NULL;
+        std::string terms;
+
+        EXPECT_EQ(SQLITE_OK, sqlite3_prepare_v2(db, sql.c_str(), -1, &stmt, NULL));
+        while (sqlite3_step(stmt) == SQLITE_ROW)
+        {
+            char numbers[64];
+            sprintf(numbers, " %s %d %d;", (const char*)sqlite3_column_text(stmt, 1), sqlite3_column_int(stmt, 2),
+                    sqlite3_column_int(stmt, 3));
+            terms.append((const char*)sqlite3_column_text(stmt, 0));
+            terms.append(numbers);
+        }
+        EXPECT_EQ(SQLITE_OK, sqlite3_finalize(stmt));
+
+        return terms;
+    }
+
+    int Count(sqlite3* db, const char* sql)
+    {
+        sqlite3_stmt* stmt = NULL;
+        int count = -1;
+
+        EXPECT_EQ(SQLITE_OK, sqlite3_prepare_v2(db, sql, -1, &stmt, NULL));
+        if (sqlite3_step(stmt) == SQLITE_ROW)
+            count = sqlite3_column_int(stmt, 0);
+        EXPECT_EQ(SQLITE_OK, sqlite3_finalize(stmt));
+
+        return count;
+    }
+}
+
+void TestNdsReplayTokenizer_replay()
+{
+    static char const* builderArgv[] = {
+            "remove_diacritics=0"
+    };
+    static char const* replayArgv[] = {
+            "replay=test_replay",
+            "remove_diacritics=0"
+    };
+
+    // Stra<U+00DF>e, U+65E5 U+672C U+8A9E
+    static const char* ROWS[][2] = {
+            { "Caf\xc3\xa9 Stra\xc3\x9f" "e 12", "Main Street" },
+            { "\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e", "Tokyo" },
+            { "Bahnhof", "Bahnhofstra\xc3\x9f" "e" },
+    };
+
+    sqlite3_tokenizer_module const* unicode61Module = NULL;
+    sqlite3_tokenizer_module const* replayModule = NULL;
+    sqlite3Fts3NdsUnicodeTokenizer(&unicode61Module);
+    sqlite3Fts3NdsReplayTokenizer(&replayModule);
+
+    nds_replay_builder* builder = NULL;
+    EXPECT_EQ(SQLITE_OK, nds_replay_builder_create("test_replay", ARRAY_SIZE(builderArgv), builderArgv, 2, &builder));
+
+    // the name is taken
+    nds_replay_builder* other = NULL;
+    EXPECT_EQ(SQLITE_ERROR, nds_replay_builder_create("test_replay", 0, NULL, 1, &other));
+    EXPECT_EQ(true, other == NULL);
+
+    for (int row = 0; row < (int)ARRAY_SIZE(ROWS); ++row)
+    {
+        for (int column = 0; column < 2; ++column)
+            EXPECT_EQ(SQLITE_OK, nds_replay_submit(builder, row + 1, ROWS[row][column], -1));
+    }
+
+    sqlite3_tokenizer* unicode61 = CreateTokenizer(unicode61Module, ARRAY_SIZE(builderArgv), builderArgv);
+    sqlite3_tokenizer* replay = CreateTokenizer(replayModule, ARRAY_SIZE(replayArgv), replayArgv);
+
+    // the first row is replayed, the second column of the second row is passed over (as if it was
+    // NULL), and the third row is replayed
+    EXPECT_EQ(Tokenize(unicode61, ROWS[0][0]), Tokenize(replay, ROWS[0][0]));
+    EXPECT_EQ(Tokenize(unicode61, ROWS[0][1]), Tokenize(replay, ROWS[0][1]));
+    EXPECT_EQ(Tokenize(unicode61, ROWS[1][0]), Tokenize(replay, ROWS[1][0]));
+    EXPECT_EQ(Tokenize(unicode61, ROWS[2][0]), Tokenize(replay, ROWS[2][0]));
+    EXPECT_EQ(Tokenize(unicode61, ROWS[2][1]), Tokenize(replay, ROWS[2][1]));
+
+    // texts that have not been submitted are tokenized on the spot
+    EXPECT_EQ(Tokenize(unicode61, "Caf\xc3\xa9 Stra\xc3\x9f" "e 12"), Tokenize(replay, "Caf\xc3\xa9 Stra\xc3\x9f" "e 12"));
+
+    nds_replay_stats stats;
+    EXPECT_EQ(SQLITE_OK, nds_replay_get_stats(builder, &stats));
+    EXPECT_EQ(5, (int)stats.replayed);
+    EXPECT_EQ(1, (int)stats.tokenized);
+    EXPECT_EQ(1, (int)stats.dropped);
+
+    // the tokenizer keeps working once the builder is gone
+    nds_replay_builder_destroy(builder);
+    EXPECT_EQ(Tokenize(unicode61, ROWS[1][1]), Tokenize(replay, ROWS[1][1]));
+
+    EXPECT_EQ(SQLITE_OK, replayModule->xDestroy(replay));
+    EXPECT_EQ(SQLITE_OK, unicode61Module->xDestroy(unicode61));
+}
+
+void TestNdsReplayTokenizer_options()
+{
+    static char const* builderArgv[] = {
+            "remove_diacritics=0"
+    };
+    static char const* replayArgv[] = {
+            "replay=test_options"
+    };
+    static char const* invalidArgv[] = {
+            "remove_diacritics=x"
+    };
+
+    sqlite3_tokenizer_module const* replayModule = NULL;
+    sqlite3Fts3NdsReplayTokenizer(&replayModule);
+
+    nds_replay_builder* builder = NULL;
+    EXPECT_EQ(SQLITE_ERROR, nds_replay_builder_create("test_options", ARRAY_SIZE(invalidArgv), invalidArgv, 1, &builder));
+    EXPECT_EQ(SQLITE_MISUSE, nds_replay_builder_create("test_options", 0, NULL, 0, &builder));
+    EXPECT_EQ(SQLITE_OK, nds_replay_builder_create("test_options", ARRAY_SIZE(builderArgv), builderArgv, 1, &builder));
+    EXPECT_EQ(SQLITE_OK, nds_replay_submit(builder, 1, "Caf\xc3\xa9", -1));
+
+    // a builder with other options than the tokenizer is not used
+    sqlite3_tokenizer* replay = CreateTokenizer(replayModule, ARRAY_SIZE(replayArgv), replayArgv);
+    EXPECT_EQ(std::string("cafe 0-5@0;"), Tokenize(replay, "Caf\xc3\xa9"));
+    EXPECT_EQ(SQLITE_OK, replayModule->xDestroy(replay));
+
+    nds_replay_stats stats;
+    EXPECT_EQ(SQLITE_OK, nds_replay_get_stats(builder, &stats));
+    EXPECT_EQ(0, (int)stats.replayed);
+    EXPECT_EQ(0, (int)stats.tokenized);
+
+    nds_replay_builder_destroy(builder);
+}
+
+void TestNdsReplayTokenizer_documentOptions()
+{
+    // all options adding terms to documents only
+    static char const* builderArgv[] = {
+            "edge_ngrams=2:4",
+            "cjk_ngram=1,2",
+            "hangul_choseong=1",
+            "phone_numbers=1"
+    };
+
+    // U+65E5 U+672C U+8A9E, U+C11C U+C6B8 U+C5ED
+    static const char* ROWS[][2] = {
+            { "Hauptstrasse 12", "+49 89 1234567" },
+            { "\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e Station", "Strandweg 5" },
+            { "\xec\x84\x9c\xec\x9a\xb8\xec\x97\xad", "(089) 12-34" },
+    };
+
+    sqlite3_tokenizer_module const* unicode61Module = NULL;
+    sqlite3Fts3NdsUnicodeTokenizer(&unicode61Module);
+
+    sqlite3* db = NULL;
+    EXPECT_EQ(SQLITE_OK, sqlite3_open(":memory:", &db));
+    sqlite3_stmt* stmt = NULL;
+    EXPECT_EQ(SQLITE_OK, sqlite3_prepare_v2(db, "SELECT fts3_tokenizer('ndsunicode61', ?)", -1, &stmt, NULL));
+    sqlite3_bind_blob(stmt, 1, &unicode61Module, sizeof(unicode61Module), SQLITE_STATIC);
+    EXPECT_EQ(SQLITE_ROW, sqlite3_step(stmt));
+    EXPECT_EQ(SQLITE_OK, sqlite3_finalize(stmt));
+    EXPECT_EQ(SQLITE_OK, nds_replay_register(db));
+
+    nds_replay_builder* builder = NULL;
+    EXPECT_EQ(SQLITE_OK, nds_replay_builder_create("test_document", ARRAY_SIZE(builderArgv), builderArgv, 2, &builder));
+
+    EXPECT_EQ(SQLITE_OK, sqlite3_exec(db,
+            "CREATE VIRTUAL TABLE live USING fts4(name, address, tokenize=ndsunicode61 "
+            "\"edge_ngrams=2:4\" \"cjk_ngram=1,2\" \"hangul_choseong=1\" \"phone_numbers=1\");"
+            "CREATE VIRTUAL TABLE replayed USING fts4(name, address, tokenize=ndsreplay \"replay=test_document\" "
+            "\"edge_ngrams=2:4\" \"cjk_ngram=1,2\" \"hangul_choseong=1\" \"phone_numbers=1\");"
+            "CREATE VIRTUAL TABLE live_terms USING fts4aux(live);"
+            "CREATE VIRTUAL TABLE replayed_terms USING fts4aux(replayed);",
+            NULL, NULL, NULL));
+
+    for (int row = 0; row < (int)ARRAY_SIZE(ROWS); ++row)
+    {
+        for (int column = 0; column < 2; ++column)
+            EXPECT_EQ(SQLITE_OK, nds_replay_submit(builder, row + 1, ROWS[row][column], -1));
+    }
+
+    EXPECT_EQ(SQLITE_OK, sqlite3_prepare_v2(db, "INSERT INTO replayed(docid, name, address) VALUES(?, ?, ?)", -1,
+            &stmt, NULL));
+    for (int row = 0; row < (int)ARRAY_SIZE(ROWS); ++row)
+    {
+        sqlite3_bind_int(stmt, 1, row + 1);
+        sqlite3_bind_text(stmt, 2, ROWS[row][0], -1, SQLITE_STATIC);
+        sqlite3_bind_text(stmt, 3, ROWS[row][1], -1, SQLITE_STATIC);
+        EXPECT_EQ(SQLITE_DONE, sqlite3_step(stmt));
+        sqlite3_reset(stmt);
+    }
+    EXPECT_EQ(SQLITE_OK, sqlite3_finalize(stmt));
+    EXPECT_EQ(SQLITE_OK, sqlite3_exec(db, "INSERT INTO live(docid, name, address) SELECT docid, name, address FROM replayed",
+            NULL, NULL, NULL));
+
+    nds_replay_stats stats;
+    EXPECT_EQ(SQLITE_OK, nds_replay_get_stats(builder, &stats));
+    EXPECT_EQ(2 * (int)ARRAY_SIZE(ROWS), (int)stats.replayed);
+
+    // the replayed index is the one built live, n-grams, unigrams, initials and numbers included
+    EXPECT_EQ(Terms(db, "live_terms"), Terms(db, "replayed_terms"));
+    EXPECT_EQ(1, Count(db, "SELECT count(*) FROM replayed WHERE replayed MATCH 'stra*'"));
+    EXPECT_EQ(1, Count(db, "SELECT count(*) FROM replayed WHERE replayed MATCH '\xe8\xaa\x9e'"));
+    EXPECT_EQ(2, Count(db, "SELECT count(*) FROM replayed WHERE replayed MATCH '0891234567 OR 1234'"));
+
+    EXPECT_EQ(SQLITE_OK, sqlite3_close(db));
+    nds_replay_builder_destroy(builder);
+}
@@ -0,0 +1,8 @@
+#ifndef TEST_NDSREPLAY_TOKENIZER_H
+#define TEST_NDSREPLAY_TOKENIZER_H
+
+void TestNdsReplayTokenizer_replay();
+void TestNdsReplayTokenizer_options();
+void TestNdsReplayTokenizer_documentOptions();
+
+#endif // TEST_NDSREPLAY_TOKENIZER_H
@@ -1,4 +1,5 @@
 #include <stddef.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -74,6 +75,11 @@ namespace
                         &iEndOffset, &iPosition) == SQLITE_OK;
             }
 
+            bool setLanguage(int languageId)
+            {
+                return m_tokenizerModule->xLanguageid(m_cursor, languageId) == SQLITE_OK;
+            }
+
             ~cursor()
             {
                 const int result = m_tokenizerModule->xClose(m_cursor);
@@ -99,6 +105,11 @@ namespace
             return new cursor(m_tokenizerModule, cur);
         }
 
+        sqlite3_tokenizer* get() const
+        {
+            return m_tokenizer;
+        }
+
     private:
         static sqlite3_tokenizer_module const* getTokenizer()
         {
@@ -137,6 +148,50 @@ namespace
         // no more tokens
         EXPECT_EQ(false, cur.nextToken(token, len, startOffset, endOffset, idx));
     }
+
+    void TestReturnedTokens(NdsUnicode61Tokenizer::cursor &cur, Token const* tokens, int const* positions,
+            int count)
+    {
+        const char* token;
+        int len;
+        int startOffset;
+        int endOffset;
+        int position;
+
+        for (int i = 0; i < count; ++i)
+        {
+            Token const& t = tokens[i];
+
+            EXPECT_EQ(true, cur.nextToken(token, len, startOffset, endOffset, position));
+
+            EXPECT_EQ(t.nBytes, len);
+            EXPECT_EQ(0, strncmp(t.token, token, len));
+            EXPECT_EQ(t.startOffset, startOffset);
+            EXPECT_EQ(t.endOffset, endOffset);
+            EXPECT_EQ(positions[i], position);
+        }
+
+        EXPECT_EQ(false, cur.nextToken(token, len, startOffset, endOffset, position));
+    }
+
+    /**
+     * Open an in-memory database with the ndsunicode61 tokenizer registered for FTS.
+     */
+    sqlite3* OpenDatabase()
+    {
+        sqlite3_tokenizer_module const* module = NULL;
+        sqlite3* db = NULL;
+        sqlite3_stmt* stmt = NULL;
+
+        sqlite3Fts3NdsUnicodeTokenizer(&module);
+        EXPECT_EQ(SQLITE_OK, sqlite3_open(":memory:", &db));
+        EXPECT_EQ(SQLITE_OK, sqlite3_prepare_v2(db, "SELECT fts3_tokenizer('ndsunicode61', ?)", -1, &stmt, NULL));
+        sqlite3_bind_blob(stmt, 1, &module, sizeof(module), SQLITE_STATIC);
+        EXPECT_EQ(SQLITE_ROW, sqlite3_step(stmt));
+        EXPECT_EQ(SQLITE_OK, sqlite3_finalize(stmt));
+
+        return db;
+    }
 }
 
 void TestNdsUnicode61Tokenizer_open()
@@ -616,3 +671,1311 @@ void TestNdsUnicode61Tokenizer_ideographicSpace()
     delete cur;
     EXPECT_EQ(true, tokenizer.close());
 }
+
+void TestNdsUnicode61Tokenizer_longToken()
+{
+    NdsUnicode61Tokenizer tokenizer;
+
+    static const char TEST_INPUT[] = {
+            'F', 'o', 'o', ',',
+            'S', 'u', 'p', 'e', 'r', 'c', 'a', 'l', 'i', 'f', 'r', 'a', 'g', 'i', 'l', 'i', 's', 't', 'i', 'c',
+            ' ',
+            'e', C(0xcc), C(0x81), // e + U+0301 COMBINING ACUTE ACCENT
+            'T', 'O', 'O', 'L', 'O', 'N', 'G', 'W', 'O', 'R', 'D',
+            '-', 'b', 'a', 'r'
+    };
+
+    static const Token OUTPUT_TOKENS[] =
+    {
+            {
+                    "foo",
+                    3,
+                    0,
+                    3
+            },
+            {
+                    "supercalifragilistic",
+                    20,
+                    4,
+                    24
+            },
+            {
+                    "etoolongword",
+                    12,
+                    25,
+                    39
+            },
+            {
+                    "bar",
+                    3,
+                    40,
+                    43
+            },
+    };
+
+    EXPECT_EQ(true, tokenizer.open(0, NULL));
+    NdsUnicode61Tokenizer::cursor* cur = tokenizer.getCursor(TEST_INPUT, ARRAY_SIZE(TEST_INPUT));
+    EXPECT_EQ(true, cur != NULL);
+
+    TestReturnedTokens(*cur, OUTPUT_TOKENS, ARRAY_SIZE(OUTPUT_TOKENS));
+
+    delete cur;
+    EXPECT_EQ(true, tokenizer.close());
+}
+
+void TestNdsUnicode61Tokenizer_nonAsciiExceptions()
+{
+    NdsUnicode61Tokenizer tokenizer;
+
+    static char const* argv[] = {
+            "tokenchars=\xe3\x80\x81", // U+3001 IDEOGRAPHIC COMMA
+            "separators=\xc3\xa9" // U+00E9 LATIN SMALL LETTER E WITH ACUTE
+    };
+
+    static const char TEST_INPUT[] = {
+            'c', 'a', 'f',
+            C(0xc3), C(0xa9), // U+00E9 LATIN SMALL LETTER E WITH ACUTE
+            'b', 'a', 'r', ' ',
+            C(0xe6), C(0x97), C(0xa5), // U+65E5
+            C(0xe6), C(0x9c), C(0xac), // U+672C
+            C(0xe3), C(0x80), C(0x81), // U+3001 IDEOGRAPHIC COMMA
+            C(0xe8), C(0xaa), C(0x9e), // U+8A9E
+            C(0xe3), C(0x80), C(0x82), // U+3002 IDEOGRAPHIC FULL STOP
+            'x'
+    };
+
+    static const Token OUTPUT_TOKENS[] =
+    {
+            {
+                    "caf",
+                    3,
+                    0,
+                    3
+            },
+            {
+                    "bar",
+                    3,
+                    5,
+                    8
+            },
+            {
+                    "\xe6\x97\xa5\xe6\x9c\xac",
+                    6,
+                    9,
+                    12
+            },
+            {
+                    "\xe6\x9c\xac\xe3\x80\x81",
+                    6,
+                    12,
+                    15
+            },
+            {
+                    "\xe3\x80\x81\xe8\xaa\x9e",
+                    6,
+                    15,
+                    21
+            },
+            {
+                    "x",
+                    1,
+                    24,
+                    25
+            },
+    };
+
+    EXPECT_EQ(true, tokenizer.open(ARRAY_SIZE(argv), argv));
+    NdsUnicode61Tokenizer::cursor* cur = tokenizer.getCursor(TEST_INPUT, ARRAY_SIZE(TEST_INPUT));
+    EXPECT_EQ(true, cur != NULL);
+
+    TestReturnedTokens(*cur, OUTPUT_TOKENS, ARRAY_SIZE(OUTPUT_TOKENS));
+
+    delete cur;
+    EXPECT_EQ(true, tokenizer.close());
+}
+
+void TestNdsUnicode61Tokenizer_cursorReuse()
+{
+    NdsUnicode61Tokenizer tokenizer;
+
+    // long enough for the token buffer to be reallocated
+    static const char TEST_INPUT_1[] = "Supercalifragilistic foo";
+    static const char TEST_INPUT_2[] = "a";
+
+    static const Token OUTPUT_TOKENS_1[] =
+    {
+            {
+                    "supercalifragilistic",
+                    20,
+                    0,
+                    20
+            },
+            {
+                    "foo",
+                    3,
+                    21,
+                    24
+            },
+    };
+
+    static const Token OUTPUT_TOKENS_2[] =
+    {
+            {
+                    "a",
+                    1,
+                    0,
+                    1
+            },
+    };
+
+    EXPECT_EQ(true, tokenizer.open(0, NULL));
+
+    // the cursor closed in each iteration is reused by the next one
+    for (int i = 0; i < 3; ++i)
+    {
+        NdsUnicode61Tokenizer::cursor* cur = tokenizer.getCursor(TEST_INPUT_1, ARRAY_SIZE(TEST_INPUT_1) - 1);
+        EXPECT_EQ(true, cur != NULL);
+        TestReturnedTokens(*cur, OUTPUT_TOKENS_1, ARRAY_SIZE(OUTPUT_TOKENS_1));
+        delete cur;
+
+        cur = tokenizer.getCursor(TEST_INPUT_2, ARRAY_SIZE(TEST_INPUT_2) - 1);
+        EXPECT_EQ(true, cur != NULL);
+        TestReturnedTokens(*cur, OUTPUT_TOKENS_2, ARRAY_SIZE(OUTPUT_TOKENS_2));
+        delete cur;
+    }
+
+    EXPECT_EQ(true, tokenizer.close());
+}
+
+void TestNdsUnicode61Tokenizer_batch()
+{
+    static char const* const TEST_INPUTS[] = {
+            "Foo bar",
+            "\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e" // U+65E5 U+672C U+8A9E
+    };
+    static const int TEST_INPUT_LENS[] = { 7, 9 };
+
+    static const Token OUTPUT_TOKENS[] =
+    {
+            { "foo", 3, 0, 3 },
+            { "bar", 3, 4, 7 },
+            { "\xe6\x97\xa5\xe6\x9c\xac", 6, 0, 3 },
+            { "\xe6\x9c\xac\xe8\xaa\x9e", 6, 3, 9 },
+    };
+    static const int OUTPUT_POSITIONS[] = { 0, 1, 0, 1 };
+    static const int OUTPUT_INPUTS[] = { 0, 0, 1, 1 };
+
+    sqlite3_tokenizer_module const* module = NULL;
+    sqlite3_tokenizer* tokenizer = NULL;
+    sqlite3Fts3NdsUnicodeTokenizer(&module);
+    EXPECT_EQ(SQLITE_OK, module->xCreate(0, NULL, &tokenizer));
+
+    char tokenData[64];
+    int tokenDataOffset[4];
+    int tokenLen[4];
+    int startOffset[4];
+    int endOffset[4];
+    int position[4];
+    int inputIndex[4];
+    nds_token_batch batch;
+    memset(&batch, 0, sizeof(batch));
+    batch.token_data = tokenData;
+    batch.token_data_capacity = sizeof(tokenData);
+    batch.token_capacity = 4;
+    batch.token_data_offset = tokenDataOffset;
+    batch.token_len = tokenLen;
+    batch.start_offset = startOffset;
+    batch.end_offset = endOffset;
+    batch.position = position;
+    batch.input_index = inputIndex;
+
+    EXPECT_EQ(SQLITE_OK, nds_tokenize_batch(tokenizer, TEST_INPUTS, TEST_INPUT_LENS, 2, &batch));
+    EXPECT_EQ(4, batch.token_count);
+    EXPECT_EQ(2, batch.input_count_done);
+    EXPECT_EQ(18, batch.token_data_size);
+    for (int i = 0; i < batch.token_count; ++i)
+    {
+        Token const& t = OUTPUT_TOKENS[i];
+        EXPECT_EQ(t.nBytes, tokenLen[i]);
+        EXPECT_EQ(0, strncmp(t.token, tokenData + tokenDataOffset[i], tokenLen[i]));
+        EXPECT_EQ(t.startOffset, startOffset[i]);
+        EXPECT_EQ(t.endOffset, endOffset[i]);
+        EXPECT_EQ(OUTPUT_POSITIONS[i], position[i]);
+        EXPECT_EQ(OUTPUT_INPUTS[i], inputIndex[i]);
+    }
+
+    // only complete inputs are stored when the output gets full
+    batch.token_capacity = 3;
+    EXPECT_EQ(SQLITE_FULL, nds_tokenize_batch(tokenizer, TEST_INPUTS, TEST_INPUT_LENS, 2, &batch));
+    EXPECT_EQ(2, batch.token_count);
+    EXPECT_EQ(1, batch.input_count_done);
+    EXPECT_EQ(6, batch.token_data_size);
+
+    EXPECT_EQ(SQLITE_OK, module->xDestroy(tokenizer));
+}
+
+void TestNdsUnicode61Tokenizer_edgeNgrams()
+{
+    NdsUnicode61Tokenizer tokenizer;
+
+    static char const* argv[] = {
+            "edge_ngrams=2:3"
+    };
+
+    static const char TEST_DOCUMENT[] = "Beijing a Xi";
+
+    static const Token DOCUMENT_TOKENS[] =
+    {
+            { "beijing", 7, 0, 7 },
+            { "\x01" "be", 3, 0, 7 },
+            { "\x01" "bei", 4, 0, 7 },
+            { "a", 1, 8, 9 },
+            { "xi", 2, 10, 12 },
+            { "\x01" "xi", 3, 10, 12 },
+    };
+    static const int DOCUMENT_POSITIONS[] = { 0, 0, 0, 1, 2, 2 };
+
+    // FTS passes a phrase without its quotes
+    static const char TEST_QUERY[] = "\"bei* beij* b* xi\"";
+
+    // only prefixes of 2 to 3 characters are mapped to n-gram terms
+    static const Token QUERY_TOKENS[] =
+    {
+            { "\x01" "bei", 4, 0, 4 },
+            { "beij", 4, 5, 9 },
+            { "b", 1, 11, 12 },
+            { "xi", 2, 14, 16 },
+    };
+
+    // outside a phrase a term gets the terms of the document, FTS looks up the first one
+    static const char TEST_TERMS[] = "bei* beij* b* xi";
+    static const Token TERM_TOKENS[] =
+    {
+            { "\x01" "bei", 4, 0, 4 },
+            { "\x01" "be", 3, 0, 3 },
+            { "bei", 3, 0, 3 },
+            { "beij", 4, 5, 9 },
+            { "\x01" "be", 3, 5, 9 },
+            { "\x01" "bei", 4, 5, 9 },
+            { "b", 1, 11, 12 },
+            { "xi", 2, 14, 16 },
+            { "\x01" "xi", 3, 14, 16 },
+    };
+    static const int TERM_POSITIONS[] = { 0, 0, 0, 1, 1, 1, 2, 3, 3 };
+
+    EXPECT_EQ(true, tokenizer.open(ARRAY_SIZE(argv), argv));
+
+    // documents are passed nul-terminated when indexed
+    NdsUnicode61Tokenizer::cursor* cur = tokenizer.getCursor(TEST_DOCUMENT, -1);
+    EXPECT_EQ(true, cur != NULL);
+    TestReturnedTokens(*cur, DOCUMENT_TOKENS, DOCUMENT_POSITIONS, ARRAY_SIZE(DOCUMENT_TOKENS));
+    delete cur;
+
+    cur = tokenizer.getCursor(TEST_QUERY + 1, ARRAY_SIZE(TEST_QUERY) - 3);
+    EXPECT_EQ(true, cur != NULL);
+    TestReturnedTokens(*cur, QUERY_TOKENS, ARRAY_SIZE(QUERY_TOKENS));
+    delete cur;
+
+    cur = tokenizer.getCursor(TEST_TERMS, ARRAY_SIZE(TEST_TERMS) - 1);
+    EXPECT_EQ(true, cur != NULL);
+    TestReturnedTokens(*cur, TERM_TOKENS, TERM_POSITIONS, ARRAY_SIZE(TERM_TOKENS));
+    delete cur;
+
+    // a batch is tokenized as documents unless it asks for query mode, lengths or not
+    static char const* const BATCH_INPUTS[] = { TEST_DOCUMENT };
+    static const int BATCH_INPUT_LENS[] = { ARRAY_SIZE(TEST_DOCUMENT) - 1 };
+    char tokenData[64];
+    int tokenDataOffset[8];
+    int tokenLen[8];
+    nds_token_batch batch;
+    memset(&batch, 0, sizeof(batch));
+    batch.token_data = tokenData;
+    batch.token_data_capacity = sizeof(tokenData);
+    batch.token_capacity = 8;
+    batch.token_data_offset = tokenDataOffset;
+    batch.token_len = tokenLen;
+
+    EXPECT_EQ(SQLITE_OK, nds_tokenize_batch(tokenizer.get(), BATCH_INPUTS, BATCH_INPUT_LENS, 1, &batch));
+    EXPECT_EQ((int)ARRAY_SIZE(DOCUMENT_TOKENS), batch.token_count);
+    batch.query_mode = 1;
+    EXPECT_EQ(SQLITE_OK, nds_tokenize_batch(tokenizer.get(), BATCH_INPUTS, BATCH_INPUT_LENS, 1, &batch));
+    EXPECT_EQ(3, batch.token_count);
+
+    EXPECT_EQ(true, tokenizer.close());
+
+    static char const* invalidArgv[] = {
+            "edge_ngrams=3:2"
+    };
+    EXPECT_EQ(false, tokenizer.open(ARRAY_SIZE(invalidArgv), invalidArgv));
+}
+
+void TestNdsUnicode61Tokenizer_cjkNgram()
+{
+    static char const* argv[] = {
+            "cjk_ngram=1,2"
+    };
+
+    static char const* unigramArgv[] = {
+            "cjk_ngram=1"
+    };
+
+    // U+5317 U+4EAC U+5E02 x
+    static const char TEST_INPUT[] = "\xe5\x8c\x97\xe4\xba\xac\xe5\xb8\x82x";
+    static const char TEST_PHRASE[] = "\"\xe5\x8c\x97\xe4\xba\xac\xe5\xb8\x82x\"";
+
+    // each unigram shares the position of the bigram starting at it, the last one that of the last bigram
+    static const Token DOCUMENT_TOKENS[] =
+    {
+            { "\xe5\x8c\x97\xe4\xba\xac", 6, 0, 3 },
+            { "\xe5\x8c\x97", 3, 0, 3 },
+            { "\xe4\xba\xac\xe5\xb8\x82", 6, 3, 9 },
+            { "\xe4\xba\xac", 3, 3, 6 },
+            { "\xe5\xb8\x82", 3, 6, 9 },
+            { "x", 1, 9, 10 },
+    };
+    static const int DOCUMENT_POSITIONS[] = { 0, 0, 1, 1, 1, 2 };
+
+    // phrases only need the bigrams
+    static const Token QUERY_TOKENS[] =
+    {
+            { "\xe5\x8c\x97\xe4\xba\xac", 6, 0, 3 },
+            { "\xe4\xba\xac\xe5\xb8\x82", 6, 3, 9 },
+            { "x", 1, 9, 10 },
+    };
+
+    static const Token UNIGRAM_TOKENS[] =
+    {
+            { "\xe5\x8c\x97", 3, 0, 3 },
+            { "\xe4\xba\xac", 3, 3, 6 },
+            { "\xe5\xb8\x82", 3, 6, 9 },
+            { "x", 1, 9, 10 },
+    };
+
+    NdsUnicode61Tokenizer tokenizer;
+    EXPECT_EQ(true, tokenizer.open(ARRAY_SIZE(argv), argv));
+
+    NdsUnicode61Tokenizer::cursor* cur = tokenizer.getCursor(TEST_INPUT, -1);
+    EXPECT_EQ(true, cur != NULL);
+    TestReturnedTokens(*cur, DOCUMENT_TOKENS, DOCUMENT_POSITIONS, ARRAY_SIZE(DOCUMENT_TOKENS));
+    delete cur;
+
+    cur = tokenizer.getCursor(TEST_PHRASE + 1, ARRAY_SIZE(TEST_PHRASE) - 3);
+    EXPECT_EQ(true, cur != NULL);
+    TestReturnedTokens(*cur, QUERY_TOKENS, ARRAY_SIZE(QUERY_TOKENS));
+    delete cur;
+
+    // other texts passed with their length get the terms of the document
+    cur = tokenizer.getCursor(TEST_INPUT, ARRAY_SIZE(TEST_INPUT) - 1);
+    EXPECT_EQ(true, cur != NULL);
+    TestReturnedTokens(*cur, DOCUMENT_TOKENS, DOCUMENT_POSITIONS, ARRAY_SIZE(DOCUMENT_TOKENS));
+    delete cur;
+
+    EXPECT_EQ(true, tokenizer.close());
+
+    EXPECT_EQ(true, tokenizer.open(ARRAY_SIZE(unigramArgv), unigramArgv));
+    cur = tokenizer.getCursor(TEST_INPUT, -1);
+    EXPECT_EQ(true, cur != NULL);
+    TestReturnedTokens(*cur, UNIGRAM_TOKENS, ARRAY_SIZE(UNIGRAM_TOKENS));
+    delete cur;
+    EXPECT_EQ(true, tokenizer.close());
+
+    static char const* invalidArgv[] = {
+            "cjk_ngram=3"
+    };
+    EXPECT_EQ(false, tokenizer.open(ARRAY_SIZE(invalidArgv), invalidArgv));
+}
+
+void TestNdsUnicode61Tokenizer_queryBigramCover()
+{
+    static char const* argv[] = {
+            "query_bigram_cover=1"
+    };
+
+    // U+5317 U+4EAC U+9996 U+90FD U+56FD
+    static const char TEST_QUERY[] = "\xe5\x8c\x97\xe4\xba\xac\xe9\xa6\x96\xe9\x83\xbd\xe5\x9b\xbd";
+
+    // the 1st and the 3rd bigram skip the overlapping character, the 2nd is never looked up
+    static const Token QUERY_TOKENS[] =
+    {
+            { "\xe5\x8c\x97\xe4\xba\xac", 6, 0, 6 },
+            { "\xe4\xba\xac\xe9\xa6\x96", 6, 3, 9 },
+            { "\xe9\xa6\x96\xe9\x83\xbd", 6, 6, 9 },
+            { "\xe9\x83\xbd\xe5\x9b\xbd", 6, 9, 15 },
+    };
+
+    // what FTS looks up: it reads one term and continues the expression at its end offset
+    static const Token LOOKED_UP_TOKENS[] =
+    {
+            { "\xe5\x8c\x97\xe4\xba\xac", 6, 0, 6 },
+            { "\xe9\xa6\x96\xe9\x83\xbd", 6, 6, 9 },
+            { "\xe9\x83\xbd\xe5\x9b\xbd", 6, 9, 15 },
+    };
+
+    NdsUnicode61Tokenizer tokenizer;
+    EXPECT_EQ(true, tokenizer.open(ARRAY_SIZE(argv), argv));
+
+    NdsUnicode61Tokenizer::cursor* cur = tokenizer.getCursor(TEST_QUERY, ARRAY_SIZE(TEST_QUERY) - 1);
+    EXPECT_EQ(true, cur != NULL);
+    TestReturnedTokens(*cur, QUERY_TOKENS, ARRAY_SIZE(QUERY_TOKENS));
+    delete cur;
+
+    int consumed = 0;
+    for (size_t i = 0; i < ARRAY_SIZE(LOOKED_UP_TOKENS); ++i)
+    {
+        Token const& t = LOOKED_UP_TOKENS[i];
+        const char* token;
+        int len;
+        int startOffset;
+        int endOffset;
+        int position;
+
+        cur = tokenizer.getCursor(TEST_QUERY + consumed, ARRAY_SIZE(TEST_QUERY) - 1 - consumed);
+        EXPECT_EQ(true, cur != NULL);
+        EXPECT_EQ(true, cur->nextToken(token, len, startOffset, endOffset, position));
+        EXPECT_EQ(t.nBytes, len);
+        EXPECT_EQ(0, strncmp(t.token, token, len));
+        EXPECT_EQ(t.startOffset, consumed + startOffset);
+        delete cur;
+
+        consumed += endOffset;
+    }
+    EXPECT_EQ(ARRAY_SIZE(TEST_QUERY) - 1, (size_t)consumed);
+
+    // documents keep all the bigrams and the usual offsets
+    cur = tokenizer.getCursor(TEST_QUERY, -1);
+    EXPECT_EQ(true, cur != NULL);
+    const char* token;
+    int len;
+    int startOffset;
+    int endOffset;
+    int position;
+    EXPECT_EQ(true, cur->nextToken(token, len, startOffset, endOffset, position));
+    EXPECT_EQ(3, endOffset);
+    delete cur;
+
+    EXPECT_EQ(true, tokenizer.close());
+}
+
+namespace
+{
+    void WriteUint32(FILE* file, unsigned value)
+    {
+        const unsigned char bytes[4] = {
+                (unsigned char)value, (unsigned char)(value >> 8),
+                (unsigned char)(value >> 16), (unsigned char)(value >> 24)
+        };
+        fwrite(bytes, 1, sizeof(bytes), file);
+    }
+
+    // writes a dictionary in the format described in nds_dictionary.h, words must be sorted
+    bool WriteDictionary(const char* path, char const* const* words, unsigned count)
+    {
+        FILE* file = fopen(path, "wb");
+        if (file == NULL)
+            return false;
+
+        fwrite("NDSDICT1", 1, 8, file);
+        WriteUint32(file, count);
+        unsigned offset = 0;
+        for (unsigned i = 0; i < count; ++i)
+        {
+            WriteUint32(file, offset);
+            offset += strlen(words[i]);
+        }
+        WriteUint32(file, offset);
+        for (unsigned i = 0; i < count; ++i)
+            fwrite(words[i], 1, strlen(words[i]), file);
+
+        return fclose(file) == 0;
+    }
+}
+
+void TestNdsUnicode61Tokenizer_dictionarySegmentation()
+{
+    static const char DICTIONARY_PATH[] = "test_ndsunicode61_dictionary.bin";
+
+    static char const* const WORDS[] = {
+            "\xe0\xb8\xa0\xe0\xb8\xb2", // U+0E20 U+0E32
+            "\xe0\xb8\xa0\xe0\xb8\xb2\xe0\xb8\xa9\xe0\xb8\xb2", // U+0E20 U+0E32 U+0E29 U+0E32 (language)
+            "\xe0\xb9\x84\xe0\xb8\x97\xe0\xb8\xa2", // U+0E44 U+0E17 U+0E22 (Thai)
+    };
+
+    static char const* argv[] = {
+            "dictionary=test_ndsunicode61_dictionary.bin",
+            "segment=thai"
+    };
+
+    static const char TEST_INPUT[] =
+            "\xe0\xb8\xa0\xe0\xb8\xb2\xe0\xb8\xa9\xe0\xb8\xb2"
+            "\xe0\xb9\x84\xe0\xb8\x97\xe0\xb8\xa2"
+            "\xe0\xb8\x81\xe0\xb8\x82\xe0\xb8\x84" // U+0E01 U+0E02 U+0E04, not in the dictionary
+            " x";
+
+    // the longest words win, the rest is bigrammed
+    static const Token OUTPUT_TOKENS[] =
+    {
+            { "\xe0\xb8\xa0\xe0\xb8\xb2\xe0\xb8\xa9\xe0\xb8\xb2", 12, 0, 12 },
+            { "\xe0\xb9\x84\xe0\xb8\x97\xe0\xb8\xa2", 9, 12, 21 },
+            { "\xe0\xb8\x81\xe0\xb8\x82", 6, 21, 24 },
+            { "\xe0\xb8\x82\xe0\xb8\x84", 6, 24, 30 },
+            { "x", 1, 31, 32 },
+    };
+
+    EXPECT_EQ(true, WriteDictionary(DICTIONARY_PATH, WORDS, ARRAY_SIZE(WORDS)));
+
+    NdsUnicode61Tokenizer tokenizer;
+    EXPECT_EQ(true, tokenizer.open(ARRAY_SIZE(argv), argv));
+    NdsUnicode61Tokenizer::cursor* cur = tokenizer.getCursor(TEST_INPUT, ARRAY_SIZE(TEST_INPUT) - 1);
+    EXPECT_EQ(true, cur != NULL);
+    TestReturnedTokens(*cur, OUTPUT_TOKENS, ARRAY_SIZE(OUTPUT_TOKENS));
+    delete cur;
+    EXPECT_EQ(true, tokenizer.close());
+
+    remove(DICTIONARY_PATH);
+
+    // segmentation needs a dictionary, and only knows some scripts
+    static char const* noDictionaryArgv[] = {
+            "segment=thai"
+    };
+    EXPECT_EQ(false, tokenizer.open(ARRAY_SIZE(noDictionaryArgv), noDictionaryArgv));
+
+    static char const* missingDictionaryArgv[] = {
+            "dictionary=test_ndsunicode61_dictionary.bin"
+    };
+    EXPECT_EQ(false, tokenizer.open(ARRAY_SIZE(missingDictionaryArgv), missingDictionaryArgv));
+}
+
+void TestNdsUnicode61Tokenizer_kanaFold()
+{
+    static char const* argv[] = {
+            "remove_diacritics=0",
+            "kana_fold=1"
+    };
+
+    // U+30D1 U+30F3, U+FF8A U+FF9F U+FF9D, U+FF21 U+FF22 U+FF23
+    static const char TEST_INPUT[] =
+            "\xe3\x83\x91\xe3\x83\xb3 \xef\xbe\x8a\xef\xbe\x9f\xef\xbe\x9d \xef\xbc\xa1\xef\xbc\xa2\xef\xbc\xa3";
+
+    // katakana and half-width katakana give the same hiragana token, full-width Latin is a word
+    static const Token EXPECTED_TOKENS[] =
+    {
+            { "\xe3\x81\xaf\xe3\x82\x9a\xe3\x82\x93", 9, 0, 6 },  // U+306F U+309A U+3093
+            { "\xe3\x81\xaf\xe3\x82\x9a\xe3\x82\x93", 9, 7, 16 },
+            { "abc", 3, 17, 26 },
+    };
+
+    static char const* invalidArgv[] = {
+            "kana_fold=yes"
+    };
+
+    NdsUnicode61Tokenizer tokenizer;
+    EXPECT_EQ(true, tokenizer.open(ARRAY_SIZE(argv), argv));
+
+    NdsUnicode61Tokenizer::cursor* cur = tokenizer.getCursor(TEST_INPUT, ARRAY_SIZE(TEST_INPUT) - 1);
+    EXPECT_EQ(true, cur != NULL);
+    TestReturnedTokens(*cur, EXPECTED_TOKENS, ARRAY_SIZE(EXPECTED_TOKENS));
+    delete cur;
+
+    EXPECT_EQ(true, tokenizer.close());
+
+    EXPECT_EQ(false, tokenizer.open(ARRAY_SIZE(invalidArgv), invalidArgv));
+}
+
+namespace
+{
+    struct PinyinEntry
+    {
+        unsigned character;
+        unsigned syllable;
+    };
+
+    // writes a pinyin table in the format described in nds_pinyin.h, entries must be sorted
+    bool WritePinyinTable(const char* path, PinyinEntry const* entries, unsigned count,
+            char const* const* syllables, unsigned syllableCount)
+    {
+        FILE* file = fopen(path, "wb");
+        if (file == NULL)
+            return false;
+
+        fwrite("NDSPINY1", 1, 8, file);
+        WriteUint32(file, count);
+        WriteUint32(file, syllableCount);
+        for (unsigned i = 0; i < count; ++i)
+            WriteUint32(file, entries[i].character | (entries[i].syllable << 21));
+        unsigned offset = 0;
+        for (unsigned i = 0; i < syllableCount; ++i)
+        {
+            WriteUint32(file, offset);
+            offset += strlen(syllables[i]);
+        }
+        WriteUint32(file, offset);
+        for (unsigned i = 0; i < syllableCount; ++i)
+            fwrite(syllables[i], 1, strlen(syllables[i]), file);
+
+        return fclose(file) == 0;
+    }
+}
+
+void TestNdsUnicode61Tokenizer_pinyin()
+{
+    static const char PINYIN_PATH[] = "test_ndsunicode61_pinyin.bin";
+
+    static char const* const SYLLABLES[] = { "dong", "guang", "sheng" };
+    static const PinyinEntry ENTRIES[] = {
+            { 0x4e1c, 0 },
+            { 0x5e7f, 1 },
+            { 0x7701, 2 },
+    };
+
+    static char const* argv[] = {
+            "pinyin=test_ndsunicode61_pinyin.bin"
+    };
+
+    // U+5E7F U+4E1C U+7701 x
+    static const char TEST_INPUT[] = "\xe5\xb9\xbf\xe4\xb8\x9c\xe7\x9c\x81x";
+    static const char TEST_PHRASE[] = "\"\xe5\xb9\xbf\xe4\xb8\x9c\xe7\x9c\x81x\"";
+
+    // each syllable is at the position of its character (the last one follows the last bigram),
+    // the initials at that of the first bigram
+    static const Token DOCUMENT_TOKENS[] =
+    {
+            { "\xe5\xb9\xbf\xe4\xb8\x9c", 6, 0, 3 },
+            { "gds", 3, 0, 9 },
+            { "guang", 5, 0, 3 },
+            { "\xe4\xb8\x9c\xe7\x9c\x81", 6, 3, 9 },
+            { "dong", 4, 3, 6 },
+            { "sheng", 5, 6, 9 },
+            { "x", 1, 9, 10 },
+    };
+    static const int DOCUMENT_POSITIONS[] = { 0, 0, 0, 1, 1, 2, 2 };
+
+    // phrases are not changed
+    static const Token QUERY_TOKENS[] =
+    {
+            { "\xe5\xb9\xbf\xe4\xb8\x9c", 6, 0, 3 },
+            { "\xe4\xb8\x9c\xe7\x9c\x81", 6, 3, 9 },
+            { "x", 1, 9, 10 },
+    };
+
+    static char const* missingTableArgv[] = {
+            "pinyin=test_ndsunicode61_pinyin.bin"
+    };
+
+    EXPECT_EQ(true, WritePinyinTable(PINYIN_PATH, ENTRIES, ARRAY_SIZE(ENTRIES), SYLLABLES, ARRAY_SIZE(SYLLABLES)));
+
+    NdsUnicode61Tokenizer tokenizer;
+    EXPECT_EQ(true, tokenizer.open(ARRAY_SIZE(argv), argv));
+
+    NdsUnicode61Tokenizer::cursor* cur = tokenizer.getCursor(TEST_INPUT, -1);
+    EXPECT_EQ(true, cur != NULL);
+    TestReturnedTokens(*cur, DOCUMENT_TOKENS, DOCUMENT_POSITIONS, ARRAY_SIZE(DOCUMENT_TOKENS));
+    delete cur;
+
+    cur = tokenizer.getCursor(TEST_PHRASE + 1, ARRAY_SIZE(TEST_PHRASE) - 3);
+    EXPECT_EQ(true, cur != NULL);
+    TestReturnedTokens(*cur, QUERY_TOKENS, ARRAY_SIZE(QUERY_TOKENS));
+    delete cur;
+
+    cur = tokenizer.getCursor(TEST_INPUT, ARRAY_SIZE(TEST_INPUT) - 1);
+    EXPECT_EQ(true, cur != NULL);
+    TestReturnedTokens(*cur, DOCUMENT_TOKENS, DOCUMENT_POSITIONS, ARRAY_SIZE(DOCUMENT_TOKENS));
+    delete cur;
+
+    EXPECT_EQ(true, tokenizer.close());
+
+    // a phrase of syllables matches the run it is read from, whatever its length
+    sqlite3* db = OpenDatabase();
+    EXPECT_EQ(SQLITE_OK, sqlite3_exec(db,
+            "CREATE VIRTUAL TABLE places USING fts4(name, tokenize=ndsunicode61 "
+                    "\"pinyin=test_ndsunicode61_pinyin.bin\");"
+            "INSERT INTO places VALUES('\xe5\xb9\xbf\xe4\xb8\x9c\xe7\x9c\x81');"
+            "INSERT INTO places VALUES('\xe5\xb9\xbf\xe4\xb8\x9c\xe7\x9c\x81\xe5\xb9\xbf\xe4\xb8\x9c x');",
+            NULL, NULL, NULL));
+
+    static const struct
+    {
+        const char* query;
+        int count;
+    } MATCHES[] = {
+            { "SELECT count(*) FROM places WHERE places MATCH '\"guang dong\"'", 2 },
+            { "SELECT count(*) FROM places WHERE places MATCH '\"dong sheng\"'", 2 },
+            { "SELECT count(*) FROM places WHERE places MATCH '\"guang dong sheng\"'", 2 },
+            { "SELECT count(*) FROM places WHERE places MATCH '\"sheng guang dong\"'", 1 },
+            { "SELECT count(*) FROM places WHERE places MATCH '\"guang dong sheng guang dong\"'", 1 },
+            { "SELECT count(*) FROM places WHERE places MATCH '\"dong guang\"'", 0 },
+            { "SELECT count(*) FROM places WHERE places MATCH '\"\xe5\xb9\xbf\xe4\xb8\x9c x\"'", 1 },
+    };
+
+    for (size_t i = 0; i < ARRAY_SIZE(MATCHES); ++i)
+    {
+        sqlite3_stmt* stmt = NULL;
+        EXPECT_EQ(SQLITE_OK, sqlite3_prepare_v2(db, MATCHES[i].query, -1, &stmt, NULL));
+        EXPECT_EQ(SQLITE_ROW, sqlite3_step(stmt));
+        EXPECT_EQ(MATCHES[i].count, sqlite3_column_int(stmt, 0));
+        EXPECT_EQ(SQLITE_OK, sqlite3_finalize(stmt));
+    }
+
+    EXPECT_EQ(SQLITE_OK, sqlite3_exec(db, "INSERT INTO places(places) VALUES('integrity-check')", NULL, NULL, NULL));
+    EXPECT_EQ(SQLITE_OK, sqlite3_close(db));
+
+    remove(PINYIN_PATH);
+
+    EXPECT_EQ(false, tokenizer.open(ARRAY_SIZE(missingTableArgv), missingTableArgv));
+}
+
+void TestNdsUnicode61Tokenizer_hangulChoseong()
+{
+    static char const* argv[] = {
+            "hangul_choseong=1"
+    };
+
+    // U+C11C U+C6B8 U+C5ED U+D55C
+    static const char TEST_INPUT[] = "\xec\x84\x9c\xec\x9a\xb8\xec\x97\xad \xed\x95\x9c";
+
+    // the choseong share the offsets and positions of their bigrams
+    static const Token DOCUMENT_TOKENS[] =
+    {
+            { "\xec\x84\x9c\xec\x9a\xb8", 6, 0, 3 },
+            { "\xe3\x85\x85\xe3\x85\x87", 6, 0, 3 },  // U+3145 U+3147
+            { "\xec\x9a\xb8\xec\x97\xad", 6, 3, 9 },
+            { "\xe3\x85\x87\xe3\x85\x87", 6, 3, 9 },  // U+3147 U+3147
+            { "\xed\x95\x9c", 3, 10, 13 },
+            { "\xe3\x85\x8e", 3, 10, 13 },  // U+314E
+    };
+    static const int DOCUMENT_POSITIONS[] = { 0, 0, 1, 1, 2, 2 };
+
+    // a query typed as initials is bigrammed like the document's choseong
+    static const char QUERY_INPUT[] = "\xe3\x85\x85\xe3\x85\x87\xe3\x85\x87";
+    static const Token QUERY_TOKENS[] =
+    {
+            { "\xe3\x85\x85\xe3\x85\x87", 6, 0, 3 },
+            { "\xe3\x85\x87\xe3\x85\x87", 6, 3, 9 },
+    };
+
+    NdsUnicode61Tokenizer tokenizer;
+    EXPECT_EQ(true, tokenizer.open(ARRAY_SIZE(argv), argv));
+
+    NdsUnicode61Tokenizer::cursor* cur = tokenizer.getCursor(TEST_INPUT, -1);
+    EXPECT_EQ(true, cur != NULL);
+    TestReturnedTokens(*cur, DOCUMENT_TOKENS, DOCUMENT_POSITIONS, ARRAY_SIZE(DOCUMENT_TOKENS));
+    delete cur;
+
+    cur = tokenizer.getCursor(QUERY_INPUT, ARRAY_SIZE(QUERY_INPUT) - 1);
+    EXPECT_EQ(true, cur != NULL);
+    TestReturnedTokens(*cur, QUERY_TOKENS, ARRAY_SIZE(QUERY_TOKENS));
+    delete cur;
+
+    EXPECT_EQ(true, tokenizer.close());
+}
+
+void TestNdsUnicode61Tokenizer_phoneNumbers()
+{
+    static char const* argv[] = {
+            "phone_numbers=1"
+    };
+
+    static const char TEST_INPUT[] = "Tel. +49 (0)89 1234-567";
+
+    // the joined forms share the offsets and positions of their first groups, "(0)" is skipped
+    // and shares the position of the next group
+    static const Token DOCUMENT_TOKENS[] =
+    {
+            { "tel", 3, 0, 3 },
+            { "49", 2, 6, 8 },
+            { "49891234567", 11, 6, 23 },
+            { "0", 1, 10, 11 },
+            { "89", 2, 12, 14 },
+            { "891234567", 9, 12, 23 },
+            { "089", 3, 12, 14 },
+            { "0891234567", 10, 12, 23 },
+            { "1234", 4, 15, 19 },
+            { "1234567", 7, 15, 23 },
+            { "567", 3, 20, 23 },
+    };
+    static const int DOCUMENT_POSITIONS[] = { 0, 1, 1, 2, 2, 2, 2, 2, 3, 3, 4 };
+
+    // a phrase is not joined, a number typed in national format matches as one
+    static const char QUERY_INPUT[] = "\"089 1234567\"";
+    static const Token QUERY_TOKENS[] =
+    {
+            { "089", 3, 0, 3 },
+            { "1234567", 7, 4, 11 },
+    };
+
+    // a phrase leaves the "(0)" out, so that it matches with or without it
+    static const char INTERNATIONAL_INPUT[] = "\"+49 (0)89 1234-567\"";
+    static const Token INTERNATIONAL_TOKENS[] =
+    {
+            { "49", 2, 1, 3 },
+            { "89", 2, 7, 9 },
+            { "1234", 4, 10, 14 },
+            { "567", 3, 15, 18 },
+    };
+
+    NdsUnicode61Tokenizer tokenizer;
+    EXPECT_EQ(true, tokenizer.open(ARRAY_SIZE(argv), argv));
+
+    NdsUnicode61Tokenizer::cursor* cur = tokenizer.getCursor(TEST_INPUT, -1);
+    EXPECT_EQ(true, cur != NULL);
+    TestReturnedTokens(*cur, DOCUMENT_TOKENS, DOCUMENT_POSITIONS, ARRAY_SIZE(DOCUMENT_TOKENS));
+    delete cur;
+
+    cur = tokenizer.getCursor(QUERY_INPUT + 1, ARRAY_SIZE(QUERY_INPUT) - 3);
+    EXPECT_EQ(true, cur != NULL);
+    TestReturnedTokens(*cur, QUERY_TOKENS, ARRAY_SIZE(QUERY_TOKENS));
+    delete cur;
+
+    cur = tokenizer.getCursor(INTERNATIONAL_INPUT + 1, ARRAY_SIZE(INTERNATIONAL_INPUT) - 3);
+    EXPECT_EQ(true, cur != NULL);
+    TestReturnedTokens(*cur, INTERNATIONAL_TOKENS, ARRAY_SIZE(INTERNATIONAL_TOKENS));
+    delete cur;
+
+    cur = tokenizer.getCursor(TEST_INPUT, ARRAY_SIZE(TEST_INPUT) - 1);
+    EXPECT_EQ(true, cur != NULL);
+    TestReturnedTokens(*cur, DOCUMENT_TOKENS, DOCUMENT_POSITIONS, ARRAY_SIZE(DOCUMENT_TOKENS));
+    delete cur;
+
+    EXPECT_EQ(true, tokenizer.close());
+
+    sqlite3* db = OpenDatabase();
+    EXPECT_EQ(SQLITE_OK, sqlite3_exec(db,
+            "CREATE VIRTUAL TABLE phones USING fts4(name, tokenize=ndsunicode61 \"phone_numbers=1\");"
+            "INSERT INTO phones VALUES('Tel. +49 (0)89 1234-567');",
+            NULL, NULL, NULL));
+
+    static const struct
+    {
+        const char* query;
+        int count;
+    } MATCHES[] = {
+            { "SELECT count(*) FROM phones WHERE phones MATCH '\"+49 89 1234567\"'", 1 },
+            { "SELECT count(*) FROM phones WHERE phones MATCH '\"+49 (0)89 1234-567\"'", 1 },
+            { "SELECT count(*) FROM phones WHERE phones MATCH '\"+49 89 1234 567\"'", 1 },
+            { "SELECT count(*) FROM phones WHERE phones MATCH '\"089 1234567\"'", 1 },
+            { "SELECT count(*) FROM phones WHERE phones MATCH '\"tel 49 89\"'", 1 },
+            { "SELECT count(*) FROM phones WHERE phones MATCH '\"+49 0 89\"'", 0 },
+    };
+
+    for (size_t i = 0; i < ARRAY_SIZE(MATCHES); ++i)
+    {
+        sqlite3_stmt* stmt = NULL;
+        EXPECT_EQ(SQLITE_OK, sqlite3_prepare_v2(db, MATCHES[i].query, -1, &stmt, NULL));
+        EXPECT_EQ(SQLITE_ROW, sqlite3_step(stmt));
+        EXPECT_EQ(MATCHES[i].count, sqlite3_column_int(stmt, 0));
+        EXPECT_EQ(SQLITE_OK, sqlite3_finalize(stmt));
+    }
+
+    EXPECT_EQ(SQLITE_OK, sqlite3_exec(db, "INSERT INTO phones(phones) VALUES('integrity-check')", NULL, NULL, NULL));
+    EXPECT_EQ(SQLITE_OK, sqlite3_close(db));
+}
+
+void TestNdsUnicode61Tokenizer_extraEdgeNgrams()
+{
+    static const char PINYIN_PATH[] = "test_ndsunicode61_pinyin.bin";
+
+    static char const* const SYLLABLES[] = { "dong", "guang", "sheng" };
+    static const PinyinEntry ENTRIES[] = {
+            { 0x4e1c, 0 },
+            { 0x5e7f, 1 },
+            { 0x7701, 2 },
+    };
+
+    EXPECT_EQ(true, WritePinyinTable(PINYIN_PATH, ENTRIES, ARRAY_SIZE(ENTRIES), SYLLABLES, ARRAY_SIZE(SYLLABLES)));
+
+    sqlite3* db = OpenDatabase();
+
+    // U+5E7F U+4E1C U+7701
+    EXPECT_EQ(SQLITE_OK, sqlite3_exec(db,
+            "CREATE VIRTUAL TABLE places USING fts4(name, tokenize=ndsunicode61 "
+                    "\"pinyin=test_ndsunicode61_pinyin.bin\" \"edge_ngrams=2:4\");"
+            "CREATE VIRTUAL TABLE phones USING fts4(name, tokenize=ndsunicode61 \"phone_numbers=1\" "
+                    "\"edge_ngrams=2:4\");"
+            "INSERT INTO places VALUES('\xe5\xb9\xbf\xe4\xb8\x9c\xe7\x9c\x81');"
+            "INSERT INTO phones VALUES('+49 (0)89 1234-567');",
+            NULL, NULL, NULL));
+
+    // prefixes of the pinyin syllables and initials, and of the joined phone number forms
+    static const struct
+    {
+        const char* query;
+        int count;
+    } MATCHES[] = {
+            { "SELECT count(*) FROM places WHERE places MATCH 'gd*'", 1 },
+            { "SELECT count(*) FROM places WHERE places MATCH 'gua*'", 1 },
+            { "SELECT count(*) FROM places WHERE places MATCH 'sh*'", 1 },
+            { "SELECT count(*) FROM places WHERE places MATCH 'gx*'", 0 },
+            { "SELECT count(*) FROM phones WHERE phones MATCH '089*'", 1 },
+            { "SELECT count(*) FROM phones WHERE phones MATCH '0891*'", 1 },
+            { "SELECT count(*) FROM phones WHERE phones MATCH '4989*'", 1 },
+            { "SELECT count(*) FROM phones WHERE phones MATCH '0892*'", 0 },
+    };
+
+    for (size_t i = 0; i < ARRAY_SIZE(MATCHES); ++i)
+    {
+        sqlite3_stmt* stmt = NULL;
+        EXPECT_EQ(SQLITE_OK, sqlite3_prepare_v2(db, MATCHES[i].query, -1, &stmt, NULL));
+        EXPECT_EQ(SQLITE_ROW, sqlite3_step(stmt));
+        EXPECT_EQ(MATCHES[i].count, sqlite3_column_int(stmt, 0));
+        EXPECT_EQ(SQLITE_OK, sqlite3_finalize(stmt));
+    }
+
+    EXPECT_EQ(SQLITE_OK, sqlite3_exec(db, "INSERT INTO places(places) VALUES('integrity-check')", NULL, NULL, NULL));
+    EXPECT_EQ(SQLITE_OK, sqlite3_exec(db, "INSERT INTO phones(phones) VALUES('integrity-check')", NULL, NULL, NULL));
+
+    EXPECT_EQ(SQLITE_OK, sqlite3_close(db));
+
+    remove(PINYIN_PATH);
+}
+
+void TestNdsUnicode61Tokenizer_tokenCache()
+{
+    static char const* argv[] = {
+            "token_cache=16"
+    };
+
+    // "Strasse" with U+00DF, "Cafe" with U+00E9 and U+0301, U+65E5 U+672C
+    static const char TEST_INPUT[] = "Stra\xc3\x9f" "e Caf\xc3\xa9\xe6\x97\xa5\xe6\x9c\xac Stra\xc3\x9f" "e "
+            "cafe\xcc\x81\xe6\x97\xa5\xe6\x9c\xac stra\xc3\x9f" "e Road";
+
+    // cached tokens are returned like the others
+    static const Token TEST_TOKENS[] =
+    {
+            { "stra\xc3\x9f" "e", 7, 0, 7 },
+            { "cafe", 4, 8, 13 },
+            { "\xe6\x97\xa5\xe6\x9c\xac", 6, 13, 19 },
+            { "stra\xc3\x9f" "e", 7, 20, 27 },
+            { "cafe", 4, 28, 34 },
+            { "\xe6\x97\xa5\xe6\x9c\xac", 6, 34, 40 },
+            { "stra\xc3\x9f" "e", 7, 41, 48 },
+            { "road", 4, 49, 53 },
+    };
+
+    NdsUnicode61Tokenizer tokenizer;
+    EXPECT_EQ(true, tokenizer.open(ARRAY_SIZE(argv), argv));
+
+    NdsUnicode61Tokenizer::cursor* cur = tokenizer.getCursor(TEST_INPUT, -1);
+    EXPECT_EQ(true, cur != NULL);
+    TestReturnedTokens(*cur, TEST_TOKENS, ARRAY_SIZE(TEST_TOKENS));
+    delete cur;
+
+    // the raw bytes are the key: only the second "Strasse" is a hit, ASCII tokens aren't looked up
+    nds_token_cache_stats stats;
+    EXPECT_EQ(SQLITE_OK, nds_tokenizer_cache_stats(tokenizer.get(), &stats));
+    EXPECT_EQ(1, (int)stats.hits);
+    EXPECT_EQ(4, (int)stats.misses);
+    EXPECT_EQ(4, stats.entry_count);
+    EXPECT_EQ(16, stats.capacity);
+
+    cur = tokenizer.getCursor(TEST_INPUT, -1);
+    EXPECT_EQ(true, cur != NULL);
+    TestReturnedTokens(*cur, TEST_TOKENS, ARRAY_SIZE(TEST_TOKENS));
+    delete cur;
+
+    EXPECT_EQ(SQLITE_OK, nds_tokenizer_cache_stats(tokenizer.get(), &stats));
+    EXPECT_EQ(6, (int)stats.hits);
+    EXPECT_EQ(4, (int)stats.misses);
+
+    EXPECT_EQ(true, tokenizer.close());
+
+    // the cache is disabled by default
+    EXPECT_EQ(true, tokenizer.open(0, NULL));
+    EXPECT_EQ(SQLITE_OK, nds_tokenizer_cache_stats(tokenizer.get(), &stats));
+    EXPECT_EQ(0, stats.capacity);
+    EXPECT_EQ(true, tokenizer.close());
+}
+
+void TestNdsUnicode61Tokenizer_queryCache()
+{
+    static char const* argv[] = {
+            "query_cache=2"
+    };
+
+    // Strasse with U+00DF, U+65E5 U+672C U+8A9E
+    static const char QUERY_1[] = "Stra\xc3\x9f" "e \xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e";
+    static const char QUERY_2[] = "Road Station";
+    static const char QUERY_3[] = "Caf\xc3\xa9";
+
+    static const Token QUERY_1_TOKENS[] =
+    {
+            { "stra\xc3\x9f" "e", 7, 0, 7 },
+            { "\xe6\x97\xa5\xe6\x9c\xac", 6, 8, 11 },
+            { "\xe6\x9c\xac\xe8\xaa\x9e", 6, 11, 17 },
+    };
+    static const Token QUERY_2_TOKENS[] =
+    {
+            { "road", 4, 0, 4 },
+            { "station", 7, 5, 12 },
+    };
+    static const Token QUERY_3_TOKENS[] =
+    {
+            { "cafe", 4, 0, 5 },
+    };
+
+    NdsUnicode61Tokenizer tokenizer;
+    EXPECT_EQ(true, tokenizer.open(ARRAY_SIZE(argv), argv));
+
+    // a text is cached the second time, and the tokens of a hit are those of the miss
+    for (int i = 0; i < 3; ++i)
+    {
+        NdsUnicode61Tokenizer::cursor* cur = tokenizer.getCursor(QUERY_1, strlen(QUERY_1));
+        EXPECT_EQ(true, cur != NULL);
+        TestReturnedTokens(*cur, QUERY_1_TOKENS, ARRAY_SIZE(QUERY_1_TOKENS));
+        delete cur;
+    }
+
+    nds_token_cache_stats stats;
+    EXPECT_EQ(SQLITE_OK, nds_tokenizer_query_cache_stats(tokenizer.get(), &stats));
+    EXPECT_EQ(1, (int)stats.hits);
+    EXPECT_EQ(1, (int)stats.misses);
+    EXPECT_EQ(1, stats.entry_count);
+    EXPECT_EQ(2, stats.capacity);
+
+    // a cursor closed after its first token still caches the whole query
+    NdsUnicode61Tokenizer::cursor* cur = tokenizer.getCursor(QUERY_2, strlen(QUERY_2));
+    TestReturnedTokens(*cur, QUERY_2_TOKENS, ARRAY_SIZE(QUERY_2_TOKENS));
+    delete cur;
+    cur = tokenizer.getCursor(QUERY_2, strlen(QUERY_2));
+    EXPECT_EQ(true, cur != NULL);
+    const char* token;
+    int len;
+    int startOffset;
+    int endOffset;
+    int position;
+    EXPECT_EQ(true, cur->nextToken(token, len, startOffset, endOffset, position));
+    EXPECT_EQ(4, len);
+    EXPECT_EQ(0, strncmp("road", token, len));
+    delete cur;
+
+    // QUERY_1 is used last, so the third query evicts QUERY_2
+    cur = tokenizer.getCursor(QUERY_1, strlen(QUERY_1));
+    TestReturnedTokens(*cur, QUERY_1_TOKENS, ARRAY_SIZE(QUERY_1_TOKENS));
+    delete cur;
+    for (int i = 0; i < 2; ++i)
+    {
+        cur = tokenizer.getCursor(QUERY_3, strlen(QUERY_3));
+        EXPECT_EQ(true, cur != NULL);
+        TestReturnedTokens(*cur, QUERY_3_TOKENS, ARRAY_SIZE(QUERY_3_TOKENS));
+        delete cur;
+    }
+    cur = tokenizer.getCursor(QUERY_1, strlen(QUERY_1));
+    TestReturnedTokens(*cur, QUERY_1_TOKENS, ARRAY_SIZE(QUERY_1_TOKENS));
+    delete cur;
+    cur = tokenizer.getCursor(QUERY_2, strlen(QUERY_2));
+    TestReturnedTokens(*cur, QUERY_2_TOKENS, ARRAY_SIZE(QUERY_2_TOKENS));
+    delete cur;
+
+    EXPECT_EQ(SQLITE_OK, nds_tokenizer_query_cache_stats(tokenizer.get(), &stats));
+    EXPECT_EQ(3, (int)stats.hits);
+    EXPECT_EQ(4, (int)stats.misses);
+    EXPECT_EQ(2, stats.entry_count);
+
+    // documents are not looked up
+    cur = tokenizer.getCursor(QUERY_1, -1);
+    EXPECT_EQ(true, cur != NULL);
+    TestReturnedTokens(*cur, QUERY_1_TOKENS, ARRAY_SIZE(QUERY_1_TOKENS));
+    delete cur;
+
+    EXPECT_EQ(SQLITE_OK, nds_tokenizer_query_cache_stats(tokenizer.get(), &stats));
+    EXPECT_EQ(3, (int)stats.hits);
+    EXPECT_EQ(4, (int)stats.misses);
+
+    // rows tokenized once with their length, as for snippet(), are neither cached nor counted
+    for (int i = 0; i < 8; ++i)
+    {
+        char row[32];
+        sprintf(row, "Row %d Main Street", i);
+        cur = tokenizer.getCursor(row, strlen(row));
+        EXPECT_EQ(true, cur != NULL);
+        while (cur->nextToken(token, len, startOffset, endOffset, position))
+            ;
+        delete cur;
+    }
+    EXPECT_EQ(SQLITE_OK, nds_tokenizer_query_cache_stats(tokenizer.get(), &stats));
+    EXPECT_EQ(3, (int)stats.hits);
+    EXPECT_EQ(4, (int)stats.misses);
+    EXPECT_EQ(2, stats.entry_count);
+    cur = tokenizer.getCursor(QUERY_1, strlen(QUERY_1));
+    TestReturnedTokens(*cur, QUERY_1_TOKENS, ARRAY_SIZE(QUERY_1_TOKENS));
+    delete cur;
+    EXPECT_EQ(SQLITE_OK, nds_tokenizer_query_cache_stats(tokenizer.get(), &stats));
+    EXPECT_EQ(4, (int)stats.hits);
+
+    EXPECT_EQ(true, tokenizer.close());
+
+    // the cache is disabled by default
+    EXPECT_EQ(true, tokenizer.open(0, NULL));
+    EXPECT_EQ(SQLITE_OK, nds_tokenizer_query_cache_stats(tokenizer.get(), &stats));
+    EXPECT_EQ(0, stats.capacity);
+    EXPECT_EQ(true, tokenizer.close());
+}
+
+void TestNdsUnicode61Tokenizer_languageid()
+{
+    static char const* argv[] = {
+            "remove_diacritics=1",
+            "query_cache=4",
+            "language=2:remove_diacritics=0",
+            "language=5:kana_fold=1",
+            "language=5:remove_diacritics=0"
+    };
+
+    // U+00E9, then U+FF21 U+FF22 U+FF23
+    static const char TEST_INPUT[] = "Caf\xc3\xa9 \xef\xbc\xa1\xef\xbc\xa2\xef\xbc\xa3";
+
+    static const Token DEFAULT_TOKENS[] =
+    {
+            { "cafe", 4, 0, 5 },
+            { "ab", 2, 6, 9 },
+            { "bc", 2, 9, 15 },
+    };
+    static const Token LANGUAGE_2_TOKENS[] =
+    {
+            { "cafe\xcc\x81", 6, 0, 5 },
+            { "ab", 2, 6, 9 },
+            { "bc", 2, 9, 15 },
+    };
+    static const Token LANGUAGE_5_TOKENS[] =
+    {
+            { "cafe\xcc\x81", 6, 0, 5 },
+            { "abc", 3, 6, 15 },
+    };
+
+    static const struct
+    {
+        int languageId;
+        Token const* tokens;
+        int count;
+    } TESTS[] =
+    {
+            { 0, DEFAULT_TOKENS, ARRAY_SIZE(DEFAULT_TOKENS) },
+            { 2, LANGUAGE_2_TOKENS, ARRAY_SIZE(LANGUAGE_2_TOKENS) },
+            { 5, LANGUAGE_5_TOKENS, ARRAY_SIZE(LANGUAGE_5_TOKENS) },
+            { 7, DEFAULT_TOKENS, ARRAY_SIZE(DEFAULT_TOKENS) },
+    };
+
+    NdsUnicode61Tokenizer tokenizer;
+    EXPECT_EQ(true, tokenizer.open(ARRAY_SIZE(argv), argv));
+
+    // documents and queries, the latter twice to replay them from the cache of their language
+    for (int mode = 0; mode < 3; ++mode)
+    {
+        for (size_t i = 0; i < ARRAY_SIZE(TESTS); ++i)
+        {
+            NdsUnicode61Tokenizer::cursor* cur = tokenizer.getCursor(TEST_INPUT,
+                    (mode == 0) ? -1 : (int)strlen(TEST_INPUT));
+            EXPECT_EQ(true, cur != NULL);
+            EXPECT_EQ(true, cur->setLanguage(TESTS[i].languageId));
+            TestReturnedTokens(*cur, TESTS[i].tokens, TESTS[i].count);
+            delete cur;
+        }
+    }
+
+    EXPECT_EQ(true, tokenizer.close());
+
+    // malformed language options
+    static char const* invalidArgv[][1] = {
+            { "language=2" },
+            { "language=x:remove_diacritics=0" },
+            { "language=-1:remove_diacritics=0" },
+            { "language=2:unknown=1" },
+            { "language=2:language=3:kana_fold=1" },
+    };
+
+    for (size_t i = 0; i < ARRAY_SIZE(invalidArgv); ++i)
+        EXPECT_EQ(false, tokenizer.open(1, invalidArgv[i]));
+}
+
+void TestNdsUnicode61Tokenizer_substitutionPrefix()
+{
+    // U+E000
+    static char const* argv[] = {
+            "substitution_prefix=\xee\x80\x80"
+    };
+
+    // ids right after a word, back to back and around U+65E5 U+672C
+    static const char TEST_INPUT[] = "Main\xee\x80\x80" "A12 \xee\x80\x80" "7\xee\x80\x80" "x "
+            "\xe6\x97\xa5\xe6\x9c\xac\xee\x80\x80" "Q9\xe6\x97\xa5\xe6\x9c\xac";
+
+    // the ids are kept as they are, prefix included; queries are tokenized the same way
+    static const Token TEST_TOKENS[] =
+    {
+            { "main", 4, 0, 4 },
+            { "\xee\x80\x80" "A12", 6, 4, 10 },
+            { "\xee\x80\x80" "7", 4, 11, 15 },
+            { "\xee\x80\x80" "x", 4, 15, 19 },
+            { "\xe6\x97\xa5\xe6\x9c\xac", 6, 20, 26 },
+            { "\xee\x80\x80" "Q9", 5, 26, 31 },
+            { "\xe6\x97\xa5\xe6\x9c\xac", 6, 31, 37 },
+    };
+
+    NdsUnicode61Tokenizer tokenizer;
+    EXPECT_EQ(true, tokenizer.open(ARRAY_SIZE(argv), argv));
+
+    for (int mode = 0; mode < 2; ++mode)
+    {
+        NdsUnicode61Tokenizer::cursor* cur = tokenizer.getCursor(TEST_INPUT,
+                (mode == 0) ? -1 : (int)ARRAY_SIZE(TEST_INPUT) - 1);
+        EXPECT_EQ(true, cur != NULL);
+        TestReturnedTokens(*cur, TEST_TOKENS, ARRAY_SIZE(TEST_TOKENS));
+        delete cur;
+    }
+
+    EXPECT_EQ(true, tokenizer.close());
+
+    // empty, not in the Private Use Area, too long
+    static char const* invalidArgv[][1] = {
+            { "substitution_prefix=" },
+            { "substitution_prefix=#" },
+            { "substitution_prefix=\xee\x80\x80" "a" },
+            { "substitution_prefix=\xee\x80\x80\xee\x80\x80\xee\x80\x80\xee\x80\x80\xee\x80\x80\xee\x80\x80" },
+    };
+
+    for (size_t i = 0; i < ARRAY_SIZE(invalidArgv); ++i)
+        EXPECT_EQ(false, tokenizer.open(1, invalidArgv[i]));
+}
+
+void TestNdsUnicode61Tokenizer_integrityCheck()
+{
+    sqlite3* db = OpenDatabase();
+
+    EXPECT_EQ(SQLITE_OK, sqlite3_exec(db,
+            "CREATE VIRTUAL TABLE plain USING fts4(name, tokenize=ndsunicode61 \"remove_diacritics=0\");"
+            "CREATE VIRTUAL TABLE ngrams USING fts4(name, tokenize=ndsunicode61 \"edge_ngrams=2:4\");"
+            "CREATE VIRTUAL TABLE extras USING fts4(name, tokenize=ndsunicode61 \"cjk_ngram=1,2\" "
+                    "\"phone_numbers=1\" \"hangul_choseong=1\");"
+            "INSERT INTO plain VALUES('Beijing Road');"
+            "INSERT INTO ngrams VALUES('Beijing Road');"
+            "INSERT INTO ngrams VALUES('bei* beijing*');"
+            "INSERT INTO extras VALUES('\xe5\x8c\x97\xe4\xba\xac\xe5\xb8\x82 +49 (0)89 1234-567 \xed\x95\x9c\xea\xb5\xad');",
+            NULL, NULL, NULL));
+    EXPECT_EQ(SQLITE_OK, sqlite3_exec(db, "INSERT INTO plain(plain) VALUES('integrity-check')", NULL, NULL, NULL));
+
+    // the check tokenizes the rows with their length, which gets the terms added to documents too
+    EXPECT_EQ(SQLITE_OK, sqlite3_exec(db, "INSERT INTO ngrams(ngrams) VALUES('integrity-check')", NULL, NULL, NULL));
+    EXPECT_EQ(SQLITE_OK, sqlite3_exec(db, "INSERT INTO extras(extras) VALUES('integrity-check')", NULL, NULL, NULL));
+
+    // the index itself is fine, and so are queries
+    sqlite3_stmt* stmt = NULL;
+    static const struct
+    {
+        const char* query;
+        int count;
+    } MATCHES[] = {
+            { "SELECT count(*) FROM ngrams WHERE ngrams MATCH 'bei*'", 2 },
+            { "SELECT count(*) FROM ngrams WHERE ngrams MATCH '\"beijing road\"'", 1 },
+            { "SELECT count(*) FROM ngrams WHERE ngrams MATCH '\"bei beijing\"'", 1 },
+            { "SELECT count(*) FROM extras WHERE extras MATCH '\xe4\xba\xac'", 1 },
+            { "SELECT count(*) FROM extras WHERE extras MATCH '\"+49 (0)89 1234-567\"'", 1 },
+            { "SELECT count(*) FROM extras WHERE extras MATCH '1234567'", 1 },
+    };
+
+    for (size_t i = 0; i < ARRAY_SIZE(MATCHES); ++i)
+    {
+        EXPECT_EQ(SQLITE_OK, sqlite3_prepare_v2(db, MATCHES[i].query, -1, &stmt, NULL));
+        EXPECT_EQ(SQLITE_ROW, sqlite3_step(stmt));
+        EXPECT_EQ(MATCHES[i].count, sqlite3_column_int(stmt, 0));
+        EXPECT_EQ(SQLITE_OK, sqlite3_finalize(stmt));
+    }
+
+    EXPECT_EQ(SQLITE_OK, sqlite3_close(db));
+}
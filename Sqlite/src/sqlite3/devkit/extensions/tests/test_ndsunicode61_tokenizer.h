@@ -8,5 +8,23 @@ void TestNdsUnicode61Tokenizer_japanese();
 void TestNdsUnicode61Tokenizer_mixed();
 void TestNdsUnicode61Tokenizer_tokencharsSeparators();
 void TestNdsUnicode61Tokenizer_ideographicSpace();
+void TestNdsUnicode61Tokenizer_longToken();
+void TestNdsUnicode61Tokenizer_nonAsciiExceptions();
+void TestNdsUnicode61Tokenizer_cursorReuse();
+void TestNdsUnicode61Tokenizer_batch();
+void TestNdsUnicode61Tokenizer_edgeNgrams();
+void TestNdsUnicode61Tokenizer_cjkNgram();
+void TestNdsUnicode61Tokenizer_queryBigramCover();
+void TestNdsUnicode61Tokenizer_dictionarySegmentation();
+void TestNdsUnicode61Tokenizer_kanaFold();
+void TestNdsUnicode61Tokenizer_pinyin();
+void TestNdsUnicode61Tokenizer_hangulChoseong();
+void TestNdsUnicode61Tokenizer_phoneNumbers();
+void TestNdsUnicode61Tokenizer_extraEdgeNgrams();
+void TestNdsUnicode61Tokenizer_tokenCache();
+void TestNdsUnicode61Tokenizer_queryCache();
+void TestNdsUnicode61Tokenizer_languageid();
+void TestNdsUnicode61Tokenizer_substitutionPrefix();
+void TestNdsUnicode61Tokenizer_integrityCheck();
 
 #endif // TEST_NDSUNICODE61_TOKENIZER_H
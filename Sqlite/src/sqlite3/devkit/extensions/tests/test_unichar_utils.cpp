@@ -106,3 +106,87 @@ void TestUnicharDecompose_fullwidthSymbol()
 
     TestUnicharDecompose(c, expected, ARRAY_SIZE(expected));
 }
+
+static void TestUnicharNormalize(unichar c, UnicharNormalizationForm form,
+        unichar const* expected, size_t expectedLen)
+{
+    unichar const* normalized = NULL;
+    unsigned normalizedLen = 0;
+    nds_bool r = UnicharNormalize(c, form, &normalized, &normalizedLen);
+    EXPECT_EQ(r, true);
+    EXPECT_EQ(static_cast<unsigned long>(normalizedLen), static_cast<unsigned long>(expectedLen));
+    for (size_t i = 0; i < normalizedLen; i++)
+    {
+        EXPECT_EQ(expected[i], normalized[i]);
+    }
+}
+
+void TestUnicharNormalize_unchanged()
+{
+    static const unichar c = 0x61; // U+0061 LATIN SMALL LETTER A
+    unichar const* normalized = NULL;
+    unsigned normalizedLen = 0;
+
+    // not changed by any form
+    EXPECT_EQ(UnicharNormalize(c, UnicharNormDecompose, &normalized, &normalizedLen), false);
+    EXPECT_EQ(UnicharNormalize(c, UnicharNormFold, &normalized, &normalizedLen), false);
+    EXPECT_EQ(UnicharNormalize(c, UnicharNormFoldRemoveDiacritics, &normalized, &normalizedLen), false);
+}
+
+void TestUnicharNormalize_latin()
+{
+    static const unichar c = 0xc4; // U+00C4 LATIN CAPITAL LETTER A WITH DIAERESIS Ä
+    static const unichar decomposed[] = {
+            0x41, // U+0041 LATIN CAPITAL LETTER A
+            0x308 // U+0308 COMBINING DIAERESIS
+    };
+    static const unichar folded[] = {
+            0x61, // U+0061 LATIN SMALL LETTER A
+            0x308 // U+0308 COMBINING DIAERESIS
+    };
+    static const unichar base[] = {
+            0x61 // U+0061 LATIN SMALL LETTER A
+    };
+
+    TestUnicharNormalize(c, UnicharNormDecompose, decomposed, ARRAY_SIZE(decomposed));
+    TestUnicharNormalize(c, UnicharNormFold, folded, ARRAY_SIZE(folded));
+    TestUnicharNormalize(c, UnicharNormFoldRemoveDiacritics, base, ARRAY_SIZE(base));
+}
+
+void TestUnicharNormalize_combiningMark()
+{
+    static const unichar c = 0x301; // U+0301 COMBINING ACUTE ACCENT
+
+    // dropped when diacritics are removed, kept otherwise
+    TestUnicharNormalize(c, UnicharNormFoldRemoveDiacritics, NULL, 0);
+
+    unichar const* normalized = NULL;
+    unsigned normalizedLen = 0;
+    EXPECT_EQ(UnicharNormalize(c, UnicharNormFold, &normalized, &normalizedLen), false);
+}
+
+void TestUnicharNormalize_kana()
+{
+    static const unichar c = 0x30f7; // U+30F7 KATAKANA LETTER VA
+    static const unichar folded[] = {
+            0x30ef, // U+30EF KATAKANA LETTER WA
+            0x3099  // U+3099 COMBINING KATAKANA-HIRAGANA VOICED SOUND MARK
+    };
+    static const unichar kanaFolded[] = {
+            0x308f, // U+308F HIRAGANA LETTER WA
+            0x3099  // U+3099 COMBINING KATAKANA-HIRAGANA VOICED SOUND MARK
+    };
+    static const unichar kanaBase[] = {
+            0x308f  // U+308F HIRAGANA LETTER WA
+    };
+    static const unichar voicedSoundMark[] = {
+            0x3099  // U+3099 COMBINING KATAKANA-HIRAGANA VOICED SOUND MARK
+    };
+
+    TestUnicharNormalize(c, UnicharNormFold, folded, ARRAY_SIZE(folded));
+    TestUnicharNormalize(c, UnicharNormFoldKana, kanaFolded, ARRAY_SIZE(kanaFolded));
+    TestUnicharNormalize(c, UnicharNormFoldRemoveDiacriticsKana, kanaBase, ARRAY_SIZE(kanaBase));
+
+    // the half-width voiced sound mark becomes the combining one
+    TestUnicharNormalize(0xff9e, UnicharNormFoldKana, voicedSoundMark, ARRAY_SIZE(voicedSoundMark));
+}
@@ -9,5 +9,9 @@ void TestUnicharDecompose_circledKatakana();
 void TestUnicharDecompose_fullwidthLatin();
 void TestUnicharDecompose_fullwidthDigit();
 void TestUnicharDecompose_fullwidthSymbol();
+void TestUnicharNormalize_unchanged();
+void TestUnicharNormalize_latin();
+void TestUnicharNormalize_combiningMark();
+void TestUnicharNormalize_kana();
 
 #endif // TEST_UNICHAR_UTILS_H
@@ -0,0 +1,151 @@
+#include <stddef.h>
+#include <string.h>
+#include <assert.h>
+
+#include "nds_sqlite3.h"
+#include "../utils/nds_int.h"
+#include "nds_dictionary.h"
+
+static const char NDS_DICTIONARY_MAGIC[8] = { 'N', 'D', 'S', 'D', 'I', 'C', 'T', '1' };
+
+/** Size of the magic and the word count. */
+static const size_t NDS_DICTIONARY_HEADER_SIZE = 12;
+
+static nds_uint32 NdsDictionary_readUint32(const unsigned char* p)
+{
+    return (nds_uint32)p[0] | ((nds_uint32)p[1] << 8) | ((nds_uint32)p[2] << 16) |
+            ((nds_uint32)p[3] << 24);
+}
+
+static nds_uint32 NdsDictionary_wordOffset(NdsDictionary const* self, unsigned idx)
+{
+    return NdsDictionary_readUint32(self->offsets + 4 * (size_t)idx);
+}
+
+static size_t NdsDictionary_wordLen(NdsDictionary const* self, unsigned idx)
+{
+    return NdsDictionary_wordOffset(self, idx + 1) - NdsDictionary_wordOffset(self, idx);
+}
+
+nds_bool NdsDictionary_init(NdsDictionary* self, const void* data, size_t size)
+{
+    const unsigned char* bytes = (const unsigned char*)data;
+    size_t wordsSize;
+    unsigned i;
+
+    memset(self, 0, sizeof(*self));
+    if (size < NDS_DICTIONARY_HEADER_SIZE || memcmp(bytes, NDS_DICTIONARY_MAGIC, sizeof(NDS_DICTIONARY_MAGIC)) != 0)
+        return NDS_FALSE;
+
+    self->count = NdsDictionary_readUint32(bytes + sizeof(NDS_DICTIONARY_MAGIC));
+    if ((size - NDS_DICTIONARY_HEADER_SIZE) / 4 <= self->count)
+        return NDS_FALSE;
+
+    self->data = bytes;
+    self->size = size;
+    self->offsets = bytes + NDS_DICTIONARY_HEADER_SIZE;
+    self->words = self->offsets + 4 * ((size_t)self->count + 1);
+    wordsSize = size - (self->words - bytes);
+
+    /* the lookup relies on the words being sorted, unique and in bounds */
+    if (NdsDictionary_wordOffset(self, 0) != 0 || NdsDictionary_wordOffset(self, self->count) > wordsSize)
+        return NDS_FALSE;
+
+    for (i = 0; i < self->count; i++)
+    {
+        if (NdsDictionary_wordOffset(self, i + 1) <= NdsDictionary_wordOffset(self, i))
+            return NDS_FALSE;
+
+        if (i > 0)
+        {
+            const size_t prevLen = NdsDictionary_wordLen(self, i - 1);
+            const size_t len = NdsDictionary_wordLen(self, i);
+            const int cmp = memcmp(self->words + NdsDictionary_wordOffset(self, i - 1),
+                    self->words + NdsDictionary_wordOffset(self, i), (prevLen < len) ? prevLen : len);
+            if (cmp > 0 || (cmp == 0 && prevLen >= len))
+                return NDS_FALSE;
+        }
+    }
+
+    return NDS_TRUE;
+}
+
+int NdsDictionary_load(NdsDictionary* self, const char* path)
+{
+    NdsMappedFile file;
+    int r;
+
+    memset(self, 0, sizeof(*self));
+    r = NdsMappedFile_open(&file, path);
+    if (r != SQLITE_OK)
+        return r;
+
+    if (!NdsDictionary_init(self, file.data, file.size))
+    {
+        NdsMappedFile_close(&file);
+        return SQLITE_CORRUPT;
+    }
+    self->file = file;
+
+    return SQLITE_OK;
+}
+
+void NdsDictionary_unload(NdsDictionary* self)
+{
+    NdsMappedFile_close(&self->file);
+    memset(self, 0, sizeof(*self));
+}
+
+/**
+ * Find the first word in lo..hi-1 whose byte at index k is greater than (or equal to) c.
+ *
+ * All the words in the range are longer than k bytes and share the first k bytes.
+ */
+static unsigned NdsDictionary_bound(NdsDictionary const* self, unsigned lo, unsigned hi, size_t k,
+        unsigned char c, nds_bool orEqual)
+{
+    while (lo < hi)
+    {
+        const unsigned mid = lo + (hi - lo) / 2;
+        const unsigned char b = self->words[NdsDictionary_wordOffset(self, mid) + k];
+        if (b < c || (!orEqual && b == c))
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+unsigned NdsDictionary_findPrefixes(NdsDictionary const* self, const char* text, size_t textLen,
+        size_t* matchLens)
+{
+    const unsigned char* bytes = (const unsigned char*)text;
+    unsigned lo = 0;
+    unsigned hi = self->count;
+    unsigned found = 0;
+    size_t k;
+
+    for (k = 0; lo < hi; k++)
+    {
+        /*
+         * The words in lo..hi-1 start with the first k bytes of the text. As they are sorted
+         * and unique, only the first one can be exactly k bytes long.
+         */
+        if (NdsDictionary_wordLen(self, lo) == k)
+        {
+            matchLens[found++] = k;
+            if (found == NDS_DICTIONARY_MAX_MATCHES)
+                break;
+
+            lo++;
+        }
+
+        if (k == textLen)
+            break;
+
+        lo = NdsDictionary_bound(self, lo, hi, k, bytes[k], NDS_TRUE);
+        hi = NdsDictionary_bound(self, lo, hi, k, bytes[k], NDS_FALSE);
+    }
+
+    return found;
+}
@@ -0,0 +1,89 @@
+#ifndef NDS_DICTIONARY_H
+#define NDS_DICTIONARY_H
+
+#include <stddef.h>
+
+#include "../utils/nds_bool.h"
+#include "../utils/nds_extension_macros.h"
+#include "nds_mapped_file.h"
+
+/**
+ * Maximum number of matches returned by NdsDictionary_findPrefixes().
+ */
+#define NDS_DICTIONARY_MAX_MATCHES 32
+
+/**
+ * A read-only word list used for word segmentation.
+ *
+ * The dictionary file is used in place (see NdsMappedFile), so it contains no pointers and
+ * needs no fix-ups. All numbers are 32-bit little endian:
+ *
+ *     "NDSDICT1"                    magic, 8 bytes
+ *     count                         number of words
+ *     offsets[count + 1]            offsets of the words from the start of the word data;
+ *                                   word i occupies offsets[i]..offsets[i+1]-1
+ *     word data                     the UTF-8 encoded words without separators
+ *
+ * The words are sorted by their bytes (memcmp() order) and unique.
+ */
+typedef struct
+{
+    /** The contents of the dictionary file. */
+    const unsigned char* data;
+
+    /** Size of the contents in bytes. */
+    size_t size;
+
+    /** Number of words. */
+    unsigned count;
+
+    /** Start of the offsets array. */
+    const unsigned char* offsets;
+
+    /** Start of the word data. */
+    const unsigned char* words;
+
+    /** The file loaded by NdsDictionary_load(), if any. */
+    NdsMappedFile file;
+} NdsDictionary;
+
+NDS_EXTENSION_BEGIN_DECLS
+
+/**
+ * Initialize a dictionary over a buffer holding the contents of a dictionary file.
+ *
+ * The buffer is not copied and must outlive the dictionary.
+ *
+ * \return True if the buffer holds a valid dictionary.
+ */
+nds_bool NdsDictionary_init(NdsDictionary* self, const void* data, size_t size);
+
+/**
+ * Load a dictionary file.
+ *
+ * \return SQLITE_OK when operation succeeded, an error code otherwise.
+ */
+int NdsDictionary_load(NdsDictionary* self, const char* path);
+
+/**
+ * Release a dictionary loaded by NdsDictionary_load().
+ */
+void NdsDictionary_unload(NdsDictionary* self);
+
+/**
+ * Find the words of the dictionary that are prefixes of a text.
+ *
+ * \param[in]  self       Pointer to the instance.
+ * \param[in]  text       The text, not nul-terminated.
+ * \param[in]  textLen    Length of the text in bytes.
+ * \param[out] matchLens  Receives the lengths (in bytes) of the matching words, shortest first.
+ *                        Must have room for NDS_DICTIONARY_MAX_MATCHES entries.
+ *
+ * \return Number of matches stored; when there are more, the longest ones are dropped.
+ */
+unsigned NdsDictionary_findPrefixes(NdsDictionary const* self, const char* text, size_t textLen,
+        size_t* matchLens);
+
+NDS_EXTENSION_END_DECLS
+
+#endif /* NDS_DICTIONARY_H */
@@ -0,0 +1,580 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "../utils/nds_bool.h"
+#include "../utils/nds_extension_macros.h"
+#include "nds_unicode61.h"
+#include "nds_highlight.h"
+
+/*
+ * nds_highlight(TEXT, QUERY, OPTION...) tokenizes TEXT with an ndsunicode61 tokenizer created with
+ * the OPTIONs (those of the FTS table) and returns the byte ranges of TEXT holding the tokens of
+ * QUERY, the MATCH expression, as a blob: one pair of little-endian 32-bit offsets (start, end)
+ * per range, in order, overlapping and adjacent ranges merged.
+ *
+ * The tokenizers are kept by the connection, one per set of options, and reuse their cursors. The
+ * terms of the query are kept as long as SQLite keeps the auxiliary data of the QUERY argument,
+ * typically for all the rows of a statement, so each row only costs the tokenization of its text.
+ */
+
+/**
+ * Maximum number of tokenizers (sets of options) kept by a connection.
+ */
+static const unsigned NDS_HIGHLIGHT_MAX_TOKENIZERS = 8;
+
+/**
+ * Size of a range in the returned blob.
+ */
+static const int NDS_HIGHLIGHT_RANGE_SIZE = 8;
+
+/**
+ * A tokenizer of the connection, allocated in one block followed by its options.
+ */
+typedef struct NdsHighlightTokenizer
+{
+    /** Next tokenizer, from the most to the least recently used. */
+    struct NdsHighlightTokenizer* next;
+
+    sqlite3_tokenizer* tokenizer;
+
+    /** Number of the tokenizer, unique in the connection: a query is only valid for its own. */
+    unsigned serial;
+
+    /** Number of options, stored after the structure, each nul-terminated. */
+    int argc;
+} NdsHighlightTokenizer;
+
+/**
+ * A token of the query.
+ */
+typedef struct
+{
+    /** Offset of the bytes of the term in the data of the query. */
+    int dataOffset;
+
+    int nBytes;
+
+    /** True if the term is followed by '*' and matches any token starting with it. */
+    nds_bool prefix;
+} NdsHighlightTerm;
+
+/**
+ * The terms of a query, allocated in one block followed by the terms, then their bytes.
+ */
+typedef struct
+{
+    /** Serial number of the tokenizer the terms come from. */
+    unsigned serial;
+
+    int termCount;
+} NdsHighlightQuery;
+
+/**
+ * The state of the function in a connection.
+ */
+typedef struct
+{
+    sqlite3_tokenizer_module const* module;
+
+    NdsHighlightTokenizer* tokenizers;
+    unsigned tokenizersCount;
+    unsigned nextSerial;
+
+    /** Terms and bytes of the query being parsed. */
+    NdsHighlightTerm* terms;
+    int termsCapacity;
+    char* data;
+    int dataCapacity;
+
+    /** Ranges of the current text, start and end offsets. */
+    int* ranges;
+    int rangesCapacity;
+} NdsHighlightContext;
+
+static const char* NdsHighlightTokenizer_options(const NdsHighlightTokenizer* self)
+{
+    return (const char*)(self + 1);
+}
+
+static NdsHighlightTerm const* NdsHighlightQuery_terms(const NdsHighlightQuery* self)
+{
+    return (NdsHighlightTerm const*)(self + 1);
+}
+
+static const char* NdsHighlightQuery_data(const NdsHighlightQuery* self)
+{
+    return (const char*)(NdsHighlightQuery_terms(self) + self->termCount);
+}
+
+/**
+ * Grow an array to hold at least count elements.
+ *
+ * \return true unless the allocation failed.
+ */
+static nds_bool NdsHighlight_reserve(void** array, int* capacity, int count, size_t elementSize)
+{
+    if (count > *capacity)
+    {
+        int newCapacity = (*capacity > 0) ? *capacity : 16;
+        void* newArray;
+
+        while (newCapacity < count)
+            newCapacity *= 2;
+        newArray = realloc(*array, (size_t)newCapacity * elementSize);
+        if (newArray == NULL)
+            return NDS_FALSE;
+        *array = newArray;
+        *capacity = newCapacity;
+    }
+
+    return NDS_TRUE;
+}
+
+static void NdsHighlightTokenizer_destroy(NdsHighlightTokenizer* self)
+{
+    self->tokenizer->pModule->xDestroy(self->tokenizer);
+    free(self);
+}
+
+static void NdsHighlight_destroyContext(void* p)
+{
+    NdsHighlightContext* self = (NdsHighlightContext*)p;
+
+    while (self->tokenizers != NULL)
+    {
+        NdsHighlightTokenizer* tokenizer = self->tokenizers;
+        self->tokenizers = tokenizer->next;
+        NdsHighlightTokenizer_destroy(tokenizer);
+    }
+    free(self->terms);
+    free(self->data);
+    free(self->ranges);
+    free(self);
+}
+
+/**
+ * Check if the options of a tokenizer are the given arguments.
+ */
+static nds_bool NdsHighlight_hasOptions(const NdsHighlightTokenizer* tokenizer, int argc,
+        sqlite3_value** argv)
+{
+    const char* option = NdsHighlightTokenizer_options(tokenizer);
+    int i;
+
+    if (tokenizer->argc != argc)
+        return NDS_FALSE;
+
+    for (i = 0; i < argc; i++)
+    {
+        const char* arg = (const char*)sqlite3_value_text(argv[i]);
+        const size_t len = strlen(option);
+        if (arg == NULL || (size_t)sqlite3_value_bytes(argv[i]) != len || memcmp(arg, option, len) != 0)
+            return NDS_FALSE;
+        option += len + 1;
+    }
+
+    return NDS_TRUE;
+}
+
+/**
+ * Create a tokenizer with the given options, and make it the most recently used one.
+ *
+ * \return SQLITE_OK when operation succeeded, an error code otherwise.
+ */
+static int NdsHighlight_createTokenizer(NdsHighlightContext* self, int argc, sqlite3_value** argv,
+        NdsHighlightTokenizer** ppTokenizer)
+{
+    NdsHighlightTokenizer* tokenizer;
+    char const** options;
+    char* option;
+    size_t optionsSize = 0;
+    int i;
+    int r;
+
+    for (i = 0; i < argc; i++)
+    {
+        if (sqlite3_value_text(argv[i]) == NULL)
+            return SQLITE_MISUSE;
+        optionsSize += (size_t)sqlite3_value_bytes(argv[i]) + 1;
+    }
+
+    tokenizer = (NdsHighlightTokenizer*)malloc(sizeof(NdsHighlightTokenizer) + optionsSize);
+    options = (char const**)malloc(sizeof(char*) * ((size_t)argc + 1));
+    if (tokenizer == NULL || options == NULL)
+    {
+        free(tokenizer);
+        free((void*)options);
+        return SQLITE_NOMEM;
+    }
+
+    option = (char*)(tokenizer + 1);
+    for (i = 0; i < argc; i++)
+    {
+        const size_t len = (size_t)sqlite3_value_bytes(argv[i]);
+        memcpy(option, sqlite3_value_text(argv[i]), len + 1);
+        options[i] = option;
+        option += len + 1;
+    }
+    tokenizer->argc = argc;
+
+    r = self->module->xCreate(argc, options, &tokenizer->tokenizer);
+    free((void*)options);
+    if (r != SQLITE_OK)
+    {
+        free(tokenizer);
+        return r;
+    }
+    tokenizer->tokenizer->pModule = self->module;
+    tokenizer->serial = ++self->nextSerial;
+
+    if (self->tokenizersCount == NDS_HIGHLIGHT_MAX_TOKENIZERS)
+    {
+        /* drop the least recently used tokenizer */
+        NdsHighlightTokenizer** last = &self->tokenizers;
+        while ((*last)->next != NULL)
+            last = &(*last)->next;
+        NdsHighlightTokenizer_destroy(*last);
+        *last = NULL;
+        self->tokenizersCount--;
+    }
+
+    tokenizer->next = self->tokenizers;
+    self->tokenizers = tokenizer;
+    self->tokenizersCount++;
+
+    *ppTokenizer = tokenizer;
+    return SQLITE_OK;
+}
+
+/**
+ * Find the tokenizer of the given options, creating it if needed.
+ *
+ * \return SQLITE_OK when operation succeeded, an error code otherwise.
+ */
+static int NdsHighlight_getTokenizer(NdsHighlightContext* self, int argc, sqlite3_value** argv,
+        NdsHighlightTokenizer** ppTokenizer)
+{
+    NdsHighlightTokenizer** p;
+
+    for (p = &self->tokenizers; *p != NULL; p = &(*p)->next)
+    {
+        NdsHighlightTokenizer* tokenizer = *p;
+        if (NdsHighlight_hasOptions(tokenizer, argc, argv))
+        {
+            if (p != &self->tokenizers)
+            {
+                *p = tokenizer->next;
+                tokenizer->next = self->tokenizers;
+                self->tokenizers = tokenizer;
+            }
+            *ppTokenizer = tokenizer;
+            return SQLITE_OK;
+        }
+    }
+
+    return NdsHighlight_createTokenizer(self, argc, argv, ppTokenizer);
+}
+
+/**
+ * Check if a token of the query is an operator of the FTS query syntax.
+ */
+static nds_bool NdsHighlight_isOperator(const char* token, int nBytes)
+{
+    return (nBytes == 2 && memcmp(token, "OR", 2) == 0) ||
+            (nBytes == 3 && (memcmp(token, "AND", 3) == 0 || memcmp(token, "NOT", 3) == 0)) ||
+            (nBytes == 4 && memcmp(token, "NEAR", 4) == 0);
+}
+
+/**
+ * Tokenize a query (as FTS does with a MATCH expression) into its terms.
+ *
+ * \return SQLITE_OK when operation succeeded, an error code otherwise.
+ */
+static int NdsHighlight_parseQuery(NdsHighlightContext* self, const NdsHighlightTokenizer* tokenizer,
+        const char* text, int len, NdsHighlightQuery** ppQuery)
+{
+    sqlite3_tokenizer* t = tokenizer->tokenizer;
+    sqlite3_tokenizer_cursor* cursor = NULL;
+    NdsHighlightQuery* query;
+    int termCount = 0;
+    int dataSize = 0;
+    int r;
+
+    if (text != NULL && len > 0)
+    {
+        const char* token;
+        int nBytes;
+        int startOffset;
+        int endOffset;
+        int position;
+
+        r = NdsUnicode61_openQuery(t, text, len, &cursor);
+        if (r != SQLITE_OK)
+            return r;
+        cursor->pTokenizer = t;
+
+        while ((r = t->pModule->xNext(cursor, &token, &nBytes, &startOffset, &endOffset, &position)) == SQLITE_OK)
+        {
+            NdsHighlightTerm* term;
+
+            if (NdsHighlight_isOperator(text + startOffset, endOffset - startOffset))
+                continue;
+
+            if (!NdsHighlight_reserve((void**)&self->terms, &self->termsCapacity, termCount + 1,
+                    sizeof(NdsHighlightTerm)) ||
+                    !NdsHighlight_reserve((void**)&self->data, &self->dataCapacity, dataSize + nBytes, 1))
+            {
+                r = SQLITE_NOMEM;
+                break;
+            }
+
+            term = &self->terms[termCount++];
+            term->dataOffset = dataSize;
+            term->nBytes = nBytes;
+            term->prefix = endOffset < len && text[endOffset] == '*';
+            memcpy(self->data + dataSize, token, (size_t)nBytes);
+            dataSize += nBytes;
+        }
+        t->pModule->xClose(cursor);
+
+        if (r != SQLITE_DONE)
+            return r;
+    }
+
+    query = (NdsHighlightQuery*)malloc(sizeof(NdsHighlightQuery) +
+            (size_t)termCount * sizeof(NdsHighlightTerm) + (size_t)dataSize);
+    if (query == NULL)
+        return SQLITE_NOMEM;
+
+    query->serial = tokenizer->serial;
+    query->termCount = termCount;
+    if (termCount > 0)
+        memcpy((void*)NdsHighlightQuery_terms(query), self->terms, (size_t)termCount * sizeof(NdsHighlightTerm));
+    if (dataSize > 0)
+        memcpy((void*)NdsHighlightQuery_data(query), self->data, (size_t)dataSize);
+
+    *ppQuery = query;
+    return SQLITE_OK;
+}
+
+/**
+ * Check if a token of the text matches a term of the query.
+ */
+static nds_bool NdsHighlight_matches(const NdsHighlightQuery* query, const char* token, int nBytes)
+{
+    NdsHighlightTerm const* terms = NdsHighlightQuery_terms(query);
+    const char* data = NdsHighlightQuery_data(query);
+    int i;
+
+    for (i = 0; i < query->termCount; i++)
+    {
+        if ((terms[i].nBytes == nBytes || (terms[i].prefix && terms[i].nBytes < nBytes)) &&
+                memcmp(data + terms[i].dataOffset, token, (size_t)terms[i].nBytes) == 0)
+            return NDS_TRUE;
+    }
+
+    return NDS_FALSE;
+}
+
+static int NdsHighlight_compareRanges(const void* range1, const void* range2)
+{
+    const int start1 = *(const int*)range1;
+    const int start2 = *(const int*)range2;
+    return (start1 > start2) - (start1 < start2);
+}
+
+/**
+ * Tokenize a text and store the sorted, merged ranges of its tokens that match the query.
+ *
+ * \return SQLITE_OK when operation succeeded, an error code otherwise.
+ */
+static int NdsHighlight_findRanges(NdsHighlightContext* self, sqlite3_tokenizer* t,
+        const NdsHighlightQuery* query, const char* text, int* pRangeCount)
+{
+    sqlite3_tokenizer_cursor* cursor = NULL;
+    const char* token;
+    int nBytes;
+    int startOffset;
+    int endOffset;
+    int position;
+    int rangeCount = 0;
+    nds_bool sorted = NDS_TRUE;
+    int merged;
+    int i;
+    int r;
+
+    *pRangeCount = 0;
+    if (query->termCount == 0)
+        return SQLITE_OK;
+
+    r = NdsUnicode61_openHighlight(t, text, &cursor);
+    if (r != SQLITE_OK)
+        return r;
+    cursor->pTokenizer = t;
+
+    while ((r = t->pModule->xNext(cursor, &token, &nBytes, &startOffset, &endOffset, &position)) == SQLITE_OK)
+    {
+        if (!NdsHighlight_matches(query, token, nBytes))
+            continue;
+
+        if (rangeCount > 0)
+        {
+            int* last = &self->ranges[2 * (rangeCount - 1)];
+            if (startOffset >= last[0] && startOffset <= last[1])
+            {
+                /* the extra tokens of a word and the bigrams of a run overlap */
+                if (endOffset > last[1])
+                    last[1] = endOffset;
+                continue;
+            }
+            sorted = sorted && startOffset > last[0];
+        }
+
+        if (!NdsHighlight_reserve((void**)&self->ranges, &self->rangesCapacity, 2 * (rangeCount + 1),
+                sizeof(int)))
+        {
+            r = SQLITE_NOMEM;
+            break;
+        }
+        self->ranges[2 * rangeCount] = startOffset;
+        self->ranges[2 * rangeCount + 1] = endOffset;
+        rangeCount++;
+    }
+    t->pModule->xClose(cursor);
+
+    if (r != SQLITE_DONE)
+        return r;
+
+    if (!sorted)
+    {
+        qsort(self->ranges, (size_t)rangeCount, 2 * sizeof(int), NdsHighlight_compareRanges);
+
+        merged = 0;
+        for (i = 1; i < rangeCount; i++)
+        {
+            int* last = &self->ranges[2 * merged];
+            const int* range = &self->ranges[2 * i];
+            if (range[0] <= last[1])
+            {
+                if (range[1] > last[1])
+                    last[1] = range[1];
+            }
+            else
+            {
+                merged++;
+                self->ranges[2 * merged] = range[0];
+                self->ranges[2 * merged + 1] = range[1];
+            }
+        }
+        rangeCount = merged + 1;
+    }
+
+    *pRangeCount = rangeCount;
+    return SQLITE_OK;
+}
+
+/**
+ * Store the offsets of the ranges as little-endian 32-bit integers, in place.
+ */
+static void NdsHighlight_encodeRanges(int* ranges, int rangeCount)
+{
+    unsigned char* p = (unsigned char*)ranges;
+    int i;
+
+    for (i = 0; i < 2 * rangeCount; i++)
+    {
+        const unsigned offset = (unsigned)ranges[i];
+        p[4 * i] = (unsigned char)offset;
+        p[4 * i + 1] = (unsigned char)(offset >> 8);
+        p[4 * i + 2] = (unsigned char)(offset >> 16);
+        p[4 * i + 3] = (unsigned char)(offset >> 24);
+    }
+}
+
+static void NdsHighlight_function(sqlite3_context* context, int argc, sqlite3_value** argv)
+{
+    NdsHighlightContext* self = (NdsHighlightContext*)sqlite3_user_data(context);
+    NdsHighlightTokenizer* tokenizer = NULL;
+    NdsHighlightQuery* query;
+    const char* text;
+    int rangeCount = 0;
+    int r;
+
+    if (argc < 2)
+    {
+        sqlite3_result_error(context, "nds_highlight() takes a text, a query and tokenizer options", -1);
+        return;
+    }
+
+    if (sqlite3_value_type(argv[0]) == SQLITE_NULL)
+    {
+        sqlite3_result_null(context);
+        return;
+    }
+
+    r = NdsHighlight_getTokenizer(self, argc - 2, argv + 2, &tokenizer);
+    if (r != SQLITE_OK)
+    {
+        if (r == SQLITE_NOMEM)
+            sqlite3_result_error_nomem(context);
+        else
+            sqlite3_result_error(context, "nds_highlight(): invalid tokenizer options", -1);
+        return;
+    }
+
+    query = (NdsHighlightQuery*)sqlite3_get_auxdata(context, 1);
+    if (query == NULL || query->serial != tokenizer->serial)
+    {
+        r = NdsHighlight_parseQuery(self, tokenizer, (const char*)sqlite3_value_text(argv[1]),
+                sqlite3_value_bytes(argv[1]), &query);
+        if (r != SQLITE_OK)
+        {
+            sqlite3_result_error_code(context, r);
+            return;
+        }
+
+        /* SQLite frees the query right away if it can't keep it */
+        sqlite3_set_auxdata(context, 1, query, free);
+        query = (NdsHighlightQuery*)sqlite3_get_auxdata(context, 1);
+        if (query == NULL)
+        {
+            sqlite3_result_error_nomem(context);
+            return;
+        }
+    }
+
+    text = (const char*)sqlite3_value_text(argv[0]);
+    if (text == NULL)
+    {
+        sqlite3_result_error_nomem(context);
+        return;
+    }
+
+    r = NdsHighlight_findRanges(self, tokenizer->tokenizer, query, text, &rangeCount);
+    if (r != SQLITE_OK)
+    {
+        sqlite3_result_error_code(context, r);
+        return;
+    }
+
+    NdsHighlight_encodeRanges(self->ranges, rangeCount);
+    sqlite3_result_blob(context, self->ranges, rangeCount * NDS_HIGHLIGHT_RANGE_SIZE, SQLITE_TRANSIENT);
+}
+
+int RegisterNdsHighlight(sqlite3* p_db)
+{
+    NdsHighlightContext* self;
+
+    if (p_db == NULL)
+        return SQLITE_ERROR;
+
+    self = (NdsHighlightContext*)malloc(sizeof(NdsHighlightContext));
+    if (self == NULL)
+        return SQLITE_NOMEM;
+    memset(self, 0, sizeof(*self));
+    sqlite3Fts3NdsUnicodeTokenizer(&self->module);
+
+    /* the context is destroyed by SQLite, even if the registration fails */
+    return sqlite3_create_function_v2(p_db, "nds_highlight", -1, SQLITE_UTF8 | SQLITE_DETERMINISTIC,
+            self, NdsHighlight_function, NULL, NULL, NdsHighlight_destroyContext);
+}
@@ -0,0 +1,16 @@
+#ifndef NDS_HIGHLIGHT_H
+#define NDS_HIGHLIGHT_H
+
+#include "nds_sqlite3.h"
+#include "../utils/nds_extension_macros.h"
+
+NDS_EXTENSION_BEGIN_DECLS
+
+/**
+ * Register the nds_highlight() SQL function, see nds_extensions_init().
+ */
+int RegisterNdsHighlight(sqlite3* p_db);
+
+NDS_EXTENSION_END_DECLS
+
+#endif /* NDS_HIGHLIGHT_H */
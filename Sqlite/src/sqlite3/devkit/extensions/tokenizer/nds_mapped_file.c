@@ -0,0 +1,99 @@
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "nds_sqlite3.h"
+#include "nds_mapped_file.h"
+
+int NdsMappedFile_open(NdsMappedFile* self, const char* path)
+{
+#ifdef _WIN32
+    FILE* file;
+    long size;
+    void* data;
+
+    memset(self, 0, sizeof(*self));
+    file = fopen(path, "rb");
+    if (file == NULL)
+        return SQLITE_CANTOPEN;
+
+    if (fseek(file, 0, SEEK_END) != 0 || (size = ftell(file)) < 0 || fseek(file, 0, SEEK_SET) != 0)
+    {
+        fclose(file);
+        return SQLITE_IOERR;
+    }
+
+    if (size == 0)
+    {
+        fclose(file);
+        return SQLITE_CORRUPT;
+    }
+
+    data = malloc(size);
+    if (data == NULL)
+    {
+        fclose(file);
+        return SQLITE_NOMEM;
+    }
+
+    if (fread(data, 1, size, file) != (size_t)size)
+    {
+        free(data);
+        fclose(file);
+        return SQLITE_IOERR;
+    }
+    fclose(file);
+
+    self->data = (const unsigned char*)data;
+    self->size = size;
+#else
+    struct stat st;
+    void* data;
+    int fd;
+
+    memset(self, 0, sizeof(*self));
+    fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return SQLITE_CANTOPEN;
+
+    if (fstat(fd, &st) != 0 || st.st_size == 0)
+    {
+        close(fd);
+        return SQLITE_CORRUPT;
+    }
+
+    data = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+        return SQLITE_IOERR;
+
+    self->data = (const unsigned char*)data;
+    self->size = st.st_size;
+    self->mapped = NDS_TRUE;
+#endif
+
+    return SQLITE_OK;
+}
+
+void NdsMappedFile_close(NdsMappedFile* self)
+{
+    if (self->data == NULL)
+        return;
+
+#ifndef _WIN32
+    if (self->mapped)
+        munmap((void*)self->data, self->size);
+    else
+#endif
+        free((void*)self->data);
+
+    memset(self, 0, sizeof(*self));
+}
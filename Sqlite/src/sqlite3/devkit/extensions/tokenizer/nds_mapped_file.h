@@ -0,0 +1,44 @@
+#ifndef NDS_MAPPED_FILE_H
+#define NDS_MAPPED_FILE_H
+
+#include <stddef.h>
+
+#include "../utils/nds_bool.h"
+#include "../utils/nds_extension_macros.h"
+
+/**
+ * The read-only contents of a data file used by the tokenizer.
+ *
+ * The file is memory-mapped where the platform allows, and read into memory otherwise.
+ */
+typedef struct
+{
+    /** The contents of the file, NULL if no file is open. */
+    const unsigned char* data;
+
+    /** Size of the contents in bytes. */
+    size_t size;
+
+    /** Whether data is mapped (rather than allocated). */
+    nds_bool mapped;
+} NdsMappedFile;
+
+NDS_EXTENSION_BEGIN_DECLS
+
+/**
+ * Open a file and make its contents available.
+ *
+ * Empty files are rejected, as none of the data files can be empty.
+ *
+ * \return SQLITE_OK when operation succeeded, an error code otherwise.
+ */
+int NdsMappedFile_open(NdsMappedFile* self, const char* path);
+
+/**
+ * Release the contents of a file opened by NdsMappedFile_open(). Does nothing if no file is open.
+ */
+void NdsMappedFile_close(NdsMappedFile* self);
+
+NDS_EXTENSION_END_DECLS
+
+#endif /* NDS_MAPPED_FILE_H */
@@ -0,0 +1,147 @@
+#include <stddef.h>
+#include <string.h>
+
+#include "nds_sqlite3.h"
+#include "../utils/nds_int.h"
+#include "nds_pinyin.h"
+
+static const char NDS_PINYIN_MAGIC[8] = { 'N', 'D', 'S', 'P', 'I', 'N', 'Y', '1' };
+
+/** Size of the magic, the character count and the syllable count. */
+static const size_t NDS_PINYIN_HEADER_SIZE = 16;
+
+/** Number of bits of an entry holding the character, the syllable index takes the rest. */
+static const unsigned NDS_PINYIN_CHARACTER_BITS = 21;
+
+static nds_uint32 NdsPinyin_readUint32(const unsigned char* p)
+{
+    return (nds_uint32)p[0] | ((nds_uint32)p[1] << 8) | ((nds_uint32)p[2] << 16) |
+            ((nds_uint32)p[3] << 24);
+}
+
+static nds_uint32 NdsPinyin_entry(NdsPinyin const* self, unsigned idx)
+{
+    return NdsPinyin_readUint32(self->entries + 4 * (size_t)idx);
+}
+
+static unichar NdsPinyin_character(nds_uint32 entry)
+{
+    return entry & ((1u << NDS_PINYIN_CHARACTER_BITS) - 1);
+}
+
+static nds_uint32 NdsPinyin_syllableOffset(NdsPinyin const* self, unsigned idx)
+{
+    return NdsPinyin_readUint32(self->syllableOffsets + 4 * (size_t)idx);
+}
+
+nds_bool NdsPinyin_init(NdsPinyin* self, const void* data, size_t size)
+{
+    const unsigned char* bytes = (const unsigned char*)data;
+    size_t syllablesSize;
+    unsigned i;
+
+    memset(self, 0, sizeof(*self));
+    if (size < NDS_PINYIN_HEADER_SIZE || memcmp(bytes, NDS_PINYIN_MAGIC, sizeof(NDS_PINYIN_MAGIC)) != 0)
+        return NDS_FALSE;
+
+    self->count = NdsPinyin_readUint32(bytes + 8);
+    self->syllableCount = NdsPinyin_readUint32(bytes + 12);
+    if (self->syllableCount > NDS_PINYIN_MAX_SYLLABLES ||
+            (size - NDS_PINYIN_HEADER_SIZE) / 4 <= (size_t)self->count + self->syllableCount)
+        return NDS_FALSE;
+
+    self->entries = bytes + NDS_PINYIN_HEADER_SIZE;
+    self->syllableOffsets = self->entries + 4 * (size_t)self->count;
+    self->syllables = self->syllableOffsets + 4 * ((size_t)self->syllableCount + 1);
+    syllablesSize = size - (self->syllables - bytes);
+
+    /*
+     * The lookup relies on sorted characters, and the tokenizer on syllables that are not empty
+     * and match themselves as Latin tokens.
+     */
+    if (NdsPinyin_syllableOffset(self, 0) != 0 ||
+            NdsPinyin_syllableOffset(self, self->syllableCount) > syllablesSize)
+        return NDS_FALSE;
+
+    for (i = 0; i < self->syllableCount; i++)
+    {
+        nds_uint32 offset;
+        if (NdsPinyin_syllableOffset(self, i + 1) <= NdsPinyin_syllableOffset(self, i))
+            return NDS_FALSE;
+
+        for (offset = NdsPinyin_syllableOffset(self, i); offset < NdsPinyin_syllableOffset(self, i + 1); offset++)
+        {
+            if (self->syllables[offset] < 'a' || self->syllables[offset] > 'z')
+                return NDS_FALSE;
+        }
+    }
+
+    for (i = 0; i < self->count; i++)
+    {
+        const nds_uint32 entry = NdsPinyin_entry(self, i);
+        if ((entry >> NDS_PINYIN_CHARACTER_BITS) >= self->syllableCount)
+            return NDS_FALSE;
+
+        if (i > 0 && NdsPinyin_character(NdsPinyin_entry(self, i - 1)) >= NdsPinyin_character(entry))
+            return NDS_FALSE;
+    }
+
+    return NDS_TRUE;
+}
+
+int NdsPinyin_load(NdsPinyin* self, const char* path)
+{
+    NdsMappedFile file;
+    int r;
+
+    memset(self, 0, sizeof(*self));
+    r = NdsMappedFile_open(&file, path);
+    if (r != SQLITE_OK)
+        return r;
+
+    if (!NdsPinyin_init(self, file.data, file.size))
+    {
+        NdsMappedFile_close(&file);
+        return SQLITE_CORRUPT;
+    }
+    self->file = file;
+
+    return SQLITE_OK;
+}
+
+void NdsPinyin_unload(NdsPinyin* self)
+{
+    NdsMappedFile_close(&self->file);
+    memset(self, 0, sizeof(*self));
+}
+
+const char* NdsPinyin_lookup(NdsPinyin const* self, unichar c, size_t* len)
+{
+    unsigned lo = 0;
+    unsigned hi = self->count;
+
+    while (lo < hi)
+    {
+        const unsigned mid = lo + (hi - lo) / 2;
+        const nds_uint32 entry = NdsPinyin_entry(self, mid);
+        const unichar character = NdsPinyin_character(entry);
+
+        if (character < c)
+        {
+            lo = mid + 1;
+        }
+        else if (character > c)
+        {
+            hi = mid;
+        }
+        else
+        {
+            const unsigned syllable = entry >> NDS_PINYIN_CHARACTER_BITS;
+            const nds_uint32 offset = NdsPinyin_syllableOffset(self, syllable);
+            *len = NdsPinyin_syllableOffset(self, syllable + 1) - offset;
+            return (const char*)self->syllables + offset;
+        }
+    }
+
+    return NULL;
+}
@@ -0,0 +1,90 @@
+#ifndef NDS_PINYIN_H
+#define NDS_PINYIN_H
+
+#include <stddef.h>
+
+#include "../utils/nds_bool.h"
+#include "../utils/nds_extension_macros.h"
+#include "../utils/unichar.h"
+#include "nds_mapped_file.h"
+
+/**
+ * Maximum number of distinct syllables of a pinyin table.
+ */
+#define NDS_PINYIN_MAX_SYLLABLES 2048
+
+/**
+ * A read-only table of the (most common) pinyin reading of Hanzi characters.
+ *
+ * Like the dictionary, the table file is used in place. All numbers are 32-bit little endian:
+ *
+ *     "NDSPINY1"                       magic, 8 bytes
+ *     count                            number of characters
+ *     syllableCount                    number of distinct syllables
+ *     entries[count]                   the character in the low 21 bits, the index of its
+ *                                      syllable in the high 11 bits; sorted by character
+ *     syllableOffsets[syllableCount+1] offsets of the syllables from the start of the syllable
+ *                                      data; syllable i occupies offsets[i]..offsets[i+1]-1
+ *     syllable data                    the syllables in lowercase ASCII without tones
+ *                                      ("v" stands for "u" with diaeresis), without separators
+ *
+ * Sharing the syllables keeps the table at about four bytes per character.
+ */
+typedef struct
+{
+    /** Number of characters. */
+    unsigned count;
+
+    /** Number of syllables. */
+    unsigned syllableCount;
+
+    /** Start of the entries array. */
+    const unsigned char* entries;
+
+    /** Start of the syllable offsets array. */
+    const unsigned char* syllableOffsets;
+
+    /** Start of the syllable data. */
+    const unsigned char* syllables;
+
+    /** The file loaded by NdsPinyin_load(), if any. */
+    NdsMappedFile file;
+} NdsPinyin;
+
+NDS_EXTENSION_BEGIN_DECLS
+
+/**
+ * Initialize a pinyin table over a buffer holding the contents of a table file.
+ *
+ * The buffer is not copied and must outlive the table.
+ *
+ * \return True if the buffer holds a valid table.
+ */
+nds_bool NdsPinyin_init(NdsPinyin* self, const void* data, size_t size);
+
+/**
+ * Load a pinyin table file.
+ *
+ * \return SQLITE_OK when operation succeeded, an error code otherwise.
+ */
+int NdsPinyin_load(NdsPinyin* self, const char* path);
+
+/**
+ * Release a table loaded by NdsPinyin_load().
+ */
+void NdsPinyin_unload(NdsPinyin* self);
+
+/**
+ * Look up the pinyin syllable of a character.
+ *
+ * \param[in]  self  Pointer to the instance.
+ * \param[in]  c     The character.
+ * \param[out] len   Receives the length of the syllable in bytes.
+ *
+ * \return The syllable (not nul-terminated), NULL if the table has no reading for the character.
+ */
+const char* NdsPinyin_lookup(NdsPinyin const* self, unichar c, size_t* len);
+
+NDS_EXTENSION_END_DECLS
+
+#endif /* NDS_PINYIN_H */
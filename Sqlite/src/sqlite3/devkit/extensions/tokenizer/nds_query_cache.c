@@ -0,0 +1,175 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "nds_query_cache.h"
+
+int NdsQueryCache_init(NdsQueryCache* self, unsigned capacity)
+{
+    unsigned buckets = 1;
+    unsigned seen = NDS_QUERY_CACHE_MIN_SEEN;
+
+    memset(self, 0, sizeof(*self));
+    if (capacity == 0 || capacity > NDS_QUERY_CACHE_MAX_ENTRIES)
+        return SQLITE_ERROR;
+
+    /* at most one entry per bucket on average */
+    while (buckets < capacity)
+        buckets *= 2;
+
+    /* a few times more texts seen once than cached, so that a page of snippets doesn't flush them */
+    while (seen < 4 * buckets)
+        seen *= 2;
+
+    self->buckets = (NdsQueryCacheEntry**)calloc(buckets, sizeof(NdsQueryCacheEntry*));
+    self->seen = (nds_uint32*)calloc(seen, sizeof(nds_uint32));
+    if (self->buckets == NULL || self->seen == NULL)
+    {
+        free(self->buckets);
+        free(self->seen);
+        memset(self, 0, sizeof(*self));
+        return SQLITE_NOMEM;
+    }
+    self->bucketMask = buckets - 1;
+    self->seenMask = seen - 1;
+    self->capacity = capacity;
+
+    return SQLITE_OK;
+}
+
+void NdsQueryCache_destroy(NdsQueryCache* self)
+{
+    while (self->newest != NULL)
+    {
+        NdsQueryCacheEntry* entry = self->newest;
+        self->newest = entry->older;
+        free(entry);
+    }
+    free(self->buckets);
+    free(self->seen);
+    memset(self, 0, sizeof(*self));
+}
+
+NdsQueryCacheToken const* NdsQueryCache_tokens(const NdsQueryCacheEntry* entry)
+{
+    return (NdsQueryCacheToken const*)(entry + 1);
+}
+
+static const char* NdsQueryCache_key(const NdsQueryCacheEntry* entry)
+{
+    return (const char*)(NdsQueryCache_tokens(entry) + entry->tokenCount);
+}
+
+const char* NdsQueryCache_data(const NdsQueryCacheEntry* entry)
+{
+    return NdsQueryCache_key(entry) + entry->keyLen;
+}
+
+static void NdsQueryCache_unlink(NdsQueryCache* self, NdsQueryCacheEntry* entry)
+{
+    if (entry->newer != NULL)
+        entry->newer->older = entry->older;
+    else
+        self->newest = entry->older;
+    if (entry->older != NULL)
+        entry->older->newer = entry->newer;
+    else
+        self->oldest = entry->newer;
+}
+
+static void NdsQueryCache_pushNewest(NdsQueryCache* self, NdsQueryCacheEntry* entry)
+{
+    entry->newer = NULL;
+    entry->older = self->newest;
+    if (self->newest != NULL)
+        self->newest->newer = entry;
+    else
+        self->oldest = entry;
+    self->newest = entry;
+}
+
+const NdsQueryCacheEntry* NdsQueryCache_find(NdsQueryCache* self, const char* key, size_t keyLen,
+        nds_uint32 hash)
+{
+    NdsQueryCacheEntry* entry;
+
+    for (entry = self->buckets[hash & self->bucketMask]; entry != NULL; entry = entry->nextInBucket)
+    {
+        if (entry->hash == hash && (size_t)entry->keyLen == keyLen &&
+                memcmp(NdsQueryCache_key(entry), key, keyLen) == 0)
+        {
+            if (entry != self->newest)
+            {
+                NdsQueryCache_unlink(self, entry);
+                NdsQueryCache_pushNewest(self, entry);
+            }
+            self->hits++;
+            return entry;
+        }
+    }
+
+    return NULL;
+}
+
+nds_bool NdsQueryCache_admit(NdsQueryCache* self, nds_uint32 hash)
+{
+    nds_uint32* slot = &self->seen[hash & self->seenMask];
+
+    if (*slot == hash)
+    {
+        self->misses++;
+        return NDS_TRUE;
+    }
+
+    *slot = hash;
+    return NDS_FALSE;
+}
+
+/**
+ * Remove the least recently used entry.
+ */
+static void NdsQueryCache_evict(NdsQueryCache* self)
+{
+    NdsQueryCacheEntry* victim = self->oldest;
+    NdsQueryCacheEntry** p = &self->buckets[victim->hash & self->bucketMask];
+
+    while (*p != victim)
+        p = &(*p)->nextInBucket;
+    *p = victim->nextInBucket;
+
+    NdsQueryCache_unlink(self, victim);
+    free(victim);
+    self->count--;
+}
+
+void NdsQueryCache_insert(NdsQueryCache* self, const char* key, size_t keyLen, nds_uint32 hash,
+        NdsQueryCacheToken const* tokens, int tokenCount, const char* data, int dataSize)
+{
+    NdsQueryCacheEntry* entry;
+    NdsQueryCacheEntry** bucket;
+
+    if (keyLen > NDS_QUERY_CACHE_MAX_KEY)
+        return;
+
+    if (self->count == self->capacity)
+        NdsQueryCache_evict(self);
+
+    entry = (NdsQueryCacheEntry*)malloc(sizeof(NdsQueryCacheEntry) +
+            (size_t)tokenCount * sizeof(NdsQueryCacheToken) + keyLen + (size_t)dataSize);
+    if (entry == NULL)
+        return;
+
+    entry->hash = hash;
+    entry->keyLen = (int)keyLen;
+    entry->tokenCount = tokenCount;
+    entry->dataSize = dataSize;
+    if (tokenCount > 0)
+        memcpy((void*)NdsQueryCache_tokens(entry), tokens, (size_t)tokenCount * sizeof(NdsQueryCacheToken));
+    memcpy((void*)NdsQueryCache_key(entry), key, keyLen);
+    memcpy((void*)NdsQueryCache_data(entry), data, (size_t)dataSize);
+
+    bucket = &self->buckets[hash & self->bucketMask];
+    entry->nextInBucket = *bucket;
+    *bucket = entry;
+    NdsQueryCache_pushNewest(self, entry);
+    self->count++;
+}
@@ -0,0 +1,143 @@
+#ifndef NDS_QUERY_CACHE_H
+#define NDS_QUERY_CACHE_H
+
+#include <stddef.h>
+
+#include "nds_sqlite3.h"
+#include "../utils/nds_bool.h"
+#include "../utils/nds_extension_macros.h"
+#include "../utils/nds_int.h"
+
+/**
+ * Maximum length (in bytes) of a text stored in the cache. MATCH expressions are short, longer
+ * texts (documents tokenized for snippets) are not cached.
+ */
+#define NDS_QUERY_CACHE_MAX_KEY 256
+
+/**
+ * Maximum number of entries of a cache.
+ */
+#define NDS_QUERY_CACHE_MAX_ENTRIES (1 << 16)
+
+/**
+ * Minimum number of slots remembering the texts seen once, see NdsQueryCache_admit().
+ */
+#define NDS_QUERY_CACHE_MIN_SEEN 1024
+
+/**
+ * A token of a cached text, as returned by the xNext() method of the tokenizer.
+ */
+typedef struct
+{
+    /** Offset of the bytes of the token in the token data. */
+    int dataOffset;
+
+    int nBytes;
+    int startOffset;
+    int endOffset;
+    int position;
+} NdsQueryCacheToken;
+
+/**
+ * An entry of the cache, allocated in one block holding the tokens, then the key, then the
+ * bytes of the tokens.
+ */
+typedef struct NdsQueryCacheEntry
+{
+    /** Next entry of the same hash bucket. */
+    struct NdsQueryCacheEntry* nextInBucket;
+
+    /** Neighbours in the list of entries, from the most to the least recently used. */
+    struct NdsQueryCacheEntry* newer;
+    struct NdsQueryCacheEntry* older;
+
+    nds_uint32 hash;
+    int keyLen;
+    int tokenCount;
+    int dataSize;
+} NdsQueryCacheEntry;
+
+/**
+ * A cache of the token lists of recently tokenized texts, keyed by their raw bytes.
+ *
+ * A text is only inserted the second time it misses: the hashes of the texts seen once are kept
+ * in a direct-mapped table, so that texts tokenized only once (the documents FTS tokenizes with
+ * their length for snippet() and offsets()) don't evict the MATCH expressions. When the cache is
+ * full, inserting a text evicts the least recently used one.
+ */
+typedef struct
+{
+    /** Hash buckets, NULL when the cache is disabled. */
+    NdsQueryCacheEntry** buckets;
+
+    /** Number of buckets minus one (the number of buckets is a power of two). */
+    unsigned bucketMask;
+
+    /** Most and least recently used entries. */
+    NdsQueryCacheEntry* newest;
+    NdsQueryCacheEntry* oldest;
+
+    /** Maximum and current number of entries. */
+    unsigned capacity;
+    unsigned count;
+
+    /** Hashes of the texts seen once, indexed by hash, and the number of slots minus one. */
+    nds_uint32* seen;
+    unsigned seenMask;
+
+    /** Number of successful lookups, and of failed lookups of texts seen before. */
+    sqlite3_uint64 hits;
+    sqlite3_uint64 misses;
+} NdsQueryCache;
+
+NDS_EXTENSION_BEGIN_DECLS
+
+/**
+ * Create a cache of the given number of entries.
+ *
+ * \return SQLITE_OK when operation succeeded, an error code otherwise.
+ */
+int NdsQueryCache_init(NdsQueryCache* self, unsigned capacity);
+
+/**
+ * Release the entries of a cache.
+ */
+void NdsQueryCache_destroy(NdsQueryCache* self);
+
+/**
+ * Look up a text, counting a hit. A hit becomes the most recently used entry.
+ *
+ * \return The entry, valid until the next insertion, or NULL if the text is not cached.
+ */
+const NdsQueryCacheEntry* NdsQueryCache_find(NdsQueryCache* self, const char* key, size_t keyLen,
+        nds_uint32 hash);
+
+/**
+ * Decide whether a text that is not in the cache is to be inserted, which is the case if it has
+ * been seen before; the lookup then counts as a miss. Otherwise the text is remembered as seen,
+ * without counting the lookup.
+ *
+ * \return True if the text is to be inserted.
+ */
+nds_bool NdsQueryCache_admit(NdsQueryCache* self, nds_uint32 hash);
+
+/**
+ * Store the tokens of a text that is not in the cache. Texts longer than NDS_QUERY_CACHE_MAX_KEY
+ * are ignored, and so are allocation failures.
+ */
+void NdsQueryCache_insert(NdsQueryCache* self, const char* key, size_t keyLen, nds_uint32 hash,
+        NdsQueryCacheToken const* tokens, int tokenCount, const char* data, int dataSize);
+
+/**
+ * The tokens of an entry.
+ */
+NdsQueryCacheToken const* NdsQueryCache_tokens(const NdsQueryCacheEntry* entry);
+
+/**
+ * The bytes of the tokens of an entry.
+ */
+const char* NdsQueryCache_data(const NdsQueryCacheEntry* entry);
+
+NDS_EXTENSION_END_DECLS
+
+#endif /* NDS_QUERY_CACHE_H */
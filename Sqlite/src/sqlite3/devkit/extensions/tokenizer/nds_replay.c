@@ -0,0 +1,868 @@
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <pthread.h>
+#endif
+
+#include "../utils/nds_bool.h"
+#include "../utils/nds_extension_macros.h"
+#include "nds_unicode61.h"
+#include "nds_replay.h"
+
+/*
+ * The ndsreplay tokenizer returns the tokens of ndsunicode61, precomputed by the worker threads of
+ * an nds_replay_builder when a row has been submitted to it, and computed on the spot otherwise.
+ *
+ * The tokenizer interface of FTS doesn't pass the docid and the column of the text to xOpen(), so
+ * the submitted texts are matched in submission order: FTS tokenizes the columns of a row in
+ * order, so as long as the rows are inserted in the order they were submitted in, the next text
+ * to tokenize is the oldest one not returned yet. The text is compared before its tokens are
+ * replayed, so a text that doesn't match is simply tokenized by the calling thread. The docid
+ * only tells which streams belong to the same row.
+ */
+
+#ifdef _WIN32
+    typedef CRITICAL_SECTION NdsReplayMutex;
+    typedef CONDITION_VARIABLE NdsReplayCondition;
+    typedef HANDLE NdsReplayThread;
+#else
+    typedef pthread_mutex_t NdsReplayMutex;
+    typedef pthread_cond_t NdsReplayCondition;
+    typedef pthread_t NdsReplayThread;
+#endif
+
+/**
+ * Name of the option of the ndsreplay tokenizer naming the builder to replay.
+ */
+static const char NDS_REPLAY_OPTION[] = "replay=";
+
+/**
+ * Initial capacity of the token arrays of a stream, per byte of text (the minimum is added).
+ */
+static const int NDS_REPLAY_TOKENS_PER_BYTE_DIVISOR = 4;
+static const int NDS_REPLAY_MIN_TOKEN_CAPACITY = 16;
+
+typedef enum
+{
+    /** Waiting for a worker. */
+    Queued,
+
+    /** Being tokenized by a worker. */
+    Running,
+
+    /** Tokenized, the batch holds the tokens unless result is an error. */
+    Done
+} NdsReplayStreamState;
+
+/**
+ * A submitted text and, once it has been tokenized, its tokens.
+ */
+typedef struct NdsReplayStream
+{
+    /** Next stream in submission order. */
+    struct NdsReplayStream* next;
+
+    /** Row of the text, as submitted. */
+    sqlite3_int64 docid;
+
+    /** Copy of the text. */
+    char* text;
+    int textLen;
+
+    NdsReplayStreamState state;
+
+    /** Result of nds_tokenize_batch() when done. */
+    int result;
+
+    /** The tokens, the per-token arrays share one allocation starting at token_data_offset. */
+    nds_token_batch batch;
+} NdsReplayStream;
+
+struct tagNdsReplayBuilder
+{
+    /** Name given to nds_replay_builder_create(). */
+    char* name;
+
+    /** Copy of the ndsunicode61 options. */
+    int argc;
+    char** argv;
+
+    /** Protects everything below, except the fields that are constant once created. */
+    NdsReplayMutex mutex;
+
+    /** Signalled when a stream is submitted, or when stopping. */
+    NdsReplayCondition workAvailable;
+
+    /** Signalled when a stream is done. */
+    NdsReplayCondition streamDone;
+
+    /** Streams not returned yet, in submission order. */
+    NdsReplayStream* head;
+    NdsReplayStream* tail;
+
+    /** Oldest queued stream. Streams before it are running or done. */
+    NdsReplayStream* nextToRun;
+
+    /** Set to stop the workers. */
+    nds_bool stopping;
+
+    /** The workers. */
+    NdsReplayThread* threads;
+    int threadCount;
+
+    /** Counters reported by nds_replay_get_stats(). */
+    nds_replay_stats stats;
+
+    /**
+     * Number of references: one from the registry until nds_replay_builder_destroy(), and one
+     * from each ndsreplay tokenizer using the builder. Protected by the registry mutex.
+     */
+    unsigned refCount;
+
+    /** Next builder in the registry. */
+    nds_replay_builder* nextRegistered;
+};
+
+/**
+ * State of the ndsreplay tokenizer.
+ */
+typedef struct
+{
+    sqlite3_tokenizer base; /* this needs to come first */
+
+    /** The ndsunicode61 tokenizer for texts not submitted to the builder. */
+    sqlite3_tokenizer* live;
+
+    /** The builder to replay, NULL if none is named, or its options differ. */
+    nds_replay_builder* builder;
+} NdsReplay;
+
+/**
+ * State of the ndsreplay tokenizer cursor.
+ */
+typedef struct
+{
+    sqlite3_tokenizer_cursor base;
+
+    /** Cursor of the ndsunicode61 tokenizer when the text is tokenized on the spot. */
+    sqlite3_tokenizer_cursor* live;
+
+    /** The stream replayed otherwise. */
+    NdsReplayStream* stream;
+
+    /** Index of the next token of the stream. */
+    int next;
+} NdsReplayCursor;
+
+/**
+ * Builders registered by nds_replay_builder_create(), protected by SQLITE_MUTEX_STATIC_MASTER.
+ */
+static nds_replay_builder* NdsReplay_registry = NULL;
+
+static void NdsReplay_initMutex(NdsReplayMutex* mutex)
+{
+#ifdef _WIN32
+    InitializeCriticalSection(mutex);
+#else
+    pthread_mutex_init(mutex, NULL);
+#endif
+}
+
+static void NdsReplay_destroyMutex(NdsReplayMutex* mutex)
+{
+#ifdef _WIN32
+    DeleteCriticalSection(mutex);
+#else
+    pthread_mutex_destroy(mutex);
+#endif
+}
+
+static void NdsReplay_lock(NdsReplayMutex* mutex)
+{
+#ifdef _WIN32
+    EnterCriticalSection(mutex);
+#else
+    pthread_mutex_lock(mutex);
+#endif
+}
+
+static void NdsReplay_unlock(NdsReplayMutex* mutex)
+{
+#ifdef _WIN32
+    LeaveCriticalSection(mutex);
+#else
+    pthread_mutex_unlock(mutex);
+#endif
+}
+
+static void NdsReplay_initCondition(NdsReplayCondition* condition)
+{
+#ifdef _WIN32
+    InitializeConditionVariable(condition);
+#else
+    pthread_cond_init(condition, NULL);
+#endif
+}
+
+static void NdsReplay_destroyCondition(NdsReplayCondition* condition)
+{
+#ifdef _WIN32
+    (void)condition;
+#else
+    pthread_cond_destroy(condition);
+#endif
+}
+
+static void NdsReplay_wait(NdsReplayCondition* condition, NdsReplayMutex* mutex)
+{
+#ifdef _WIN32
+    SleepConditionVariableCS(condition, mutex, INFINITE);
+#else
+    pthread_cond_wait(condition, mutex);
+#endif
+}
+
+static void NdsReplay_broadcast(NdsReplayCondition* condition)
+{
+#ifdef _WIN32
+    WakeAllConditionVariable(condition);
+#else
+    pthread_cond_broadcast(condition);
+#endif
+}
+
+static void NdsReplay_freeStream(NdsReplayStream* stream)
+{
+    free(stream->text);
+    free(stream->batch.token_data);
+    free(stream->batch.token_data_offset);
+    free(stream);
+}
+
+/**
+ * (Re)allocate the output arrays of a stream's batch.
+ *
+ * \return True unless allocating failed.
+ */
+static nds_bool NdsReplay_allocBatch(nds_token_batch* batch, int tokenCapacity, int dataCapacity)
+{
+    free(batch->token_data);
+    free(batch->token_data_offset);
+    memset(batch, 0, sizeof(*batch));
+
+    batch->token_data = (char*)malloc((size_t)dataCapacity);
+    batch->token_data_offset = (int*)malloc(5 * sizeof(int) * (size_t)tokenCapacity);
+    if (batch->token_data == NULL || batch->token_data_offset == NULL)
+        return NDS_FALSE;
+
+    batch->token_data_capacity = dataCapacity;
+    batch->token_capacity = tokenCapacity;
+    batch->token_len = batch->token_data_offset + tokenCapacity;
+    batch->start_offset = batch->token_len + tokenCapacity;
+    batch->end_offset = batch->start_offset + tokenCapacity;
+    batch->position = batch->end_offset + tokenCapacity;
+    return NDS_TRUE;
+}
+
+/**
+ * Tokenize the text of a stream, growing its batch until all tokens fit.
+ */
+static void NdsReplay_tokenizeStream(sqlite3_tokenizer* tokenizer, NdsReplayStream* stream)
+{
+    int tokenCapacity = stream->textLen / NDS_REPLAY_TOKENS_PER_BYTE_DIVISOR + NDS_REPLAY_MIN_TOKEN_CAPACITY;
+    int dataCapacity = 2 * stream->textLen + NDS_REPLAY_MIN_TOKEN_CAPACITY;
+    const char* text = stream->text;
+
+    for (;;)
+    {
+        if (!NdsReplay_allocBatch(&stream->batch, tokenCapacity, dataCapacity))
+        {
+            stream->result = SQLITE_NOMEM;
+            return;
+        }
+
+        /* nul-terminated and in document mode, as FTS passes the text when it indexes the row */
+        stream->result = NdsUnicode61_tokenizeBatch(tokenizer, &text, NULL, 1, &stream->batch);
+        if (stream->result != SQLITE_FULL || tokenCapacity > INT_MAX / 10 || dataCapacity > INT_MAX / 2)
+            return;
+
+        tokenCapacity *= 2;
+        dataCapacity *= 2;
+    }
+}
+
+#ifdef _WIN32
+static DWORD WINAPI NdsReplay_worker(void* arg)
+#else
+static void* NdsReplay_worker(void* arg)
+#endif
+{
+    nds_replay_builder* builder = (nds_replay_builder*)arg;
+    sqlite3_tokenizer_module const* module;
+    sqlite3_tokenizer* tokenizer = NULL;
+    int r;
+
+    /* each worker has its own tokenizer, they are not synchronized */
+    sqlite3Fts3NdsUnicodeTokenizer(&module);
+    r = module->xCreate(builder->argc, (char const* const*)builder->argv, &tokenizer);
+
+    NdsReplay_lock(&builder->mutex);
+    while (!builder->stopping)
+    {
+        NdsReplayStream* stream = builder->nextToRun;
+        if (stream == NULL)
+        {
+            NdsReplay_wait(&builder->workAvailable, &builder->mutex);
+            continue;
+        }
+
+        builder->nextToRun = stream->next;
+        stream->state = Running;
+        NdsReplay_unlock(&builder->mutex);
+
+        if (r == SQLITE_OK)
+            NdsReplay_tokenizeStream(tokenizer, stream);
+        else
+            stream->result = r;
+
+        NdsReplay_lock(&builder->mutex);
+        stream->state = Done;
+        NdsReplay_broadcast(&builder->streamDone);
+    }
+    NdsReplay_unlock(&builder->mutex);
+
+    if (tokenizer != NULL)
+        module->xDestroy(tokenizer);
+    return 0;
+}
+
+static nds_bool NdsReplay_startThread(NdsReplayThread* thread, nds_replay_builder* builder)
+{
+#ifdef _WIN32
+    *thread = CreateThread(NULL, 0, NdsReplay_worker, builder, 0, NULL);
+    return *thread != NULL;
+#else
+    return pthread_create(thread, NULL, NdsReplay_worker, builder) == 0;
+#endif
+}
+
+static void NdsReplay_joinThread(NdsReplayThread thread)
+{
+#ifdef _WIN32
+    WaitForSingleObject(thread, INFINITE);
+    CloseHandle(thread);
+#else
+    pthread_join(thread, NULL);
+#endif
+}
+
+/**
+ * Stop the workers and release a builder that's no longer referenced.
+ */
+static void NdsReplay_freeBuilder(nds_replay_builder* builder)
+{
+    int i;
+
+    NdsReplay_lock(&builder->mutex);
+    builder->stopping = NDS_TRUE;
+    NdsReplay_broadcast(&builder->workAvailable);
+    NdsReplay_unlock(&builder->mutex);
+
+    for (i = 0; i < builder->threadCount; i++)
+        NdsReplay_joinThread(builder->threads[i]);
+
+    while (builder->head != NULL)
+    {
+        NdsReplayStream* stream = builder->head;
+        builder->head = stream->next;
+        NdsReplay_freeStream(stream);
+    }
+
+    NdsReplay_destroyCondition(&builder->streamDone);
+    NdsReplay_destroyCondition(&builder->workAvailable);
+    NdsReplay_destroyMutex(&builder->mutex);
+    for (i = 0; i < builder->argc; i++)
+        free(builder->argv[i]);
+    free(builder->argv);
+    free(builder->threads);
+    free(builder->name);
+    free(builder);
+}
+
+static void NdsReplay_releaseBuilder(nds_replay_builder* builder)
+{
+    sqlite3_mutex* registryMutex = sqlite3_mutex_alloc(SQLITE_MUTEX_STATIC_MASTER);
+    unsigned refCount;
+
+    sqlite3_mutex_enter(registryMutex);
+    refCount = --builder->refCount;
+    sqlite3_mutex_leave(registryMutex);
+
+    if (refCount == 0)
+        NdsReplay_freeBuilder(builder);
+}
+
+static char* NdsReplay_copyString(const char* s)
+{
+    const size_t size = strlen(s) + 1;
+    char* copy = (char*)malloc(size);
+    if (copy != NULL)
+        memcpy(copy, s, size);
+    return copy;
+}
+
+int nds_replay_builder_create(const char* name, int argc, char const* const* argv, int thread_count,
+        nds_replay_builder** builder)
+{
+    sqlite3_mutex* registryMutex;
+    nds_replay_builder* self;
+    nds_replay_builder* other;
+    sqlite3_tokenizer_module const* module;
+    sqlite3_tokenizer* tokenizer;
+    int r;
+    int i;
+
+    if (name == NULL || builder == NULL || argc < 0 || (argc > 0 && argv == NULL) || thread_count < 1)
+        return SQLITE_MISUSE;
+    *builder = NULL;
+
+    /* fail early on options ndsunicode61 doesn't accept */
+    sqlite3Fts3NdsUnicodeTokenizer(&module);
+    r = module->xCreate(argc, argv, &tokenizer);
+    if (r != SQLITE_OK)
+        return r;
+    module->xDestroy(tokenizer);
+
+    self = (nds_replay_builder*)calloc(1, sizeof(nds_replay_builder));
+    if (self == NULL)
+        return SQLITE_NOMEM;
+
+    self->name = NdsReplay_copyString(name);
+    self->argv = (char**)calloc((size_t)argc + 1, sizeof(char*));
+    self->threads = (NdsReplayThread*)calloc((size_t)thread_count, sizeof(NdsReplayThread));
+    if (self->name == NULL || self->argv == NULL || self->threads == NULL)
+    {
+        free(self->name);
+        free(self->argv);
+        free(self->threads);
+        free(self);
+        return SQLITE_NOMEM;
+    }
+    for (i = 0; i < argc; i++)
+    {
+        self->argv[i] = NdsReplay_copyString(argv[i]);
+        self->argc += (self->argv[i] != NULL);
+    }
+    self->refCount = 1;
+    NdsReplay_initMutex(&self->mutex);
+    NdsReplay_initCondition(&self->workAvailable);
+    NdsReplay_initCondition(&self->streamDone);
+    if (self->argc != argc)
+    {
+        NdsReplay_freeBuilder(self);
+        return SQLITE_NOMEM;
+    }
+
+    while (self->threadCount < thread_count && NdsReplay_startThread(&self->threads[self->threadCount], self))
+        self->threadCount++;
+    if (self->threadCount == 0)
+    {
+        NdsReplay_freeBuilder(self);
+        return SQLITE_ERROR;
+    }
+
+    registryMutex = sqlite3_mutex_alloc(SQLITE_MUTEX_STATIC_MASTER);
+    sqlite3_mutex_enter(registryMutex);
+    for (other = NdsReplay_registry; other != NULL && strcmp(other->name, name) != 0; other = other->nextRegistered)
+        ;
+    if (other == NULL)
+    {
+        self->nextRegistered = NdsReplay_registry;
+        NdsReplay_registry = self;
+    }
+    sqlite3_mutex_leave(registryMutex);
+
+    if (other != NULL)
+    {
+        /* the name is taken */
+        NdsReplay_freeBuilder(self);
+        return SQLITE_ERROR;
+    }
+
+    *builder = self;
+    return SQLITE_OK;
+}
+
+int nds_replay_submit(nds_replay_builder* builder, sqlite3_int64 docid, const char* text, int len)
+{
+    NdsReplayStream* stream;
+
+    if (builder == NULL || text == NULL)
+        return SQLITE_MISUSE;
+
+    stream = (NdsReplayStream*)calloc(1, sizeof(NdsReplayStream));
+    if (stream == NULL)
+        return SQLITE_NOMEM;
+
+    stream->docid = docid;
+    stream->textLen = (len >= 0) ? len : (int)strlen(text);
+    stream->text = (char*)malloc((size_t)stream->textLen + 1);
+    if (stream->text == NULL)
+    {
+        free(stream);
+        return SQLITE_NOMEM;
+    }
+    memcpy(stream->text, text, (size_t)stream->textLen);
+    stream->text[stream->textLen] = '\0';
+    stream->state = Queued;
+
+    NdsReplay_lock(&builder->mutex);
+    if (builder->tail != NULL)
+        builder->tail->next = stream;
+    else
+        builder->head = stream;
+    builder->tail = stream;
+    if (builder->nextToRun == NULL)
+        builder->nextToRun = stream;
+    NdsReplay_broadcast(&builder->workAvailable);
+    NdsReplay_unlock(&builder->mutex);
+
+    return SQLITE_OK;
+}
+
+int nds_replay_get_stats(nds_replay_builder* builder, nds_replay_stats* stats)
+{
+    if (builder == NULL || stats == NULL)
+        return SQLITE_MISUSE;
+
+    NdsReplay_lock(&builder->mutex);
+    *stats = builder->stats;
+    NdsReplay_unlock(&builder->mutex);
+
+    return SQLITE_OK;
+}
+
+void nds_replay_builder_destroy(nds_replay_builder* builder)
+{
+    sqlite3_mutex* registryMutex;
+    nds_replay_builder** p;
+
+    if (builder == NULL)
+        return;
+
+    registryMutex = sqlite3_mutex_alloc(SQLITE_MUTEX_STATIC_MASTER);
+    sqlite3_mutex_enter(registryMutex);
+    for (p = &NdsReplay_registry; *p != NULL; p = &(*p)->nextRegistered)
+    {
+        if (*p == builder)
+        {
+            *p = builder->nextRegistered;
+            break;
+        }
+    }
+    sqlite3_mutex_leave(registryMutex);
+
+    /* the tokenizers still using the builder keep it alive */
+    NdsReplay_releaseBuilder(builder);
+}
+
+/**
+ * Find the builder named by the options of an ndsreplay tokenizer, and take a reference to it.
+ *
+ * \return The builder, or NULL if it doesn't exist or uses other ndsunicode61 options.
+ */
+static nds_replay_builder* NdsReplay_acquireBuilder(const char* name, int argc, char const* const* argv)
+{
+    sqlite3_mutex* registryMutex = sqlite3_mutex_alloc(SQLITE_MUTEX_STATIC_MASTER);
+    nds_replay_builder* builder;
+    int i;
+
+    sqlite3_mutex_enter(registryMutex);
+    for (builder = NdsReplay_registry; builder != NULL; builder = builder->nextRegistered)
+    {
+        if (strcmp(builder->name, name) == 0)
+            break;
+    }
+    if (builder != NULL && builder->argc == argc)
+    {
+        for (i = 0; i < argc && strcmp(builder->argv[i], argv[i]) == 0; i++)
+            ;
+        if (i == argc)
+            builder->refCount++;
+        else
+            builder = NULL;
+    }
+    else
+    {
+        builder = NULL;
+    }
+    sqlite3_mutex_leave(registryMutex);
+
+    return builder;
+}
+
+/**
+ * Take the stream of a text out of the builder, waiting for it to be tokenized.
+ *
+ * Only the streams of the row of the oldest stream and of the following row are candidates.
+ * Older streams than the one returned are dropped: FTS has moved past them, most likely because
+ * they were submitted for columns that have been inserted as NULL.
+ *
+ * \return The stream, or NULL if the text has not been submitted (or tokenizing it failed).
+ */
+static NdsReplayStream* NdsReplay_takeStream(nds_replay_builder* builder, const char* text, int textLen)
+{
+    NdsReplayStream* stream;
+    NdsReplayStream* dropped;
+    const NdsReplayStream* nextRow = NULL;
+
+    NdsReplay_lock(&builder->mutex);
+    for (stream = builder->head; stream != NULL; stream = stream->next)
+    {
+        if (stream->docid != builder->head->docid && nextRow == NULL)
+            nextRow = stream;
+        else if (nextRow != NULL && stream->docid != nextRow->docid)
+            stream = NULL;
+
+        if (stream == NULL ||
+                (stream->textLen == textLen && memcmp(stream->text, text, (size_t)textLen) == 0))
+            break;
+    }
+
+    if (stream == NULL)
+    {
+        builder->stats.tokenized++;
+        NdsReplay_unlock(&builder->mutex);
+        return NULL;
+    }
+
+    /* unlink the stream and the older ones once they are done */
+    dropped = (builder->head != stream) ? builder->head : NULL;
+    while (builder->head != stream)
+    {
+        NdsReplayStream* older = builder->head;
+        while (older->state != Done)
+            NdsReplay_wait(&builder->streamDone, &builder->mutex);
+        builder->head = older->next;
+        if (builder->head == stream)
+            older->next = NULL;
+        builder->stats.dropped++;
+    }
+    while (stream->state != Done)
+        NdsReplay_wait(&builder->streamDone, &builder->mutex);
+    builder->head = stream->next;
+    if (builder->head == NULL)
+        builder->tail = NULL;
+    stream->next = NULL;
+    if (stream->result == SQLITE_OK)
+        builder->stats.replayed++;
+    else
+        builder->stats.tokenized++;
+    NdsReplay_unlock(&builder->mutex);
+
+    while (dropped != NULL)
+    {
+        NdsReplayStream* next = dropped->next;
+        NdsReplay_freeStream(dropped);
+        dropped = next;
+    }
+
+    if (stream->result != SQLITE_OK)
+    {
+        NdsReplay_freeStream(stream);
+        return NULL;
+    }
+    return stream;
+}
+
+/**
+ * Create an instance of the ndsreplay tokenizer.
+ *
+ * The options are those of ndsunicode61, and replay=NAME naming the builder whose streams are
+ * replayed. The builder must have been created with the same ndsunicode61 options (in the same
+ * order), otherwise it's not used.
+ */
+static int NdsReplay_create(int argc, char const* const* argv, sqlite3_tokenizer** ppTokenizer)
+{
+    sqlite3_tokenizer_module const* module;
+    NdsReplay* self;
+    char const** options;
+    const char* name = NULL;
+    int optionCount = 0;
+    int r;
+    int i;
+
+    options = (char const**)malloc(sizeof(char*) * ((size_t)argc + 1));
+    if (options == NULL)
+        return SQLITE_NOMEM;
+    for (i = 0; i < argc; i++)
+    {
+        if (strncmp(argv[i], NDS_REPLAY_OPTION, ARRAY_SIZE(NDS_REPLAY_OPTION) - 1) == 0)
+            name = argv[i] + ARRAY_SIZE(NDS_REPLAY_OPTION) - 1;
+        else
+            options[optionCount++] = argv[i];
+    }
+
+    self = (NdsReplay*)calloc(1, sizeof(NdsReplay));
+    if (self == NULL)
+    {
+        free(options);
+        return SQLITE_NOMEM;
+    }
+
+    sqlite3Fts3NdsUnicodeTokenizer(&module);
+    r = module->xCreate(optionCount, options, &self->live);
+    if (r == SQLITE_OK)
+    {
+        self->live->pModule = module;
+        if (name != NULL)
+            self->builder = NdsReplay_acquireBuilder(name, optionCount, options);
+        *ppTokenizer = &self->base;
+    }
+    else
+    {
+        free(self);
+    }
+    free(options);
+
+    return r;
+}
+
+static int NdsReplay_destroy(sqlite3_tokenizer* pTokenizer)
+{
+    NdsReplay* self = (NdsReplay*)pTokenizer;
+
+    if (self == NULL)
+        return SQLITE_ERROR;
+
+    if (self->builder != NULL)
+        NdsReplay_releaseBuilder(self->builder);
+    self->live->pModule->xDestroy(self->live);
+    free(self);
+
+    return SQLITE_OK;
+}
+
+/**
+ * Create an instance of the ndsreplay tokenizer cursor.
+ *
+ * Only documents (nBytes < 0, see NdsUnicode61_open()) are looked up in the builder.
+ */
+static int NdsReplay_open(sqlite3_tokenizer* pTokenizer, const char* pInput, int nBytes,
+        sqlite3_tokenizer_cursor** ppCursor)
+{
+    NdsReplay* self = (NdsReplay*)pTokenizer;
+    NdsReplayCursor* cursor;
+
+    if (self == NULL)
+        return SQLITE_ERROR;
+
+    cursor = (NdsReplayCursor*)calloc(1, sizeof(NdsReplayCursor));
+    if (cursor == NULL)
+        return SQLITE_NOMEM;
+
+    if (self->builder != NULL && nBytes < 0)
+        cursor->stream = NdsReplay_takeStream(self->builder, pInput, (int)strlen(pInput));
+
+    if (cursor->stream == NULL)
+    {
+        const int r = self->live->pModule->xOpen(self->live, pInput, nBytes, &cursor->live);
+        if (r != SQLITE_OK)
+        {
+            free(cursor);
+            return r;
+        }
+        cursor->live->pTokenizer = self->live;
+    }
+
+    *ppCursor = &cursor->base;
+    return SQLITE_OK;
+}
+
+static int NdsReplay_close(sqlite3_tokenizer_cursor* pCursor)
+{
+    NdsReplayCursor* cursor = (NdsReplayCursor*)pCursor;
+
+    if (cursor == NULL)
+        return SQLITE_ERROR;
+
+    if (cursor->live != NULL)
+        cursor->live->pTokenizer->pModule->xClose(cursor->live);
+    if (cursor->stream != NULL)
+        NdsReplay_freeStream(cursor->stream);
+    free(cursor);
+
+    return SQLITE_OK;
+}
+
+static int NdsReplay_next(sqlite3_tokenizer_cursor* pCursor, const char** ppToken, int* pnBytes,
+        int* piStartOffset, int* piEndOffset, int* piPosition)
+{
+    NdsReplayCursor* cursor = (NdsReplayCursor*)pCursor;
+    const nds_token_batch* batch;
+    int i;
+
+    if (cursor == NULL)
+        return SQLITE_ERROR;
+
+    if (cursor->live != NULL)
+    {
+        return cursor->live->pTokenizer->pModule->xNext(cursor->live, ppToken, pnBytes, piStartOffset,
+                piEndOffset, piPosition);
+    }
+
+    batch = &cursor->stream->batch;
+    if (cursor->next >= batch->token_count)
+        return SQLITE_DONE;
+
+    i = cursor->next++;
+    *ppToken = batch->token_data + batch->token_data_offset[i];
+    *pnBytes = batch->token_len[i];
+    *piStartOffset = batch->start_offset[i];
+    *piEndOffset = batch->end_offset[i];
+    *piPosition = batch->position[i];
+
+    return SQLITE_OK;
+}
+
+/**
+ * Description of the ndsreplay tokenizer.
+ */
+static const sqlite3_tokenizer_module NDS_REPLAY =
+{
+        0,                      /* version */
+        NdsReplay_create,       /* xCreate */
+        NdsReplay_destroy,      /* xDestroy */
+        NdsReplay_open,         /* xOpen */
+        NdsReplay_close,        /* xClose */
+        NdsReplay_next,         /* xNext */
+        0                       /* xLanguageid (not supported for modules version 0) */
+};
+
+void sqlite3Fts3NdsReplayTokenizer(sqlite3_tokenizer_module const** ndsreplay)
+{
+    *ndsreplay = &NDS_REPLAY;
+}
+
+int nds_replay_register(sqlite3* db)
+{
+    const sqlite3_tokenizer_module* module = &NDS_REPLAY;
+    sqlite3_stmt* stmt;
+    int r;
+
+    if (db == NULL)
+        return SQLITE_MISUSE;
+
+    r = sqlite3_prepare_v2(db, "SELECT fts3_tokenizer('ndsreplay', ?)", -1, &stmt, NULL);
+    if (r != SQLITE_OK)
+        return r;
+
+    sqlite3_bind_blob(stmt, 1, &module, sizeof(module), SQLITE_STATIC);
+    sqlite3_step(stmt);
+
+    return sqlite3_finalize(stmt);
+}
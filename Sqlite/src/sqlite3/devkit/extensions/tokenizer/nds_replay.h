@@ -0,0 +1,17 @@
+#ifndef NDS_REPLAY_H
+#define NDS_REPLAY_H
+
+#include "nds_sqlite3.h"
+#include "../utils/nds_extension_macros.h"
+#include "../nds_extensions.h"
+
+NDS_EXTENSION_BEGIN_DECLS
+
+/**
+ * Get a pointer to the ndsreplay tokenizer module.
+ */
+void sqlite3Fts3NdsReplayTokenizer(sqlite3_tokenizer_module const** ndsreplay);
+
+NDS_EXTENSION_END_DECLS
+
+#endif /* NDS_REPLAY_H */
@@ -0,0 +1,119 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "nds_token_cache.h"
+
+int NdsTokenCache_init(NdsTokenCache* self, unsigned capacity)
+{
+    unsigned sets = 1;
+
+    memset(self, 0, sizeof(*self));
+    if (capacity == 0 || capacity > NDS_TOKEN_CACHE_MAX_ENTRIES)
+        return SQLITE_ERROR;
+
+    while (sets * NDS_TOKEN_CACHE_WAYS < capacity)
+        sets *= 2;
+
+    self->entries = (NdsTokenCacheEntry*)calloc((size_t)sets * NDS_TOKEN_CACHE_WAYS, sizeof(NdsTokenCacheEntry));
+    if (self->entries == NULL)
+        return SQLITE_NOMEM;
+    self->setMask = sets - 1;
+
+    return SQLITE_OK;
+}
+
+void NdsTokenCache_destroy(NdsTokenCache* self)
+{
+    free(self->entries);
+    memset(self, 0, sizeof(*self));
+}
+
+unsigned NdsTokenCache_capacity(NdsTokenCache const* self)
+{
+    return (self->entries != NULL) ? (self->setMask + 1) * NDS_TOKEN_CACHE_WAYS : 0;
+}
+
+nds_uint32 NdsTokenCache_hash(const char* key, size_t keyLen)
+{
+    /* FNV-1a */
+    nds_uint32 hash = 2166136261u;
+    size_t i;
+
+    for (i = 0; i < keyLen; i++)
+    {
+        hash ^= (unsigned char)key[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static NdsTokenCacheEntry* NdsTokenCache_set(NdsTokenCache* self, nds_uint32 hash)
+{
+    /* the lowest bits of the hash only depend on the lowest bits of the bytes */
+    return self->entries + (size_t)((hash >> 8) & self->setMask) * NDS_TOKEN_CACHE_WAYS;
+}
+
+nds_bool NdsTokenCache_find(NdsTokenCache* self, const char* key, size_t keyLen, nds_uint32 hash,
+        const char** value, size_t* valueLen)
+{
+    NdsTokenCacheEntry* set = NdsTokenCache_set(self, hash);
+    unsigned i;
+
+    for (i = 0; i < NDS_TOKEN_CACHE_WAYS; i++)
+    {
+        NdsTokenCacheEntry* entry = &set[i];
+        if (entry->keyLen == keyLen && entry->hash == hash && memcmp(entry->key, key, keyLen) == 0)
+        {
+            if (entry->uses < 0xffff)
+                entry->uses++;
+            *value = entry->value;
+            *valueLen = entry->valueLen;
+            self->hits++;
+            return NDS_TRUE;
+        }
+    }
+
+    self->misses++;
+    return NDS_FALSE;
+}
+
+void NdsTokenCache_insert(NdsTokenCache* self, const char* key, size_t keyLen, nds_uint32 hash,
+        const char* value, size_t valueLen)
+{
+    NdsTokenCacheEntry* set = NdsTokenCache_set(self, hash);
+    NdsTokenCacheEntry* victim = NULL;
+    unsigned i;
+
+    if (keyLen == 0 || keyLen > NDS_TOKEN_CACHE_MAX_KEY || valueLen > NDS_TOKEN_CACHE_MAX_VALUE)
+        return;
+
+    for (i = 0; i < NDS_TOKEN_CACHE_WAYS && victim == NULL; i++)
+    {
+        if (set[i].keyLen == 0)
+            victim = &set[i];
+    }
+
+    if (victim == NULL)
+    {
+        /* replace the least used entry, and age the others so that they can be replaced later */
+        victim = &set[0];
+        for (i = 1; i < NDS_TOKEN_CACHE_WAYS; i++)
+        {
+            if (set[i].uses < victim->uses)
+                victim = &set[i];
+        }
+        for (i = 0; i < NDS_TOKEN_CACHE_WAYS; i++)
+            set[i].uses /= 2;
+    }
+    else
+    {
+        self->count++;
+    }
+
+    victim->hash = hash;
+    victim->uses = 0;
+    victim->keyLen = (unsigned char)keyLen;
+    victim->valueLen = (unsigned char)valueLen;
+    memcpy(victim->key, key, keyLen);
+    memcpy(victim->value, value, valueLen);
+}
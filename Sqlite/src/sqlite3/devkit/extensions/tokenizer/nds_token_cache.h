@@ -0,0 +1,115 @@
+#ifndef NDS_TOKEN_CACHE_H
+#define NDS_TOKEN_CACHE_H
+
+#include <stddef.h>
+
+#include "nds_sqlite3.h"
+#include "../utils/nds_bool.h"
+#include "../utils/nds_extension_macros.h"
+#include "../utils/nds_int.h"
+
+/**
+ * Maximum length (in bytes) of a key and of a value stored in the cache. Longer tokens are rare
+ * in the data the cache is meant for, and are not cached.
+ */
+#define NDS_TOKEN_CACHE_MAX_KEY 31
+#define NDS_TOKEN_CACHE_MAX_VALUE 48
+
+/**
+ * Number of entries a key may be stored in.
+ */
+#define NDS_TOKEN_CACHE_WAYS 4
+
+/**
+ * Maximum number of entries of a cache.
+ */
+#define NDS_TOKEN_CACHE_MAX_ENTRIES (1 << 20)
+
+/**
+ * An entry of the cache, holding the key and the value inline.
+ */
+typedef struct
+{
+    /** Hash of the key. */
+    nds_uint32 hash;
+
+    /** Number of hits, halved when another entry of the set is replaced. */
+    unsigned short uses;
+
+    /** Length of the key, zero for an unused entry. */
+    unsigned char keyLen;
+
+    /** Length of the value. */
+    unsigned char valueLen;
+
+    char key[NDS_TOKEN_CACHE_MAX_KEY];
+    char value[NDS_TOKEN_CACHE_MAX_VALUE];
+} NdsTokenCacheEntry;
+
+/**
+ * A fixed-size cache of the normalized forms of tokens, keyed by their raw bytes.
+ *
+ * The cache is set associative: a key is stored in one of the NDS_TOKEN_CACHE_WAYS entries of the
+ * set selected by its hash, replacing the least used entry of the set when all of them are taken.
+ * Nothing is allocated once the cache has been created.
+ */
+typedef struct
+{
+    /** The entries, NDS_TOKEN_CACHE_WAYS per set; NULL when the cache is disabled. */
+    NdsTokenCacheEntry* entries;
+
+    /** Number of sets minus one (the number of sets is a power of two). */
+    unsigned setMask;
+
+    /** Number of used entries. */
+    unsigned count;
+
+    /** Number of successful and failed lookups. */
+    sqlite3_uint64 hits;
+    sqlite3_uint64 misses;
+} NdsTokenCache;
+
+NDS_EXTENSION_BEGIN_DECLS
+
+/**
+ * Create a cache of at least the given number of entries.
+ *
+ * \return SQLITE_OK when operation succeeded, an error code otherwise.
+ */
+int NdsTokenCache_init(NdsTokenCache* self, unsigned capacity);
+
+/**
+ * Release the entries of a cache.
+ */
+void NdsTokenCache_destroy(NdsTokenCache* self);
+
+/**
+ * Number of entries of the cache.
+ */
+unsigned NdsTokenCache_capacity(NdsTokenCache const* self);
+
+/**
+ * Hash a key.
+ */
+nds_uint32 NdsTokenCache_hash(const char* key, size_t keyLen);
+
+/**
+ * Look up a key, counting the lookup as a hit or a miss.
+ *
+ * \param[out] value    Receives the stored value on success; it's valid until the next insertion.
+ * \param[out] valueLen Receives the length of the value on success.
+ *
+ * \return True if the key has been found.
+ */
+nds_bool NdsTokenCache_find(NdsTokenCache* self, const char* key, size_t keyLen, nds_uint32 hash,
+        const char** value, size_t* valueLen);
+
+/**
+ * Store a value for a key that is not in the cache. Keys or values that are too long are ignored.
+ */
+void NdsTokenCache_insert(NdsTokenCache* self, const char* key, size_t keyLen, nds_uint32 hash,
+        const char* value, size_t valueLen);
+
+NDS_EXTENSION_END_DECLS
+
+#endif /* NDS_TOKEN_CACHE_H */
@@ -0,0 +1,18 @@
+#include "../nds_extensions.h"
+#include "nds_unicode61.h"
+
+int nds_tokenize_batch(sqlite3_tokenizer* tokenizer, char const* const* inputs,
+                       int const* input_lens, int input_count, nds_token_batch* batch)
+{
+    return NdsUnicode61_tokenizeBatch(tokenizer, inputs, input_lens, input_count, batch);
+}
+
+int nds_tokenizer_cache_stats(sqlite3_tokenizer* tokenizer, nds_token_cache_stats* stats)
+{
+    return NdsUnicode61_getCacheStats(tokenizer, stats);
+}
+
+int nds_tokenizer_query_cache_stats(sqlite3_tokenizer* tokenizer, nds_token_cache_stats* stats)
+{
+    return NdsUnicode61_getQueryCacheStats(tokenizer, stats);
+}
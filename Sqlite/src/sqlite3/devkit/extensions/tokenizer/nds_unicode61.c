@@ -7,7 +7,12 @@
 #include "../utils/unichar.h"
 #include "../utils/unichar_utils.h"
 #include "../utils/utf8_utils.h"
+#include "nds_dictionary.h"
+#include "nds_pinyin.h"
+#include "nds_query_cache.h"
+#include "nds_token_cache.h"
 #include "nds_unicode61.h"
+#include "nds_unicode61_class_data.h"
 #include "string_buffer.h"
 
 /**
@@ -19,19 +24,156 @@
 static const nds_bool NDSUNICODE61_REMOVE_DIACRITICS_DEFAULT = NDS_TRUE;
 
 /**
- * Structure holding the state of the NDS unicode61 tokenizer.
+ * Maximum number of closed cursors kept by a tokenizer for reuse.
+ */
+static const unsigned NDSUNICODE61_CURSOR_POOL_SIZE = 4;
+
+/**
+ * Token buffers of pooled cursors that grew beyond this size are released.
+ */
+static const size_t NDSUNICODE61_POOLED_TOKEN_CAPACITY_MAX = 4096;
+
+/**
+ * First byte of the edge n-gram terms (edge_ngrams option).
+ *
+ * It's a separator for any sane configuration, so the n-gram terms can't collide with the
+ * terms of regular tokens.
+ */
+static const char NDSUNICODE61_EDGE_NGRAM_MARKER = '\x01';
+
+/**
+ * Flags of NdsUnicode61Cursor::pendingUnigrams.
+ */
+static const unsigned NDSUNICODE61_FIRST_UNIGRAM = 0x1;
+static const unsigned NDSUNICODE61_SECOND_UNIGRAM = 0x2;
+
+/**
+ * Scripts that can be segmented with a dictionary, see the segment option.
+ */
+static const unsigned NDSUNICODE61_SCRIPT_THAI = 0x1;
+static const unsigned NDSUNICODE61_SCRIPT_LAO = 0x2;
+static const unsigned NDSUNICODE61_SCRIPT_KHMER = 0x4;
+
+/**
+ * Characters that may separate the digit groups of a phone number, see the phone_numbers option.
+ */
+static const char NDSUNICODE61_PHONE_SEPARATORS[] = " -/.()";
+
+/**
+ * Range of the precomposed Hangul syllables, see the hangul_choseong option.
+ */
+static const unichar NDSUNICODE61_HANGUL_FIRST = 0xac00;
+static const unichar NDSUNICODE61_HANGUL_LAST = 0xd7a3;
+
+/**
+ * Mixed into the query cache hash of a text tokenized in term mode, see NdsUnicode61_startReplay().
+ */
+static const nds_uint32 NDSUNICODE61_TERM_MODE_HASH = 0x9e3779b9u;
+
+/**
+ * Maximum length (in bytes) of the substitution_prefix option.
+ */
+#define NDSUNICODE61_SUBSTITUTION_PREFIX_MAX 16
+
+struct NdsUnicode61;
+struct NdsUnicode61Cursor;
+
+/**
+ * The tokenizer used for the texts of an FTS4 language id, see the language option.
  */
 typedef struct
+{
+    int languageId;
+    struct NdsUnicode61* tokenizer;
+} NdsUnicode61Language;
+
+/**
+ * Structure holding the state of the NDS unicode61 tokenizer.
+ */
+typedef struct NdsUnicode61
 {
     sqlite3_tokenizer base; /* this needs to come first */
 
     nds_bool removeDiacritics;
 
     /**
-     * Exceptions to NdsUnicode61_isTokenChar().
+     * Whether katakana, half-width katakana and full-width ASCII are folded together with
+     * hiragana and ASCII, see the kana_fold option.
+     */
+    nds_bool kanaFold;
+
+    /**
+     * Whether the bigrammable characters are emitted as unigrams and/or bigrams, see the
+     * cjk_ngram option.
+     */
+    nds_bool cjkUnigrams;
+    nds_bool cjkBigrams;
+
+    /**
+     * Whether queries are reduced to a covering set of bigrams, see the query_bigram_cover option.
+     */
+    nds_bool queryBigramCover;
+
+    /**
+     * Word list used to segment the scripts in segmentedScripts, see the dictionary option.
+     */
+    NdsDictionary dictionary;
+
+    /**
+     * Scripts segmented into dictionary words instead of bigrams, a combination of
+     * NDSUNICODE61_SCRIPT_* flags.
+     */
+    unsigned segmentedScripts;
+
+    /**
+     * Pinyin readings of the Hanzi, see the pinyin option. Not loaded (no entries) unless enabled.
+     */
+    NdsPinyin pinyin;
+
+    /**
+     * Whether the choseong of Hangul bigrams are indexed, see the hangul_choseong option.
+     */
+    nds_bool hangulChoseong;
+
+    /**
+     * Whether the joined forms of digit groups are indexed, see the phone_numbers option.
+     */
+    nds_bool phoneNumbers;
+
+    /**
+     * Normalized forms of recently seen Latin tokens, see the token_cache option. Disabled (no
+     * entries) unless enabled.
+     */
+    NdsTokenCache tokenCache;
+
+    /**
+     * Token lists of recently tokenized queries, see the query_cache option. Disabled (no
+     * buckets) unless enabled.
+     */
+    NdsQueryCache queryCache;
+
+    /**
+     * Tokenizers of the language ids configured with the language option, created from the
+     * options of this tokenizer and those of the language. Texts of other language ids use this
+     * tokenizer.
+     */
+    NdsUnicode61Language* languages;
+    size_t languagesCount;
+
+    /**
+     * Prefix of the substitution ids, see the substitution_prefix option; substitutionPrefixLen
+     * is zero unless it's set. Its first character, substitutionStart, is made a separator so
+     * that it ends the token before it.
+     */
+    char substitutionPrefix[NDSUNICODE61_SUBSTITUTION_PREFIX_MAX];
+    size_t substitutionPrefixLen;
+    unichar substitutionStart;
+
+    /**
+     * Exceptions to NdsUnicode61_isAlNum().
      *
      * This is a sorted array of unicode characters that are to be treated differently
-     * than what NdsUnicode61_isTokenChar() returns. This is filled based on the value
+     * than what NdsUnicode61_isAlNum() returns. This is filled based on the value
      * of tokenchar and separators arguments.
      */
     unichar *alnumExceptions;
@@ -40,6 +182,48 @@ typedef struct
      * Number of entries in the exceptions array.
      */
     size_t alnumExceptionsCount;
+
+    /**
+     * Block index of the class table, see nds_unicode61_class_data.h.
+     *
+     * Points to NdsUnicode61ClassIndex unless there are exceptions (or kana_fold is enabled),
+     * in which case it's a private copy referring the blocks affected by the exceptions to
+     * private copies of these blocks.
+     */
+    const unsigned short* classIndex;
+
+    /**
+     * Blocks of the class table, NdsUnicode61ClassBlocks or a private extended copy.
+     */
+    const NdsUnicode61ClassBlock* classBlocks;
+
+    /**
+     * Classification of the ASCII characters, exceptions included.
+     *
+     * Zero for separators, otherwise the case-folded character. Filled by
+     * NdsUnicode61_initAsciiTable() once the arguments have been parsed.
+     */
+    unsigned char asciiTokenChars[128];
+
+    /**
+     * Length (in characters) of the shortest and the longest edge n-gram emitted for Latin
+     * tokens, see the edge_ngrams option. Both are zero when edge n-grams are disabled.
+     */
+    unsigned edgeNgramMin;
+    unsigned edgeNgramMax;
+
+    /**
+     * Closed cursors kept for reuse, linked through NdsUnicode61Cursor::nextFree.
+     *
+     * Like the rest of the tokenizer this is not synchronized; FTS uses a tokenizer
+     * instance from one connection only.
+     */
+    struct NdsUnicode61Cursor* freeCursors;
+
+    /**
+     * Number of cursors in freeCursors.
+     */
+    unsigned freeCursorsCount;
 } NdsUnicode61;
 
 /**
@@ -64,20 +248,111 @@ typedef enum
      * Current character is covered by the bigram algorithm. It follows another character
      * covered by the bigram algorithm.
      */
-    Bigram
+    Bigram,
+
+    /**
+     * Current character is in a run of characters segmented with the dictionary, which
+     * has been split into words (and unknown stretches) by NdsUnicode61_segmentRun().
+     */
+    Segment
 } BigramTokenizerState;
 
 /**
- * Structure holding the state of the NDS unicode61 tokenizer's cursor.
+ * What the NDS unicode61 tokenizer cursor tokenizes, see NdsUnicode61_open().
+ */
+typedef enum
+{
+    /**
+     * A document: all terms are returned.
+     */
+    DocumentMode = 0,
+
+    /**
+     * A text passed with its length, outside a phrase: the terms of the document, but the term a
+     * query looks up comes first at each position.
+     */
+    TermMode,
+
+    /**
+     * A phrase of a MATCH expression: only the terms a query looks up are returned.
+     */
+    QueryMode
+} NdsUnicode61Mode;
+
+/**
+ * A character boundary in a run of characters segmented with the dictionary.
+ */
+typedef struct
+{
+    /**
+     * Offset (in bytes) of the boundary from the start of the input.
+     */
+    int offset;
+
+    /**
+     * The best segmentation of the run up to this boundary: number of characters not covered
+     * by words, number of words, the boundary it continues from and whether that step is a word.
+     */
+    unsigned unknown;
+    unsigned words;
+    unsigned prev;
+    nds_bool isWord;
+
+    /**
+     * The step from this boundary taken by the best segmentation of the whole run.
+     */
+    unsigned next;
+    nds_bool nextIsWord;
+} NdsUnicode61SegmentNode;
+
+/**
+ * An extra token to be returned at the position of the last returned token.
  */
 typedef struct
+{
+    const char* token;
+    int nBytes;
+    int startOffset;
+    int endOffset;
+
+    /**
+     * True if the edge n-grams of the token are returned after it, see the edge_ngrams option.
+     */
+    nds_bool edgeNgrams;
+
+    /**
+     * True if the token is returned at the position following that of the last returned token.
+     */
+    nds_bool nextPosition;
+} NdsUnicode61PendingToken;
+
+/**
+ * Maximum number of extra tokens returned with a token: the pinyin initials of the run of Hanzi
+ * a bigram starts, the pinyin syllables of its two characters, and its choseong; or the joined
+ * forms of a phone number and, after a prefix query term, the token itself.
+ */
+#define NDSUNICODE61_MAX_PENDING_TOKENS 4
+
+/**
+ * Structure holding the state of the NDS unicode61 tokenizer's cursor.
+ */
+typedef struct NdsUnicode61Cursor
 {
     sqlite3_tokenizer_cursor base;
 
+    /**
+     * The tokenizer of the language of the text, see NdsUnicode61_languageid(). The cursor is
+     * still pooled by the tokenizer it was opened with (base.pTokenizer).
+     */
+    struct NdsUnicode61* module;
+
     /**
      * The raw input.
+     *
+     * This is the buffer passed to NdsUnicode61_open(), which FTS keeps alive until the cursor
+     * is closed, so it's not copied.
      */
-    char* inputStart;
+    const char* inputStart;
 
     /**
      * One-past the last byte of the input.
@@ -148,6 +423,131 @@ typedef struct
      * for bigramOffset1.
      */
     int bigramOffset2;
+
+    /**
+     * In Bigram state, when indexing both unigrams and bigrams:
+     * Characters of the last returned bigram that are still to be returned as unigrams,
+     * a combination of NDSUNICODE61_FIRST_UNIGRAM and NDSUNICODE61_SECOND_UNIGRAM.
+     */
+    unsigned pendingUnigrams;
+
+    /**
+     * What the cursor tokenizes, see NdsUnicode61_open().
+     */
+    NdsUnicode61Mode mode;
+
+    /**
+     * True if the offsets of all bigrams cover both of their characters, see
+     * NdsUnicode61_openHighlight().
+     */
+    nds_bool wholeBigrams;
+
+    /**
+     * The edge n-gram marker followed by the last Latin token.
+     *
+     * The edge n-grams of the token are prefixes of this buffer.
+     */
+    StringBuffer edgeNgram;
+
+    /**
+     * Number of bytes of edgeNgram making up the last returned edge n-gram.
+     */
+    size_t edgeNgramSize;
+
+    /**
+     * Number of edge n-grams of the last token that are still to be returned.
+     */
+    unsigned edgeNgramsLeft;
+
+    /**
+     * Offsets and position of the token the pending edge n-grams belong to.
+     */
+    int edgeNgramStartOffset;
+    int edgeNgramEndOffset;
+    int edgeNgramPosition;
+
+    /**
+     * In Segment state: the character boundaries of the run (one more than its characters).
+     */
+    NdsUnicode61SegmentNode* segmentNodes;
+    size_t segmentNodesCapacity;
+
+    /**
+     * In Segment state: number of characters in the run.
+     */
+    unsigned segmentLength;
+
+    /**
+     * In Segment state: the boundary the next token starts at.
+     */
+    unsigned segmentPos;
+
+    /**
+     * In Segment state: end of the stretch of unknown characters being bigrammed, if any.
+     */
+    unsigned segmentUnknownEnd;
+
+    /**
+     * Extra tokens of the last returned bigram (or single character), see the pinyin and
+     * hangul_choseong options. The first pendingTokensNext of the pendingTokensCount tokens
+     * have been returned already.
+     */
+    NdsUnicode61PendingToken pendingTokens[NDSUNICODE61_MAX_PENDING_TOKENS];
+    unsigned pendingTokensCount;
+    unsigned pendingTokensNext;
+
+    /**
+     * The initials of the current run of characters with a pinyin reading.
+     */
+    StringBuffer pinyinInitials;
+
+    /**
+     * End of the current run of characters with a pinyin reading, NULL before the first one.
+     */
+    const char* pinyinRunEnd;
+
+    /**
+     * The choseong of the last returned Hangul bigram (or syllable), up to two jamo.
+     */
+    char choseong[2 * 4];
+
+    /**
+     * A trunk prefix ('0') followed by the digit groups from the last returned one to the end of
+     * its run; the joined forms of the phone number are substrings of it.
+     */
+    StringBuffer phoneNumber;
+
+    /**
+     * End of the current run of digit groups, NULL before the first one.
+     */
+    const char* phoneRunEnd;
+
+    /**
+     * Number of the last returned digit group in its run (1 for the first one), and whether the run
+     * is written in international format (preceded by '+').
+     */
+    unsigned phoneGroup;
+    nds_bool phoneInternational;
+
+    /**
+     * With the query_cache option, outside document mode: the tokens of the whole input, taken
+     * from the cache or recorded when the first token is requested (once the language is known),
+     * and returned from here. replayNext tokens of the replayCount ones have been returned already,
+     * and replayResult follows the last one.
+     */
+    nds_bool replayPending;
+    nds_bool replaying;
+    NdsQueryCacheToken* replayTokens;
+    size_t replayTokensCapacity;
+    StringBuffer replayData;
+    int replayCount;
+    int replayNext;
+    int replayResult;
+
+    /**
+     * Next cursor in NdsUnicode61::freeCursors while the cursor is pooled.
+     */
+    struct NdsUnicode61Cursor* nextFree;
 } NdsUnicode61Cursor;
 
 static int NdsUnicode61_create(int argc, char const* const* argv, sqlite3_tokenizer** ppTokenizer);
@@ -157,6 +557,7 @@ static int NdsUnicode61_open(sqlite3_tokenizer* pTokenizer, const char* pInput,
 static int NdsUnicode61_close(sqlite3_tokenizer_cursor* pCursor);
 static int NdsUnicode61_next(sqlite3_tokenizer_cursor* pCursor, const char** ppToken, int* pnBytes,
         int* piStartOffset, int* piEndOffset, int* piPosition);
+static int NdsUnicode61_languageid(sqlite3_tokenizer_cursor* pCursor, int iLangid);
 
 /**
  * Add a string of characters into the exceptions array.
@@ -169,27 +570,164 @@ static int NdsUnicode61_next(sqlite3_tokenizer_cursor* pCursor, const char** ppT
  */
 static int NdsUnicode61_addExceptions(NdsUnicode61* self, nds_bool tokenChars, const char* chars);
 
+/**
+ * Fill the table of ASCII characters used by the fast path of the tokenizer.
+ *
+ * \param[in] self Instance of the tokenizer module.
+ */
+static void NdsUnicode61_initAsciiTable(NdsUnicode61* self);
+
+/**
+ * Set up the class table of the tokenizer, merging the exceptions into it.
+ *
+ * \param[in] self Instance of the tokenizer module.
+ * \return SQLITE_OK when operation succeeded, an error code otherwise.
+ */
+static int NdsUnicode61_initClassTable(NdsUnicode61* self);
+
+/**
+ * Split a language=ID:OPTION argument.
+ *
+ * \param[out] languageId Receives the language id, may be NULL.
+ *
+ * \return The option, or NULL if the argument is malformed.
+ */
+static const char* NdsUnicode61_getLanguageOption(const char* argument, int* languageId)
+{
+    int id;
+    int consumed = 0;
+
+    if (sscanf(argument, "language=%d:%n", &id, &consumed) != 1 || consumed == 0 || id < 0)
+        return NULL;
+
+    if (languageId != NULL)
+        *languageId = id;
+    return argument + consumed;
+}
+
+/**
+ * Check whether two options have the same name (the part up to '=').
+ */
+static nds_bool NdsUnicode61_isSameOption(const char* option1, const char* option2)
+{
+    const size_t len = strcspn(option1, "=");
+    return strncmp(option1, option2, len + 1) == 0;
+}
+
+/**
+ * Check if a character is in one of the Private Use Areas.
+ */
+static nds_bool NdsUnicode61_isPrivateUse(unichar c)
+{
+    return
+            (c >= 0xe000 && c <= 0xf8ff) ||
+            (c >= 0xf0000 && c <= 0xffffd) ||
+            (c >= 0x100000 && c <= 0x10fffd);
+}
+
 /**
  * Parse the arguments passed.
  *
  * The ndsunicode61 tokenizer recognizes the following options:
  * remove_diacritics=VALUE where VALUE is either 1 or 0 - enables or disables diacritic stripping
+ * kana_fold=VALUE where VALUE is either 1 or 0 - when enabled, katakana (including half-width
+ *                       katakana and their separate voiced sound marks) is indexed and queried as
+ *                       hiragana, and full-width ASCII as ASCII words rather than bigrams
  * tokenchars=STRING - turns characters from STRING into token characters (not separators)
  * separators=STRING - turns characters from STRING into separators
+ * edge_ngrams=MIN:MAX - for prefix search, indexes the leading MIN to MAX characters of each Latin
+ *                       token, pinyin syllable and initials and joined phone number as extra
+ *                       terms; a query prefix "abc*" of MIN to MAX characters is then looked up
+ *                       as one such term instead of being expanded by FTS
+ * cjk_ngram=VALUE where VALUE is 2 (default), 1 or 1,2 - selects whether CJK (bigrammable)
+ *                       characters are indexed as bigrams, unigrams, or both; in the latter case
+ *                       the unigrams share the positions of the bigrams and queries are
+ *                       tokenized to bigrams (single characters to unigrams)
+ * query_bigram_cover=VALUE where VALUE is either 1 or 0 - when enabled, the end offsets of the
+ *                       bigrams of a query skip the overlapping character, so that FTS, which
+ *                       continues a MATCH expression at the end offset of its last term, looks
+ *                       up a covering set of bigrams (0-1, 2-3, ..., and the final one) instead
+ *                       of all of them
+ * dictionary=PATH - loads a word list for the segment option, see nds_dictionary.h for the format
+ * segment=SCRIPTS where SCRIPTS is a comma-separated list of thai, lao and khmer - splits runs of
+ *                       these scripts into the longest dictionary words (maximal matching) instead
+ *                       of bigrams; stretches not covered by words are still bigrammed
+ * pinyin=PATH - loads a Hanzi to pinyin table (see nds_pinyin.h for the format) and indexes the
+ *                       pinyin syllable of each Hanzi at its position (that of the bigram it
+ *                       starts, or the one following the last bigram of its run) and the initials
+ *                       of each run of two or more Hanzi ("gds" for the run read "guang dong
+ *                       sheng"), so that a Latin query, a phrase of syllables included, matches
+ *                       them
+ * hangul_choseong=VALUE where VALUE is either 1 or 0 - when enabled, each bigram (or single
+ *                       character) of Hangul syllables is indexed with the bigram of their initial
+ *                       consonants at the same position, so that a query typed as initials
+ *                       (U+3145 U+3147) matches
+ * phone_numbers=VALUE where VALUE is either 1 or 0 - when enabled, a run of digit groups separated
+ *                       by " -/.()" ("+49 89 1234567") is also indexed joined into one number,
+ *                       together with its suffixes starting at a group ("891234567") and, for
+ *                       numbers written with '+', the national forms with the trunk prefix 0
+ *                       ("089", "0891234567"); each joined form is at the position of its first
+ *                       group, and a "(0)" group is skipped: between two groups it takes no
+ *                       position of its own and is left out of phrases, so that "+49 89 1234567"
+ *                       matches "+49 (0)89 1234-567" as a phrase
+ * token_cache=COUNT - keeps the normalized forms of up to about COUNT Latin tokens with non-ASCII
+ *                       characters (up to NDS_TOKEN_CACHE_MAX_KEY bytes), so that repeated words
+ *                       ("strasse" for U+00DF) are not decoded and folded again; the hit rate is
+ *                       reported by nds_tokenizer_cache_stats(). 0 (default) disables the cache
+ * query_cache=COUNT - keeps the tokens (with their offsets and positions) of the last COUNT texts
+ *                       passed with their length (up to NDS_QUERY_CACHE_MAX_KEY bytes), so that
+ *                       MATCH expressions repeated while a query is typed are not tokenized
+ *                       again; the hit rate is reported by nds_tokenizer_query_cache_stats().
+ *                       A text is only cached the second time it is tokenized: FTS also passes
+ *                       the rows it tokenizes for snippet() and offsets() with their length, and
+ *                       these must not evict the MATCH expressions. 0 (default) disables the cache
+ * substitution_prefix=STRING - STRING is one or more Private Use Area characters starting the
+ *                       substitution ids; an id (the prefix and the token characters that follow
+ *                       it, up to a CJK one) is returned as one token, byte for byte, instead of
+ *                       being bigrammed. The first character of the prefix becomes a separator
+ * language=ID:OPTION - applies OPTION, any of the above replacing the one of the same name, to the
+ *                       texts of the FTS4 language id ID (see the languageid table option), for
+ *                       instance "language=3:remove_diacritics=0" or "language=7:pinyin=" (an
+ *                       empty dictionary or pinyin path loads none); texts of language ids
+ *                       without a language option are tokenized with the other options. Each
+ *                       configured language gets its own tokenizer instance, caches included
  *
  * The behaviour of tokenchars and separators should mimic the behaviour of these in the unicode61
  * tokenizer.
  *
+ * The options edge_ngrams, cjk_ngram=1,2, pinyin, hangul_choseong and phone_numbers add terms to
+ * documents, but not to the phrases of queries, see NdsUnicode61_open().
+ *
  * \return SQLITE_OK when operation succeeded, an error code otherwise.
  */
 static int NdsUnicode61_parseArguments(NdsUnicode61* self, int argc, char const* const* argv)
 {
     static const char REMOVE_DIACRITICS[] = "remove_diacritics=";
+    static const char KANA_FOLD[] = "kana_fold=";
     static const char TOKENCHARS[] = "tokenchars=";
     static const char SEPARATORS[] = "separators=";
+    static const char EDGE_NGRAMS[] = "edge_ngrams=";
+    static const char CJK_NGRAM[] = "cjk_ngram=";
+    static const char QUERY_BIGRAM_COVER[] = "query_bigram_cover=";
+    static const char DICTIONARY[] = "dictionary=";
+    static const char SEGMENT[] = "segment=";
+    static const char PINYIN[] = "pinyin=";
+    static const char HANGUL_CHOSEONG[] = "hangul_choseong=";
+    static const char PHONE_NUMBERS[] = "phone_numbers=";
+    static const char TOKEN_CACHE[] = "token_cache=";
+    static const char QUERY_CACHE[] = "query_cache=";
+    static const char SUBSTITUTION_PREFIX[] = "substitution_prefix=";
+    static const char LANGUAGE[] = "language=";
     int idx;
 
     self->removeDiacritics = NDSUNICODE61_REMOVE_DIACRITICS_DEFAULT;
+    self->kanaFold = NDS_FALSE;
+    self->cjkUnigrams = NDS_FALSE;
+    self->cjkBigrams = NDS_TRUE;
+    self->queryBigramCover = NDS_FALSE;
+    self->segmentedScripts = 0;
+    self->hangulChoseong = NDS_FALSE;
+    self->phoneNumbers = NDS_FALSE;
     self->alnumExceptions = NULL;
     self->alnumExceptionsCount = 0;
 
@@ -209,6 +747,19 @@ static int NdsUnicode61_parseArguments(NdsUnicode61* self, int argc, char const*
                 return SQLITE_ERROR;
             }
         }
+        else if (strncmp(argv[idx], KANA_FOLD, ARRAY_SIZE(KANA_FOLD) - 1) == 0)
+        {
+            int kanaFold;
+            if (sscanf(argv[idx] + ARRAY_SIZE(KANA_FOLD) - 1, "%d", &kanaFold) == 1)
+            {
+                self->kanaFold = kanaFold != 0;
+            }
+            else
+            {
+                /* can't parse as number - fail */
+                return SQLITE_ERROR;
+            }
+        }
         else if (strncmp(argv[idx], TOKENCHARS, ARRAY_SIZE(TOKENCHARS) - 1) == 0)
         {
             int r = NdsUnicode61_addExceptions(self, NDS_TRUE, argv[idx] + ARRAY_SIZE(TOKENCHARS) - 1);
@@ -221,18 +772,315 @@ static int NdsUnicode61_parseArguments(NdsUnicode61* self, int argc, char const*
             if (r != SQLITE_OK)
                 return r;
         }
-        else
+        else if (strncmp(argv[idx], EDGE_NGRAMS, ARRAY_SIZE(EDGE_NGRAMS) - 1) == 0)
         {
-            /* unknown option */
-            return SQLITE_ERROR;
+            int minLen;
+            int maxLen;
+            char extra;
+            if (sscanf(argv[idx] + ARRAY_SIZE(EDGE_NGRAMS) - 1, "%d:%d%c", &minLen, &maxLen, &extra) == 2 &&
+                    minLen > 0 && maxLen >= minLen)
+            {
+                self->edgeNgramMin = (unsigned)minLen;
+                self->edgeNgramMax = (unsigned)maxLen;
+            }
+            else
+            {
+                /* not a valid range - fail */
+                return SQLITE_ERROR;
+            }
         }
-    }
-
-    return SQLITE_OK;
-}
-
-/**
- * Create an instance of the NDS unicode61 tokenizer.
+        else if (strncmp(argv[idx], CJK_NGRAM, ARRAY_SIZE(CJK_NGRAM) - 1) == 0)
+        {
+            const char* value = argv[idx] + ARRAY_SIZE(CJK_NGRAM) - 1;
+            self->cjkUnigrams = strcmp(value, "1") == 0 || strcmp(value, "1,2") == 0;
+            self->cjkBigrams = strcmp(value, "2") == 0 || strcmp(value, "1,2") == 0;
+            if (!self->cjkUnigrams && !self->cjkBigrams)
+            {
+                /* unknown n-gram set - fail */
+                return SQLITE_ERROR;
+            }
+        }
+        else if (strncmp(argv[idx], QUERY_BIGRAM_COVER, ARRAY_SIZE(QUERY_BIGRAM_COVER) - 1) == 0)
+        {
+            int queryBigramCover;
+            if (sscanf(argv[idx] + ARRAY_SIZE(QUERY_BIGRAM_COVER) - 1, "%d",
+                    &queryBigramCover) == 1)
+            {
+                self->queryBigramCover = queryBigramCover != 0;
+            }
+            else
+            {
+                /* can't parse as number - fail */
+                return SQLITE_ERROR;
+            }
+        }
+        else if (strncmp(argv[idx], DICTIONARY, ARRAY_SIZE(DICTIONARY) - 1) == 0)
+        {
+            const char* path = argv[idx] + ARRAY_SIZE(DICTIONARY) - 1;
+            NdsDictionary_unload(&self->dictionary);
+            if (*path != '\0')
+            {
+                int r = NdsDictionary_load(&self->dictionary, path);
+                if (r != SQLITE_OK)
+                    return r;
+            }
+        }
+        else if (strncmp(argv[idx], SEGMENT, ARRAY_SIZE(SEGMENT) - 1) == 0)
+        {
+            const char* script = argv[idx] + ARRAY_SIZE(SEGMENT) - 1;
+            while (*script != '\0')
+            {
+                const size_t len = strcspn(script, ",");
+                if (len == 4 && strncmp(script, "thai", len) == 0)
+                    self->segmentedScripts |= NDSUNICODE61_SCRIPT_THAI;
+                else if (len == 3 && strncmp(script, "lao", len) == 0)
+                    self->segmentedScripts |= NDSUNICODE61_SCRIPT_LAO;
+                else if (len == 5 && strncmp(script, "khmer", len) == 0)
+                    self->segmentedScripts |= NDSUNICODE61_SCRIPT_KHMER;
+                else
+                {
+                    /* unknown script - fail */
+                    return SQLITE_ERROR;
+                }
+
+                script += len;
+                if (*script == ',')
+                    script++;
+            }
+        }
+        else if (strncmp(argv[idx], PINYIN, ARRAY_SIZE(PINYIN) - 1) == 0)
+        {
+            const char* path = argv[idx] + ARRAY_SIZE(PINYIN) - 1;
+            NdsPinyin_unload(&self->pinyin);
+            if (*path != '\0')
+            {
+                int r = NdsPinyin_load(&self->pinyin, path);
+                if (r != SQLITE_OK)
+                    return r;
+            }
+        }
+        else if (strncmp(argv[idx], HANGUL_CHOSEONG, ARRAY_SIZE(HANGUL_CHOSEONG) - 1) == 0)
+        {
+            int hangulChoseong;
+            if (sscanf(argv[idx] + ARRAY_SIZE(HANGUL_CHOSEONG) - 1, "%d", &hangulChoseong) == 1)
+            {
+                self->hangulChoseong = hangulChoseong != 0;
+            }
+            else
+            {
+                /* can't parse as number - fail */
+                return SQLITE_ERROR;
+            }
+        }
+        else if (strncmp(argv[idx], PHONE_NUMBERS, ARRAY_SIZE(PHONE_NUMBERS) - 1) == 0)
+        {
+            int phoneNumbers;
+            if (sscanf(argv[idx] + ARRAY_SIZE(PHONE_NUMBERS) - 1, "%d", &phoneNumbers) == 1)
+            {
+                self->phoneNumbers = phoneNumbers != 0;
+            }
+            else
+            {
+                /* can't parse as number - fail */
+                return SQLITE_ERROR;
+            }
+        }
+        else if (strncmp(argv[idx], TOKEN_CACHE, ARRAY_SIZE(TOKEN_CACHE) - 1) == 0)
+        {
+            int capacity;
+            char extra;
+            if (sscanf(argv[idx] + ARRAY_SIZE(TOKEN_CACHE) - 1, "%d%c", &capacity, &extra) == 1 &&
+                    capacity >= 0)
+            {
+                NdsTokenCache_destroy(&self->tokenCache);
+                if (capacity > 0)
+                {
+                    int r = NdsTokenCache_init(&self->tokenCache, (unsigned)capacity);
+                    if (r != SQLITE_OK)
+                        return r;
+                }
+            }
+            else
+            {
+                /* can't parse as number - fail */
+                return SQLITE_ERROR;
+            }
+        }
+        else if (strncmp(argv[idx], QUERY_CACHE, ARRAY_SIZE(QUERY_CACHE) - 1) == 0)
+        {
+            int capacity;
+            char extra;
+            if (sscanf(argv[idx] + ARRAY_SIZE(QUERY_CACHE) - 1, "%d%c", &capacity, &extra) == 1 &&
+                    capacity >= 0)
+            {
+                NdsQueryCache_destroy(&self->queryCache);
+                if (capacity > 0)
+                {
+                    int r = NdsQueryCache_init(&self->queryCache, (unsigned)capacity);
+                    if (r != SQLITE_OK)
+                        return r;
+                }
+            }
+            else
+            {
+                /* can't parse as number - fail */
+                return SQLITE_ERROR;
+            }
+        }
+        else if (strncmp(argv[idx], SUBSTITUTION_PREFIX, ARRAY_SIZE(SUBSTITUTION_PREFIX) - 1) == 0)
+        {
+            const char* prefix = argv[idx] + ARRAY_SIZE(SUBSTITUTION_PREFIX) - 1;
+            const size_t len = strlen(prefix);
+            const char* c = prefix;
+            int bytesLeft = (int)len;
+            unichar u;
+
+            if (len == 0 || len > NDSUNICODE61_SUBSTITUTION_PREFIX_MAX)
+                return SQLITE_ERROR;
+            if (!DecodeNextUtf8CharToUnichar(&c, &bytesLeft, &self->substitutionStart))
+                return SQLITE_ERROR;
+            u = self->substitutionStart;
+            do
+            {
+                if (!NdsUnicode61_isPrivateUse(u))
+                    return SQLITE_ERROR;
+            } while (DecodeNextUtf8CharToUnichar(&c, &bytesLeft, &u));
+            if (bytesLeft != 0)
+            {
+                /* invalid utf8 - fail */
+                return SQLITE_ERROR;
+            }
+
+            memcpy(self->substitutionPrefix, prefix, len);
+            self->substitutionPrefixLen = len;
+        }
+        else if (strncmp(argv[idx], LANGUAGE, ARRAY_SIZE(LANGUAGE) - 1) == 0)
+        {
+            /* the tokenizers of the languages are created once the options have been parsed */
+            const char* option = NdsUnicode61_getLanguageOption(argv[idx], NULL);
+            if (option == NULL || strncmp(option, LANGUAGE, ARRAY_SIZE(LANGUAGE) - 1) == 0)
+                return SQLITE_ERROR;
+        }
+        else
+        {
+            /* unknown option */
+            return SQLITE_ERROR;
+        }
+    }
+
+    if (self->segmentedScripts != 0 && self->dictionary.data == NULL)
+    {
+        /* nothing to segment with */
+        return SQLITE_ERROR;
+    }
+
+    if (self->substitutionPrefixLen > 0)
+    {
+        /* the id starts a new token even right after a word */
+        char start[5];
+        char* end = start;
+        WriteUnicharAsUtf8(self->substitutionStart, &end, start + ARRAY_SIZE(start) - 1);
+        *end = '\0';
+        return NdsUnicode61_addExceptions(self, NDS_FALSE, start);
+    }
+
+    return SQLITE_OK;
+}
+
+/**
+ * Create the tokenizer of a language: the options of the tokenizer are followed by those of the
+ * language, which replace the options of the same name.
+ *
+ * \return SQLITE_OK when operation succeeded, an error code otherwise.
+ */
+static int NdsUnicode61_createLanguage(NdsUnicode61Language* language, int argc, char const* const* argv)
+{
+    char const** options;
+    sqlite3_tokenizer* tokenizer;
+    int optionCount = 0;
+    int idx;
+    int r;
+
+    options = (char const**)malloc(sizeof(char*) * ((size_t)argc + 1));
+    if (options == NULL)
+        return SQLITE_NOMEM;
+
+    for (idx = 0; idx < argc; idx++)
+    {
+        nds_bool replaced = NDS_FALSE;
+        int other;
+
+        if (NdsUnicode61_getLanguageOption(argv[idx], NULL) != NULL)
+            continue;
+        for (other = 0; other < argc && !replaced; other++)
+        {
+            int languageId;
+            const char* option = NdsUnicode61_getLanguageOption(argv[other], &languageId);
+            replaced = option != NULL && languageId == language->languageId &&
+                    NdsUnicode61_isSameOption(option, argv[idx]);
+        }
+        if (!replaced)
+            options[optionCount++] = argv[idx];
+    }
+    for (idx = 0; idx < argc; idx++)
+    {
+        int languageId;
+        const char* option = NdsUnicode61_getLanguageOption(argv[idx], &languageId);
+        if (option != NULL && languageId == language->languageId)
+            options[optionCount++] = option;
+    }
+
+    r = NdsUnicode61_create(optionCount, options, &tokenizer);
+    free(options);
+    if (r != SQLITE_OK)
+        return r;
+
+    language->tokenizer = (NdsUnicode61*)tokenizer;
+    return SQLITE_OK;
+}
+
+/**
+ * Create the tokenizers of the languages named by the language options.
+ *
+ * \return SQLITE_OK when operation succeeded, an error code otherwise.
+ */
+static int NdsUnicode61_createLanguages(NdsUnicode61* self, int argc, char const* const* argv)
+{
+    int idx;
+
+    for (idx = 0; idx < argc; idx++)
+    {
+        NdsUnicode61Language* languages;
+        int languageId;
+        size_t i;
+        int r;
+
+        if (NdsUnicode61_getLanguageOption(argv[idx], &languageId) == NULL)
+            continue;
+        for (i = 0; i < self->languagesCount && self->languages[i].languageId != languageId; i++)
+            ;
+        if (i < self->languagesCount)
+            continue;
+
+        languages = (NdsUnicode61Language*)realloc(self->languages,
+                (self->languagesCount + 1) * sizeof(NdsUnicode61Language));
+        if (languages == NULL)
+            return SQLITE_NOMEM;
+        self->languages = languages;
+
+        languages[i].languageId = languageId;
+        languages[i].tokenizer = NULL;
+        r = NdsUnicode61_createLanguage(&languages[i], argc, argv);
+        if (r != SQLITE_OK)
+            return r;
+        self->languagesCount++;
+    }
+
+    return SQLITE_OK;
+}
+
+/**
+ * Create an instance of the NDS unicode61 tokenizer.
  */
 int NdsUnicode61_create(int argc, char const* const* argv, sqlite3_tokenizer** ppTokenizer)
 {
@@ -251,6 +1099,21 @@ int NdsUnicode61_create(int argc, char const* const* argv, sqlite3_tokenizer** p
         return result;
     }
 
+    result = NdsUnicode61_initClassTable(self);
+    if (result != SQLITE_OK)
+    {
+        NdsUnicode61_destroy(&self->base);
+        return result;
+    }
+    NdsUnicode61_initAsciiTable(self);
+
+    result = NdsUnicode61_createLanguages(self, argc, argv);
+    if (result != SQLITE_OK)
+    {
+        NdsUnicode61_destroy(&self->base);
+        return result;
+    }
+
     *ppTokenizer = &self->base;
     return SQLITE_OK;
 }
@@ -269,43 +1132,236 @@ int NdsUnicode61_destroy(sqlite3_tokenizer* pTokenizer)
     result = SQLITE_OK;
 
     self = (NdsUnicode61*)pTokenizer;
+    while (self->freeCursors != NULL)
+    {
+        NdsUnicode61Cursor* cursor = self->freeCursors;
+        self->freeCursors = cursor->nextFree;
+        StringBuffer_destroy(&cursor->token);
+        StringBuffer_destroy(&cursor->edgeNgram);
+        StringBuffer_destroy(&cursor->pinyinInitials);
+        StringBuffer_destroy(&cursor->phoneNumber);
+        StringBuffer_destroy(&cursor->replayData);
+        free(cursor->replayTokens);
+        free(cursor->segmentNodes);
+        free(cursor);
+    }
+    NdsDictionary_unload(&self->dictionary);
+    NdsPinyin_unload(&self->pinyin);
+    NdsTokenCache_destroy(&self->tokenCache);
+    NdsQueryCache_destroy(&self->queryCache);
+    while (self->languagesCount > 0)
+        NdsUnicode61_destroy(&self->languages[--self->languagesCount].tokenizer->base);
+    free(self->languages);
+    if (self->classIndex != NdsUnicode61ClassIndex)
+        free((void*)self->classIndex);
+    if (self->classBlocks != NdsUnicode61ClassBlocks)
+        free((void*)self->classBlocks);
+    free(self->alnumExceptions);
     free(self);
 
     return result;
 }
 
 /**
- * Create an instance of the NDS unicode61 tokenizer cursor.
+ * Append a token to the tokens replayed by a cursor.
+ *
+ * \return True unless storing the token failed.
  */
-int NdsUnicode61_open(sqlite3_tokenizer* pTokenizer, const char* pInput, int nBytes,
-        sqlite3_tokenizer_cursor **ppCursor)
+static nds_bool NdsUnicode61_recordToken(NdsUnicode61Cursor* cursor, const char* token, int nBytes,
+        int startOffset, int endOffset, int position)
+{
+    NdsQueryCacheToken* recorded;
+
+    if ((size_t)cursor->replayCount == cursor->replayTokensCapacity)
+    {
+        const size_t capacity = (cursor->replayTokensCapacity > 0) ? 2 * cursor->replayTokensCapacity : 16;
+        NdsQueryCacheToken* tokens = (NdsQueryCacheToken*)realloc(cursor->replayTokens,
+                capacity * sizeof(NdsQueryCacheToken));
+        if (tokens == NULL)
+            return NDS_FALSE;
+        cursor->replayTokens = tokens;
+        cursor->replayTokensCapacity = capacity;
+    }
+    if (!StringBuffer_ensureExtraCapacity(&cursor->replayData, (size_t)nBytes))
+        return NDS_FALSE;
+
+    recorded = &cursor->replayTokens[cursor->replayCount++];
+    recorded->dataOffset = (int)cursor->replayData.size;
+    recorded->nBytes = nBytes;
+    recorded->startOffset = startOffset;
+    recorded->endOffset = endOffset;
+    recorded->position = position;
+    memcpy(cursor->replayData.buffer + cursor->replayData.size, token, (size_t)nBytes);
+    cursor->replayData.size += (size_t)nBytes;
+
+    return NDS_TRUE;
+}
+
+/**
+ * Fill the tokens replayed by a cursor opened in query or term mode, from the query cache or, if
+ * the input has been seen before, by tokenizing the whole input (which is then cached). An input
+ * seen for the first time is tokenized as it is read, without replaying.
+ *
+ * FTS often reads only the first token of a query cursor and opens another one at its end
+ * offset, so the tokens are recorded up front rather than as they are read. The same text is
+ * cached separately for each mode, through a different hash.
+ */
+static int NdsUnicode61_startReplay(NdsUnicode61* module, NdsUnicode61Cursor* cursor,
+        const char* input, size_t len)
+{
+    const nds_uint32 hash = NdsTokenCache_hash(input, len) ^
+            ((cursor->mode == TermMode) ? NDSUNICODE61_TERM_MODE_HASH : 0);
+    const NdsQueryCacheEntry* entry = NdsQueryCache_find(&module->queryCache, input, len, hash);
+
+    if (entry != NULL)
+    {
+        NdsQueryCacheToken const* tokens = NdsQueryCache_tokens(entry);
+        const char* data = NdsQueryCache_data(entry);
+        int i;
+
+        for (i = 0; i < entry->tokenCount; i++)
+        {
+            if (!NdsUnicode61_recordToken(cursor, data + tokens[i].dataOffset, tokens[i].nBytes,
+                    tokens[i].startOffset, tokens[i].endOffset, tokens[i].position))
+                return SQLITE_NOMEM;
+        }
+        cursor->replayResult = SQLITE_DONE;
+    }
+    else if (!NdsQueryCache_admit(&module->queryCache, hash))
+    {
+        return SQLITE_OK;
+    }
+    else
+    {
+        const char* token;
+        int nBytes;
+        int startOffset;
+        int endOffset;
+        int position;
+        int result;
+
+        while ((result = NdsUnicode61_next(&cursor->base, &token, &nBytes, &startOffset, &endOffset,
+                &position)) == SQLITE_OK)
+        {
+            if (!NdsUnicode61_recordToken(cursor, token, nBytes, startOffset, endOffset, position))
+                return SQLITE_NOMEM;
+        }
+
+        /* an error is replayed after the tokens preceding it, but not cached */
+        cursor->replayResult = result;
+        if (result == SQLITE_DONE)
+        {
+            NdsQueryCache_insert(&module->queryCache, input, len, hash, cursor->replayTokens,
+                    cursor->replayCount, cursor->replayData.buffer, (int)cursor->replayData.size);
+        }
+    }
+
+    cursor->replaying = NDS_TRUE;
+    return SQLITE_OK;
+}
+
+/**
+ * Return the next token replayed by a cursor, see NdsUnicode61_startReplay().
+ */
+static int NdsUnicode61_nextReplayed(NdsUnicode61Cursor* cursor, const char** ppToken, int* pnBytes,
+        int* piStartOffset, int* piEndOffset, int* piPosition)
+{
+    const NdsQueryCacheToken* token;
+
+    if (cursor->replayNext == cursor->replayCount)
+        return cursor->replayResult;
+
+    token = &cursor->replayTokens[cursor->replayNext++];
+    *ppToken = cursor->replayData.buffer + token->dataOffset;
+    *pnBytes = token->nBytes;
+    *piStartOffset = token->startOffset;
+    *piEndOffset = token->endOffset;
+    *piPosition = token->position;
+
+    return SQLITE_OK;
+}
+
+/**
+ * Create an instance of the NDS unicode61 tokenizer cursor, tokenizing the input in a mode.
+ */
+static int NdsUnicode61_openCursor(sqlite3_tokenizer* pTokenizer, const char* pInput, int nBytes,
+        NdsUnicode61Mode mode, sqlite3_tokenizer_cursor **ppCursor)
 {
+    NdsUnicode61* module;
     NdsUnicode61Cursor* cursor;
     size_t len;
 
     if (pTokenizer == NULL)
         return SQLITE_ERROR;
 
-    cursor = (NdsUnicode61Cursor*)malloc(sizeof(NdsUnicode61Cursor));
-    if (cursor == NULL)
+    module = (NdsUnicode61*)pTokenizer;
+    if (module->freeCursors != NULL)
     {
-        return SQLITE_NOMEM;
+        /* reuse a pooled cursor, including its token buffer */
+        cursor = module->freeCursors;
+        module->freeCursors = cursor->nextFree;
+        module->freeCursorsCount--;
+        StringBuffer_flush(&cursor->token);
+        StringBuffer_flush(&cursor->edgeNgram);
+        StringBuffer_flush(&cursor->pinyinInitials);
+        StringBuffer_flush(&cursor->phoneNumber);
+        StringBuffer_flush(&cursor->replayData);
     }
-    memset(cursor, 0, sizeof(*cursor));
-
-    StringBuffer_init(&cursor->token);
-
-    /* store a copy of the passed argument */
-    len = (nBytes >= 0) ? (size_t)nBytes : strlen(pInput);
-    if (len > 0)
+    else
     {
-        cursor->inputStart = (char*)malloc(len);
-        if (cursor->inputStart == NULL)
+        cursor = (NdsUnicode61Cursor*)malloc(sizeof(NdsUnicode61Cursor));
+        if (cursor == NULL)
         {
-            NdsUnicode61_close(&cursor->base);
             return SQLITE_NOMEM;
         }
-        memcpy(cursor->inputStart, pInput, len);
+        StringBuffer_init(&cursor->token);
+        StringBuffer_init(&cursor->edgeNgram);
+        StringBuffer_init(&cursor->pinyinInitials);
+        StringBuffer_init(&cursor->phoneNumber);
+        StringBuffer_init(&cursor->replayData);
+        cursor->segmentNodes = NULL;
+        cursor->segmentNodesCapacity = 0;
+        cursor->replayTokens = NULL;
+        cursor->replayTokensCapacity = 0;
+    }
+
+    /* the token buffers, the segmentation nodes and the replayed tokens are the only state that survives pooling */
+    cursor->base.pTokenizer = pTokenizer;
+    cursor->module = module;
+    cursor->state = Unknown;
+    cursor->currentCharacter = 0;
+    cursor->index = 0;
+    cursor->bigramFirstCharSize = 0;
+    cursor->bigramOffset1 = 0;
+    cursor->bigramOffset2 = 0;
+    cursor->pendingUnigrams = 0;
+    cursor->mode = mode;
+    cursor->wholeBigrams = NDS_FALSE;
+    cursor->edgeNgramSize = 0;
+    cursor->edgeNgramsLeft = 0;
+    cursor->edgeNgramStartOffset = 0;
+    cursor->edgeNgramEndOffset = 0;
+    cursor->edgeNgramPosition = 0;
+    cursor->segmentLength = 0;
+    cursor->segmentPos = 0;
+    cursor->segmentUnknownEnd = 0;
+    cursor->pendingTokensCount = 0;
+    cursor->pendingTokensNext = 0;
+    cursor->pinyinRunEnd = NULL;
+    cursor->phoneRunEnd = NULL;
+    cursor->phoneGroup = 0;
+    cursor->phoneInternational = NDS_FALSE;
+    cursor->replaying = NDS_FALSE;
+    cursor->replayCount = 0;
+    cursor->replayNext = 0;
+    cursor->replayResult = SQLITE_DONE;
+    cursor->nextFree = NULL;
+
+    /* tokenize the passed buffer in place */
+    len = (nBytes >= 0) ? (size_t)nBytes : strlen(pInput);
+    if (len > 0)
+    {
+        cursor->inputStart = pInput;
         cursor->inputEnd = cursor->inputStart + len;
     }
     else
@@ -316,26 +1372,107 @@ int NdsUnicode61_open(sqlite3_tokenizer* pTokenizer, const char* pInput, int nBy
 
     cursor->next = cursor->inputStart;
     cursor->current = NULL;
+    cursor->replayPending = cursor->mode != DocumentMode && len > 0 && len <= NDS_QUERY_CACHE_MAX_KEY;
 
     *ppCursor = &cursor->base;
 
     return SQLITE_OK;
 }
 
+/**
+ * Create an instance of the NDS unicode61 tokenizer cursor.
+ *
+ * FTS passes a nul-terminated document (nBytes < 0) when it indexes a row, which gets all terms.
+ * Everything else comes with its length, and only a phrase of a MATCH expression can be told
+ * apart: FTS passes it without its quotes, so the closing one follows the input. A phrase is
+ * tokenized in query mode, in which no extra terms (edge n-grams, unigrams, pinyin, initials,
+ * phone number forms) are emitted, since they would become extra tokens of the phrase.
+ *
+ * Any other text (a term of a MATCH expression, a row checked by the 'integrity-check' command or
+ * tokenized for snippets) gets the terms of the document at the same positions. Of a term FTS
+ * only looks up the first token, so the token a query means comes first: the edge n-gram of a
+ * prefix ("abc*") that has one, followed by the token itself and its other terms.
+ */
+int NdsUnicode61_open(sqlite3_tokenizer* pTokenizer, const char* pInput, int nBytes,
+        sqlite3_tokenizer_cursor **ppCursor)
+{
+    NdsUnicode61Mode mode = DocumentMode;
+
+    if (nBytes >= 0)
+    {
+        /* the input is not nul-terminated, so the byte that follows it belongs to the caller */
+        mode = (nBytes > 0 && pInput[nBytes - 1] != '\0' && pInput[nBytes] == '"') ? QueryMode : TermMode;
+    }
+    return NdsUnicode61_openCursor(pTokenizer, pInput, nBytes, mode, ppCursor);
+}
+
 /**
  * Destroy an instance of the NDS unicode61 tokenizer cursor.
  */
 int NdsUnicode61_close(sqlite3_tokenizer_cursor* pCursor)
 {
+    NdsUnicode61* module;
     NdsUnicode61Cursor* cursor;
 
     if (pCursor == NULL)
         return SQLITE_ERROR;
 
     cursor = (NdsUnicode61Cursor*)pCursor;
+    module = (NdsUnicode61*)cursor->base.pTokenizer;
+
+    if (module != NULL && module->freeCursorsCount < NDSUNICODE61_CURSOR_POOL_SIZE)
+    {
+        if (cursor->token.capacity > NDSUNICODE61_POOLED_TOKEN_CAPACITY_MAX)
+        {
+            /* don't keep an unusually long token's buffer around */
+            StringBuffer_destroy(&cursor->token);
+            StringBuffer_init(&cursor->token);
+        }
+        if (cursor->edgeNgram.capacity > NDSUNICODE61_POOLED_TOKEN_CAPACITY_MAX)
+        {
+            StringBuffer_destroy(&cursor->edgeNgram);
+            StringBuffer_init(&cursor->edgeNgram);
+        }
+        if (cursor->pinyinInitials.capacity > NDSUNICODE61_POOLED_TOKEN_CAPACITY_MAX)
+        {
+            StringBuffer_destroy(&cursor->pinyinInitials);
+            StringBuffer_init(&cursor->pinyinInitials);
+        }
+        if (cursor->phoneNumber.capacity > NDSUNICODE61_POOLED_TOKEN_CAPACITY_MAX)
+        {
+            StringBuffer_destroy(&cursor->phoneNumber);
+            StringBuffer_init(&cursor->phoneNumber);
+        }
+        if (cursor->replayData.capacity > NDSUNICODE61_POOLED_TOKEN_CAPACITY_MAX)
+        {
+            StringBuffer_destroy(&cursor->replayData);
+            StringBuffer_init(&cursor->replayData);
+        }
+        if (cursor->replayTokensCapacity * sizeof(NdsQueryCacheToken) > NDSUNICODE61_POOLED_TOKEN_CAPACITY_MAX)
+        {
+            free(cursor->replayTokens);
+            cursor->replayTokens = NULL;
+            cursor->replayTokensCapacity = 0;
+        }
+        if (cursor->segmentNodesCapacity * sizeof(NdsUnicode61SegmentNode) > NDSUNICODE61_POOLED_TOKEN_CAPACITY_MAX)
+        {
+            free(cursor->segmentNodes);
+            cursor->segmentNodes = NULL;
+            cursor->segmentNodesCapacity = 0;
+        }
+        cursor->nextFree = module->freeCursors;
+        module->freeCursors = cursor;
+        module->freeCursorsCount++;
+        return SQLITE_OK;
+    }
 
     StringBuffer_destroy(&cursor->token);
-    free(cursor->inputStart);
+    StringBuffer_destroy(&cursor->edgeNgram);
+    StringBuffer_destroy(&cursor->pinyinInitials);
+    StringBuffer_destroy(&cursor->phoneNumber);
+    StringBuffer_destroy(&cursor->replayData);
+    free(cursor->replayTokens);
+    free(cursor->segmentNodes);
     free(cursor);
 
     return SQLITE_OK;
@@ -343,18 +1480,28 @@ int NdsUnicode61_close(sqlite3_tokenizer_cursor* pCursor)
 
 /**
  * Retrieve the NdsUnicode61 tokenizer module instance from a NdsUnicode61Cursor instance.
+ *
+ * This is the tokenizer of the language of the text, see NdsUnicode61_languageid().
  */
 static NdsUnicode61* NdsUnicode61_getModulefromCursor(NdsUnicode61Cursor* cursor)
 {
-    return (NdsUnicode61*)cursor->base.pTokenizer;
+    return cursor->module;
 }
 
 /**
  * Return true if given character is a diacritic character.
+ *
+ * With kana_fold, the non-combining voiced sound marks (half-width U+ff9e, U+ff9f and
+ * U+309b, U+309c) are diacritics too, so that they stay with the preceding kana, which
+ * then normalizes like the precomposed one.
  */
-static nds_bool NdsUnicode61_isDiacritic(unichar character)
+static nds_bool NdsUnicode61_isDiacritic(const NdsUnicode61* self, unichar character)
 {
-    /* TODO: How should non-combining JP diacritics (U+ff9e, U+ff9f) be tokenized? */
+    if (self->kanaFold && (character == 0xff9e || character == 0xff9f ||
+            character == 0x309b || character == 0x309c))
+    {
+        return NDS_TRUE;
+    }
     return UnicharIsCombiningMark(character);
 }
 
@@ -389,8 +1536,22 @@ static nds_bool NdsUnicode61_isEnd(NdsUnicode61Cursor const* cursor)
     return cursor->current == cursor->inputEnd;
 }
 
-/*
- * Read next unicode character from the input.
+/**
+ * Check if the current character starts a substitution id (see the substitution_prefix option).
+ */
+static nds_bool NdsUnicode61_isSubstitutionStart(NdsUnicode61Cursor* cursor)
+{
+    const NdsUnicode61* module = NdsUnicode61_getModulefromCursor(cursor);
+
+    return module->substitutionPrefixLen > 0 &&
+            cursor->current != NULL && !NdsUnicode61_isEnd(cursor) &&
+            cursor->currentCharacter == module->substitutionStart &&
+            (size_t)(cursor->inputEnd - cursor->current) >= module->substitutionPrefixLen &&
+            memcmp(cursor->current, module->substitutionPrefix, module->substitutionPrefixLen) == 0;
+}
+
+/*
+ * Read next unicode character from the input.
  *
  * \param[in,out] cursor The tokenizer's cursor. The reading starts from cursor->next. The value is adapted
  *                       to point to the next character if the read succeeded. The currently-read characted
@@ -768,11 +1929,77 @@ static nds_bool NdsUnicode61_isException(const NdsUnicode61* self, unichar c)
     return NDS_FALSE;
 }
 
-static nds_bool NdsUnicode61_isTokenChar(const NdsUnicode61* self, unichar c)
+/**
+ * Check if a given character can be a part of a token, without the class table.
+ *
+ * This is used while the exceptions are parsed, before the class table is set up.
+ */
+static nds_bool NdsUnicode61_computeIsTokenChar(const NdsUnicode61* self, unichar c)
 {
     return NdsUnicode61_isAlNum(c) ^ NdsUnicode61_isException(self, c);
 }
 
+/**
+ * Get the class of a character (combination of NDSUNICODE61_CLASS_* flags), exceptions included.
+ */
+static unsigned NdsUnicode61_getClass(const NdsUnicode61* self, unichar c)
+{
+    if (c < NDSUNICODE61_CLASS_LIMIT)
+    {
+        const NdsUnicode61ClassBlock* block =
+                &self->classBlocks[self->classIndex[c >> NDSUNICODE61_CLASS_BLOCK_SHIFT]];
+        const unsigned bit = (c & 15) * NDSUNICODE61_CLASS_BITS;
+        return (block->bits[(c >> 4) & (ARRAY_SIZE(block->bits) - 1)] >> bit) &
+                (NDSUNICODE61_CLASS_TOKENCHAR | NDSUNICODE61_CLASS_BIGRAMMABLE);
+    }
+
+    return (NdsUnicode61_computeIsTokenChar(self, c) ? NDSUNICODE61_CLASS_TOKENCHAR : 0) |
+            (NdsUnicode61_isBigrammable(c) ? NDSUNICODE61_CLASS_BIGRAMMABLE : 0);
+}
+
+static nds_bool NdsUnicode61_isTokenChar(const NdsUnicode61* self, unichar c)
+{
+    return (NdsUnicode61_getClass(self, c) & NDSUNICODE61_CLASS_TOKENCHAR) != 0;
+}
+
+/**
+ * Check whether a bigrammable character is segmented with the dictionary instead.
+ */
+static nds_bool NdsUnicode61_isSegmented(const NdsUnicode61* self, unichar c)
+{
+    unsigned script = 0;
+
+    if (self->segmentedScripts == 0)
+        return NDS_FALSE;
+
+    if (c >= 0xe00 && c < 0xe80)
+        script = NDSUNICODE61_SCRIPT_THAI;
+    else if (c >= 0xe80 && c < 0xf00)
+        script = NDSUNICODE61_SCRIPT_LAO;
+    else if (c >= 0x1780 && c < 0x1800)
+        script = NDSUNICODE61_SCRIPT_KHMER;
+
+    return (self->segmentedScripts & script) != 0;
+}
+
+/**
+ * Check whether a character continues a run of bigrammed characters.
+ */
+static nds_bool NdsUnicode61_continuesBigramRun(const NdsUnicode61* self, unichar c)
+{
+    return NdsUnicode61_getClass(self, c) == (NDSUNICODE61_CLASS_TOKENCHAR | NDSUNICODE61_CLASS_BIGRAMMABLE) &&
+            !NdsUnicode61_isSegmented(self, c);
+}
+
+/**
+ * Check whether a character continues a run of characters segmented with the dictionary.
+ */
+static nds_bool NdsUnicode61_continuesSegmentRun(const NdsUnicode61* self, unichar c)
+{
+    return NdsUnicode61_getClass(self, c) == (NDSUNICODE61_CLASS_TOKENCHAR | NDSUNICODE61_CLASS_BIGRAMMABLE) &&
+            NdsUnicode61_isSegmented(self, c);
+}
+
 static int NdsUnicode61_addExceptions(NdsUnicode61* self, nds_bool tokenChars, const char* chars)
 {
     const int len = strlen(chars);
@@ -786,7 +2013,7 @@ static int NdsUnicode61_addExceptions(NdsUnicode61* self, nds_bool tokenChars, c
          * A character present twice in input causes inefficient allocation (unused byte at the
          * end of the alnumExceptions array) but apart from that it causes no other issues.
          */
-        if (NdsUnicode61_isTokenChar(self, u) != tokenChars)
+        if (NdsUnicode61_computeIsTokenChar(self, u) != tokenChars)
             extraCharsCount++;
     }
 
@@ -803,7 +2030,7 @@ static int NdsUnicode61_addExceptions(NdsUnicode61* self, nds_bool tokenChars, c
         c = chars;
         while (DecodeNextUtf8CharToUnichar(&c, &l, &u))
         {
-            if (NdsUnicode61_isTokenChar(self, u) != tokenChars)
+            if (NdsUnicode61_computeIsTokenChar(self, u) != tokenChars)
             {
                 /* find where to insert u */
                 size_t insertIdx = 0;
@@ -832,6 +2059,122 @@ static int NdsUnicode61_addExceptions(NdsUnicode61* self, nds_bool tokenChars, c
     return SQLITE_OK;
 }
 
+/**
+ * Get the class block of a character for modification, making a private copy of it first
+ * unless it already is one.
+ */
+static NdsUnicode61ClassBlock* NdsUnicode61_privateClassBlock(unsigned short* index,
+        NdsUnicode61ClassBlock* blocks, size_t* blocksCount, unichar c)
+{
+    const size_t blockIdx = c >> NDSUNICODE61_CLASS_BLOCK_SHIFT;
+
+    if (index[blockIdx] < NdsUnicode61ClassBlocksCount)
+    {
+        assert(*blocksCount < 0xffff);
+        blocks[*blocksCount] = blocks[index[blockIdx]];
+        index[blockIdx] = (unsigned short)(*blocksCount)++;
+    }
+
+    return &blocks[index[blockIdx]];
+}
+
+static int NdsUnicode61_initClassTable(NdsUnicode61* self)
+{
+    unsigned short* index;
+    NdsUnicode61ClassBlock* blocks;
+    size_t blocksCount = NdsUnicode61ClassBlocksCount;
+    size_t affectedBlocks = 0;
+    size_t i;
+    unichar c;
+
+    self->classIndex = NdsUnicode61ClassIndex;
+    self->classBlocks = NdsUnicode61ClassBlocks;
+
+    /* the exceptions are sorted, so the characters of each block are adjacent */
+    for (i = 0; i < self->alnumExceptionsCount; i++)
+    {
+        const unichar c = self->alnumExceptions[i];
+        if (c < NDSUNICODE61_CLASS_LIMIT && (i == 0 ||
+                (c >> NDSUNICODE61_CLASS_BLOCK_SHIFT) !=
+                (self->alnumExceptions[i - 1] >> NDSUNICODE61_CLASS_BLOCK_SHIFT)))
+            affectedBlocks++;
+    }
+    if (self->kanaFold)
+    {
+        /* the full-width ASCII block, unless an exception already counted it */
+        affectedBlocks++;
+    }
+    if (affectedBlocks == 0)
+        return SQLITE_OK;
+
+    index = (unsigned short*)malloc(sizeof(NdsUnicode61ClassIndex));
+    blocks = (NdsUnicode61ClassBlock*)malloc(
+            (blocksCount + affectedBlocks) * sizeof(NdsUnicode61ClassBlock));
+    if (index == NULL || blocks == NULL)
+    {
+        free(index);
+        free(blocks);
+        return SQLITE_NOMEM;
+    }
+    memcpy(index, NdsUnicode61ClassIndex, sizeof(NdsUnicode61ClassIndex));
+    memcpy(blocks, NdsUnicode61ClassBlocks, blocksCount * sizeof(NdsUnicode61ClassBlock));
+
+    for (i = 0; i < self->alnumExceptionsCount; i++)
+    {
+        /* an exception flips the token character flag given by NdsUnicode61_isAlNum() */
+        NdsUnicode61ClassBlock* block;
+
+        c = self->alnumExceptions[i];
+        if (c >= NDSUNICODE61_CLASS_LIMIT)
+            break;
+
+        block = NdsUnicode61_privateClassBlock(index, blocks, &blocksCount, c);
+        block->bits[(c >> 4) & (ARRAY_SIZE(block->bits) - 1)] ^=
+                NDSUNICODE61_CLASS_TOKENCHAR << ((c & 15) * NDSUNICODE61_CLASS_BITS);
+    }
+
+    if (self->kanaFold)
+    {
+        /* full-width ASCII (U+ff01..U+ff5e) normalizes to ASCII, so it forms words, not bigrams */
+        for (c = 0xff01; c <= 0xff5e; c++)
+        {
+            NdsUnicode61ClassBlock* block = NdsUnicode61_privateClassBlock(index, blocks, &blocksCount, c);
+            block->bits[(c >> 4) & (ARRAY_SIZE(block->bits) - 1)] &=
+                    ~((unsigned)NDSUNICODE61_CLASS_BIGRAMMABLE << ((c & 15) * NDSUNICODE61_CLASS_BITS));
+        }
+    }
+    assert(blocksCount <= NdsUnicode61ClassBlocksCount + affectedBlocks);
+
+    self->classIndex = index;
+    self->classBlocks = blocks;
+    return SQLITE_OK;
+}
+
+static void NdsUnicode61_initAsciiTable(NdsUnicode61* self)
+{
+    unichar c;
+
+    for (c = 0; c < 128; c++)
+    {
+        /*
+         * ASCII characters have no decomposition and are not diacritics, so folding is all
+         * that NdsUnicode61_addTokenCodepoint() does to them. NUL can't be made a token
+         * character (the arguments are nul-terminated), so zero is free to mean separator.
+         */
+        self->asciiTokenChars[c] = NdsUnicode61_isTokenChar(self, c) ?
+                (unsigned char)sqlite3FtsUnicodeFold(c, self->removeDiacritics) : 0;
+    }
+}
+
+/**
+ * Check whether a byte of the input is an ASCII separator.
+ */
+static nds_bool NdsUnicode61_isAsciiSeparator(const NdsUnicode61* self, char c)
+{
+    const unsigned char b = (unsigned char)c;
+    return b < 0x80 && self->asciiTokenChars[b] == 0;
+}
+
 /**
  * Append a unicode codepoint to the token buffer.
  *
@@ -842,62 +2185,56 @@ static int NdsUnicode61_addExceptions(NdsUnicode61* self, nds_bool tokenChars, c
  */
 static nds_bool NdsUnicode61_addTokenCodepoint(NdsUnicode61Cursor* cursor, unichar character)
 {
-    const nds_bool removeDiacritics = NdsUnicode61_getModulefromCursor(cursor)->removeDiacritics;
+    const NdsUnicode61* module = NdsUnicode61_getModulefromCursor(cursor);
+    UnicharNormalizationForm form;
     unsigned i;
-    unichar const* decomposed = NULL;
-    unsigned decompositionLen = 0;
+    unichar const* normalized = NULL;
+    unsigned normalizedLen = 0;
 
-    /* resuse FTS code: case folding FTS and optional diacritic removal */
-    character = sqlite3FtsUnicodeFold(character, removeDiacritics);
-    if (character == 0)
-        return NDS_TRUE; /* 0 means character is completely ignored */
+    if (module->kanaFold)
+        form = module->removeDiacritics ? UnicharNormFoldRemoveDiacriticsKana : UnicharNormFoldKana;
+    else
+        form = module->removeDiacritics ? UnicharNormFoldRemoveDiacritics : UnicharNormFold;
 
-    if (!UnicharDecompose(character, &decomposed, &decompositionLen))
+    /*
+     * Case folding (FTS code, with optional diacritic removal), decomposition and stripping
+     * of the combining diacritics are precomputed in a single table. A length of 0 means
+     * the character is completely ignored.
+     */
+    if (!UnicharNormalize(character, form, &normalized, &normalizedLen))
     {
-        decomposed = &character;
-        decompositionLen = 1;
+        return StringBuffer_pushBackUnichar(&cursor->token, character);
     }
 
-
-    for (i = 0; i < decompositionLen; ++i)
+    for (i = 0; i < normalizedLen; ++i)
     {
-        const unichar c = decomposed[i];
-        if (!removeDiacritics || !NdsUnicode61_isDiacritic(c))
-        {
-            if (!StringBuffer_pushBackUnichar(&cursor->token, c))
-                return NDS_FALSE;
-        }
+        if (!StringBuffer_pushBackUnichar(&cursor->token, normalized[i]))
+            return NDS_FALSE;
     }
 
     return NDS_TRUE;
 }
 
 /**
- * Append the current character and any successive combining diacritics to the bigram buffer.
- *
- * The processing starts as cursor->current (cursor->currentCharacter), and if it's
- * a combining diacritics it continues reading subsequent characters as long as they are
- * combining diacritic and adding them to the token buffer.
+ * Move past the current character and append any successive combining diacritics to the token buffer.
  *
  * In the end, cursor->current points to the next character (no longer a combining diacritic)
  * or end (cursor->inputEnd) if there are no more characters in the input.
  *
- * \return true unless decoding (invalid utf8) or storing a character failed.
+ * \return true unless decoding (invalid utf8) failed.
  */
-static nds_bool NdsUnicode61_accumulateTokenCharacter(NdsUnicode61Cursor* cursor)
+static nds_bool NdsUnicode61_accumulateDiacritics(NdsUnicode61Cursor* cursor)
 {
     nds_bool success = NDS_TRUE;
     nds_bool cont = NDS_TRUE;
 
-    if (!NdsUnicode61_addTokenCodepoint(cursor, cursor->currentCharacter))
-        return NDS_FALSE;
-
     while (success && cont)
     {
         success = NdsUnicode61_getNextChar(cursor);
         if (success)
         {
-            cont = NdsUnicode61_isDiacritic(cursor->currentCharacter);
+            cont = NdsUnicode61_isDiacritic(NdsUnicode61_getModulefromCursor(cursor),
+                    cursor->currentCharacter);
             if (cont)
                 NdsUnicode61_addTokenCodepoint(cursor, cursor->currentCharacter);
         }
@@ -907,7 +2244,79 @@ static nds_bool NdsUnicode61_accumulateTokenCharacter(NdsUnicode61Cursor* cursor
 }
 
 /**
- * Move the current pointer until a non-separator or end is reached.
+ * Append the current character and any successive combining diacritics to the bigram buffer.
+ *
+ * The processing starts as cursor->current (cursor->currentCharacter), and if it's
+ * a combining diacritics it continues reading subsequent characters as long as they are
+ * combining diacritic and adding them to the token buffer.
+ *
+ * In the end, cursor->current points to the next character (no longer a combining diacritic)
+ * or end (cursor->inputEnd) if there are no more characters in the input.
+ *
+ * \return true unless decoding (invalid utf8) or storing a character failed.
+ */
+static nds_bool NdsUnicode61_accumulateTokenCharacter(NdsUnicode61Cursor* cursor)
+{
+    if (!NdsUnicode61_addTokenCodepoint(cursor, cursor->currentCharacter))
+        return NDS_FALSE;
+
+    return NdsUnicode61_accumulateDiacritics(cursor);
+}
+
+/**
+ * Append the run of ASCII token characters starting at the current character to the token buffer,
+ * followed by any combining diacritics.
+ *
+ * This is the fast path of NdsUnicode61_accumulateTokenCharacter() for Latin-script input: the
+ * bytes are case-folded through the table of the tokenizer without being decoded. The run ends
+ * at the first non-ASCII byte or ASCII separator, and the cursor is left in the same state as if
+ * NdsUnicode61_accumulateTokenCharacter() had been called for each character of the run.
+ *
+ * \return true unless decoding (invalid utf8) or storing a character failed.
+ */
+static nds_bool NdsUnicode61_accumulateAsciiRun(NdsUnicode61Cursor* cursor)
+{
+    const unsigned char* table = NdsUnicode61_getModulefromCursor(cursor)->asciiTokenChars;
+    const unsigned char* start = (const unsigned char*)cursor->current;
+    const unsigned char* end = (const unsigned char*)cursor->inputEnd;
+    const unsigned char* p = start;
+    StringBuffer* token = &cursor->token;
+    char* out;
+
+    while (p != end && *p < 0x80 && table[*p] != 0)
+        ++p;
+
+    if (!StringBuffer_ensureExtraCapacity(token, p - start))
+        return NDS_FALSE;
+
+    out = token->buffer + token->size;
+    token->size += p - start;
+    while (start != p)
+        *out++ = (char)table[*start++];
+
+    cursor->next = (const char*)p;
+    return NdsUnicode61_accumulateDiacritics(cursor);
+}
+
+/**
+ * Append the current character (and any successive combining diacritics) of a Latin token to the
+ * token buffer, taking the ASCII fast path where possible.
+ *
+ * \return true unless decoding (invalid utf8) or storing a character failed.
+ */
+static nds_bool NdsUnicode61_accumulateLatinCharacter(NdsUnicode61Cursor* cursor)
+{
+    const unichar c = cursor->currentCharacter;
+
+    if (c < 0x80 && NdsUnicode61_getModulefromCursor(cursor)->asciiTokenChars[c] != 0)
+        return NdsUnicode61_accumulateAsciiRun(cursor);
+
+    return NdsUnicode61_accumulateTokenCharacter(cursor);
+}
+
+/**
+ * Move the current pointer until a non-separator, the start of a substitution id or end is
+ * reached.
  *
  * \return False if decoding input failed, true otherwise.
  */
@@ -917,8 +2326,17 @@ static nds_bool NdsUnicode61_seekTokenStart(NdsUnicode61Cursor* cursor)
     nds_bool success;
     assert(cursor->state == Unknown);
 
+    /* the separator that ended the previous token may start an id */
+    if (NdsUnicode61_isSubstitutionStart(cursor))
+        return NDS_TRUE;
+
+    /* skip ASCII separators without decoding them */
+    while (cursor->next != cursor->inputEnd && NdsUnicode61_isAsciiSeparator(module, *cursor->next))
+        cursor->next++;
+
     success = NdsUnicode61_getNextChar(cursor);
-    while (success && !NdsUnicode61_isTokenChar(module, cursor->currentCharacter))
+    while (success && !NdsUnicode61_isTokenChar(module, cursor->currentCharacter) &&
+            !NdsUnicode61_isSubstitutionStart(cursor))
     {
         success = NdsUnicode61_getNextChar(cursor);
     }
@@ -926,6 +2344,147 @@ static nds_bool NdsUnicode61_seekTokenStart(NdsUnicode61Cursor* cursor)
     return NdsUnicode61_isEnd(cursor) || success;
 }
 
+/**
+ * Return the substitution id starting at the current character: the prefix and the token
+ * characters that follow it, up to a bigrammed one, as they are in the input.
+ *
+ * The cursor is left at the first character that is not part of the id, or at the end of the
+ * input, in the state to process that character.
+ *
+ * \return SQLITE_OK when operation succeeded, an error code otherwise.
+ */
+static int NdsUnicode61_nextSubstitution(NdsUnicode61Cursor* cursor, const char** ppToken,
+        int* pnBytes, int* piStartOffset, int* piEndOffset)
+{
+    const NdsUnicode61* module = NdsUnicode61_getModulefromCursor(cursor);
+    const char* start = cursor->current;
+    nds_bool success;
+
+    assert(NdsUnicode61_isSubstitutionStart(cursor));
+    cursor->next = start + module->substitutionPrefixLen;
+    do
+    {
+        success = NdsUnicode61_getNextChar(cursor);
+    } while (success &&
+            NdsUnicode61_getClass(module, cursor->currentCharacter) == NDSUNICODE61_CLASS_TOKENCHAR);
+
+    if (!success && !NdsUnicode61_isEnd(cursor))
+    {
+        /* invalid utf8 */
+        NdsUnicode61_resetCursor(cursor);
+        return SQLITE_ERROR;
+    }
+
+    /* continue with the bigrams of a CJK character that ends the id */
+    if (!NdsUnicode61_isEnd(cursor) && NdsUnicode61_isTokenChar(module, cursor->currentCharacter))
+        cursor->state = BigramStart;
+
+    *ppToken = start;
+    *pnBytes = (int)(cursor->current - start);
+    *piStartOffset = (int)(start - cursor->inputStart);
+    *piEndOffset = (int)(cursor->current - cursor->inputStart);
+    return SQLITE_OK;
+}
+
+/**
+ * Move past the Latin token starting at the current character without storing it.
+ *
+ * The cursor is left in the same state as by the loop of NdsUnicode61_nextLatin(): at the first
+ * character that is not part of the token, or at the end of the input.
+ *
+ * \param[in,out] cursor   The state of the cursor.
+ * \param[out]    nonAscii Set to true if the token contains a non-ASCII character.
+ *
+ * \return true unless decoding (invalid utf8) failed.
+ */
+static nds_bool NdsUnicode61_skipLatinToken(NdsUnicode61Cursor* cursor, nds_bool* nonAscii)
+{
+    const NdsUnicode61* module = NdsUnicode61_getModulefromCursor(cursor);
+    const unsigned char* table = module->asciiTokenChars;
+    unsigned characterClass;
+
+    *nonAscii = NDS_FALSE;
+    do
+    {
+        nds_bool success;
+
+        if (cursor->currentCharacter < 0x80 && table[cursor->currentCharacter] != 0)
+        {
+            const unsigned char* p = (const unsigned char*)cursor->current;
+            while (p != (const unsigned char*)cursor->inputEnd && *p < 0x80 && table[*p] != 0)
+                ++p;
+            cursor->next = (const char*)p;
+        }
+        else
+        {
+            *nonAscii = NDS_TRUE;
+        }
+
+        for (;;)
+        {
+            success = NdsUnicode61_getNextChar(cursor);
+            if (!success || !NdsUnicode61_isDiacritic(module, cursor->currentCharacter))
+                break;
+            *nonAscii = NDS_TRUE;
+        }
+        if (!success)
+            return NdsUnicode61_isEnd(cursor);
+
+        characterClass = NdsUnicode61_getClass(module, cursor->currentCharacter);
+    }
+    while ((characterClass & NDSUNICODE61_CLASS_BIGRAMMABLE) == 0 &&
+            (characterClass & NDSUNICODE61_CLASS_TOKENCHAR) != 0);
+
+    return NDS_TRUE;
+}
+
+/**
+ * Look up the Latin token starting at the current character in the token cache.
+ *
+ * On a hit, the token is stored in the token buffer and the cursor is moved past it like
+ * NdsUnicode61_nextLatin() does. Otherwise the cursor is left unchanged, and *keyLen is set to
+ * the length of the raw token if its normalized form is to be added to the cache (zero if not).
+ *
+ * ASCII tokens aren't looked up, the fast path of the ASCII characters costs less than the lookup.
+ *
+ * \return True on a hit.
+ */
+static nds_bool NdsUnicode61_nextCachedLatin(NdsUnicode61Cursor* cursor, int* pnBytes, size_t* keyLen,
+        nds_uint32* hash)
+{
+    NdsUnicode61* module = NdsUnicode61_getModulefromCursor(cursor);
+    const char* tokenStart = cursor->current;
+    const char* savedNext = cursor->next;
+    const unichar savedCharacter = cursor->currentCharacter;
+    const char* value;
+    size_t valueLen;
+    nds_bool nonAscii;
+
+    *keyLen = 0;
+    if (NdsUnicode61_skipLatinToken(cursor, &nonAscii) && nonAscii &&
+            cursor->current - tokenStart <= NDS_TOKEN_CACHE_MAX_KEY)
+    {
+        *keyLen = cursor->current - tokenStart;
+        *hash = NdsTokenCache_hash(tokenStart, *keyLen);
+        if (NdsTokenCache_find(&module->tokenCache, tokenStart, *keyLen, *hash, &value, &valueLen) &&
+                StringBuffer_ensureExtraCapacity(&cursor->token, valueLen))
+        {
+            memcpy(cursor->token.buffer, value, valueLen);
+            cursor->token.size = valueLen;
+            *pnBytes = (int)*keyLen;
+            cursor->state = (NdsUnicode61_isEnd(cursor) ||
+                    (NdsUnicode61_getClass(module, cursor->currentCharacter) & NDSUNICODE61_CLASS_TOKENCHAR) == 0) ?
+                    Unknown : BigramStart;
+            return NDS_TRUE;
+        }
+    }
+
+    cursor->current = tokenStart;
+    cursor->next = savedNext;
+    cursor->currentCharacter = savedCharacter;
+    return NDS_FALSE;
+}
+
 /**
  * Find the end of the current latin word.
  *
@@ -937,25 +2496,32 @@ static nds_bool NdsUnicode61_seekTokenStart(NdsUnicode61Cursor* cursor)
  */
 static int NdsUnicode61_nextLatin(NdsUnicode61Cursor* cursor, int* pnBytes)
 {
-    const NdsUnicode61* module = NdsUnicode61_getModulefromCursor(cursor);
+    NdsUnicode61* module = NdsUnicode61_getModulefromCursor(cursor);
     nds_bool currentIsCJK = NDS_FALSE;
     nds_bool currentIsSeparator = NDS_FALSE;
     nds_bool success = NDS_TRUE;
     const char* tokenStart = cursor->current;
+    size_t cacheKeyLen = 0;
+    nds_uint32 cacheHash = 0;
 
     assert(cursor->state == Latin);
 
     StringBuffer_flush(&cursor->token);
-    if (!NdsUnicode61_accumulateTokenCharacter(cursor))
+    if (module->tokenCache.entries != NULL &&
+            NdsUnicode61_nextCachedLatin(cursor, pnBytes, &cacheKeyLen, &cacheHash))
+        return SQLITE_OK;
+
+    if (!NdsUnicode61_accumulateLatinCharacter(cursor))
         return SQLITE_ERROR;
 
     while (success && !currentIsCJK && !currentIsSeparator && !NdsUnicode61_isEnd(cursor))
     {
-        currentIsCJK = NdsUnicode61_isBigrammable(cursor->currentCharacter);
-        currentIsSeparator = !NdsUnicode61_isTokenChar(module, cursor->currentCharacter);
+        const unsigned characterClass = NdsUnicode61_getClass(module, cursor->currentCharacter);
+        currentIsCJK = (characterClass & NDSUNICODE61_CLASS_BIGRAMMABLE) != 0;
+        currentIsSeparator = (characterClass & NDSUNICODE61_CLASS_TOKENCHAR) == 0;
         if (!currentIsCJK && !currentIsSeparator)
         {
-            success = NdsUnicode61_accumulateTokenCharacter(cursor);
+            success = NdsUnicode61_accumulateLatinCharacter(cursor);
         }
     }
 
@@ -981,6 +2547,12 @@ static int NdsUnicode61_nextLatin(NdsUnicode61Cursor* cursor, int* pnBytes)
         cursor->state = (currentIsSeparator) ? Unknown : BigramStart;
     }
 
+    if (cacheKeyLen != 0)
+    {
+        NdsTokenCache_insert(&module->tokenCache, tokenStart, cacheKeyLen, cacheHash,
+                cursor->token.buffer, cursor->token.size);
+    }
+
     return SQLITE_OK;
 }
 
@@ -1007,6 +2579,11 @@ static int NdsUnicode61_nextLatin(NdsUnicode61Cursor* cursor, int* pnBytes)
  *
  * If the next character is not bigrammable, the state is changed to Latin.
  *
+ * With the cjk_ngram option, every character is returned on its own in the BigramStart state
+ * when only unigrams are indexed. When both are indexed, the characters of a bigram are
+ * marked as pending unigrams (in index mode), to be returned by the following calls to
+ * NdsUnicode61_next().
+ *
  * \param[in,out] cursor    The state of the cursor.
  * \param[out]    haveToken set to true if a token has been extracted.
  * \return True unless an error has occurred.
@@ -1035,8 +2612,16 @@ static nds_bool NdsUnicode61_nextBigram(NdsUnicode61Cursor* cursor, nds_bool* ha
     if (!NdsUnicode61_isEnd(cursor))
     {
         const NdsUnicode61* module = NdsUnicode61_getModulefromCursor(cursor);
-        const nds_bool isSeparator = !NdsUnicode61_isTokenChar(module, cursor->currentCharacter);
-        if (!isSeparator && NdsUnicode61_isBigrammable(cursor->currentCharacter))
+        const unsigned characterClass = NdsUnicode61_getClass(module, cursor->currentCharacter);
+        const nds_bool isSeparator = (characterClass & NDSUNICODE61_CLASS_TOKENCHAR) == 0;
+        const nds_bool continuesRun = NdsUnicode61_continuesBigramRun(module, cursor->currentCharacter);
+        if (continuesRun && !module->cjkBigrams)
+        {
+            /* unigrams only: return the character, the next one starts over */
+            cursor->bigramOffset2 = cursor->current - cursor->inputStart;
+            *haveToken = NDS_TRUE;
+        }
+        else if (continuesRun)
         {
             /* we have a CJK bi-gram */
             cursor->bigramOffset2 = cursor->current - cursor->inputStart;
@@ -1045,6 +2630,8 @@ static nds_bool NdsUnicode61_nextBigram(NdsUnicode61Cursor* cursor, nds_bool* ha
 
             cursor->state = Bigram;
             *haveToken = NDS_TRUE;
+            if (module->cjkUnigrams && cursor->mode != QueryMode)
+                cursor->pendingUnigrams = NDSUNICODE61_FIRST_UNIGRAM;
         }
         else
         {
@@ -1056,7 +2643,10 @@ static nds_bool NdsUnicode61_nextBigram(NdsUnicode61Cursor* cursor, nds_bool* ha
             }
             /* else: nothing to do */
 
-            cursor->state = (isSeparator) ? Unknown : Latin;
+            if (isSeparator)
+                cursor->state = Unknown;
+            else
+                cursor->state = (characterClass & NDSUNICODE61_CLASS_BIGRAMMABLE) ? BigramStart : Latin;
         }
     }
     else
@@ -1076,49 +2666,872 @@ static nds_bool NdsUnicode61_nextBigram(NdsUnicode61Cursor* cursor, nds_bool* ha
 }
 
 /**
- * Implementation of the tokenizer's next callback. It's responsible for fetching the next token.
+ * Split the run of characters segmented with the dictionary that starts at the current character.
+ *
+ * The run is split by maximal matching: the segmentation covers as many characters as possible
+ * with dictionary words, and uses as few words as possible for that. The characters not covered
+ * by words are returned as bigrams by NdsUnicode61_nextSegment().
+ *
+ * \return True unless allocating the nodes failed.
  */
-int NdsUnicode61_next(sqlite3_tokenizer_cursor* pCursor, const char** ppToken, int* pnBytes,
-        int* piStartOffset, int* piEndOffset, int* piPosition)
+static nds_bool NdsUnicode61_segmentRun(NdsUnicode61Cursor* cursor)
 {
-    NdsUnicode61Cursor* cursor = (NdsUnicode61Cursor*)pCursor;
     const NdsUnicode61* module = NdsUnicode61_getModulefromCursor(cursor);
-    nds_bool haveToken = NDS_FALSE;
-
-    if (cursor == NULL)
-        return SQLITE_ERROR;
+    NdsUnicode61SegmentNode* nodes;
+    const char* p = cursor->next;
+    unsigned n = 0;
+    unsigned i;
 
-    while (!haveToken)
+    /* collect the character boundaries, combining diacritics belong to the preceding character */
+    for (;;)
     {
-        if (NdsUnicode61_isEnd(cursor))
-            return SQLITE_DONE;
+        const char* q = p;
+        nds_bool more = NDS_FALSE;
+        unichar c;
 
-        if (cursor->state == Unknown)
+        for (;;)
         {
-            nds_bool r = NdsUnicode61_seekTokenStart(cursor);
-            if (!r)
-                return SQLITE_ERROR;
+            int bytesLeft = cursor->inputEnd - p;
+            q = p;
+            if (bytesLeft == 0 || !DecodeNextUtf8CharToUnichar(&q, &bytesLeft, &c))
+                break;
+            if (!NdsUnicode61_isDiacritic(module, c))
+            {
+                more = NdsUnicode61_continuesSegmentRun(module, c);
+                break;
+            }
+            p = q;
+        }
 
-            if (NdsUnicode61_isEnd(cursor))
-                return SQLITE_DONE;
+        if (n + 2 > cursor->segmentNodesCapacity)
+        {
+            const size_t capacity = (cursor->segmentNodesCapacity > 0) ? 2 * cursor->segmentNodesCapacity : 32;
+            nodes = (NdsUnicode61SegmentNode*)realloc(cursor->segmentNodes,
+                    capacity * sizeof(NdsUnicode61SegmentNode));
+            if (nodes == NULL)
+                return NDS_FALSE;
 
-            cursor->state = (NdsUnicode61_isBigrammable(cursor->currentCharacter)) ? BigramStart : Latin;
+            cursor->segmentNodes = nodes;
+            cursor->segmentNodesCapacity = capacity;
         }
 
-        assert(cursor->state != Unknown);
+        n++;
+        cursor->segmentNodes[n].offset = p - cursor->inputStart;
+        if (!more)
+            break;
 
-        if (cursor->state == Latin)
-        {
-            int result;
-            size_t nBytes;
+        p = q;
+    }
 
-            *piStartOffset = cursor->current - cursor->inputStart;
-            result = NdsUnicode61_nextLatin(cursor, pnBytes);
-            if (result != SQLITE_OK)
+    nodes = cursor->segmentNodes;
+    nodes[0].offset = cursor->current - cursor->inputStart;
+    for (i = 0; i <= n; i++)
+    {
+        nodes[i].unknown = (unsigned)-1;
+        nodes[i].words = 0;
+        nodes[i].prev = 0;
+        nodes[i].isWord = NDS_FALSE;
+    }
+    nodes[0].unknown = 0;
+
+    for (i = 0; i < n; i++)
+    {
+        size_t matchLens[NDS_DICTIONARY_MAX_MATCHES];
+        const unsigned matchCount = NdsDictionary_findPrefixes(&module->dictionary,
+                cursor->inputStart + nodes[i].offset, nodes[n].offset - nodes[i].offset, matchLens);
+        unsigned j = i + 1;
+        unsigned m;
+
+        /* a character not covered by a word */
+        if (nodes[i].unknown + 1 < nodes[j].unknown ||
+                (nodes[i].unknown + 1 == nodes[j].unknown && nodes[i].words < nodes[j].words))
+        {
+            nodes[j].unknown = nodes[i].unknown + 1;
+            nodes[j].words = nodes[i].words;
+            nodes[j].prev = i;
+            nodes[j].isWord = NDS_FALSE;
+        }
+
+        /* the words starting here, shortest first; those ending within a character don't count */
+        for (m = 0; m < matchCount; m++)
+        {
+            const int end = nodes[i].offset + (int)matchLens[m];
+            while (j < n && nodes[j].offset < end)
+                j++;
+            if (nodes[j].offset != end)
+                continue;
+
+            if (nodes[i].unknown < nodes[j].unknown ||
+                    (nodes[i].unknown == nodes[j].unknown && nodes[i].words + 1 < nodes[j].words))
+            {
+                nodes[j].unknown = nodes[i].unknown;
+                nodes[j].words = nodes[i].words + 1;
+                nodes[j].prev = i;
+                nodes[j].isWord = NDS_TRUE;
+            }
+        }
+    }
+
+    /* turn the best segmentation into forward steps */
+    for (i = n; i > 0; i = nodes[i].prev)
+    {
+        nodes[nodes[i].prev].next = i;
+        nodes[nodes[i].prev].nextIsWord = nodes[i].isWord;
+    }
+
+    cursor->segmentLength = n;
+    cursor->segmentPos = 0;
+    cursor->segmentUnknownEnd = 0;
+    return NDS_TRUE;
+}
+
+/**
+ * Read the characters between two offsets into the token buffer.
+ *
+ * In the end, cursor->current points to the character at the end offset.
+ *
+ * \return true unless decoding (invalid utf8) or storing a character failed.
+ */
+static nds_bool NdsUnicode61_accumulateRange(NdsUnicode61Cursor* cursor, int startOffset, int endOffset)
+{
+    const char* end = cursor->inputStart + endOffset;
+
+    StringBuffer_flush(&cursor->token);
+    cursor->next = cursor->inputStart + startOffset;
+    if (!NdsUnicode61_getNextChar(cursor))
+        return NDS_FALSE;
+
+    while (cursor->current < end)
+    {
+        if (!NdsUnicode61_accumulateTokenCharacter(cursor))
+            return NDS_FALSE;
+    }
+
+    return NDS_TRUE;
+}
+
+/**
+ * Implementation of "next" callback for the Segment state.
+ *
+ * Returns the next word of the run split by NdsUnicode61_segmentRun(), or the next bigram of
+ * a stretch of characters that is not covered by words. Once the run is exhausted, the state
+ * is set according to the character that follows it.
+ *
+ * \return SQLITE_OK unless an error has occurred.
+ */
+static int NdsUnicode61_nextSegment(NdsUnicode61Cursor* cursor, int* piStartOffset, int* piEndOffset)
+{
+    const NdsUnicode61SegmentNode* nodes = cursor->segmentNodes;
+    const unsigned i = cursor->segmentPos;
+    unsigned end;
+
+    assert(cursor->state == Segment && i < cursor->segmentLength);
+
+    if (nodes[i].nextIsWord)
+    {
+        end = nodes[i].next;
+        cursor->segmentPos = end;
+        *piEndOffset = nodes[end].offset;
+    }
+    else
+    {
+        if (cursor->segmentUnknownEnd <= i)
+        {
+            /* find the end of the unknown stretch starting here */
+            unsigned u = i;
+            while (u < cursor->segmentLength && !nodes[u].nextIsWord)
+                u++;
+            cursor->segmentUnknownEnd = u;
+        }
+
+        if (cursor->segmentUnknownEnd - i == 1)
+        {
+            /* a single unknown character -> return it as a token */
+            end = i + 1;
+            cursor->segmentPos = end;
+            *piEndOffset = nodes[end].offset;
+        }
+        else
+        {
+            /* like elsewhere, all but the last bigram end at their second character */
+            end = i + 2;
+            if (end == cursor->segmentUnknownEnd)
+            {
+                cursor->segmentPos = end;
+                *piEndOffset = nodes[end].offset;
+            }
+            else
+            {
+                cursor->segmentPos = i + 1;
+                *piEndOffset = nodes[i + 1].offset;
+            }
+        }
+    }
+
+    *piStartOffset = nodes[i].offset;
+    if (!NdsUnicode61_accumulateRange(cursor, nodes[i].offset, nodes[end].offset))
+    {
+        /* invalid utf8 input */
+        NdsUnicode61_resetCursor(cursor);
+        return SQLITE_ERROR;
+    }
+
+    if (cursor->segmentPos == cursor->segmentLength)
+    {
+        /* the run is over, continue with the character that follows it */
+        if (NdsUnicode61_isEnd(cursor))
+        {
+            cursor->state = Unknown;
+        }
+        else
+        {
+            const unsigned characterClass = NdsUnicode61_getClass(NdsUnicode61_getModulefromCursor(cursor),
+                    cursor->currentCharacter);
+            if ((characterClass & NDSUNICODE61_CLASS_TOKENCHAR) == 0)
+                cursor->state = Unknown;
+            else
+                cursor->state = (characterClass & NDSUNICODE61_CLASS_BIGRAMMABLE) ? BigramStart : Latin;
+        }
+    }
+
+    return SQLITE_OK;
+}
+
+/**
+ * Check whether the current character is the last one of a run of bigrammable characters.
+ *
+ * Only the characters following the current one are decoded; the cursor is not moved.
+ */
+static nds_bool NdsUnicode61_isLastOfBigramRun(NdsUnicode61Cursor* cursor)
+{
+    const NdsUnicode61* module = NdsUnicode61_getModulefromCursor(cursor);
+    const char* next = cursor->next;
+    int bytesLeft = cursor->inputEnd - cursor->next;
+    unichar c;
+
+    /* combining diacritics belong to the current character */
+    do
+    {
+        if (bytesLeft == 0 || !DecodeNextUtf8CharToUnichar(&next, &bytesLeft, &c))
+            return NDS_TRUE;
+    } while (NdsUnicode61_isDiacritic(module, c));
+
+    return !NdsUnicode61_continuesBigramRun(module, c);
+}
+
+/**
+ * Return the next pending unigram of the last returned bigram.
+ */
+static void NdsUnicode61_nextPendingUnigram(NdsUnicode61Cursor* cursor, const char** ppToken,
+        int* pnBytes, int* piStartOffset, int* piEndOffset)
+{
+    const char* bigram;
+    size_t size;
+
+    StringBuffer_getBuffer(&cursor->token, &bigram, &size);
+    if (cursor->pendingUnigrams & NDSUNICODE61_FIRST_UNIGRAM)
+    {
+        cursor->pendingUnigrams &= ~NDSUNICODE61_FIRST_UNIGRAM;
+        *ppToken = bigram;
+        *pnBytes = (int)cursor->bigramFirstCharSize;
+        *piStartOffset = cursor->bigramOffset1;
+        *piEndOffset = cursor->bigramOffset2;
+    }
+    else
+    {
+        assert(cursor->pendingUnigrams == NDSUNICODE61_SECOND_UNIGRAM);
+        cursor->pendingUnigrams = 0;
+        *ppToken = bigram + cursor->bigramFirstCharSize;
+        *pnBytes = (int)(size - cursor->bigramFirstCharSize);
+        *piStartOffset = cursor->bigramOffset2;
+        *piEndOffset = cursor->current - cursor->inputStart;
+    }
+}
+
+/**
+ * Queue an extra token to be returned at the position of the last returned token, followed by
+ * its edge n-grams if edgeNgrams is true.
+ *
+ * The queue is drained before another token is read, so it is empty unless the tokens belong
+ * to the same token.
+ */
+static void NdsUnicode61_queueToken(NdsUnicode61Cursor* cursor, const char* token, int nBytes,
+        int startOffset, int endOffset, nds_bool edgeNgrams)
+{
+    NdsUnicode61PendingToken* pending;
+
+    if (cursor->pendingTokensNext == cursor->pendingTokensCount)
+    {
+        cursor->pendingTokensCount = 0;
+        cursor->pendingTokensNext = 0;
+    }
+
+    assert(cursor->pendingTokensCount < NDSUNICODE61_MAX_PENDING_TOKENS);
+    pending = &cursor->pendingTokens[cursor->pendingTokensCount++];
+    pending->token = token;
+    pending->nBytes = nBytes;
+    pending->startOffset = startOffset;
+    pending->endOffset = endOffset;
+    pending->edgeNgrams = edgeNgrams;
+    pending->nextPosition = NDS_FALSE;
+}
+
+/**
+ * Queue the choseong (initial consonants) of a token made of one or two Hangul syllables, see the
+ * hangul_choseong option. Other tokens have none.
+ *
+ * The syllables are decomposed arithmetically; the initial consonants are returned as the
+ * compatibility jamo (U+3131..U+314E) that keyboards produce, so that a query typed as
+ * initials is bigrammed the same way.
+ */
+static void NdsUnicode61_addChoseong(NdsUnicode61Cursor* cursor, const char* token, int nBytes,
+        int startOffset, int endOffset)
+{
+    /* the compatibility jamo of the 19 initial consonants */
+    static const unsigned short CHOSEONG[] = {
+            0x3131, 0x3132, 0x3134, 0x3137, 0x3138, 0x3139, 0x3141, 0x3142, 0x3143, 0x3145,
+            0x3146, 0x3147, 0x3148, 0x3149, 0x314a, 0x314b, 0x314c, 0x314d, 0x314e
+    };
+    char* out = cursor->choseong;
+    unsigned count = 0;
+    unichar c;
+
+    while (nBytes > 0)
+    {
+        if (!DecodeNextUtf8CharToUnichar(&token, &nBytes, &c))
+            return;
+
+        if (c < NDSUNICODE61_HANGUL_FIRST || c > NDSUNICODE61_HANGUL_LAST || count == 2)
+            return;
+
+        /* syllable = FIRST + (initial * 21 + medial) * 28 + final */
+        if (!WriteUnicharAsUtf8(CHOSEONG[(c - NDSUNICODE61_HANGUL_FIRST) / (21 * 28)], &out,
+                cursor->choseong + sizeof(cursor->choseong)))
+            return;
+        count++;
+    }
+
+    if (count > 0)
+        NdsUnicode61_queueToken(cursor, cursor->choseong, out - cursor->choseong, startOffset, endOffset,
+                NDS_FALSE);
+}
+
+/**
+ * Look up the pinyin syllable of a character, see NdsPinyin_lookup().
+ *
+ * Compatibility ideographs are looked up as the unified ideographs they decompose to.
+ */
+static const char* NdsUnicode61_pinyinOf(const NdsUnicode61* self, unichar c, size_t* len)
+{
+    unichar const* decomposed;
+    unsigned decomposedLen;
+
+    if (UnicharNormalize(c, UnicharNormDecompose, &decomposed, &decomposedLen) && decomposedLen == 1)
+        c = decomposed[0];
+
+    return NdsPinyin_lookup(&self->pinyin, c, len);
+}
+
+/**
+ * Queue a pinyin token for the character at an offset of the input, if the character has a reading,
+ * at the position of the last returned token or, if nextPosition is true, at the following one.
+ */
+static void NdsUnicode61_addPinyinSyllable(NdsUnicode61Cursor* cursor, int startOffset, int endOffset,
+        nds_bool nextPosition)
+{
+    const NdsUnicode61* module = NdsUnicode61_getModulefromCursor(cursor);
+    const char* p = cursor->inputStart + startOffset;
+    int bytesLeft = endOffset - startOffset;
+    const char* syllable;
+    size_t len;
+    unichar c;
+
+    if (!DecodeNextUtf8CharToUnichar(&p, &bytesLeft, &c))
+        return;
+
+    syllable = NdsUnicode61_pinyinOf(module, c, &len);
+    if (syllable == NULL)
+        return;
+
+    NdsUnicode61_queueToken(cursor, syllable, (int)len, startOffset, endOffset, NDS_TRUE);
+    cursor->pendingTokens[cursor->pendingTokensCount - 1].nextPosition = nextPosition;
+}
+
+/**
+ * Queue the initials of the run of characters with a pinyin reading that starts at an offset
+ * of the input, unless the run is shorter than two characters.
+ *
+ * \return True unless storing the initials failed.
+ */
+static nds_bool NdsUnicode61_addPinyinInitials(NdsUnicode61Cursor* cursor, int startOffset)
+{
+    const NdsUnicode61* module = NdsUnicode61_getModulefromCursor(cursor);
+    const char* p = cursor->inputStart + startOffset;
+    unsigned count = 0;
+
+    StringBuffer_flush(&cursor->pinyinInitials);
+    for (;;)
+    {
+        const char* q = p;
+        int bytesLeft = cursor->inputEnd - p;
+        const char* syllable;
+        size_t len;
+        unichar c;
+
+        if (bytesLeft == 0 || !DecodeNextUtf8CharToUnichar(&q, &bytesLeft, &c))
+            break;
+
+        /* combining diacritics belong to the preceding character */
+        if (count == 0 || !NdsUnicode61_isDiacritic(module, c))
+        {
+            if (!NdsUnicode61_continuesBigramRun(module, c))
+                break;
+
+            syllable = NdsUnicode61_pinyinOf(module, c, &len);
+            if (syllable == NULL)
+                break;
+
+            if (!StringBuffer_pushBackUnichar(&cursor->pinyinInitials, (unichar)(unsigned char)syllable[0]))
+                return NDS_FALSE;
+            count++;
+        }
+        p = q;
+    }
+    cursor->pinyinRunEnd = p;
+
+    if (count >= 2)
+    {
+        NdsUnicode61_queueToken(cursor, cursor->pinyinInitials.buffer,
+                (int)StringBuffer_getSize(&cursor->pinyinInitials), startOffset, p - cursor->inputStart,
+                NDS_TRUE);
+    }
+    return NDS_TRUE;
+}
+
+/**
+ * Queue the pinyin tokens of the bigram (or single character) that has just been returned.
+ *
+ * The initials of a run are queued with its first bigram, so that their position is not lower
+ * than that of an earlier occurrence of the same term (a syllable of the run).
+ *
+ * \param[in,out] cursor      The state of the cursor.
+ * \param[in]     lastBigram  Whether the bigram is the last one of its run.
+ * \param[in]     endOffset   End offset of the token.
+ *
+ * \return True unless storing the initials failed.
+ */
+static nds_bool NdsUnicode61_startPinyin(NdsUnicode61Cursor* cursor, nds_bool lastBigram, int endOffset)
+{
+    const nds_bool isBigram = cursor->bigramFirstCharSize < StringBuffer_getSize(&cursor->token);
+    const int firstEnd = isBigram ? cursor->bigramOffset2 : endOffset;
+
+    if (cursor->pinyinRunEnd == NULL || cursor->inputStart + cursor->bigramOffset1 >= cursor->pinyinRunEnd)
+    {
+        if (!NdsUnicode61_addPinyinInitials(cursor, cursor->bigramOffset1))
+            return NDS_FALSE;
+    }
+
+    NdsUnicode61_addPinyinSyllable(cursor, cursor->bigramOffset1, firstEnd, NDS_FALSE);
+    if (isBigram && lastBigram)
+    {
+        /*
+         * no bigram starts at the last character, so its syllable is queued here, at the position
+         * a bigram starting at it would have, so that a phrase of the syllables matches the run
+         */
+        NdsUnicode61_addPinyinSyllable(cursor, cursor->bigramOffset2, endOffset, NDS_TRUE);
+    }
+    return NDS_TRUE;
+}
+
+/**
+ * Check whether a byte of the input separates the digit groups of a phone number.
+ */
+static nds_bool NdsUnicode61_isPhoneSeparator(const NdsUnicode61* self, char c)
+{
+    return c != '\0' && strchr(NDSUNICODE61_PHONE_SEPARATORS, c) != NULL &&
+            NdsUnicode61_isAsciiSeparator(self, c);
+}
+
+/**
+ * Check whether the digit group start..end-1 of the input is a "(0)", the trunk prefix that
+ * international numbers are sometimes written with.
+ */
+static nds_bool NdsUnicode61_isTrunkPrefixGroup(NdsUnicode61Cursor* cursor, const char* start,
+        const char* end)
+{
+    return end - start == 1 && *start == '0' && start > cursor->inputStart && start[-1] == '(' &&
+            end < cursor->inputEnd && *end == ')';
+}
+
+/**
+ * Check whether the token start..end-1 of the input is a "(0)" group between two digit groups of
+ * a phone number ("+49 (0)89"), which shares the position of the group that follows it.
+ */
+static nds_bool NdsUnicode61_isTrunkPrefix(NdsUnicode61Cursor* cursor, const char* start, const char* end)
+{
+    const NdsUnicode61* module = NdsUnicode61_getModulefromCursor(cursor);
+    const char* before = start;
+    const char* after = end;
+
+    if (!NdsUnicode61_isTrunkPrefixGroup(cursor, start, end))
+        return NDS_FALSE;
+
+    while (before > cursor->inputStart && NdsUnicode61_isPhoneSeparator(module, before[-1]))
+        before--;
+    while (after < cursor->inputEnd && NdsUnicode61_isPhoneSeparator(module, *after))
+        after++;
+
+    return before > cursor->inputStart && before[-1] >= '0' && before[-1] <= '9' &&
+            after < cursor->inputEnd && *after >= '0' && *after <= '9';
+}
+
+/**
+ * Queue the joined forms of the run of digit groups that the digit token that has just been
+ * returned belongs to, see the phone_numbers option.
+ *
+ * The forms are returned with the group they start at, so only the following groups need to
+ * be read ahead: the suffix of the run from this group, and for the second group of an
+ * international number the national forms, which are the group and that suffix preceded by
+ * the trunk prefix.
+ *
+ * \return True unless storing the number failed.
+ */
+static nds_bool NdsUnicode61_startPhoneNumber(NdsUnicode61Cursor* cursor, const char* token,
+        int nBytes, int startOffset, int endOffset)
+{
+    const NdsUnicode61* module = NdsUnicode61_getModulefromCursor(cursor);
+    StringBuffer* number = &cursor->phoneNumber;
+    const char* p = cursor->inputStart + endOffset;
+    unsigned groups = 1;
+    int i;
+
+    for (i = 0; i < nBytes; i++)
+    {
+        if (token[i] < '0' || token[i] > '9')
+            return NDS_TRUE;
+    }
+
+    if (cursor->phoneRunEnd != NULL && cursor->inputStart + startOffset < cursor->phoneRunEnd)
+    {
+        if (NdsUnicode61_isTrunkPrefixGroup(cursor, cursor->inputStart + startOffset, p))
+            return NDS_TRUE;
+        cursor->phoneGroup++;
+    }
+    else
+    {
+        cursor->phoneGroup = 1;
+        cursor->phoneInternational = startOffset > 0 && cursor->inputStart[startOffset - 1] == '+';
+    }
+
+    StringBuffer_flush(number);
+    if (!StringBuffer_ensureExtraCapacity(number, nBytes + 1))
+        return NDS_FALSE;
+    number->buffer[0] = '0';
+    memcpy(number->buffer + 1, token, nBytes);
+    number->size = nBytes + 1;
+
+    /* append the following groups of the run */
+    cursor->phoneRunEnd = p;
+    for (;;)
+    {
+        const char* groupStart = p;
+        const char* groupEnd;
+
+        while (groupStart < cursor->inputEnd && NdsUnicode61_isPhoneSeparator(module, *groupStart))
+            groupStart++;
+        if (groupStart == p || groupStart == cursor->inputEnd || *groupStart < '0' || *groupStart > '9')
+            break;
+
+        groupEnd = groupStart;
+        while (groupEnd < cursor->inputEnd && *groupEnd >= '0' && *groupEnd <= '9')
+            groupEnd++;
+        if (groupEnd < cursor->inputEnd && !NdsUnicode61_isAsciiSeparator(module, *groupEnd))
+        {
+            /* the digits start a longer token */
+            break;
+        }
+
+        if (!NdsUnicode61_isTrunkPrefixGroup(cursor, groupStart, groupEnd))
+        {
+            if (!StringBuffer_ensureExtraCapacity(number, groupEnd - groupStart))
+                return NDS_FALSE;
+            memcpy(number->buffer + number->size, groupStart, groupEnd - groupStart);
+            number->size += groupEnd - groupStart;
+            groups++;
+        }
+        p = groupEnd;
+        cursor->phoneRunEnd = p;
+    }
+
+    if (groups > 1)
+    {
+        NdsUnicode61_queueToken(cursor, number->buffer + 1, (int)number->size - 1, startOffset,
+                cursor->phoneRunEnd - cursor->inputStart, NDS_TRUE);
+    }
+    if (cursor->phoneInternational && cursor->phoneGroup == 2)
+    {
+        NdsUnicode61_queueToken(cursor, number->buffer, nBytes + 1, startOffset, endOffset, NDS_TRUE);
+        if (groups > 1)
+        {
+            NdsUnicode61_queueToken(cursor, number->buffer, (int)number->size, startOffset,
+                    cursor->phoneRunEnd - cursor->inputStart, NDS_TRUE);
+        }
+    }
+    return NDS_TRUE;
+}
+
+/**
+ * Extend the edge n-gram by one character.
+ */
+static void NdsUnicode61_extendEdgeNgram(NdsUnicode61Cursor* cursor)
+{
+    const char* ngram;
+    size_t size;
+
+    StringBuffer_getBuffer(&cursor->edgeNgram, &ngram, &size);
+    assert(cursor->edgeNgramSize < size);
+    do
+    {
+        cursor->edgeNgramSize++;
+    } while (cursor->edgeNgramSize < size && IsUtf8ContinuationByte(ngram[cursor->edgeNgramSize]));
+}
+
+/**
+ * Prepare the edge n-grams of a token of charCount characters, at least edgeNgramMin, to be
+ * returned after it.
+ *
+ * \return True unless storing the n-gram failed.
+ */
+static nds_bool NdsUnicode61_prepareEdgeNgrams(NdsUnicode61Cursor* cursor, const char* token,
+        size_t tokenSize, unsigned charCount, int startOffset, int endOffset, int position)
+{
+    const NdsUnicode61* module = NdsUnicode61_getModulefromCursor(cursor);
+    StringBuffer* ngram = &cursor->edgeNgram;
+    unsigned i;
+
+    StringBuffer_flush(ngram);
+    if (!StringBuffer_ensureExtraCapacity(ngram, tokenSize + 1))
+        return NDS_FALSE;
+
+    ngram->buffer[0] = NDSUNICODE61_EDGE_NGRAM_MARKER;
+    memcpy(ngram->buffer + 1, token, tokenSize);
+    ngram->size = tokenSize + 1;
+
+    /* the first n-gram returned is one character longer than this */
+    cursor->edgeNgramSize = 1;
+    for (i = 1; i < module->edgeNgramMin; i++)
+        NdsUnicode61_extendEdgeNgram(cursor);
+
+    cursor->edgeNgramsLeft = ((charCount < module->edgeNgramMax) ? charCount : module->edgeNgramMax) -
+            module->edgeNgramMin + 1;
+    cursor->edgeNgramStartOffset = startOffset;
+    cursor->edgeNgramEndOffset = endOffset;
+    cursor->edgeNgramPosition = position;
+    return NDS_TRUE;
+}
+
+/**
+ * Prepare the edge n-grams of the Latin token that has just been read into the token buffer.
+ *
+ * A token edgeNgramMin to edgeNgramMax characters long and directly followed by '*' is a prefix
+ * query outside document mode: the token is replaced by the matching n-gram term and its end
+ * offset is moved past the '*', so that FTS looks the term up instead of expanding the prefix.
+ * In term mode the token itself and its other n-grams follow, in query mode no n-grams are
+ * emitted.
+ *
+ * \param[in,out] cursor       The state of the cursor.
+ * \param[in,out] ppToken      The token to be returned.
+ * \param[in,out] pnBytes      Size of the token to be returned.
+ * \param[in]     startOffset  Start offset of the token.
+ * \param[in,out] piEndOffset  End offset of the token.
+ * \return True unless storing the n-gram failed.
+ */
+static nds_bool NdsUnicode61_startEdgeNgrams(NdsUnicode61Cursor* cursor, const char** ppToken,
+        int* pnBytes, int startOffset, int* piEndOffset)
+{
+    const NdsUnicode61* module = NdsUnicode61_getModulefromCursor(cursor);
+    const char* token;
+    size_t tokenSize;
+    unsigned charCount;
+    nds_bool prefix;
+
+    if (module->edgeNgramMax == 0)
+        return NDS_TRUE;
+
+    StringBuffer_getBuffer(&cursor->token, &token, &tokenSize);
+    charCount = GetUtf8StringCharCount(token, (int)tokenSize);
+    if (charCount < module->edgeNgramMin)
+        return NDS_TRUE;
+
+    prefix = cursor->mode != DocumentMode && charCount <= module->edgeNgramMax &&
+            !NdsUnicode61_isEnd(cursor) && *cursor->current == '*';
+    if (cursor->mode == QueryMode && !prefix)
+        return NDS_TRUE;
+
+    if (!NdsUnicode61_prepareEdgeNgrams(cursor, token, tokenSize, charCount, startOffset, *piEndOffset,
+            cursor->index))
+        return NDS_FALSE;
+
+    if (prefix)
+    {
+        /* the whole n-gram goes first, the token and the shorter n-grams follow in term mode */
+        if (cursor->mode == TermMode)
+            NdsUnicode61_queueToken(cursor, token, (int)tokenSize, startOffset, *piEndOffset, NDS_FALSE);
+        cursor->edgeNgramsLeft = (cursor->mode == TermMode) ? cursor->edgeNgramsLeft - 1 : 0;
+        *ppToken = cursor->edgeNgram.buffer;
+        *pnBytes = (int)cursor->edgeNgram.size;
+        *piEndOffset += 1;
+    }
+    return NDS_TRUE;
+}
+
+/**
+ * Implementation of the tokenizer's next callback. It's responsible for fetching the next token.
+ */
+int NdsUnicode61_next(sqlite3_tokenizer_cursor* pCursor, const char** ppToken, int* pnBytes,
+        int* piStartOffset, int* piEndOffset, int* piPosition)
+{
+    NdsUnicode61Cursor* cursor = (NdsUnicode61Cursor*)pCursor;
+    const NdsUnicode61* module = NdsUnicode61_getModulefromCursor(cursor);
+    nds_bool haveToken = NDS_FALSE;
+    nds_bool sharesPosition = NDS_FALSE;
+
+    if (cursor == NULL)
+        return SQLITE_ERROR;
+
+    if (cursor->replayPending)
+    {
+        cursor->replayPending = NDS_FALSE;
+        if (module->queryCache.buckets != NULL)
+        {
+            const int r = NdsUnicode61_startReplay(cursor->module, cursor, cursor->inputStart,
+                    (size_t)(cursor->inputEnd - cursor->inputStart));
+            if (r != SQLITE_OK)
+                return r;
+        }
+    }
+
+    if (cursor->replaying)
+        return NdsUnicode61_nextReplayed(cursor, ppToken, pnBytes, piStartOffset, piEndOffset, piPosition);
+
+    if (cursor->edgeNgramsLeft > 0)
+    {
+        /* the edge n-grams share the position of their token */
+        NdsUnicode61_extendEdgeNgram(cursor);
+        cursor->edgeNgramsLeft--;
+        *ppToken = cursor->edgeNgram.buffer;
+        *pnBytes = (int)cursor->edgeNgramSize;
+        *piStartOffset = cursor->edgeNgramStartOffset;
+        *piEndOffset = cursor->edgeNgramEndOffset;
+        *piPosition = cursor->edgeNgramPosition;
+        return SQLITE_OK;
+    }
+
+    if (cursor->pendingTokensNext < cursor->pendingTokensCount)
+    {
+        /* the extra tokens share the position of their bigram, their n-grams follow them */
+        const NdsUnicode61PendingToken* pending = &cursor->pendingTokens[cursor->pendingTokensNext++];
+        *piPosition = pending->nextPosition ? cursor->index : cursor->index - 1;
+        if (pending->edgeNgrams && module->edgeNgramMax > 0)
+        {
+            const unsigned charCount = GetUtf8StringCharCount(pending->token, pending->nBytes);
+            if (charCount >= module->edgeNgramMin &&
+                    !NdsUnicode61_prepareEdgeNgrams(cursor, pending->token, (size_t)pending->nBytes,
+                            charCount, pending->startOffset, pending->endOffset, *piPosition))
+                return SQLITE_NOMEM;
+        }
+        *ppToken = pending->token;
+        *pnBytes = pending->nBytes;
+        *piStartOffset = pending->startOffset;
+        *piEndOffset = pending->endOffset;
+        return SQLITE_OK;
+    }
+
+    if (cursor->pendingUnigrams != 0)
+    {
+        /* the unigrams share the position of their bigram */
+        NdsUnicode61_nextPendingUnigram(cursor, ppToken, pnBytes, piStartOffset, piEndOffset);
+        if (module->hangulChoseong)
+            NdsUnicode61_addChoseong(cursor, *ppToken, *pnBytes, *piStartOffset, *piEndOffset);
+        *piPosition = cursor->index - 1;
+        return SQLITE_OK;
+    }
+
+
+    while (!haveToken)
+    {
+        if (NdsUnicode61_isEnd(cursor))
+            return SQLITE_DONE;
+
+        if (cursor->state == Unknown)
+        {
+            nds_bool r = NdsUnicode61_seekTokenStart(cursor);
+            if (!r)
+                return SQLITE_ERROR;
+
+            if (NdsUnicode61_isEnd(cursor))
+                return SQLITE_DONE;
+
+            if (!NdsUnicode61_isTokenChar(module, cursor->currentCharacter))
+            {
+                /* a separator is only sought out when it starts a substitution id */
+                int r = NdsUnicode61_nextSubstitution(cursor, ppToken, pnBytes, piStartOffset,
+                        piEndOffset);
+                if (r != SQLITE_OK)
+                    return r;
+                break;
+            }
+
+            cursor->state = (NdsUnicode61_getClass(module, cursor->currentCharacter) &
+                    NDSUNICODE61_CLASS_BIGRAMMABLE) ? BigramStart : Latin;
+        }
+
+        assert(cursor->state != Unknown);
+
+        if (cursor->state == BigramStart &&
+                NdsUnicode61_isSegmented(module, cursor->currentCharacter))
+        {
+            if (!NdsUnicode61_segmentRun(cursor))
+                return SQLITE_NOMEM;
+            cursor->state = Segment;
+        }
+
+        if (cursor->state == Segment)
+        {
+            size_t nBytes;
+            int r = NdsUnicode61_nextSegment(cursor, piStartOffset, piEndOffset);
+            if (r != SQLITE_OK)
+                return r;
+
+            StringBuffer_getBuffer(&cursor->token, ppToken, &nBytes);
+            *pnBytes = (int)nBytes;
+            haveToken = NDS_TRUE;
+        }
+        else if (cursor->state == Latin)
+        {
+            int result;
+            size_t nBytes;
+
+            *piStartOffset = cursor->current - cursor->inputStart;
+            result = NdsUnicode61_nextLatin(cursor, pnBytes);
+            if (result != SQLITE_OK)
                 return result;
             *piEndOffset = *piStartOffset + *pnBytes;
             StringBuffer_getBuffer(&cursor->token, ppToken, &nBytes);
             *pnBytes = nBytes;
+            if (module->phoneNumbers && NdsUnicode61_isTrunkPrefix(cursor,
+                    cursor->inputStart + *piStartOffset, cursor->inputStart + *piEndOffset))
+            {
+                /* the "(0)" of a phone number is not part of phrases, which are written without it */
+                if (cursor->mode == QueryMode)
+                    continue;
+                sharesPosition = NDS_TRUE;
+            }
+            else if (module->phoneNumbers && cursor->mode != QueryMode &&
+                    !NdsUnicode61_startPhoneNumber(cursor, *ppToken, *pnBytes, *piStartOffset, *piEndOffset))
+                return SQLITE_NOMEM;
+            if (!NdsUnicode61_startEdgeNgrams(cursor, ppToken, pnBytes, *piStartOffset, piEndOffset))
+                return SQLITE_NOMEM;
             haveToken = NDS_TRUE;
         }
         else
@@ -1130,6 +3543,7 @@ int NdsUnicode61_next(sqlite3_tokenizer_cursor* pCursor, const char** ppToken, i
             if (haveToken)
             {
                 nds_bool lastBigram;
+                nds_bool coverBigram;
                 size_t nBytes;
 
                 StringBuffer_getBuffer(&cursor->token, ppToken, &nBytes);
@@ -1139,19 +3553,194 @@ int NdsUnicode61_next(sqlite3_tokenizer_cursor* pCursor, const char** ppToken, i
                 /*
                  * For all but the last bigrams return indices for the first letter.
                  * This makes SQLite correctly handle tokenizing match expressions.
+                 *
+                 * When covering a query, SQLite is instead made to skip the second letter,
+                 * unless only one letter would be left (it still needs to start a bigram).
                  */
                 lastBigram = NdsUnicode61_isEnd(cursor) ||
-                        !NdsUnicode61_isTokenChar(module, cursor->currentCharacter) ||
-                        !NdsUnicode61_isBigrammable(cursor->currentCharacter);
+                        !NdsUnicode61_continuesBigramRun(module, cursor->currentCharacter);
+                coverBigram = !lastBigram && module->queryBigramCover && cursor->mode != DocumentMode &&
+                        !NdsUnicode61_isLastOfBigramRun(cursor);
 
-                *piEndOffset = (lastBigram) ?
+                *piEndOffset = (lastBigram || coverBigram || cursor->wholeBigrams) ?
                         cursor->current - cursor->inputStart
                         : cursor->bigramOffset2;
+
+                if (lastBigram && cursor->pendingUnigrams != 0)
+                {
+                    /* no bigram starts at the last character, so its unigram goes here too */
+                    cursor->pendingUnigrams |= NDSUNICODE61_SECOND_UNIGRAM;
+                }
+
+                if (module->pinyin.entries != NULL && cursor->mode != QueryMode &&
+                        !NdsUnicode61_startPinyin(cursor, lastBigram, *piEndOffset))
+                    return SQLITE_NOMEM;
+
+                if (module->hangulChoseong && cursor->mode != QueryMode)
+                    NdsUnicode61_addChoseong(cursor, *ppToken, *pnBytes, *piStartOffset, *piEndOffset);
             }
         }
     }
 
-    *piPosition = cursor->index++;
+    *piPosition = sharesPosition ? cursor->index : cursor->index++;
+
+    return SQLITE_OK;
+}
+
+/**
+ * Append all tokens of an opened cursor to a batch.
+ *
+ * \return SQLITE_DONE when all tokens have been stored, SQLITE_FULL if the batch is full,
+ * another error code otherwise.
+ */
+static int NdsUnicode61_appendTokens(NdsUnicode61Cursor* cursor, int inputIndex, nds_token_batch* batch)
+{
+    const char* token;
+    int nBytes;
+    int startOffset;
+    int endOffset;
+    int position;
+    int result;
+
+    while ((result = NdsUnicode61_next(&cursor->base, &token, &nBytes, &startOffset, &endOffset,
+            &position)) == SQLITE_OK)
+    {
+        const int i = batch->token_count;
+
+        if (i >= batch->token_capacity || nBytes > batch->token_data_capacity - batch->token_data_size)
+            return SQLITE_FULL;
+
+        memcpy(batch->token_data + batch->token_data_size, token, nBytes);
+        batch->token_data_offset[i] = batch->token_data_size;
+        batch->token_len[i] = nBytes;
+        if (batch->start_offset != NULL)
+            batch->start_offset[i] = startOffset;
+        if (batch->end_offset != NULL)
+            batch->end_offset[i] = endOffset;
+        if (batch->position != NULL)
+            batch->position[i] = position;
+        if (batch->input_index != NULL)
+            batch->input_index[i] = inputIndex;
+
+        batch->token_data_size += nBytes;
+        batch->token_count++;
+    }
+
+    return result;
+}
+
+int NdsUnicode61_tokenizeBatch(sqlite3_tokenizer* pTokenizer, char const* const* inputs,
+        int const* inputLens, int inputCount, nds_token_batch* batch)
+{
+    int idx;
+
+    if (pTokenizer == NULL || batch == NULL || (inputCount > 0 && inputs == NULL))
+        return SQLITE_ERROR;
+
+    batch->token_count = 0;
+    batch->token_data_size = 0;
+    batch->input_count_done = 0;
+
+    for (idx = 0; idx < inputCount; idx++)
+    {
+        const int tokenCount = batch->token_count;
+        const int tokenDataSize = batch->token_data_size;
+        sqlite3_tokenizer_cursor* pCursor;
+        int result;
+
+        /* the cursor comes from the pool of the tokenizer, so this doesn't allocate */
+        result = NdsUnicode61_openCursor(pTokenizer, inputs[idx], (inputLens != NULL) ? inputLens[idx] : -1,
+                (batch->query_mode != 0) ? QueryMode : DocumentMode, &pCursor);
+        if (result != SQLITE_OK)
+            return result;
+
+        result = NdsUnicode61_appendTokens((NdsUnicode61Cursor*)pCursor, idx, batch);
+        NdsUnicode61_close(pCursor);
+
+        if (result != SQLITE_DONE)
+        {
+            /* only complete inputs are kept */
+            batch->token_count = tokenCount;
+            batch->token_data_size = tokenDataSize;
+            return result;
+        }
+        batch->input_count_done++;
+    }
+
+    return SQLITE_OK;
+}
+
+int NdsUnicode61_getCacheStats(sqlite3_tokenizer* pTokenizer, nds_token_cache_stats* stats)
+{
+    const NdsUnicode61* self = (const NdsUnicode61*)pTokenizer;
+
+    if (pTokenizer == NULL || stats == NULL)
+        return SQLITE_ERROR;
+
+    stats->hits = self->tokenCache.hits;
+    stats->misses = self->tokenCache.misses;
+    stats->entry_count = (int)self->tokenCache.count;
+    stats->capacity = (int)NdsTokenCache_capacity(&self->tokenCache);
+
+    return SQLITE_OK;
+}
+
+int NdsUnicode61_getQueryCacheStats(sqlite3_tokenizer* pTokenizer, nds_token_cache_stats* stats)
+{
+    const NdsUnicode61* self = (const NdsUnicode61*)pTokenizer;
+
+    if (pTokenizer == NULL || stats == NULL)
+        return SQLITE_ERROR;
+
+    stats->hits = self->queryCache.hits;
+    stats->misses = self->queryCache.misses;
+    stats->entry_count = (int)self->queryCache.count;
+    stats->capacity = (int)self->queryCache.capacity;
+
+    return SQLITE_OK;
+}
+
+int NdsUnicode61_openQuery(sqlite3_tokenizer* pTokenizer, const char* pInput, int nBytes,
+        sqlite3_tokenizer_cursor** ppCursor)
+{
+    return NdsUnicode61_openCursor(pTokenizer, pInput, nBytes, QueryMode, ppCursor);
+}
+
+int NdsUnicode61_openHighlight(sqlite3_tokenizer* pTokenizer, const char* pInput,
+        sqlite3_tokenizer_cursor** ppCursor)
+{
+    const int r = NdsUnicode61_openCursor(pTokenizer, pInput, -1, DocumentMode, ppCursor);
+    if (r == SQLITE_OK)
+        ((NdsUnicode61Cursor*)*ppCursor)->wholeBigrams = NDS_TRUE;
+    return r;
+}
+
+/**
+ * Select the tokenizer of the language of the text, see the language option.
+ *
+ * FTS calls this after NdsUnicode61_open() and before the first NdsUnicode61_next(). Each
+ * language id has its own index in FTS4, so the tokens of a language only have to be
+ * consistent with the queries of that language.
+ */
+int NdsUnicode61_languageid(sqlite3_tokenizer_cursor* pCursor, int iLangid)
+{
+    NdsUnicode61Cursor* cursor = (NdsUnicode61Cursor*)pCursor;
+    NdsUnicode61* module;
+    size_t i;
+
+    if (cursor == NULL)
+        return SQLITE_ERROR;
+
+    module = (NdsUnicode61*)cursor->base.pTokenizer;
+    cursor->module = module;
+    for (i = 0; i < module->languagesCount; i++)
+    {
+        if (module->languages[i].languageId == iLangid)
+        {
+            cursor->module = module->languages[i].tokenizer;
+            break;
+        }
+    }
 
     return SQLITE_OK;
 }
@@ -1161,16 +3750,13 @@ int NdsUnicode61_next(sqlite3_tokenizer_cursor* pCursor, const char** ppToken, i
  */
 static const sqlite3_tokenizer_module NDS_UNICODE61 =
 {
-        /*
-         * Unicode61 also uses version '0' here (no support for xLanguageid()).
-         */
-        0,                      /* version */
+        1,                      /* version */
         NdsUnicode61_create,    /* xCreate */
         NdsUnicode61_destroy,   /* xDestroy */
         NdsUnicode61_open,      /* xOpen */
         NdsUnicode61_close,     /* xClose */
         NdsUnicode61_next,      /* xNext */
-        0                       /* xLanguageid (not supported for modules version 0) */
+        NdsUnicode61_languageid /* xLanguageid */
 };
 
 /* to be called from SQLite */
@@ -3,11 +3,43 @@
 
 #include "nds_sqlite3.h"
 #include "../utils/nds_extension_macros.h"
+#include "../nds_extensions.h"
 
 NDS_EXTENSION_BEGIN_DECLS
 
 void sqlite3Fts3NdsUnicodeTokenizer(sqlite3_tokenizer_module const** ndsunicode61);
 
+/**
+ * Implementation of nds_tokenize_batch().
+ */
+int NdsUnicode61_tokenizeBatch(sqlite3_tokenizer* pTokenizer, char const* const* inputs,
+        int const* inputLens, int inputCount, nds_token_batch* batch);
+
+/**
+ * Implementation of nds_tokenizer_cache_stats().
+ */
+int NdsUnicode61_getCacheStats(sqlite3_tokenizer* pTokenizer, nds_token_cache_stats* stats);
+
+/**
+ * Implementation of nds_tokenizer_query_cache_stats().
+ */
+int NdsUnicode61_getQueryCacheStats(sqlite3_tokenizer* pTokenizer, nds_token_cache_stats* stats);
+
+/**
+ * Open a cursor tokenizing a query like FTS does a phrase of a MATCH expression: only the terms a
+ * query looks up are returned, without the extra terms of documents.
+ */
+int NdsUnicode61_openQuery(sqlite3_tokenizer* pTokenizer, const char* pInput, int nBytes,
+        sqlite3_tokenizer_cursor** ppCursor);
+
+/**
+ * Open a cursor tokenizing a nul-terminated document, like FTS does when it indexes a row, except
+ * that the offsets of every bigram cover both of its characters, not just the first one. A
+ * highlight made of the offsets of the matching tokens then covers whole characters.
+ */
+int NdsUnicode61_openHighlight(sqlite3_tokenizer* pTokenizer, const char* pInput,
+        sqlite3_tokenizer_cursor** ppCursor);
+
 NDS_EXTENSION_END_DECLS
 
 #endif /* NDS_UNICODE61_H */
@@ -0,0 +1,972 @@
+/*
+ * Two-level table of the classes of unicode characters used by the ndsunicode61 tokenizer.
+ *
+ * Generated from the ranges in NdsUnicode61_isAlNum() and NdsUnicode61_isBigrammable(),
+ * it needs to be regenerated whenever these change.
+ */
+#include <stddef.h>
+
+#include "nds_unicode61_class_data.h"
+#include "../utils/nds_extension_macros.h"
+
+const NdsUnicode61ClassBlock NdsUnicode61ClassBlocks[] =
+{
+    { /* 0: first used by U+0000 */
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00055555,
+            0x55555554, 0x00155555, 0x55555554, 0x00155555,
+            0x00000000, 0x00000000, 0x00100000, 0x15140450,
+            0x55555555, 0x55551555, 0x55555555, 0x55551555,
+        }
+    },
+    { /* 1: first used by U+0100 */
+        {
+            0x55555555, 0x55555555, 0x55555555, 0x55555555,
+            0x55555555, 0x55555555, 0x55555555, 0x55555555,
+            0x55555555, 0x55555555, 0x55555555, 0x55555555,
+            0x55555555, 0x55555555, 0x55555555, 0x55555555,
+        }
+    },
+    { /* 2: first used by U+0200 */
+        {
+            0x55555555, 0x55555555, 0x55555555, 0x55555555,
+            0x55555555, 0x55555555, 0x55555555, 0x55555555,
+            0x55555555, 0x55555555, 0x55555555, 0x55555555,
+            0x55555005, 0x00000005, 0x11000155, 0x00000000,
+        }
+    },
+    { /* 3: first used by U+0300 */
+        {
+            0x55555555, 0x55555555, 0x55555555, 0x55555555,
+            0x55555555, 0x55555555, 0x55555555, 0x45555155,
+            0x55551055, 0x55555555, 0x55555555, 0x55555555,
+            0x55555555, 0x55555555, 0x55555555, 0x55554555,
+        }
+    },
+    { /* 4: first used by U+0400 */
+        {
+            0x55555555, 0x55555555, 0x55555555, 0x55555555,
+            0x55555555, 0x55555555, 0x55555555, 0x55555555,
+            0x55500005, 0x55555555, 0x55555555, 0x55555555,
+            0x55555555, 0x55555555, 0x55555555, 0x55555555,
+        }
+    },
+    { /* 5: first used by U+0500 */
+        {
+            0x55555555, 0x55555555, 0x55555555, 0x55555555,
+            0x55555555, 0x00055555, 0x55555555, 0x55555555,
+            0x15415555, 0x00000001, 0x00000000, 0x00000000,
+            0x55550000, 0x55555555, 0x55555555, 0x55555415,
+        }
+    },
+    { /* 6: first used by U+0600 */
+        {
+            0x00000400, 0x05000000, 0x55555555, 0x55555555,
+            0x00155555, 0x00000000, 0x50055555, 0x55555554,
+            0x55555555, 0x55555555, 0x55555555, 0x55555555,
+            0x55555555, 0x00000455, 0x50001400, 0x41555555,
+        }
+    },
+    { /* 7: first used by U+0700 */
+        {
+            0x10000000, 0x55555551, 0x55555555, 0x00000000,
+            0x55400000, 0x55555555, 0x55555555, 0x55555555,
+            0x55555555, 0x55555555, 0x00000555, 0x55555554,
+            0x55555555, 0x55555555, 0x00155555, 0x55500500,
+        }
+    },
+    { /* 8: first used by U+0800 */
+        {
+            0x55555555, 0x00100555, 0x50010100, 0x40000000,
+            0x55555555, 0x45015555, 0x55555555, 0x55555555,
+            0x55555555, 0x55555555, 0x55555555, 0x55555555,
+            0x55555555, 0x55555555, 0x00000055, 0x40000000,
+        }
+    },
+    { /* 9: first used by U+0900 */
+        {
+            0x55555500, 0x55555555, 0x55555555, 0x04055555,
+            0x00000000, 0x55550001, 0x55555005, 0x55555554,
+            0x55555501, 0x55555555, 0x55555555, 0x04555555,
+            0x50141400, 0x55551555, 0x55555505, 0x55055505,
+        }
+    },
+    { /* 10: first used by U+0A00 */
+        {
+            0x55555501, 0x55555555, 0x55555555, 0x04555555,
+            0x50141540, 0x55555551, 0x55555555, 0x55555150,
+            0x55555501, 0x55555555, 0x55555555, 0x04555555,
+            0x50101000, 0x55555555, 0x55555505, 0x55555550,
+        }
+    },
+    { /* 11: first used by U+0B00 */
+        {
+            0x55555501, 0x55555555, 0x55555555, 0x04555555,
+            0x50141400, 0x55550555, 0x55555505, 0x55555554,
+            0x55555545, 0x55555555, 0x55555555, 0x05555555,
+            0x50040540, 0x55551555, 0x55555555, 0x55400015,
+        }
+    },
+    { /* 12: first used by U+0C00 */
+        {
+            0x55555501, 0x55555555, 0x55555555, 0x05555555,
+            0x50040400, 0x55554155, 0x55555505, 0x15555555,
+            0x55555505, 0x55555555, 0x55555555, 0x04555555,
+            0x50040400, 0x55554155, 0x55555505, 0x55555555,
+        }
+    },
+    { /* 13: first used by U+0D00 */
+        {
+            0x55555505, 0x55555555, 0x55555555, 0x05555555,
+            0x50040400, 0x55551555, 0x55555505, 0x55515555,
+            0x55555505, 0x55555555, 0x55555555, 0x55555555,
+            0x15455555, 0x00004400, 0x55555555, 0x55555405,
+        }
+    },
+    { /* 14: first used by U+0E00 */
+        {
+            0xffffffff, 0xffffffff, 0xbfffffff, 0xffffffff,
+            0xbfffefff, 0xffafffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xfebaaafb,
+            0xfaaaffff, 0xffffffff, 0xffffffff, 0xffffffff,
+        }
+    },
+    { /* 15: first used by U+0F00 */
+        {
+            0x00000001, 0x00000000, 0x55555555, 0x00000055,
+            0x55555555, 0x55555555, 0x55555555, 0x00000001,
+            0x01550000, 0x00010000, 0x00000000, 0x04000000,
+            0x04000000, 0x55400000, 0x55555555, 0x55555555,
+        }
+    },
+    { /* 16: first used by U+1000 */
+        {
+            0x55555555, 0x55555555, 0x00155555, 0x40000000,
+            0x00055555, 0x05500555, 0x50001404, 0x55555401,
+            0x10000005, 0x00055555, 0x55555555, 0x55555555,
+            0x55555555, 0x55555555, 0x55555555, 0x55155555,
+        }
+    },
+    { /* 17: first used by U+1300 */
+        {
+            0x55555555, 0x55555555, 0x55555555, 0x55555555,
+            0x55555555, 0x01555555, 0x55540000, 0x55555555,
+            0x55555555, 0x55500000, 0x55555555, 0x55555555,
+            0x55555555, 0x55555555, 0x55555555, 0x55555555,
+        }
+    },
+    { /* 18: first used by U+1400 */
+        {
+            0x55555554, 0x55555555, 0x55555555, 0x55555555,
+            0x55555555, 0x55555555, 0x55555555, 0x55555555,
+            0x55555555, 0x55555555, 0x55555555, 0x55555555,
+            0x55555555, 0x55555555, 0x55555555, 0x55555555,
+        }
+    },
+    { /* 19: first used by U+1600 */
+        {
+            0x55555555, 0x55555555, 0x55555555, 0x55555555,
+            0x55555555, 0x55555555, 0x41555555, 0x55555555,
+            0x55555554, 0x54155555, 0x55555555, 0x55555555,
+            0x55555555, 0x55555555, 0x50155555, 0x55555555,
+        }
+    },
+    { /* 20: first used by U+1700 */
+        {
+            0x55555555, 0x55555405, 0x55555555, 0x55554005,
+            0x55555555, 0x55555505, 0x55555555, 0x55555505,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xaaaaaaff,
+            0xaaaaaaaa, 0xfbaaeaaa, 0xffffffff, 0xffffffff,
+        }
+    },
+    { /* 21: first used by U+1800 */
+        {
+            0x40000000, 0x55555555, 0x55555555, 0x55555555,
+            0x55555555, 0x55555555, 0x55555555, 0x55555555,
+            0x55555555, 0x55555555, 0x55515555, 0x55555555,
+            0x55555555, 0x55555555, 0x55555555, 0x55555555,
+        }
+    },
+    { /* 22: first used by U+1900 */
+        {
+            0x55555555, 0x55555555, 0x55000000, 0x55000000,
+            0x55555054, 0x55555555, 0x55555555, 0x55555555,
+            0x55555555, 0x55555555, 0x55555555, 0x00000000,
+            0x55505554, 0x05555555, 0x00000000, 0x00000000,
+        }
+    },
+    { /* 23: first used by U+1A00 */
+        {
+            0x55555555, 0x05001555, 0x55555555, 0x55555555,
+            0x55555555, 0x40000155, 0x00000000, 0x14000000,
+            0x55555555, 0x55555555, 0x50004000, 0x55555555,
+            0x55555555, 0x55555555, 0x55555555, 0x55555555,
+        }
+    },
+    { /* 24: first used by U+1B00 */
+        {
+            0x55555400, 0x55555555, 0x55555555, 0x00000055,
+            0x55555400, 0x00055555, 0x00000000, 0x54000000,
+            0x55555540, 0x55555555, 0x50000001, 0x55555555,
+            0x55555555, 0x55555555, 0x00000555, 0x00555500,
+        }
+    },
+    { /* 25: first used by U+1C00 */
+        {
+            0x55555555, 0x55555555, 0x00000055, 0x00150000,
+            0x55555555, 0x55555555, 0x55555555, 0x05555555,
+            0x55555555, 0x55555555, 0x55555555, 0x55555555,
+            0x55550000, 0x00000000, 0x51540000, 0x55555405,
+        }
+    },
+    { /* 26: first used by U+1F00 */
+        {
+            0x55555555, 0x55555555, 0x55555555, 0x55555555,
+            0x55555555, 0x55555555, 0x55555555, 0x55555555,
+            0x55555555, 0x55555555, 0x55555555, 0x11555555,
+            0x01555550, 0x01555555, 0x01555555, 0x41555555,
+        }
+    },
+    { /* 27: first used by U+2000 */
+        {
+            0xaaaaaaa8, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa,
+            0xaaaaaaaa, 0xaaaaaaaa, 0xaaaffeaa, 0xeaafffff,
+            0xeaafffff, 0xffffffff, 0xaaaaaaaa, 0xfffaaaaa,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+        }
+    },
+    { /* 28: first used by U+2100 */
+        {
+            0xfffaeaba, 0xaffeaeff, 0xeffbbbaa, 0xffafffff,
+            0xbaaffeaa, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa,
+            0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa,
+        }
+    },
+    { /* 29: first used by U+2200 */
+        {
+            0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa,
+            0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa,
+            0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa,
+            0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa,
+        }
+    },
+    { /* 30: first used by U+2300 */
+        {
+            0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa,
+            0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa,
+            0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa,
+            0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xffffffaa,
+        }
+    },
+    { /* 31: first used by U+2400 */
+        {
+            0xaaaaaaaa, 0xaaaaaaaa, 0xffffeaaa, 0xffffffff,
+            0xffeaaaaa, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+        }
+    },
+    { /* 32: first used by U+2700 */
+        {
+            0xaaaaaaab, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa,
+            0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xfffffaaa,
+            0xffffffff, 0xaaaaaaff, 0xaaaaaaaa, 0xaaaaaaaa,
+            0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa,
+        }
+    },
+    { /* 33: first used by U+2B00 */
+        {
+            0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa,
+            0xfeaaaaaa, 0xfffaaaaa, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+        }
+    },
+    { /* 34: first used by U+2C00 */
+        {
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xbfeaabff, 0xaeabfffa,
+        }
+    },
+    { /* 35: first used by U+2D00 */
+        {
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xbffffffe,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xaaaaaaaa, 0xaaaaaaaa,
+        }
+    },
+    { /* 36: first used by U+2E00 */
+        {
+            0xaaaaaaaa, 0xaaaaaaaa, 0xeaaaaaaa, 0xffaaaaaa,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xaaaaaaaa, 0xaabaaaaa, 0xaaaaaaaa, 0xaaaaaaaa,
+            0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xffffffaa,
+        }
+    },
+    { /* 37: first used by U+2F00 */
+        {
+            0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa,
+            0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa,
+            0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa,
+            0xaaaaaaaa, 0xfffffaaa, 0xffffffff, 0xffaaaaaa,
+        }
+    },
+    { /* 38: first used by U+3000 */
+        {
+            0xaaaafeaa, 0xaaaaaaaa, 0xaaaffffe, 0xabffaffe,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xfffffffe, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffbfffff,
+        }
+    },
+    { /* 39: first used by U+3100 */
+        {
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xaaaaaffa, 0xffffffff, 0xffffffff,
+            0xaaaaaaaa, 0xaaaaaaaa, 0xffffffaa, 0xffffffff,
+        }
+    },
+    { /* 40: first used by U+3200 */
+        {
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xfffffffe, 0xffffffff, 0xbfffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xaaffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+        }
+    },
+    { /* 41: first used by U+3400 */
+        {
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+        }
+    },
+    { /* 42: first used by U+4D00 */
+        {
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa,
+        }
+    },
+    { /* 43: first used by U+A400 */
+        {
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa,
+            0xffffeaaa, 0xffffffff, 0xffffffff, 0xafffffff,
+        }
+    },
+    { /* 44: first used by U+A600 */
+        {
+            0xabffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xbfffffff, 0xeaaaaaaa,
+            0xffffffff, 0xbfffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffaaaa,
+        }
+    },
+    { /* 45: first used by U+A700 */
+        {
+            0xaaaaaaaa, 0xffffeaaa, 0xfffffffa, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffebffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+        }
+    },
+    { /* 46: first used by U+A800 */
+        {
+            0xffbfefef, 0xffffffff, 0xffaaaabf, 0xfffaafff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffaaff,
+            0xfffffffa, 0xffffffff, 0xffffffff, 0xaaaaaaff,
+            0xaffffeaa, 0xffffffff, 0xaaaaaaaa, 0xffeafffa,
+        }
+    },
+    { /* 47: first used by U+A900 */
+        {
+            0xffffffff, 0xffffffff, 0xaaaaafff, 0xffffffff,
+            0xaaaabfff, 0xbfffffaa, 0xffffffff, 0xffffffff,
+            0xffffffaa, 0xffffffff, 0xffffffff, 0xaaaaaabf,
+            0xfaaaaaaa, 0xafffffff, 0xffffffff, 0xffffffff,
+        }
+    },
+    { /* 48: first used by U+AA00 */
+        {
+            0xffffffff, 0xffffffff, 0xaaabffff, 0xffffeaaa,
+            0xfaffffbf, 0xaaffffff, 0xffffffff, 0xffbabfff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xaffebeae,
+            0xfffffffb, 0xafffffff, 0xaabfffff, 0xffffebfa,
+        }
+    },
+    { /* 49: first used by U+AB00 */
+        {
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xfaaaaabf, 0xffffffff,
+        }
+    },
+    { /* 50: first used by U+D800 */
+        {
+            0xfffffffe, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+        }
+    },
+    { /* 51: first used by U+DB00 */
+        {
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xbfffffff,
+            0xfffffffe, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xbfffffff,
+        }
+    },
+    { /* 52: first used by U+DF00 */
+        {
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xbfffffff,
+        }
+    },
+    { /* 53: first used by U+FB00 */
+        {
+            0xffffffff, 0xefffffff, 0xfffbffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xaaaaaaaf,
+            0xfffffffa, 0xffffffff, 0xffffffff, 0xffffffff,
+        }
+    },
+    { /* 54: first used by U+FD00 */
+        {
+            0xffffffff, 0xffffffff, 0xffffffff, 0xafffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xfaffffff,
+        }
+    },
+    { /* 55: first used by U+FE00 */
+        {
+            0xaaaaaaaa, 0xfffaaaaa, 0xffffffff, 0xaaaaaaaa,
+            0xaaaaaaaa, 0xaaaaaaea, 0xffaaeaaa, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xbfffffff,
+        }
+    },
+    { /* 56: first used by U+FF00 */
+        {
+            0xaaaaaaab, 0xaaafffff, 0xfffffffe, 0xaabfffff,
+            0xfffffffe, 0xaabfffff, 0xfffffaaa, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xeaaaeaaa, 0xfaabffff,
+        }
+    },
+    { /* 57: first used by U+10100 */
+        {
+            0xffffffea, 0xffffffff, 0xffffffff, 0xaaaabfff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xaaabffff,
+            0xfffaaaaa, 0xffaaaaaa, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xaaaaaaaa, 0xaaaaaaaa, 0xfaaaaaaa,
+        }
+    },
+    { /* 58: first used by U+10300 */
+        {
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xbfffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xfffffffe, 0xffffffff, 0xffffffff,
+        }
+    },
+    { /* 59: first used by U+10800 */
+        {
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffbfff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+        }
+    },
+    { /* 60: first used by U+10900 */
+        {
+            0xffffffff, 0xbfffffff, 0xffffffff, 0xbfffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+        }
+    },
+    { /* 61: first used by U+10A00 */
+        {
+            0xaaffebab, 0xffffffff, 0xffffffff, 0xbfeaffff,
+            0xffffffff, 0xfffeaaaa, 0xffffffff, 0xbfffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+        }
+    },
+    { /* 62: first used by U+10B00 */
+        {
+            0xffffffff, 0xffffffff, 0xffffffff, 0xaaabffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+        }
+    },
+    { /* 63: first used by U+11000 */
+        {
+            0xffffffea, 0xffffffff, 0xffffffff, 0xaaaaffff,
+            0xfaaaaaaa, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffea, 0xffffffff, 0xffffffff, 0xaaaaaaaa,
+            0xfffffffa, 0xffffffff, 0xffffffff, 0xffffffff,
+        }
+    },
+    { /* 64: first used by U+11100 */
+        {
+            0xffffffea, 0xffffffff, 0xaaaabfff, 0xfffffeaa,
+            0xffffffaa, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffea, 0xffffffff, 0xffffffff, 0xaaaaaabf,
+            0xfffeabfe, 0xffffffff, 0xffffffff, 0xffffffff,
+        }
+    },
+    { /* 65: first used by U+11600 */
+        {
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xaabfffff, 0xffffaaaa,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+        }
+    },
+    { /* 66: first used by U+12400 */
+        {
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffaa,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+        }
+    },
+    { /* 67: first used by U+16F00 */
+        {
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xaaaaaaab, 0xaaaaaaaa, 0xeaaaaaaa,
+            0xbfffffff, 0xffffffea, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+        }
+    },
+    { /* 68: first used by U+1D000 */
+        {
+            0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa,
+            0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa,
+            0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa,
+            0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xfffffaaa,
+        }
+    },
+    { /* 69: first used by U+1D100 */
+        {
+            0xaaaaaaaa, 0xaaaaaaaa, 0xaaabeaaa, 0xaaaaaaaa,
+            0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa,
+            0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa,
+            0xaaaaaaaa, 0xfaaaaaaa, 0xffffffff, 0xffffffff,
+        }
+    },
+    { /* 70: first used by U+1D200 */
+        {
+            0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa,
+            0xfffffaaa, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+        }
+    },
+    { /* 71: first used by U+1D300 */
+        {
+            0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa,
+            0xaaaaaaaa, 0xffffeaaa, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+        }
+    },
+    { /* 72: first used by U+1D600 */
+        {
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xfffffffb, 0xffbfffff, 0xffffffff, 0xffbfffff,
+        }
+    },
+    { /* 73: first used by U+1D700 */
+        {
+            0xffffffff, 0xfffffbff, 0xffffffff, 0xfffffbff,
+            0xbfffffff, 0xffffffff, 0xbfffffff, 0xffffffff,
+            0xfffbffff, 0xffffffff, 0xfffbffff, 0xffffffff,
+            0xffffffbf, 0xffffffff, 0xffffffff, 0xffffffff,
+        }
+    },
+    { /* 74: first used by U+1EE00 */
+        {
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xfffffffa,
+        }
+    },
+    { /* 75: first used by U+1F000 */
+        {
+            0xaaaaaaaa, 0xaaaaaaaa, 0xffaaaaaa, 0xaaaaaaaa,
+            0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa,
+            0xaaaaaaaa, 0xffffffaa, 0xeaaaaaaa, 0xeaaaaaab,
+            0xaaaaaaab, 0xaaaaaaab, 0xffffffff, 0xffffffff,
+        }
+    },
+    { /* 76: first used by U+1F100 */
+        {
+            0xffffffff, 0xaaaaaaaa, 0xeaaaaaaa, 0xaaaaaaaa,
+            0xaaaaaaaa, 0xaaaaaaaa, 0xffaaaaaa, 0xaaaaaaaa,
+            0xaaaaaaaa, 0xffeaaaaa, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xaaaaafff, 0xaaaaaaaa,
+        }
+    },
+    { /* 77: first used by U+1F200 */
+        {
+            0xffffffea, 0xaaaaaaaa, 0xaaaaaaaa, 0xffeaaaaa,
+            0xfffeaaaa, 0xfffffffa, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+        }
+    },
+    { /* 78: first used by U+1F300 */
+        {
+            0xaaaaaaaa, 0xaaaaaaaa, 0xfffffffe, 0xaaaabaaa,
+            0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xfeaaaaaa,
+            0xaaaaaaaa, 0xffffffaa, 0xaaaaaaaa, 0xaaaaaaaa,
+            0xffeaaeaa, 0xffffffff, 0xaaaaaaaa, 0xfffffffe,
+        }
+    },
+    { /* 79: first used by U+1F400 */
+        {
+            0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xeaaaaaaa,
+            0xaaaaaaae, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa,
+            0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa,
+            0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xfeabaaaa,
+        }
+    },
+    { /* 80: first used by U+1F500 */
+        {
+            0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xfaaaaaaa,
+            0xffffffaa, 0xaaaaaaaa, 0xffffaaaa, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xaabfffff,
+        }
+    },
+    { /* 81: first used by U+1F600 */
+        {
+            0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa,
+            0xaaaaabfe, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa,
+            0xfffffaaa, 0xffffffff, 0xffffffff, 0xffffffff,
+        }
+    },
+    { /* 82: first used by U+1F700 */
+        {
+            0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa,
+            0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xffffffaa,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+        }
+    },
+    { /* 83: first used by U+E0000 */
+        {
+            0xfffffffb, 0xffffffff, 0xaaaaaaaa, 0xaaaaaaaa,
+            0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+        }
+    },
+    { /* 84: first used by U+E0100 */
+        {
+            0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa,
+            0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa,
+            0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa,
+            0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xffffffff,
+        }
+    },
+};
+
+const unsigned NdsUnicode61ClassBlocksCount = ARRAY_SIZE(NdsUnicode61ClassBlocks);
+
+const unsigned short NdsUnicode61ClassIndex[NDSUNICODE61_CLASS_INDEX_SIZE] =
+{
+    /* U+0000 */ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    /* U+1000 */ 16, 1, 1, 17, 18, 1, 19, 20, 21, 22, 23, 24, 25, 1, 1, 26,
+    /* U+2000 */ 27, 28, 29, 30, 31, 29, 29, 32, 29, 29, 29, 33, 34, 35, 36, 37,
+    /* U+3000 */ 38, 39, 40, 29, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+4000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 42, 41, 41,
+    /* U+5000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+6000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+7000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+8000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+9000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+A000 */ 41, 41, 41, 41, 43, 41, 44, 45, 46, 47, 48, 49, 41, 41, 41, 41,
+    /* U+B000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+C000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+D000 */ 41, 41, 41, 41, 41, 41, 41, 41, 50, 41, 41, 51, 50, 41, 41, 52,
+    /* U+E000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+F000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 53, 41, 54, 55, 56,
+    /* U+10000 */ 41, 57, 41, 58, 41, 41, 41, 41, 59, 60, 61, 62, 41, 41, 41, 41,
+    /* U+11000 */ 63, 64, 41, 41, 41, 41, 65, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+12000 */ 41, 41, 41, 41, 66, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+13000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+14000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+15000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+16000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 67,
+    /* U+17000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+18000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+19000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+1A000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+1B000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+1C000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+1D000 */ 68, 69, 70, 71, 41, 41, 72, 73, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+1E000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 74, 41,
+    /* U+1F000 */ 75, 76, 77, 78, 79, 80, 81, 82, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+20000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+21000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+22000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+23000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+24000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+25000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+26000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+27000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+28000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+29000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+2A000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+2B000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+2C000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+2D000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+2E000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+2F000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+30000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+31000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+32000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+33000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+34000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+35000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+36000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+37000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+38000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+39000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+3A000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+3B000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+3C000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+3D000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+3E000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+3F000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+40000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+41000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+42000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+43000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+44000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+45000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+46000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+47000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+48000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+49000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+4A000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+4B000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+4C000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+4D000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+4E000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+4F000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+50000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+51000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+52000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+53000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+54000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+55000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+56000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+57000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+58000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+59000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+5A000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+5B000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+5C000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+5D000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+5E000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+5F000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+60000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+61000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+62000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+63000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+64000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+65000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+66000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+67000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+68000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+69000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+6A000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+6B000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+6C000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+6D000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+6E000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+6F000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+70000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+71000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+72000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+73000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+74000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+75000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+76000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+77000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+78000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+79000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+7A000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+7B000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+7C000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+7D000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+7E000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+7F000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+80000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+81000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+82000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+83000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+84000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+85000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+86000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+87000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+88000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+89000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+8A000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+8B000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+8C000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+8D000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+8E000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+8F000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+90000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+91000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+92000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+93000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+94000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+95000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+96000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+97000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+98000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+99000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+9A000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+9B000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+9C000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+9D000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+9E000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+9F000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+A0000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+A1000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+A2000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+A3000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+A4000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+A5000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+A6000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+A7000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+A8000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+A9000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+AA000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+AB000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+AC000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+AD000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+AE000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+AF000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+B0000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+B1000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+B2000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+B3000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+B4000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+B5000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+B6000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+B7000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+B8000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+B9000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+BA000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+BB000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+BC000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+BD000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+BE000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+BF000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+C0000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+C1000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+C2000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+C3000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+C4000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+C5000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+C6000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+C7000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+C8000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+C9000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+CA000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+CB000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+CC000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+CD000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+CE000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+CF000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+D0000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+D1000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+D2000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+D3000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+D4000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+D5000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+D6000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+D7000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+D8000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+D9000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+DA000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+DB000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+DC000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+DD000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+DE000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+DF000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+E0000 */ 83, 84, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+E1000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+E2000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+E3000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+E4000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+E5000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+E6000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+E7000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+E8000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+E9000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+EA000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+EB000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+EC000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+ED000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+EE000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+EF000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+F0000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+F1000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+F2000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+F3000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+F4000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+F5000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+F6000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+F7000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+F8000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+F9000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+FA000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+FB000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+FC000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+FD000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+FE000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+FF000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+100000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+101000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+102000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+103000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+104000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+105000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+106000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+107000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+108000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+109000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+10A000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+10B000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+10C000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+10D000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+10E000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    /* U+10F000 */ 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+};
@@ -0,0 +1,51 @@
+#ifndef NDS_UNICODE61_CLASS_DATA_H
+#define NDS_UNICODE61_CLASS_DATA_H
+
+#include "../utils/unichar.h"
+#include "../utils/nds_extension_macros.h"
+
+/** Class flag: the character can be a part of a token (it's not a separator). */
+#define NDSUNICODE61_CLASS_TOKENCHAR 0x1
+
+/** Class flag: the character is tokenized as bigrams (CJK and similar scripts). */
+#define NDSUNICODE61_CLASS_BIGRAMMABLE 0x2
+
+/** Number of bits of the class of one character. */
+#define NDSUNICODE61_CLASS_BITS 2
+
+/** log2 of the number of characters described by one block. */
+#define NDSUNICODE61_CLASS_BLOCK_SHIFT 8
+
+/** The table describes the characters below this limit. */
+#define NDSUNICODE61_CLASS_LIMIT 0x110000
+
+/** Number of entries in NdsUnicode61ClassIndex. */
+#define NDSUNICODE61_CLASS_INDEX_SIZE (NDSUNICODE61_CLASS_LIMIT >> NDSUNICODE61_CLASS_BLOCK_SHIFT)
+
+/**
+ * Classes of a block of consecutive characters.
+ *
+ * Each word holds the classes of 16 characters, NDSUNICODE61_CLASS_BITS
+ * bits each, the lowest character in the lowest bits.
+ */
+typedef struct
+{
+    unsigned int bits[(1 << NDSUNICODE61_CLASS_BLOCK_SHIFT) * NDSUNICODE61_CLASS_BITS / 32];
+} NdsUnicode61ClassBlock;
+
+NDS_EXTENSION_BEGIN_DECLS
+
+/**
+ * Distinct blocks of the class table.
+ */
+extern const NdsUnicode61ClassBlock NdsUnicode61ClassBlocks[];
+extern const unsigned               NdsUnicode61ClassBlocksCount;
+
+/**
+ * Index of the block in NdsUnicode61ClassBlocks for each block of characters.
+ */
+extern const unsigned short NdsUnicode61ClassIndex[NDSUNICODE61_CLASS_INDEX_SIZE];
+
+NDS_EXTENSION_END_DECLS
+
+#endif /* NDS_UNICODE61_CLASS_DATA_H */
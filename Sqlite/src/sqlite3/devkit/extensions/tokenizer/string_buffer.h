@@ -2,6 +2,7 @@
 #define STRING_BUFFER_H
 
 #include <stdlib.h>
+#include <string.h>
 #include "../utils/utf8_utils.h"
 
 /**
@@ -104,6 +105,10 @@ static nds_bool StringBuffer_ensureExtraCapacity(StringBuffer* self, size_t extr
         if (newBuffer == NULL)
             return NDS_FALSE; /* old buffer and capacity stay valid */
 
+        /* the contents still live in the static buffer on the 1st reallocation */
+        if (self->dynBuffer == NULL)
+            memcpy(newBuffer, self->staticBuffer, self->size);
+
         self->dynBuffer = self->buffer = newBuffer;
         self->capacity = newCapacity;
     }
@@ -0,0 +1,3095 @@
+/*
+ * Two-level table of unicode normalizations, see UnicharNormalize().
+ *
+ * Generated from UnicharDecompose(), UnicharIsCombiningMark() and the case folding of the
+ * ndsunicode61 tokenizer (sqlite3FtsUnicodeFold()), plus the katakana to hiragana mapping of the
+ * kana forms; it needs to be regenerated whenever these change.
+ */
+#include <stddef.h>
+
+#include "unichar_normalization_data.h"
+#include "nds_extension_macros.h"
+
+const unichar UnicharNormalizationSequences[] =
+{
+    0 /*unused, offset 0 means the character is not changed*/,
+    /*   1*/ 0 /*character count*/,
+    /*   2*/ 1 /*character count*/, 0x0061,
+    /*   4*/ 1 /*character count*/, 0x0062,
+    /*   6*/ 1 /*character count*/, 0x0063,
+    /*   8*/ 1 /*character count*/, 0x0064,
+    /*  10*/ 1 /*character count*/, 0x0065,
+    /*  12*/ 1 /*character count*/, 0x0066,
+    /*  14*/ 1 /*character count*/, 0x0067,
+    /*  16*/ 1 /*character count*/, 0x0068,
+    /*  18*/ 1 /*character count*/, 0x0069,
+    /*  20*/ 1 /*character count*/, 0x006a,
+    /*  22*/ 1 /*character count*/, 0x006b,
+    /*  24*/ 1 /*character count*/, 0x006c,
+    /*  26*/ 1 /*character count*/, 0x006d,
+    /*  28*/ 1 /*character count*/, 0x006e,
+    /*  30*/ 1 /*character count*/, 0x006f,
+    /*  32*/ 1 /*character count*/, 0x0070,
+    /*  34*/ 1 /*character count*/, 0x0071,
+    /*  36*/ 1 /*character count*/, 0x0072,
+    /*  38*/ 1 /*character count*/, 0x0073,
+    /*  40*/ 1 /*character count*/, 0x0074,
+    /*  42*/ 1 /*character count*/, 0x0075,
+    /*  44*/ 1 /*character count*/, 0x0076,
+    /*  46*/ 1 /*character count*/, 0x0077,
+    /*  48*/ 1 /*character count*/, 0x0078,
+    /*  50*/ 1 /*character count*/, 0x0079,
+    /*  52*/ 1 /*character count*/, 0x007a,
+    /*  54*/ 1 /*character count*/, 0x0020,
+    /*  56*/ 2 /*character count*/, 0x0020, 0x0308,
+    /*  59*/ 2 /*character count*/, 0x0020, 0x0304,
+    /*  62*/ 1 /*character count*/, 0x0032,
+    /*  64*/ 1 /*character count*/, 0x0033,
+    /*  66*/ 2 /*character count*/, 0x0020, 0x0301,
+    /*  69*/ 1 /*character count*/, 0x03bc,
+    /*  71*/ 2 /*character count*/, 0x0020, 0x0327,
+    /*  74*/ 1 /*character count*/, 0x0031,
+    /*  76*/ 3 /*character count*/, 0x0031, 0x2044, 0x0034,
+    /*  80*/ 3 /*character count*/, 0x0031, 0x2044, 0x0032,
+    /*  84*/ 3 /*character count*/, 0x0033, 0x2044, 0x0034,
+    /*  88*/ 2 /*character count*/, 0x0041, 0x0300,
+    /*  91*/ 2 /*character count*/, 0x0061, 0x0300,
+    /*  94*/ 2 /*character count*/, 0x0041, 0x0301,
+    /*  97*/ 2 /*character count*/, 0x0061, 0x0301,
+    /* 100*/ 2 /*character count*/, 0x0041, 0x0302,
+    /* 103*/ 2 /*character count*/, 0x0061, 0x0302,
+    /* 106*/ 2 /*character count*/, 0x0041, 0x0303,
+    /* 109*/ 2 /*character count*/, 0x0061, 0x0303,
+    /* 112*/ 2 /*character count*/, 0x0041, 0x0308,
+    /* 115*/ 2 /*character count*/, 0x0061, 0x0308,
+    /* 118*/ 2 /*character count*/, 0x0041, 0x030a,
+    /* 121*/ 2 /*character count*/, 0x0061, 0x030a,
+    /* 124*/ 1 /*character count*/, 0x00e6,
+    /* 126*/ 2 /*character count*/, 0x0043, 0x0327,
+    /* 129*/ 2 /*character count*/, 0x0063, 0x0327,
+    /* 132*/ 2 /*character count*/, 0x0045, 0x0300,
+    /* 135*/ 2 /*character count*/, 0x0065, 0x0300,
+    /* 138*/ 2 /*character count*/, 0x0045, 0x0301,
+    /* 141*/ 2 /*character count*/, 0x0065, 0x0301,
+    /* 144*/ 2 /*character count*/, 0x0045, 0x0302,
+    /* 147*/ 2 /*character count*/, 0x0065, 0x0302,
+    /* 150*/ 2 /*character count*/, 0x0045, 0x0308,
+    /* 153*/ 2 /*character count*/, 0x0065, 0x0308,
+    /* 156*/ 2 /*character count*/, 0x0049, 0x0300,
+    /* 159*/ 2 /*character count*/, 0x0069, 0x0300,
+    /* 162*/ 2 /*character count*/, 0x0049, 0x0301,
+    /* 165*/ 2 /*character count*/, 0x0069, 0x0301,
+    /* 168*/ 2 /*character count*/, 0x0049, 0x0302,
+    /* 171*/ 2 /*character count*/, 0x0069, 0x0302,
+    /* 174*/ 2 /*character count*/, 0x0049, 0x0308,
+    /* 177*/ 2 /*character count*/, 0x0069, 0x0308,
+    /* 180*/ 1 /*character count*/, 0x00f0,
+    /* 182*/ 2 /*character count*/, 0x004e, 0x0303,
+    /* 185*/ 2 /*character count*/, 0x006e, 0x0303,
+    /* 188*/ 2 /*character count*/, 0x004f, 0x0300,
+    /* 191*/ 2 /*character count*/, 0x006f, 0x0300,
+    /* 194*/ 2 /*character count*/, 0x004f, 0x0301,
+    /* 197*/ 2 /*character count*/, 0x006f, 0x0301,
+    /* 200*/ 2 /*character count*/, 0x004f, 0x0302,
+    /* 203*/ 2 /*character count*/, 0x006f, 0x0302,
+    /* 206*/ 2 /*character count*/, 0x004f, 0x0303,
+    /* 209*/ 2 /*character count*/, 0x006f, 0x0303,
+    /* 212*/ 2 /*character count*/, 0x004f, 0x0308,
+    /* 215*/ 2 /*character count*/, 0x006f, 0x0308,
+    /* 218*/ 1 /*character count*/, 0x00f8,
+    /* 220*/ 2 /*character count*/, 0x0055, 0x0300,
+    /* 223*/ 2 /*character count*/, 0x0075, 0x0300,
+    /* 226*/ 2 /*character count*/, 0x0055, 0x0301,
+    /* 229*/ 2 /*character count*/, 0x0075, 0x0301,
+    /* 232*/ 2 /*character count*/, 0x0055, 0x0302,
+    /* 235*/ 2 /*character count*/, 0x0075, 0x0302,
+    /* 238*/ 2 /*character count*/, 0x0055, 0x0308,
+    /* 241*/ 2 /*character count*/, 0x0075, 0x0308,
+    /* 244*/ 2 /*character count*/, 0x0059, 0x0301,
+    /* 247*/ 2 /*character count*/, 0x0079, 0x0301,
+    /* 250*/ 1 /*character count*/, 0x00fe,
+    /* 252*/ 2 /*character count*/, 0x0079, 0x0308,
+    /* 255*/ 2 /*character count*/, 0x0041, 0x0304,
+    /* 258*/ 2 /*character count*/, 0x0061, 0x0304,
+    /* 261*/ 2 /*character count*/, 0x0041, 0x0306,
+    /* 264*/ 2 /*character count*/, 0x0061, 0x0306,
+    /* 267*/ 2 /*character count*/, 0x0041, 0x0328,
+    /* 270*/ 2 /*character count*/, 0x0061, 0x0328,
+    /* 273*/ 2 /*character count*/, 0x0043, 0x0301,
+    /* 276*/ 2 /*character count*/, 0x0063, 0x0301,
+    /* 279*/ 2 /*character count*/, 0x0043, 0x0302,
+    /* 282*/ 2 /*character count*/, 0x0063, 0x0302,
+    /* 285*/ 2 /*character count*/, 0x0043, 0x0307,
+    /* 288*/ 2 /*character count*/, 0x0063, 0x0307,
+    /* 291*/ 2 /*character count*/, 0x0043, 0x030c,
+    /* 294*/ 2 /*character count*/, 0x0063, 0x030c,
+    /* 297*/ 2 /*character count*/, 0x0044, 0x030c,
+    /* 300*/ 2 /*character count*/, 0x0064, 0x030c,
+    /* 303*/ 1 /*character count*/, 0x0111,
+    /* 305*/ 2 /*character count*/, 0x0045, 0x0304,
+    /* 308*/ 2 /*character count*/, 0x0065, 0x0304,
+    /* 311*/ 2 /*character count*/, 0x0045, 0x0306,
+    /* 314*/ 2 /*character count*/, 0x0065, 0x0306,
+    /* 317*/ 2 /*character count*/, 0x0045, 0x0307,
+    /* 320*/ 2 /*character count*/, 0x0065, 0x0307,
+    /* 323*/ 2 /*character count*/, 0x0045, 0x0328,
+    /* 326*/ 2 /*character count*/, 0x0065, 0x0328,
+    /* 329*/ 2 /*character count*/, 0x0045, 0x030c,
+    /* 332*/ 2 /*character count*/, 0x0065, 0x030c,
+    /* 335*/ 2 /*character count*/, 0x0047, 0x0302,
+    /* 338*/ 2 /*character count*/, 0x0067, 0x0302,
+    /* 341*/ 2 /*character count*/, 0x0047, 0x0306,
+    /* 344*/ 2 /*character count*/, 0x0067, 0x0306,
+    /* 347*/ 2 /*character count*/, 0x0047, 0x0307,
+    /* 350*/ 2 /*character count*/, 0x0067, 0x0307,
+    /* 353*/ 2 /*character count*/, 0x0047, 0x0327,
+    /* 356*/ 2 /*character count*/, 0x0067, 0x0327,
+    /* 359*/ 2 /*character count*/, 0x0048, 0x0302,
+    /* 362*/ 2 /*character count*/, 0x0068, 0x0302,
+    /* 365*/ 1 /*character count*/, 0x0127,
+    /* 367*/ 2 /*character count*/, 0x0049, 0x0303,
+    /* 370*/ 2 /*character count*/, 0x0069, 0x0303,
+    /* 373*/ 2 /*character count*/, 0x0049, 0x0304,
+    /* 376*/ 2 /*character count*/, 0x0069, 0x0304,
+    /* 379*/ 2 /*character count*/, 0x0049, 0x0306,
+    /* 382*/ 2 /*character count*/, 0x0069, 0x0306,
+    /* 385*/ 2 /*character count*/, 0x0049, 0x0328,
+    /* 388*/ 2 /*character count*/, 0x0069, 0x0328,
+    /* 391*/ 2 /*character count*/, 0x0049, 0x0307,
+    /* 394*/ 2 /*character count*/, 0x0049, 0x004a,
+    /* 397*/ 2 /*character count*/, 0x0069, 0x006a,
+    /* 400*/ 2 /*character count*/, 0x004a, 0x0302,
+    /* 403*/ 2 /*character count*/, 0x006a, 0x0302,
+    /* 406*/ 2 /*character count*/, 0x004b, 0x0327,
+    /* 409*/ 2 /*character count*/, 0x006b, 0x0327,
+    /* 412*/ 2 /*character count*/, 0x004c, 0x0301,
+    /* 415*/ 2 /*character count*/, 0x006c, 0x0301,
+    /* 418*/ 2 /*character count*/, 0x004c, 0x0327,
+    /* 421*/ 2 /*character count*/, 0x006c, 0x0327,
+    /* 424*/ 2 /*character count*/, 0x004c, 0x030c,
+    /* 427*/ 2 /*character count*/, 0x006c, 0x030c,
+    /* 430*/ 2 /*character count*/, 0x004c, 0x00b7,
+    /* 433*/ 2 /*character count*/, 0x006c, 0x00b7,
+    /* 436*/ 1 /*character count*/, 0x0142,
+    /* 438*/ 2 /*character count*/, 0x004e, 0x0301,
+    /* 441*/ 2 /*character count*/, 0x006e, 0x0301,
+    /* 444*/ 2 /*character count*/, 0x004e, 0x0327,
+    /* 447*/ 2 /*character count*/, 0x006e, 0x0327,
+    /* 450*/ 2 /*character count*/, 0x004e, 0x030c,
+    /* 453*/ 2 /*character count*/, 0x006e, 0x030c,
+    /* 456*/ 2 /*character count*/, 0x02bc, 0x006e,
+    /* 459*/ 1 /*character count*/, 0x014b,
+    /* 461*/ 2 /*character count*/, 0x004f, 0x0304,
+    /* 464*/ 2 /*character count*/, 0x006f, 0x0304,
+    /* 467*/ 2 /*character count*/, 0x004f, 0x0306,
+    /* 470*/ 2 /*character count*/, 0x006f, 0x0306,
+    /* 473*/ 2 /*character count*/, 0x004f, 0x030b,
+    /* 476*/ 2 /*character count*/, 0x006f, 0x030b,
+    /* 479*/ 1 /*character count*/, 0x0153,
+    /* 481*/ 2 /*character count*/, 0x0052, 0x0301,
+    /* 484*/ 2 /*character count*/, 0x0072, 0x0301,
+    /* 487*/ 2 /*character count*/, 0x0052, 0x0327,
+    /* 490*/ 2 /*character count*/, 0x0072, 0x0327,
+    /* 493*/ 2 /*character count*/, 0x0052, 0x030c,
+    /* 496*/ 2 /*character count*/, 0x0072, 0x030c,
+    /* 499*/ 2 /*character count*/, 0x0053, 0x0301,
+    /* 502*/ 2 /*character count*/, 0x0073, 0x0301,
+    /* 505*/ 2 /*character count*/, 0x0053, 0x0302,
+    /* 508*/ 2 /*character count*/, 0x0073, 0x0302,
+    /* 511*/ 2 /*character count*/, 0x0053, 0x0327,
+    /* 514*/ 2 /*character count*/, 0x0073, 0x0327,
+    /* 517*/ 2 /*character count*/, 0x0053, 0x030c,
+    /* 520*/ 2 /*character count*/, 0x0073, 0x030c,
+    /* 523*/ 2 /*character count*/, 0x0054, 0x0327,
+    /* 526*/ 2 /*character count*/, 0x0074, 0x0327,
+    /* 529*/ 2 /*character count*/, 0x0054, 0x030c,
+    /* 532*/ 2 /*character count*/, 0x0074, 0x030c,
+    /* 535*/ 1 /*character count*/, 0x0167,
+    /* 537*/ 2 /*character count*/, 0x0055, 0x0303,
+    /* 540*/ 2 /*character count*/, 0x0075, 0x0303,
+    /* 543*/ 2 /*character count*/, 0x0055, 0x0304,
+    /* 546*/ 2 /*character count*/, 0x0075, 0x0304,
+    /* 549*/ 2 /*character count*/, 0x0055, 0x0306,
+    /* 552*/ 2 /*character count*/, 0x0075, 0x0306,
+    /* 555*/ 2 /*character count*/, 0x0055, 0x030a,
+    /* 558*/ 2 /*character count*/, 0x0075, 0x030a,
+    /* 561*/ 2 /*character count*/, 0x0055, 0x030b,
+    /* 564*/ 2 /*character count*/, 0x0075, 0x030b,
+    /* 567*/ 2 /*character count*/, 0x0055, 0x0328,
+    /* 570*/ 2 /*character count*/, 0x0075, 0x0328,
+    /* 573*/ 2 /*character count*/, 0x0057, 0x0302,
+    /* 576*/ 2 /*character count*/, 0x0077, 0x0302,
+    /* 579*/ 2 /*character count*/, 0x0059, 0x0302,
+    /* 582*/ 2 /*character count*/, 0x0079, 0x0302,
+    /* 585*/ 2 /*character count*/, 0x0059, 0x0308,
+    /* 588*/ 2 /*character count*/, 0x005a, 0x0301,
+    /* 591*/ 2 /*character count*/, 0x007a, 0x0301,
+    /* 594*/ 2 /*character count*/, 0x005a, 0x0307,
+    /* 597*/ 2 /*character count*/, 0x007a, 0x0307,
+    /* 600*/ 2 /*character count*/, 0x005a, 0x030c,
+    /* 603*/ 2 /*character count*/, 0x007a, 0x030c,
+    /* 606*/ 1 /*character count*/, 0x0253,
+    /* 608*/ 1 /*character count*/, 0x0183,
+    /* 610*/ 1 /*character count*/, 0x0185,
+    /* 612*/ 1 /*character count*/, 0x0254,
+    /* 614*/ 1 /*character count*/, 0x0188,
+    /* 616*/ 1 /*character count*/, 0x0256,
+    /* 618*/ 1 /*character count*/, 0x0257,
+    /* 620*/ 1 /*character count*/, 0x018c,
+    /* 622*/ 1 /*character count*/, 0x01dd,
+    /* 624*/ 1 /*character count*/, 0x0259,
+    /* 626*/ 1 /*character count*/, 0x025b,
+    /* 628*/ 1 /*character count*/, 0x0192,
+    /* 630*/ 1 /*character count*/, 0x0260,
+    /* 632*/ 1 /*character count*/, 0x0263,
+    /* 634*/ 1 /*character count*/, 0x0269,
+    /* 636*/ 1 /*character count*/, 0x0268,
+    /* 638*/ 1 /*character count*/, 0x0199,
+    /* 640*/ 1 /*character count*/, 0x026f,
+    /* 642*/ 1 /*character count*/, 0x0272,
+    /* 644*/ 1 /*character count*/, 0x0275,
+    /* 646*/ 2 /*character count*/, 0x004f, 0x031b,
+    /* 649*/ 2 /*character count*/, 0x006f, 0x031b,
+    /* 652*/ 1 /*character count*/, 0x01a3,
+    /* 654*/ 1 /*character count*/, 0x01a5,
+    /* 656*/ 1 /*character count*/, 0x0280,
+    /* 658*/ 1 /*character count*/, 0x01a8,
+    /* 660*/ 1 /*character count*/, 0x0283,
+    /* 662*/ 1 /*character count*/, 0x01ad,
+    /* 664*/ 1 /*character count*/, 0x0288,
+    /* 666*/ 2 /*character count*/, 0x0055, 0x031b,
+    /* 669*/ 2 /*character count*/, 0x0075, 0x031b,
+    /* 672*/ 1 /*character count*/, 0x028a,
+    /* 674*/ 1 /*character count*/, 0x028b,
+    /* 676*/ 1 /*character count*/, 0x01b4,
+    /* 678*/ 1 /*character count*/, 0x01b6,
+    /* 680*/ 1 /*character count*/, 0x0292,
+    /* 682*/ 1 /*character count*/, 0x01b9,
+    /* 684*/ 1 /*character count*/, 0x01bd,
+    /* 686*/ 3 /*character count*/, 0x0044, 0x005a, 0x030c,
+    /* 690*/ 3 /*character count*/, 0x0064, 0x007a, 0x030c,
+    /* 694*/ 2 /*character count*/, 0x0064, 0x007a,
+    /* 697*/ 3 /*character count*/, 0x0044, 0x007a, 0x030c,
+    /* 701*/ 2 /*character count*/, 0x004c, 0x004a,
+    /* 704*/ 2 /*character count*/, 0x006c, 0x006a,
+    /* 707*/ 2 /*character count*/, 0x004c, 0x006a,
+    /* 710*/ 2 /*character count*/, 0x004e, 0x004a,
+    /* 713*/ 2 /*character count*/, 0x006e, 0x006a,
+    /* 716*/ 2 /*character count*/, 0x004e, 0x006a,
+    /* 719*/ 2 /*character count*/, 0x0041, 0x030c,
+    /* 722*/ 2 /*character count*/, 0x0061, 0x030c,
+    /* 725*/ 2 /*character count*/, 0x0049, 0x030c,
+    /* 728*/ 2 /*character count*/, 0x0069, 0x030c,
+    /* 731*/ 2 /*character count*/, 0x004f, 0x030c,
+    /* 734*/ 2 /*character count*/, 0x006f, 0x030c,
+    /* 737*/ 2 /*character count*/, 0x0055, 0x030c,
+    /* 740*/ 2 /*character count*/, 0x0075, 0x030c,
+    /* 743*/ 3 /*character count*/, 0x0055, 0x0308, 0x0304,
+    /* 747*/ 3 /*character count*/, 0x0075, 0x0308, 0x0304,
+    /* 751*/ 3 /*character count*/, 0x0055, 0x0308, 0x0301,
+    /* 755*/ 3 /*character count*/, 0x0075, 0x0308, 0x0301,
+    /* 759*/ 3 /*character count*/, 0x0055, 0x0308, 0x030c,
+    /* 763*/ 3 /*character count*/, 0x0075, 0x0308, 0x030c,
+    /* 767*/ 3 /*character count*/, 0x0055, 0x0308, 0x0300,
+    /* 771*/ 3 /*character count*/, 0x0075, 0x0308, 0x0300,
+    /* 775*/ 3 /*character count*/, 0x0041, 0x0308, 0x0304,
+    /* 779*/ 3 /*character count*/, 0x0061, 0x0308, 0x0304,
+    /* 783*/ 3 /*character count*/, 0x0041, 0x0307, 0x0304,
+    /* 787*/ 3 /*character count*/, 0x0061, 0x0307, 0x0304,
+    /* 791*/ 2 /*character count*/, 0x00c6, 0x0304,
+    /* 794*/ 2 /*character count*/, 0x00e6, 0x0304,
+    /* 797*/ 1 /*character count*/, 0x01e5,
+    /* 799*/ 2 /*character count*/, 0x0047, 0x030c,
+    /* 802*/ 2 /*character count*/, 0x0067, 0x030c,
+    /* 805*/ 2 /*character count*/, 0x004b, 0x030c,
+    /* 808*/ 2 /*character count*/, 0x006b, 0x030c,
+    /* 811*/ 2 /*character count*/, 0x004f, 0x0328,
+    /* 814*/ 2 /*character count*/, 0x006f, 0x0328,
+    /* 817*/ 3 /*character count*/, 0x004f, 0x0328, 0x0304,
+    /* 821*/ 3 /*character count*/, 0x006f, 0x0328, 0x0304,
+    /* 825*/ 2 /*character count*/, 0x01b7, 0x030c,
+    /* 828*/ 2 /*character count*/, 0x0292, 0x030c,
+    /* 831*/ 2 /*character count*/, 0x006a, 0x030c,
+    /* 834*/ 2 /*character count*/, 0x0044, 0x005a,
+    /* 837*/ 2 /*character count*/, 0x0044, 0x007a,
+    /* 840*/ 2 /*character count*/, 0x0047, 0x0301,
+    /* 843*/ 2 /*character count*/, 0x0067, 0x0301,
+    /* 846*/ 1 /*character count*/, 0x0195,
+    /* 848*/ 1 /*character count*/, 0x01bf,
+    /* 850*/ 2 /*character count*/, 0x004e, 0x0300,
+    /* 853*/ 2 /*character count*/, 0x006e, 0x0300,
+    /* 856*/ 3 /*character count*/, 0x0041, 0x030a, 0x0301,
+    /* 860*/ 3 /*character count*/, 0x0061, 0x030a, 0x0301,
+    /* 864*/ 2 /*character count*/, 0x00c6, 0x0301,
+    /* 867*/ 2 /*character count*/, 0x00e6, 0x0301,
+    /* 870*/ 2 /*character count*/, 0x00d8, 0x0301,
+    /* 873*/ 2 /*character count*/, 0x00f8, 0x0301,
+    /* 876*/ 2 /*character count*/, 0x0041, 0x030f,
+    /* 879*/ 2 /*character count*/, 0x0061, 0x030f,
+    /* 882*/ 2 /*character count*/, 0x0041, 0x0311,
+    /* 885*/ 2 /*character count*/, 0x0061, 0x0311,
+    /* 888*/ 2 /*character count*/, 0x0045, 0x030f,
+    /* 891*/ 2 /*character count*/, 0x0065, 0x030f,
+    /* 894*/ 2 /*character count*/, 0x0045, 0x0311,
+    /* 897*/ 2 /*character count*/, 0x0065, 0x0311,
+    /* 900*/ 2 /*character count*/, 0x0049, 0x030f,
+    /* 903*/ 2 /*character count*/, 0x0069, 0x030f,
+    /* 906*/ 2 /*character count*/, 0x0049, 0x0311,
+    /* 909*/ 2 /*character count*/, 0x0069, 0x0311,
+    /* 912*/ 2 /*character count*/, 0x004f, 0x030f,
+    /* 915*/ 2 /*character count*/, 0x006f, 0x030f,
+    /* 918*/ 2 /*character count*/, 0x004f, 0x0311,
+    /* 921*/ 2 /*character count*/, 0x006f, 0x0311,
+    /* 924*/ 2 /*character count*/, 0x0052, 0x030f,
+    /* 927*/ 2 /*character count*/, 0x0072, 0x030f,
+    /* 930*/ 2 /*character count*/, 0x0052, 0x0311,
+    /* 933*/ 2 /*character count*/, 0x0072, 0x0311,
+    /* 936*/ 2 /*character count*/, 0x0055, 0x030f,
+    /* 939*/ 2 /*character count*/, 0x0075, 0x030f,
+    /* 942*/ 2 /*character count*/, 0x0055, 0x0311,
+    /* 945*/ 2 /*character count*/, 0x0075, 0x0311,
+    /* 948*/ 2 /*character count*/, 0x0053, 0x0326,
+    /* 951*/ 2 /*character count*/, 0x0073, 0x0326,
+    /* 954*/ 2 /*character count*/, 0x0054, 0x0326,
+    /* 957*/ 2 /*character count*/, 0x0074, 0x0326,
+    /* 960*/ 1 /*character count*/, 0x021d,
+    /* 962*/ 2 /*character count*/, 0x0048, 0x030c,
+    /* 965*/ 2 /*character count*/, 0x0068, 0x030c,
+    /* 968*/ 1 /*character count*/, 0x019e,
+    /* 970*/ 1 /*character count*/, 0x0223,
+    /* 972*/ 1 /*character count*/, 0x0225,
+    /* 974*/ 2 /*character count*/, 0x0041, 0x0307,
+    /* 977*/ 2 /*character count*/, 0x0061, 0x0307,
+    /* 980*/ 2 /*character count*/, 0x0045, 0x0327,
+    /* 983*/ 2 /*character count*/, 0x0065, 0x0327,
+    /* 986*/ 3 /*character count*/, 0x004f, 0x0308, 0x0304,
+    /* 990*/ 3 /*character count*/, 0x006f, 0x0308, 0x0304,
+    /* 994*/ 3 /*character count*/, 0x004f, 0x0303, 0x0304,
+    /* 998*/ 3 /*character count*/, 0x006f, 0x0303, 0x0304,
+    /*1002*/ 2 /*character count*/, 0x004f, 0x0307,
+    /*1005*/ 2 /*character count*/, 0x006f, 0x0307,
+    /*1008*/ 3 /*character count*/, 0x004f, 0x0307, 0x0304,
+    /*1012*/ 3 /*character count*/, 0x006f, 0x0307, 0x0304,
+    /*1016*/ 2 /*character count*/, 0x0059, 0x0304,
+    /*1019*/ 2 /*character count*/, 0x0079, 0x0304,
+    /*1022*/ 1 /*character count*/, 0x2c65,
+    /*1024*/ 1 /*character count*/, 0x023c,
+    /*1026*/ 1 /*character count*/, 0x019a,
+    /*1028*/ 1 /*character count*/, 0x2c66,
+    /*1030*/ 1 /*character count*/, 0x0242,
+    /*1032*/ 1 /*character count*/, 0x0180,
+    /*1034*/ 1 /*character count*/, 0x0289,
+    /*1036*/ 1 /*character count*/, 0x028c,
+    /*1038*/ 1 /*character count*/, 0x0247,
+    /*1040*/ 1 /*character count*/, 0x0249,
+    /*1042*/ 1 /*character count*/, 0x024b,
+    /*1044*/ 1 /*character count*/, 0x024d,
+    /*1046*/ 1 /*character count*/, 0x024f,
+    /*1048*/ 1 /*character count*/, 0x03b9,
+    /*1050*/ 1 /*character count*/, 0x0371,
+    /*1052*/ 1 /*character count*/, 0x0373,
+    /*1054*/ 1 /*character count*/, 0x0377,
+    /*1056*/ 1 /*character count*/, 0x03ac,
+    /*1058*/ 1 /*character count*/, 0x03ad,
+    /*1060*/ 1 /*character count*/, 0x03ae,
+    /*1062*/ 1 /*character count*/, 0x03af,
+    /*1064*/ 1 /*character count*/, 0x03cc,
+    /*1066*/ 1 /*character count*/, 0x03cd,
+    /*1068*/ 1 /*character count*/, 0x03ce,
+    /*1070*/ 1 /*character count*/, 0x03b1,
+    /*1072*/ 1 /*character count*/, 0x03b2,
+    /*1074*/ 1 /*character count*/, 0x03b3,
+    /*1076*/ 1 /*character count*/, 0x03b4,
+    /*1078*/ 1 /*character count*/, 0x03b5,
+    /*1080*/ 1 /*character count*/, 0x03b6,
+    /*1082*/ 1 /*character count*/, 0x03b7,
+    /*1084*/ 1 /*character count*/, 0x03b8,
+    /*1086*/ 1 /*character count*/, 0x03ba,
+    /*1088*/ 1 /*character count*/, 0x03bb,
+    /*1090*/ 1 /*character count*/, 0x03bd,
+    /*1092*/ 1 /*character count*/, 0x03be,
+    /*1094*/ 1 /*character count*/, 0x03bf,
+    /*1096*/ 1 /*character count*/, 0x03c0,
+    /*1098*/ 1 /*character count*/, 0x03c1,
+    /*1100*/ 1 /*character count*/, 0x03c3,
+    /*1102*/ 1 /*character count*/, 0x03c4,
+    /*1104*/ 1 /*character count*/, 0x03c5,
+    /*1106*/ 1 /*character count*/, 0x03c6,
+    /*1108*/ 1 /*character count*/, 0x03c7,
+    /*1110*/ 1 /*character count*/, 0x03c8,
+    /*1112*/ 1 /*character count*/, 0x03c9,
+    /*1114*/ 1 /*character count*/, 0x03ca,
+    /*1116*/ 1 /*character count*/, 0x03cb,
+    /*1118*/ 1 /*character count*/, 0x03d7,
+    /*1120*/ 1 /*character count*/, 0x03d9,
+    /*1122*/ 1 /*character count*/, 0x03db,
+    /*1124*/ 1 /*character count*/, 0x03dd,
+    /*1126*/ 1 /*character count*/, 0x03df,
+    /*1128*/ 1 /*character count*/, 0x03e1,
+    /*1130*/ 1 /*character count*/, 0x03e3,
+    /*1132*/ 1 /*character count*/, 0x03e5,
+    /*1134*/ 1 /*character count*/, 0x03e7,
+    /*1136*/ 1 /*character count*/, 0x03e9,
+    /*1138*/ 1 /*character count*/, 0x03eb,
+    /*1140*/ 1 /*character count*/, 0x03ed,
+    /*1142*/ 1 /*character count*/, 0x03ef,
+    /*1144*/ 1 /*character count*/, 0x03f8,
+    /*1146*/ 1 /*character count*/, 0x03f2,
+    /*1148*/ 1 /*character count*/, 0x03fb,
+    /*1150*/ 1 /*character count*/, 0x037b,
+    /*1152*/ 1 /*character count*/, 0x037c,
+    /*1154*/ 1 /*character count*/, 0x037d,
+    /*1156*/ 1 /*character count*/, 0x0450,
+    /*1158*/ 1 /*character count*/, 0x0451,
+    /*1160*/ 1 /*character count*/, 0x0452,
+    /*1162*/ 1 /*character count*/, 0x0453,
+    /*1164*/ 1 /*character count*/, 0x0454,
+    /*1166*/ 1 /*character count*/, 0x0455,
+    /*1168*/ 1 /*character count*/, 0x0456,
+    /*1170*/ 1 /*character count*/, 0x0457,
+    /*1172*/ 1 /*character count*/, 0x0458,
+    /*1174*/ 1 /*character count*/, 0x0459,
+    /*1176*/ 1 /*character count*/, 0x045a,
+    /*1178*/ 1 /*character count*/, 0x045b,
+    /*1180*/ 1 /*character count*/, 0x045c,
+    /*1182*/ 1 /*character count*/, 0x045d,
+    /*1184*/ 1 /*character count*/, 0x045e,
+    /*1186*/ 1 /*character count*/, 0x045f,
+    /*1188*/ 1 /*character count*/, 0x0430,
+    /*1190*/ 1 /*character count*/, 0x0431,
+    /*1192*/ 1 /*character count*/, 0x0432,
+    /*1194*/ 1 /*character count*/, 0x0433,
+    /*1196*/ 1 /*character count*/, 0x0434,
+    /*1198*/ 1 /*character count*/, 0x0435,
+    /*1200*/ 1 /*character count*/, 0x0436,
+    /*1202*/ 1 /*character count*/, 0x0437,
+    /*1204*/ 1 /*character count*/, 0x0438,
+    /*1206*/ 1 /*character count*/, 0x0439,
+    /*1208*/ 1 /*character count*/, 0x043a,
+    /*1210*/ 1 /*character count*/, 0x043b,
+    /*1212*/ 1 /*character count*/, 0x043c,
+    /*1214*/ 1 /*character count*/, 0x043d,
+    /*1216*/ 1 /*character count*/, 0x043e,
+    /*1218*/ 1 /*character count*/, 0x043f,
+    /*1220*/ 1 /*character count*/, 0x0440,
+    /*1222*/ 1 /*character count*/, 0x0441,
+    /*1224*/ 1 /*character count*/, 0x0442,
+    /*1226*/ 1 /*character count*/, 0x0443,
+    /*1228*/ 1 /*character count*/, 0x0444,
+    /*1230*/ 1 /*character count*/, 0x0445,
+    /*1232*/ 1 /*character count*/, 0x0446,
+    /*1234*/ 1 /*character count*/, 0x0447,
+    /*1236*/ 1 /*character count*/, 0x0448,
+    /*1238*/ 1 /*character count*/, 0x0449,
+    /*1240*/ 1 /*character count*/, 0x044a,
+    /*1242*/ 1 /*character count*/, 0x044b,
+    /*1244*/ 1 /*character count*/, 0x044c,
+    /*1246*/ 1 /*character count*/, 0x044d,
+    /*1248*/ 1 /*character count*/, 0x044e,
+    /*1250*/ 1 /*character count*/, 0x044f,
+    /*1252*/ 1 /*character count*/, 0x0461,
+    /*1254*/ 1 /*character count*/, 0x0463,
+    /*1256*/ 1 /*character count*/, 0x0465,
+    /*1258*/ 1 /*character count*/, 0x0467,
+    /*1260*/ 1 /*character count*/, 0x0469,
+    /*1262*/ 1 /*character count*/, 0x046b,
+    /*1264*/ 1 /*character count*/, 0x046d,
+    /*1266*/ 1 /*character count*/, 0x046f,
+    /*1268*/ 1 /*character count*/, 0x0471,
+    /*1270*/ 1 /*character count*/, 0x0473,
+    /*1272*/ 1 /*character count*/, 0x0475,
+    /*1274*/ 1 /*character count*/, 0x0477,
+    /*1276*/ 1 /*character count*/, 0x0479,
+    /*1278*/ 1 /*character count*/, 0x047b,
+    /*1280*/ 1 /*character count*/, 0x047d,
+    /*1282*/ 1 /*character count*/, 0x047f,
+    /*1284*/ 1 /*character count*/, 0x0481,
+    /*1286*/ 1 /*character count*/, 0x048b,
+    /*1288*/ 1 /*character count*/, 0x048d,
+    /*1290*/ 1 /*character count*/, 0x048f,
+    /*1292*/ 1 /*character count*/, 0x0491,
+    /*1294*/ 1 /*character count*/, 0x0493,
+    /*1296*/ 1 /*character count*/, 0x0495,
+    /*1298*/ 1 /*character count*/, 0x0497,
+    /*1300*/ 1 /*character count*/, 0x0499,
+    /*1302*/ 1 /*character count*/, 0x049b,
+    /*1304*/ 1 /*character count*/, 0x049d,
+    /*1306*/ 1 /*character count*/, 0x049f,
+    /*1308*/ 1 /*character count*/, 0x04a1,
+    /*1310*/ 1 /*character count*/, 0x04a3,
+    /*1312*/ 1 /*character count*/, 0x04a5,
+    /*1314*/ 1 /*character count*/, 0x04a7,
+    /*1316*/ 1 /*character count*/, 0x04a9,
+    /*1318*/ 1 /*character count*/, 0x04ab,
+    /*1320*/ 1 /*character count*/, 0x04ad,
+    /*1322*/ 1 /*character count*/, 0x04af,
+    /*1324*/ 1 /*character count*/, 0x04b1,
+    /*1326*/ 1 /*character count*/, 0x04b3,
+    /*1328*/ 1 /*character count*/, 0x04b5,
+    /*1330*/ 1 /*character count*/, 0x04b7,
+    /*1332*/ 1 /*character count*/, 0x04b9,
+    /*1334*/ 1 /*character count*/, 0x04bb,
+    /*1336*/ 1 /*character count*/, 0x04bd,
+    /*1338*/ 1 /*character count*/, 0x04bf,
+    /*1340*/ 1 /*character count*/, 0x04cf,
+    /*1342*/ 1 /*character count*/, 0x04c2,
+    /*1344*/ 1 /*character count*/, 0x04c4,
+    /*1346*/ 1 /*character count*/, 0x04c6,
+    /*1348*/ 1 /*character count*/, 0x04c8,
+    /*1350*/ 1 /*character count*/, 0x04ca,
+    /*1352*/ 1 /*character count*/, 0x04cc,
+    /*1354*/ 1 /*character count*/, 0x04ce,
+    /*1356*/ 1 /*character count*/, 0x04d1,
+    /*1358*/ 1 /*character count*/, 0x04d3,
+    /*1360*/ 1 /*character count*/, 0x04d5,
+    /*1362*/ 1 /*character count*/, 0x04d7,
+    /*1364*/ 1 /*character count*/, 0x04d9,
+    /*1366*/ 1 /*character count*/, 0x04db,
+    /*1368*/ 1 /*character count*/, 0x04dd,
+    /*1370*/ 1 /*character count*/, 0x04df,
+    /*1372*/ 1 /*character count*/, 0x04e1,
+    /*1374*/ 1 /*character count*/, 0x04e3,
+    /*1376*/ 1 /*character count*/, 0x04e5,
+    /*1378*/ 1 /*character count*/, 0x04e7,
+    /*1380*/ 1 /*character count*/, 0x04e9,
+    /*1382*/ 1 /*character count*/, 0x04eb,
+    /*1384*/ 1 /*character count*/, 0x04ed,
+    /*1386*/ 1 /*character count*/, 0x04ef,
+    /*1388*/ 1 /*character count*/, 0x04f1,
+    /*1390*/ 1 /*character count*/, 0x04f3,
+    /*1392*/ 1 /*character count*/, 0x04f5,
+    /*1394*/ 1 /*character count*/, 0x04f7,
+    /*1396*/ 1 /*character count*/, 0x04f9,
+    /*1398*/ 1 /*character count*/, 0x04fb,
+    /*1400*/ 1 /*character count*/, 0x04fd,
+    /*1402*/ 1 /*character count*/, 0x04ff,
+    /*1404*/ 1 /*character count*/, 0x0501,
+    /*1406*/ 1 /*character count*/, 0x0503,
+    /*1408*/ 1 /*character count*/, 0x0505,
+    /*1410*/ 1 /*character count*/, 0x0507,
+    /*1412*/ 1 /*character count*/, 0x0509,
+    /*1414*/ 1 /*character count*/, 0x050b,
+    /*1416*/ 1 /*character count*/, 0x050d,
+    /*1418*/ 1 /*character count*/, 0x050f,
+    /*1420*/ 1 /*character count*/, 0x0511,
+    /*1422*/ 1 /*character count*/, 0x0513,
+    /*1424*/ 1 /*character count*/, 0x0515,
+    /*1426*/ 1 /*character count*/, 0x0517,
+    /*1428*/ 1 /*character count*/, 0x0519,
+    /*1430*/ 1 /*character count*/, 0x051b,
+    /*1432*/ 1 /*character count*/, 0x051d,
+    /*1434*/ 1 /*character count*/, 0x051f,
+    /*1436*/ 1 /*character count*/, 0x0521,
+    /*1438*/ 1 /*character count*/, 0x0523,
+    /*1440*/ 1 /*character count*/, 0x0525,
+    /*1442*/ 1 /*character count*/, 0x0527,
+    /*1444*/ 1 /*character count*/, 0x0561,
+    /*1446*/ 1 /*character count*/, 0x0562,
+    /*1448*/ 1 /*character count*/, 0x0563,
+    /*1450*/ 1 /*character count*/, 0x0564,
+    /*1452*/ 1 /*character count*/, 0x0565,
+    /*1454*/ 1 /*character count*/, 0x0566,
+    /*1456*/ 1 /*character count*/, 0x0567,
+    /*1458*/ 1 /*character count*/, 0x0568,
+    /*1460*/ 1 /*character count*/, 0x0569,
+    /*1462*/ 1 /*character count*/, 0x056a,
+    /*1464*/ 1 /*character count*/, 0x056b,
+    /*1466*/ 1 /*character count*/, 0x056c,
+    /*1468*/ 1 /*character count*/, 0x056d,
+    /*1470*/ 1 /*character count*/, 0x056e,
+    /*1472*/ 1 /*character count*/, 0x056f,
+    /*1474*/ 1 /*character count*/, 0x0570,
+    /*1476*/ 1 /*character count*/, 0x0571,
+    /*1478*/ 1 /*character count*/, 0x0572,
+    /*1480*/ 1 /*character count*/, 0x0573,
+    /*1482*/ 1 /*character count*/, 0x0574,
+    /*1484*/ 1 /*character count*/, 0x0575,
+    /*1486*/ 1 /*character count*/, 0x0576,
+    /*1488*/ 1 /*character count*/, 0x0577,
+    /*1490*/ 1 /*character count*/, 0x0578,
+    /*1492*/ 1 /*character count*/, 0x0579,
+    /*1494*/ 1 /*character count*/, 0x057a,
+    /*1496*/ 1 /*character count*/, 0x057b,
+    /*1498*/ 1 /*character count*/, 0x057c,
+    /*1500*/ 1 /*character count*/, 0x057d,
+    /*1502*/ 1 /*character count*/, 0x057e,
+    /*1504*/ 1 /*character count*/, 0x057f,
+    /*1506*/ 1 /*character count*/, 0x0580,
+    /*1508*/ 1 /*character count*/, 0x0581,
+    /*1510*/ 1 /*character count*/, 0x0582,
+    /*1512*/ 1 /*character count*/, 0x0583,
+    /*1514*/ 1 /*character count*/, 0x0584,
+    /*1516*/ 1 /*character count*/, 0x0585,
+    /*1518*/ 1 /*character count*/, 0x0586,
+    /*1520*/ 1 /*character count*/, 0x2d00,
+    /*1522*/ 1 /*character count*/, 0x2d01,
+    /*1524*/ 1 /*character count*/, 0x2d02,
+    /*1526*/ 1 /*character count*/, 0x2d03,
+    /*1528*/ 1 /*character count*/, 0x2d04,
+    /*1530*/ 1 /*character count*/, 0x2d05,
+    /*1532*/ 1 /*character count*/, 0x2d06,
+    /*1534*/ 1 /*character count*/, 0x2d07,
+    /*1536*/ 1 /*character count*/, 0x2d08,
+    /*1538*/ 1 /*character count*/, 0x2d09,
+    /*1540*/ 1 /*character count*/, 0x2d0a,
+    /*1542*/ 1 /*character count*/, 0x2d0b,
+    /*1544*/ 1 /*character count*/, 0x2d0c,
+    /*1546*/ 1 /*character count*/, 0x2d0d,
+    /*1548*/ 1 /*character count*/, 0x2d0e,
+    /*1550*/ 1 /*character count*/, 0x2d0f,
+    /*1552*/ 1 /*character count*/, 0x2d10,
+    /*1554*/ 1 /*character count*/, 0x2d11,
+    /*1556*/ 1 /*character count*/, 0x2d12,
+    /*1558*/ 1 /*character count*/, 0x2d13,
+    /*1560*/ 1 /*character count*/, 0x2d14,
+    /*1562*/ 1 /*character count*/, 0x2d15,
+    /*1564*/ 1 /*character count*/, 0x2d16,
+    /*1566*/ 1 /*character count*/, 0x2d17,
+    /*1568*/ 1 /*character count*/, 0x2d18,
+    /*1570*/ 1 /*character count*/, 0x2d19,
+    /*1572*/ 1 /*character count*/, 0x2d1a,
+    /*1574*/ 1 /*character count*/, 0x2d1b,
+    /*1576*/ 1 /*character count*/, 0x2d1c,
+    /*1578*/ 1 /*character count*/, 0x2d1d,
+    /*1580*/ 1 /*character count*/, 0x2d1e,
+    /*1582*/ 1 /*character count*/, 0x2d1f,
+    /*1584*/ 1 /*character count*/, 0x2d20,
+    /*1586*/ 1 /*character count*/, 0x2d21,
+    /*1588*/ 1 /*character count*/, 0x2d22,
+    /*1590*/ 1 /*character count*/, 0x2d23,
+    /*1592*/ 1 /*character count*/, 0x2d24,
+    /*1594*/ 1 /*character count*/, 0x2d25,
+    /*1596*/ 1 /*character count*/, 0x2d27,
+    /*1598*/ 1 /*character count*/, 0x2d2d,
+    /*1600*/ 1 /*character count*/, 0x1e01,
+    /*1602*/ 1 /*character count*/, 0x1e03,
+    /*1604*/ 1 /*character count*/, 0x1e05,
+    /*1606*/ 1 /*character count*/, 0x1e07,
+    /*1608*/ 1 /*character count*/, 0x1e09,
+    /*1610*/ 1 /*character count*/, 0x1e0b,
+    /*1612*/ 1 /*character count*/, 0x1e0d,
+    /*1614*/ 1 /*character count*/, 0x1e0f,
+    /*1616*/ 1 /*character count*/, 0x1e11,
+    /*1618*/ 1 /*character count*/, 0x1e13,
+    /*1620*/ 1 /*character count*/, 0x1e15,
+    /*1622*/ 1 /*character count*/, 0x1e17,
+    /*1624*/ 1 /*character count*/, 0x1e19,
+    /*1626*/ 1 /*character count*/, 0x1e1b,
+    /*1628*/ 1 /*character count*/, 0x1e1d,
+    /*1630*/ 1 /*character count*/, 0x1e1f,
+    /*1632*/ 1 /*character count*/, 0x1e21,
+    /*1634*/ 1 /*character count*/, 0x1e23,
+    /*1636*/ 1 /*character count*/, 0x1e25,
+    /*1638*/ 1 /*character count*/, 0x1e27,
+    /*1640*/ 1 /*character count*/, 0x1e29,
+    /*1642*/ 1 /*character count*/, 0x1e2b,
+    /*1644*/ 1 /*character count*/, 0x1e2d,
+    /*1646*/ 1 /*character count*/, 0x1e2f,
+    /*1648*/ 1 /*character count*/, 0x1e31,
+    /*1650*/ 1 /*character count*/, 0x1e33,
+    /*1652*/ 1 /*character count*/, 0x1e35,
+    /*1654*/ 1 /*character count*/, 0x1e37,
+    /*1656*/ 1 /*character count*/, 0x1e39,
+    /*1658*/ 1 /*character count*/, 0x1e3b,
+    /*1660*/ 1 /*character count*/, 0x1e3d,
+    /*1662*/ 1 /*character count*/, 0x1e3f,
+    /*1664*/ 1 /*character count*/, 0x1e41,
+    /*1666*/ 1 /*character count*/, 0x1e43,
+    /*1668*/ 1 /*character count*/, 0x1e45,
+    /*1670*/ 1 /*character count*/, 0x1e47,
+    /*1672*/ 1 /*character count*/, 0x1e49,
+    /*1674*/ 1 /*character count*/, 0x1e4b,
+    /*1676*/ 1 /*character count*/, 0x1e4d,
+    /*1678*/ 1 /*character count*/, 0x1e4f,
+    /*1680*/ 1 /*character count*/, 0x1e51,
+    /*1682*/ 1 /*character count*/, 0x1e53,
+    /*1684*/ 1 /*character count*/, 0x1e55,
+    /*1686*/ 1 /*character count*/, 0x1e57,
+    /*1688*/ 1 /*character count*/, 0x1e59,
+    /*1690*/ 1 /*character count*/, 0x1e5b,
+    /*1692*/ 1 /*character count*/, 0x1e5d,
+    /*1694*/ 1 /*character count*/, 0x1e5f,
+    /*1696*/ 1 /*character count*/, 0x1e61,
+    /*1698*/ 1 /*character count*/, 0x1e63,
+    /*1700*/ 1 /*character count*/, 0x1e65,
+    /*1702*/ 1 /*character count*/, 0x1e67,
+    /*1704*/ 1 /*character count*/, 0x1e69,
+    /*1706*/ 1 /*character count*/, 0x1e6b,
+    /*1708*/ 1 /*character count*/, 0x1e6d,
+    /*1710*/ 1 /*character count*/, 0x1e6f,
+    /*1712*/ 1 /*character count*/, 0x1e71,
+    /*1714*/ 1 /*character count*/, 0x1e73,
+    /*1716*/ 1 /*character count*/, 0x1e75,
+    /*1718*/ 1 /*character count*/, 0x1e77,
+    /*1720*/ 1 /*character count*/, 0x1e79,
+    /*1722*/ 1 /*character count*/, 0x1e7b,
+    /*1724*/ 1 /*character count*/, 0x1e7d,
+    /*1726*/ 1 /*character count*/, 0x1e7f,
+    /*1728*/ 1 /*character count*/, 0x1e81,
+    /*1730*/ 1 /*character count*/, 0x1e83,
+    /*1732*/ 1 /*character count*/, 0x1e85,
+    /*1734*/ 1 /*character count*/, 0x1e87,
+    /*1736*/ 1 /*character count*/, 0x1e89,
+    /*1738*/ 1 /*character count*/, 0x1e8b,
+    /*1740*/ 1 /*character count*/, 0x1e8d,
+    /*1742*/ 1 /*character count*/, 0x1e8f,
+    /*1744*/ 1 /*character count*/, 0x1e91,
+    /*1746*/ 1 /*character count*/, 0x1e93,
+    /*1748*/ 1 /*character count*/, 0x1e95,
+    /*1750*/ 1 /*character count*/, 0x00df,
+    /*1752*/ 1 /*character count*/, 0x1ea1,
+    /*1754*/ 1 /*character count*/, 0x1ea3,
+    /*1756*/ 1 /*character count*/, 0x1ea5,
+    /*1758*/ 1 /*character count*/, 0x1ea7,
+    /*1760*/ 1 /*character count*/, 0x1ea9,
+    /*1762*/ 1 /*character count*/, 0x1eab,
+    /*1764*/ 1 /*character count*/, 0x1ead,
+    /*1766*/ 1 /*character count*/, 0x1eaf,
+    /*1768*/ 1 /*character count*/, 0x1eb1,
+    /*1770*/ 1 /*character count*/, 0x1eb3,
+    /*1772*/ 1 /*character count*/, 0x1eb5,
+    /*1774*/ 1 /*character count*/, 0x1eb7,
+    /*1776*/ 1 /*character count*/, 0x1eb9,
+    /*1778*/ 1 /*character count*/, 0x1ebb,
+    /*1780*/ 1 /*character count*/, 0x1ebd,
+    /*1782*/ 1 /*character count*/, 0x1ebf,
+    /*1784*/ 1 /*character count*/, 0x1ec1,
+    /*1786*/ 1 /*character count*/, 0x1ec3,
+    /*1788*/ 1 /*character count*/, 0x1ec5,
+    /*1790*/ 1 /*character count*/, 0x1ec7,
+    /*1792*/ 1 /*character count*/, 0x1ec9,
+    /*1794*/ 1 /*character count*/, 0x1ecb,
+    /*1796*/ 1 /*character count*/, 0x1ecd,
+    /*1798*/ 1 /*character count*/, 0x1ecf,
+    /*1800*/ 1 /*character count*/, 0x1ed1,
+    /*1802*/ 1 /*character count*/, 0x1ed3,
+    /*1804*/ 1 /*character count*/, 0x1ed5,
+    /*1806*/ 1 /*character count*/, 0x1ed7,
+    /*1808*/ 1 /*character count*/, 0x1ed9,
+    /*1810*/ 1 /*character count*/, 0x1edb,
+    /*1812*/ 1 /*character count*/, 0x1edd,
+    /*1814*/ 1 /*character count*/, 0x1edf,
+    /*1816*/ 1 /*character count*/, 0x1ee1,
+    /*1818*/ 1 /*character count*/, 0x1ee3,
+    /*1820*/ 1 /*character count*/, 0x1ee5,
+    /*1822*/ 1 /*character count*/, 0x1ee7,
+    /*1824*/ 1 /*character count*/, 0x1ee9,
+    /*1826*/ 1 /*character count*/, 0x1eeb,
+    /*1828*/ 1 /*character count*/, 0x1eed,
+    /*1830*/ 1 /*character count*/, 0x1eef,
+    /*1832*/ 1 /*character count*/, 0x1ef1,
+    /*1834*/ 1 /*character count*/, 0x1ef3,
+    /*1836*/ 1 /*character count*/, 0x1ef5,
+    /*1838*/ 1 /*character count*/, 0x1ef7,
+    /*1840*/ 1 /*character count*/, 0x1ef9,
+    /*1842*/ 1 /*character count*/, 0x1efb,
+    /*1844*/ 1 /*character count*/, 0x1efd,
+    /*1846*/ 1 /*character count*/, 0x1eff,
+    /*1848*/ 1 /*character count*/, 0x1f00,
+    /*1850*/ 1 /*character count*/, 0x1f01,
+    /*1852*/ 1 /*character count*/, 0x1f02,
+    /*1854*/ 1 /*character count*/, 0x1f03,
+    /*1856*/ 1 /*character count*/, 0x1f04,
+    /*1858*/ 1 /*character count*/, 0x1f05,
+    /*1860*/ 1 /*character count*/, 0x1f06,
+    /*1862*/ 1 /*character count*/, 0x1f07,
+    /*1864*/ 1 /*character count*/, 0x1f10,
+    /*1866*/ 1 /*character count*/, 0x1f11,
+    /*1868*/ 1 /*character count*/, 0x1f12,
+    /*1870*/ 1 /*character count*/, 0x1f13,
+    /*1872*/ 1 /*character count*/, 0x1f14,
+    /*1874*/ 1 /*character count*/, 0x1f15,
+    /*1876*/ 1 /*character count*/, 0x1f20,
+    /*1878*/ 1 /*character count*/, 0x1f21,
+    /*1880*/ 1 /*character count*/, 0x1f22,
+    /*1882*/ 1 /*character count*/, 0x1f23,
+    /*1884*/ 1 /*character count*/, 0x1f24,
+    /*1886*/ 1 /*character count*/, 0x1f25,
+    /*1888*/ 1 /*character count*/, 0x1f26,
+    /*1890*/ 1 /*character count*/, 0x1f27,
+    /*1892*/ 1 /*character count*/, 0x1f30,
+    /*1894*/ 1 /*character count*/, 0x1f31,
+    /*1896*/ 1 /*character count*/, 0x1f32,
+    /*1898*/ 1 /*character count*/, 0x1f33,
+    /*1900*/ 1 /*character count*/, 0x1f34,
+    /*1902*/ 1 /*character count*/, 0x1f35,
+    /*1904*/ 1 /*character count*/, 0x1f36,
+    /*1906*/ 1 /*character count*/, 0x1f37,
+    /*1908*/ 1 /*character count*/, 0x1f40,
+    /*1910*/ 1 /*character count*/, 0x1f41,
+    /*1912*/ 1 /*character count*/, 0x1f42,
+    /*1914*/ 1 /*character count*/, 0x1f43,
+    /*1916*/ 1 /*character count*/, 0x1f44,
+    /*1918*/ 1 /*character count*/, 0x1f45,
+    /*1920*/ 1 /*character count*/, 0x1f51,
+    /*1922*/ 1 /*character count*/, 0x1f53,
+    /*1924*/ 1 /*character count*/, 0x1f55,
+    /*1926*/ 1 /*character count*/, 0x1f57,
+    /*1928*/ 1 /*character count*/, 0x1f60,
+    /*1930*/ 1 /*character count*/, 0x1f61,
+    /*1932*/ 1 /*character count*/, 0x1f62,
+    /*1934*/ 1 /*character count*/, 0x1f63,
+    /*1936*/ 1 /*character count*/, 0x1f64,
+    /*1938*/ 1 /*character count*/, 0x1f65,
+    /*1940*/ 1 /*character count*/, 0x1f66,
+    /*1942*/ 1 /*character count*/, 0x1f67,
+    /*1944*/ 1 /*character count*/, 0x1f80,
+    /*1946*/ 1 /*character count*/, 0x1f81,
+    /*1948*/ 1 /*character count*/, 0x1f82,
+    /*1950*/ 1 /*character count*/, 0x1f83,
+    /*1952*/ 1 /*character count*/, 0x1f84,
+    /*1954*/ 1 /*character count*/, 0x1f85,
+    /*1956*/ 1 /*character count*/, 0x1f86,
+    /*1958*/ 1 /*character count*/, 0x1f87,
+    /*1960*/ 1 /*character count*/, 0x1f90,
+    /*1962*/ 1 /*character count*/, 0x1f91,
+    /*1964*/ 1 /*character count*/, 0x1f92,
+    /*1966*/ 1 /*character count*/, 0x1f93,
+    /*1968*/ 1 /*character count*/, 0x1f94,
+    /*1970*/ 1 /*character count*/, 0x1f95,
+    /*1972*/ 1 /*character count*/, 0x1f96,
+    /*1974*/ 1 /*character count*/, 0x1f97,
+    /*1976*/ 1 /*character count*/, 0x1fa0,
+    /*1978*/ 1 /*character count*/, 0x1fa1,
+    /*1980*/ 1 /*character count*/, 0x1fa2,
+    /*1982*/ 1 /*character count*/, 0x1fa3,
+    /*1984*/ 1 /*character count*/, 0x1fa4,
+    /*1986*/ 1 /*character count*/, 0x1fa5,
+    /*1988*/ 1 /*character count*/, 0x1fa6,
+    /*1990*/ 1 /*character count*/, 0x1fa7,
+    /*1992*/ 1 /*character count*/, 0x1fb0,
+    /*1994*/ 1 /*character count*/, 0x1fb1,
+    /*1996*/ 1 /*character count*/, 0x1f70,
+    /*1998*/ 1 /*character count*/, 0x1f71,
+    /*2000*/ 1 /*character count*/, 0x1fb3,
+    /*2002*/ 1 /*character count*/, 0x1f72,
+    /*2004*/ 1 /*character count*/, 0x1f73,
+    /*2006*/ 1 /*character count*/, 0x1f74,
+    /*2008*/ 1 /*character count*/, 0x1f75,
+    /*2010*/ 1 /*character count*/, 0x1fc3,
+    /*2012*/ 1 /*character count*/, 0x1fd0,
+    /*2014*/ 1 /*character count*/, 0x1fd1,
+    /*2016*/ 1 /*character count*/, 0x1f76,
+    /*2018*/ 1 /*character count*/, 0x1f77,
+    /*2020*/ 1 /*character count*/, 0x1fe0,
+    /*2022*/ 1 /*character count*/, 0x1fe1,
+    /*2024*/ 1 /*character count*/, 0x1f7a,
+    /*2026*/ 1 /*character count*/, 0x1f7b,
+    /*2028*/ 1 /*character count*/, 0x1fe5,
+    /*2030*/ 1 /*character count*/, 0x1f78,
+    /*2032*/ 1 /*character count*/, 0x1f79,
+    /*2034*/ 1 /*character count*/, 0x1f7c,
+    /*2036*/ 1 /*character count*/, 0x1f7d,
+    /*2038*/ 1 /*character count*/, 0x1ff3,
+    /*2040*/ 1 /*character count*/, 0x214e,
+    /*2042*/ 1 /*character count*/, 0x2170,
+    /*2044*/ 1 /*character count*/, 0x2171,
+    /*2046*/ 1 /*character count*/, 0x2172,
+    /*2048*/ 1 /*character count*/, 0x2173,
+    /*2050*/ 1 /*character count*/, 0x2174,
+    /*2052*/ 1 /*character count*/, 0x2175,
+    /*2054*/ 1 /*character count*/, 0x2176,
+    /*2056*/ 1 /*character count*/, 0x2177,
+    /*2058*/ 1 /*character count*/, 0x2178,
+    /*2060*/ 1 /*character count*/, 0x2179,
+    /*2062*/ 1 /*character count*/, 0x217a,
+    /*2064*/ 1 /*character count*/, 0x217b,
+    /*2066*/ 1 /*character count*/, 0x217c,
+    /*2068*/ 1 /*character count*/, 0x217d,
+    /*2070*/ 1 /*character count*/, 0x217e,
+    /*2072*/ 1 /*character count*/, 0x217f,
+    /*2074*/ 1 /*character count*/, 0x2184,
+    /*2076*/ 1 /*character count*/, 0x24d0,
+    /*2078*/ 1 /*character count*/, 0x24d1,
+    /*2080*/ 1 /*character count*/, 0x24d2,
+    /*2082*/ 1 /*character count*/, 0x24d3,
+    /*2084*/ 1 /*character count*/, 0x24d4,
+    /*2086*/ 1 /*character count*/, 0x24d5,
+    /*2088*/ 1 /*character count*/, 0x24d6,
+    /*2090*/ 1 /*character count*/, 0x24d7,
+    /*2092*/ 1 /*character count*/, 0x24d8,
+    /*2094*/ 1 /*character count*/, 0x24d9,
+    /*2096*/ 1 /*character count*/, 0x24da,
+    /*2098*/ 1 /*character count*/, 0x24db,
+    /*2100*/ 1 /*character count*/, 0x24dc,
+    /*2102*/ 1 /*character count*/, 0x24dd,
+    /*2104*/ 1 /*character count*/, 0x24de,
+    /*2106*/ 1 /*character count*/, 0x24df,
+    /*2108*/ 1 /*character count*/, 0x24e0,
+    /*2110*/ 1 /*character count*/, 0x24e1,
+    /*2112*/ 1 /*character count*/, 0x24e2,
+    /*2114*/ 1 /*character count*/, 0x24e3,
+    /*2116*/ 1 /*character count*/, 0x24e4,
+    /*2118*/ 1 /*character count*/, 0x24e5,
+    /*2120*/ 1 /*character count*/, 0x24e6,
+    /*2122*/ 1 /*character count*/, 0x24e7,
+    /*2124*/ 1 /*character count*/, 0x24e8,
+    /*2126*/ 1 /*character count*/, 0x24e9,
+    /*2128*/ 1 /*character count*/, 0x2c30,
+    /*2130*/ 1 /*character count*/, 0x2c31,
+    /*2132*/ 1 /*character count*/, 0x2c32,
+    /*2134*/ 1 /*character count*/, 0x2c33,
+    /*2136*/ 1 /*character count*/, 0x2c34,
+    /*2138*/ 1 /*character count*/, 0x2c35,
+    /*2140*/ 1 /*character count*/, 0x2c36,
+    /*2142*/ 1 /*character count*/, 0x2c37,
+    /*2144*/ 1 /*character count*/, 0x2c38,
+    /*2146*/ 1 /*character count*/, 0x2c39,
+    /*2148*/ 1 /*character count*/, 0x2c3a,
+    /*2150*/ 1 /*character count*/, 0x2c3b,
+    /*2152*/ 1 /*character count*/, 0x2c3c,
+    /*2154*/ 1 /*character count*/, 0x2c3d,
+    /*2156*/ 1 /*character count*/, 0x2c3e,
+    /*2158*/ 1 /*character count*/, 0x2c3f,
+    /*2160*/ 1 /*character count*/, 0x2c40,
+    /*2162*/ 1 /*character count*/, 0x2c41,
+    /*2164*/ 1 /*character count*/, 0x2c42,
+    /*2166*/ 1 /*character count*/, 0x2c43,
+    /*2168*/ 1 /*character count*/, 0x2c44,
+    /*2170*/ 1 /*character count*/, 0x2c45,
+    /*2172*/ 1 /*character count*/, 0x2c46,
+    /*2174*/ 1 /*character count*/, 0x2c47,
+    /*2176*/ 1 /*character count*/, 0x2c48,
+    /*2178*/ 1 /*character count*/, 0x2c49,
+    /*2180*/ 1 /*character count*/, 0x2c4a,
+    /*2182*/ 1 /*character count*/, 0x2c4b,
+    /*2184*/ 1 /*character count*/, 0x2c4c,
+    /*2186*/ 1 /*character count*/, 0x2c4d,
+    /*2188*/ 1 /*character count*/, 0x2c4e,
+    /*2190*/ 1 /*character count*/, 0x2c4f,
+    /*2192*/ 1 /*character count*/, 0x2c50,
+    /*2194*/ 1 /*character count*/, 0x2c51,
+    /*2196*/ 1 /*character count*/, 0x2c52,
+    /*2198*/ 1 /*character count*/, 0x2c53,
+    /*2200*/ 1 /*character count*/, 0x2c54,
+    /*2202*/ 1 /*character count*/, 0x2c55,
+    /*2204*/ 1 /*character count*/, 0x2c56,
+    /*2206*/ 1 /*character count*/, 0x2c57,
+    /*2208*/ 1 /*character count*/, 0x2c58,
+    /*2210*/ 1 /*character count*/, 0x2c59,
+    /*2212*/ 1 /*character count*/, 0x2c5a,
+    /*2214*/ 1 /*character count*/, 0x2c5b,
+    /*2216*/ 1 /*character count*/, 0x2c5c,
+    /*2218*/ 1 /*character count*/, 0x2c5d,
+    /*2220*/ 1 /*character count*/, 0x2c5e,
+    /*2222*/ 1 /*character count*/, 0x2c61,
+    /*2224*/ 1 /*character count*/, 0x026b,
+    /*2226*/ 1 /*character count*/, 0x1d7d,
+    /*2228*/ 1 /*character count*/, 0x027d,
+    /*2230*/ 1 /*character count*/, 0x2c68,
+    /*2232*/ 1 /*character count*/, 0x2c6a,
+    /*2234*/ 1 /*character count*/, 0x2c6c,
+    /*2236*/ 1 /*character count*/, 0x0251,
+    /*2238*/ 1 /*character count*/, 0x0271,
+    /*2240*/ 1 /*character count*/, 0x0250,
+    /*2242*/ 1 /*character count*/, 0x0252,
+    /*2244*/ 1 /*character count*/, 0x2c73,
+    /*2246*/ 1 /*character count*/, 0x2c76,
+    /*2248*/ 1 /*character count*/, 0x023f,
+    /*2250*/ 1 /*character count*/, 0x0240,
+    /*2252*/ 1 /*character count*/, 0x2c81,
+    /*2254*/ 1 /*character count*/, 0x2c83,
+    /*2256*/ 1 /*character count*/, 0x2c85,
+    /*2258*/ 1 /*character count*/, 0x2c87,
+    /*2260*/ 1 /*character count*/, 0x2c89,
+    /*2262*/ 1 /*character count*/, 0x2c8b,
+    /*2264*/ 1 /*character count*/, 0x2c8d,
+    /*2266*/ 1 /*character count*/, 0x2c8f,
+    /*2268*/ 1 /*character count*/, 0x2c91,
+    /*2270*/ 1 /*character count*/, 0x2c93,
+    /*2272*/ 1 /*character count*/, 0x2c95,
+    /*2274*/ 1 /*character count*/, 0x2c97,
+    /*2276*/ 1 /*character count*/, 0x2c99,
+    /*2278*/ 1 /*character count*/, 0x2c9b,
+    /*2280*/ 1 /*character count*/, 0x2c9d,
+    /*2282*/ 1 /*character count*/, 0x2c9f,
+    /*2284*/ 1 /*character count*/, 0x2ca1,
+    /*2286*/ 1 /*character count*/, 0x2ca3,
+    /*2288*/ 1 /*character count*/, 0x2ca5,
+    /*2290*/ 1 /*character count*/, 0x2ca7,
+    /*2292*/ 1 /*character count*/, 0x2ca9,
+    /*2294*/ 1 /*character count*/, 0x2cab,
+    /*2296*/ 1 /*character count*/, 0x2cad,
+    /*2298*/ 1 /*character count*/, 0x2caf,
+    /*2300*/ 1 /*character count*/, 0x2cb1,
+    /*2302*/ 1 /*character count*/, 0x2cb3,
+    /*2304*/ 1 /*character count*/, 0x2cb5,
+    /*2306*/ 1 /*character count*/, 0x2cb7,
+    /*2308*/ 1 /*character count*/, 0x2cb9,
+    /*2310*/ 1 /*character count*/, 0x2cbb,
+    /*2312*/ 1 /*character count*/, 0x2cbd,
+    /*2314*/ 1 /*character count*/, 0x2cbf,
+    /*2316*/ 1 /*character count*/, 0x2cc1,
+    /*2318*/ 1 /*character count*/, 0x2cc3,
+    /*2320*/ 1 /*character count*/, 0x2cc5,
+    /*2322*/ 1 /*character count*/, 0x2cc7,
+    /*2324*/ 1 /*character count*/, 0x2cc9,
+    /*2326*/ 1 /*character count*/, 0x2ccb,
+    /*2328*/ 1 /*character count*/, 0x2ccd,
+    /*2330*/ 1 /*character count*/, 0x2ccf,
+    /*2332*/ 1 /*character count*/, 0x2cd1,
+    /*2334*/ 1 /*character count*/, 0x2cd3,
+    /*2336*/ 1 /*character count*/, 0x2cd5,
+    /*2338*/ 1 /*character count*/, 0x2cd7,
+    /*2340*/ 1 /*character count*/, 0x2cd9,
+    /*2342*/ 1 /*character count*/, 0x2cdb,
+    /*2344*/ 1 /*character count*/, 0x2cdd,
+    /*2346*/ 1 /*character count*/, 0x2cdf,
+    /*2348*/ 1 /*character count*/, 0x2ce1,
+    /*2350*/ 1 /*character count*/, 0x2ce3,
+    /*2352*/ 1 /*character count*/, 0x2cec,
+    /*2354*/ 1 /*character count*/, 0x2cee,
+    /*2356*/ 1 /*character count*/, 0x2cf3,
+    /*2358*/ 1 /*character count*/, 0x3042,
+    /*2360*/ 1 /*character count*/, 0x3044,
+    /*2362*/ 1 /*character count*/, 0x3046,
+    /*2364*/ 1 /*character count*/, 0x3048,
+    /*2366*/ 1 /*character count*/, 0x304a,
+    /*2368*/ 2 /*character count*/, 0x304b, 0x3099,
+    /*2371*/ 1 /*character count*/, 0x304b,
+    /*2373*/ 2 /*character count*/, 0x304d, 0x3099,
+    /*2376*/ 1 /*character count*/, 0x304d,
+    /*2378*/ 2 /*character count*/, 0x304f, 0x3099,
+    /*2381*/ 1 /*character count*/, 0x304f,
+    /*2383*/ 2 /*character count*/, 0x3051, 0x3099,
+    /*2386*/ 1 /*character count*/, 0x3051,
+    /*2388*/ 2 /*character count*/, 0x3053, 0x3099,
+    /*2391*/ 1 /*character count*/, 0x3053,
+    /*2393*/ 2 /*character count*/, 0x3055, 0x3099,
+    /*2396*/ 1 /*character count*/, 0x3055,
+    /*2398*/ 2 /*character count*/, 0x3057, 0x3099,
+    /*2401*/ 1 /*character count*/, 0x3057,
+    /*2403*/ 2 /*character count*/, 0x3059, 0x3099,
+    /*2406*/ 1 /*character count*/, 0x3059,
+    /*2408*/ 2 /*character count*/, 0x305b, 0x3099,
+    /*2411*/ 1 /*character count*/, 0x305b,
+    /*2413*/ 2 /*character count*/, 0x305d, 0x3099,
+    /*2416*/ 1 /*character count*/, 0x305d,
+    /*2418*/ 2 /*character count*/, 0x305f, 0x3099,
+    /*2421*/ 1 /*character count*/, 0x305f,
+    /*2423*/ 2 /*character count*/, 0x3061, 0x3099,
+    /*2426*/ 1 /*character count*/, 0x3061,
+    /*2428*/ 1 /*character count*/, 0x3064,
+    /*2430*/ 2 /*character count*/, 0x3064, 0x3099,
+    /*2433*/ 2 /*character count*/, 0x3066, 0x3099,
+    /*2436*/ 1 /*character count*/, 0x3066,
+    /*2438*/ 2 /*character count*/, 0x3068, 0x3099,
+    /*2441*/ 1 /*character count*/, 0x3068,
+    /*2443*/ 2 /*character count*/, 0x306f, 0x3099,
+    /*2446*/ 1 /*character count*/, 0x306f,
+    /*2448*/ 2 /*character count*/, 0x306f, 0x309a,
+    /*2451*/ 2 /*character count*/, 0x3072, 0x3099,
+    /*2454*/ 1 /*character count*/, 0x3072,
+    /*2456*/ 2 /*character count*/, 0x3072, 0x309a,
+    /*2459*/ 2 /*character count*/, 0x3075, 0x3099,
+    /*2462*/ 1 /*character count*/, 0x3075,
+    /*2464*/ 2 /*character count*/, 0x3075, 0x309a,
+    /*2467*/ 2 /*character count*/, 0x3078, 0x3099,
+    /*2470*/ 1 /*character count*/, 0x3078,
+    /*2472*/ 2 /*character count*/, 0x3078, 0x309a,
+    /*2475*/ 2 /*character count*/, 0x307b, 0x3099,
+    /*2478*/ 1 /*character count*/, 0x307b,
+    /*2480*/ 2 /*character count*/, 0x307b, 0x309a,
+    /*2483*/ 1 /*character count*/, 0x3084,
+    /*2485*/ 1 /*character count*/, 0x3086,
+    /*2487*/ 1 /*character count*/, 0x3088,
+    /*2489*/ 1 /*character count*/, 0x308f,
+    /*2491*/ 2 /*character count*/, 0x3046, 0x3099,
+    /*2494*/ 2 /*character count*/, 0x0020, 0x3099,
+    /*2497*/ 1 /*character count*/, 0x3099,
+    /*2499*/ 2 /*character count*/, 0x0020, 0x309a,
+    /*2502*/ 1 /*character count*/, 0x309a,
+    /*2504*/ 2 /*character count*/, 0x309d, 0x3099,
+    /*2507*/ 1 /*character count*/, 0x309d,
+    /*2509*/ 2 /*character count*/, 0x3088, 0x308a,
+    /*2512*/ 1 /*character count*/, 0x306a,
+    /*2514*/ 1 /*character count*/, 0x306b,
+    /*2516*/ 1 /*character count*/, 0x306c,
+    /*2518*/ 1 /*character count*/, 0x306d,
+    /*2520*/ 1 /*character count*/, 0x306e,
+    /*2522*/ 1 /*character count*/, 0x307e,
+    /*2524*/ 1 /*character count*/, 0x307f,
+    /*2526*/ 1 /*character count*/, 0x3080,
+    /*2528*/ 1 /*character count*/, 0x3081,
+    /*2530*/ 1 /*character count*/, 0x3082,
+    /*2532*/ 1 /*character count*/, 0x3089,
+    /*2534*/ 1 /*character count*/, 0x308a,
+    /*2536*/ 1 /*character count*/, 0x308b,
+    /*2538*/ 1 /*character count*/, 0x308c,
+    /*2540*/ 1 /*character count*/, 0x308d,
+    /*2542*/ 1 /*character count*/, 0x3090,
+    /*2544*/ 1 /*character count*/, 0x3091,
+    /*2546*/ 1 /*character count*/, 0x3092,
+    /*2548*/ 1 /*character count*/, 0x3093,
+    /*2550*/ 2 /*character count*/, 0x30ef, 0x3099,
+    /*2553*/ 1 /*character count*/, 0x30ef,
+    /*2555*/ 2 /*character count*/, 0x308f, 0x3099,
+    /*2558*/ 2 /*character count*/, 0x30f0, 0x3099,
+    /*2561*/ 1 /*character count*/, 0x30f0,
+    /*2563*/ 2 /*character count*/, 0x3090, 0x3099,
+    /*2566*/ 2 /*character count*/, 0x30f1, 0x3099,
+    /*2569*/ 1 /*character count*/, 0x30f1,
+    /*2571*/ 2 /*character count*/, 0x3091, 0x3099,
+    /*2574*/ 2 /*character count*/, 0x30f2, 0x3099,
+    /*2577*/ 1 /*character count*/, 0x30f2,
+    /*2579*/ 2 /*character count*/, 0x3092, 0x3099,
+    /*2582*/ 2 /*character count*/, 0x30b3, 0x30c8,
+    /*2585*/ 2 /*character count*/, 0x3053, 0x3068,
+    /*2588*/ 1 /*character count*/, 0xa641,
+    /*2590*/ 1 /*character count*/, 0xa643,
+    /*2592*/ 1 /*character count*/, 0xa645,
+    /*2594*/ 1 /*character count*/, 0xa647,
+    /*2596*/ 1 /*character count*/, 0xa649,
+    /*2598*/ 1 /*character count*/, 0xa64b,
+    /*2600*/ 1 /*character count*/, 0xa64d,
+    /*2602*/ 1 /*character count*/, 0xa64f,
+    /*2604*/ 1 /*character count*/, 0xa651,
+    /*2606*/ 1 /*character count*/, 0xa653,
+    /*2608*/ 1 /*character count*/, 0xa655,
+    /*2610*/ 1 /*character count*/, 0xa657,
+    /*2612*/ 1 /*character count*/, 0xa659,
+    /*2614*/ 1 /*character count*/, 0xa65b,
+    /*2616*/ 1 /*character count*/, 0xa65d,
+    /*2618*/ 1 /*character count*/, 0xa65f,
+    /*2620*/ 1 /*character count*/, 0xa661,
+    /*2622*/ 1 /*character count*/, 0xa663,
+    /*2624*/ 1 /*character count*/, 0xa665,
+    /*2626*/ 1 /*character count*/, 0xa667,
+    /*2628*/ 1 /*character count*/, 0xa669,
+    /*2630*/ 1 /*character count*/, 0xa66b,
+    /*2632*/ 1 /*character count*/, 0xa66d,
+    /*2634*/ 1 /*character count*/, 0xa681,
+    /*2636*/ 1 /*character count*/, 0xa683,
+    /*2638*/ 1 /*character count*/, 0xa685,
+    /*2640*/ 1 /*character count*/, 0xa687,
+    /*2642*/ 1 /*character count*/, 0xa689,
+    /*2644*/ 1 /*character count*/, 0xa68b,
+    /*2646*/ 1 /*character count*/, 0xa68d,
+    /*2648*/ 1 /*character count*/, 0xa68f,
+    /*2650*/ 1 /*character count*/, 0xa691,
+    /*2652*/ 1 /*character count*/, 0xa693,
+    /*2654*/ 1 /*character count*/, 0xa695,
+    /*2656*/ 1 /*character count*/, 0xa697,
+    /*2658*/ 1 /*character count*/, 0xa723,
+    /*2660*/ 1 /*character count*/, 0xa725,
+    /*2662*/ 1 /*character count*/, 0xa727,
+    /*2664*/ 1 /*character count*/, 0xa729,
+    /*2666*/ 1 /*character count*/, 0xa72b,
+    /*2668*/ 1 /*character count*/, 0xa72d,
+    /*2670*/ 1 /*character count*/, 0xa72f,
+    /*2672*/ 1 /*character count*/, 0xa733,
+    /*2674*/ 1 /*character count*/, 0xa735,
+    /*2676*/ 1 /*character count*/, 0xa737,
+    /*2678*/ 1 /*character count*/, 0xa739,
+    /*2680*/ 1 /*character count*/, 0xa73b,
+    /*2682*/ 1 /*character count*/, 0xa73d,
+    /*2684*/ 1 /*character count*/, 0xa73f,
+    /*2686*/ 1 /*character count*/, 0xa741,
+    /*2688*/ 1 /*character count*/, 0xa743,
+    /*2690*/ 1 /*character count*/, 0xa745,
+    /*2692*/ 1 /*character count*/, 0xa747,
+    /*2694*/ 1 /*character count*/, 0xa749,
+    /*2696*/ 1 /*character count*/, 0xa74b,
+    /*2698*/ 1 /*character count*/, 0xa74d,
+    /*2700*/ 1 /*character count*/, 0xa74f,
+    /*2702*/ 1 /*character count*/, 0xa751,
+    /*2704*/ 1 /*character count*/, 0xa753,
+    /*2706*/ 1 /*character count*/, 0xa755,
+    /*2708*/ 1 /*character count*/, 0xa757,
+    /*2710*/ 1 /*character count*/, 0xa759,
+    /*2712*/ 1 /*character count*/, 0xa75b,
+    /*2714*/ 1 /*character count*/, 0xa75d,
+    /*2716*/ 1 /*character count*/, 0xa75f,
+    /*2718*/ 1 /*character count*/, 0xa761,
+    /*2720*/ 1 /*character count*/, 0xa763,
+    /*2722*/ 1 /*character count*/, 0xa765,
+    /*2724*/ 1 /*character count*/, 0xa767,
+    /*2726*/ 1 /*character count*/, 0xa769,
+    /*2728*/ 1 /*character count*/, 0xa76b,
+    /*2730*/ 1 /*character count*/, 0xa76d,
+    /*2732*/ 1 /*character count*/, 0xa76f,
+    /*2734*/ 1 /*character count*/, 0xa77a,
+    /*2736*/ 1 /*character count*/, 0xa77c,
+    /*2738*/ 1 /*character count*/, 0x1d79,
+    /*2740*/ 1 /*character count*/, 0xa77f,
+    /*2742*/ 1 /*character count*/, 0xa781,
+    /*2744*/ 1 /*character count*/, 0xa783,
+    /*2746*/ 1 /*character count*/, 0xa785,
+    /*2748*/ 1 /*character count*/, 0xa787,
+    /*2750*/ 1 /*character count*/, 0xa78c,
+    /*2752*/ 1 /*character count*/, 0x0265,
+    /*2754*/ 1 /*character count*/, 0xa791,
+    /*2756*/ 1 /*character count*/, 0xa793,
+    /*2758*/ 1 /*character count*/, 0xa7a1,
+    /*2760*/ 1 /*character count*/, 0xa7a3,
+    /*2762*/ 1 /*character count*/, 0xa7a5,
+    /*2764*/ 1 /*character count*/, 0xa7a7,
+    /*2766*/ 1 /*character count*/, 0xa7a9,
+    /*2768*/ 1 /*character count*/, 0x0266,
+    /*2770*/ 1 /*character count*/, 0x0021,
+    /*2772*/ 1 /*character count*/, 0x0022,
+    /*2774*/ 1 /*character count*/, 0x0023,
+    /*2776*/ 1 /*character count*/, 0x0024,
+    /*2778*/ 1 /*character count*/, 0x0025,
+    /*2780*/ 1 /*character count*/, 0x0026,
+    /*2782*/ 1 /*character count*/, 0x0027,
+    /*2784*/ 1 /*character count*/, 0x0028,
+    /*2786*/ 1 /*character count*/, 0x0029,
+    /*2788*/ 1 /*character count*/, 0x002a,
+    /*2790*/ 1 /*character count*/, 0x002b,
+    /*2792*/ 1 /*character count*/, 0x002c,
+    /*2794*/ 1 /*character count*/, 0x002d,
+    /*2796*/ 1 /*character count*/, 0x002e,
+    /*2798*/ 1 /*character count*/, 0x002f,
+    /*2800*/ 1 /*character count*/, 0x0030,
+    /*2802*/ 1 /*character count*/, 0x0034,
+    /*2804*/ 1 /*character count*/, 0x0035,
+    /*2806*/ 1 /*character count*/, 0x0036,
+    /*2808*/ 1 /*character count*/, 0x0037,
+    /*2810*/ 1 /*character count*/, 0x0038,
+    /*2812*/ 1 /*character count*/, 0x0039,
+    /*2814*/ 1 /*character count*/, 0x003a,
+    /*2816*/ 1 /*character count*/, 0x003b,
+    /*2818*/ 1 /*character count*/, 0x003c,
+    /*2820*/ 1 /*character count*/, 0x003d,
+    /*2822*/ 1 /*character count*/, 0x003e,
+    /*2824*/ 1 /*character count*/, 0x003f,
+    /*2826*/ 1 /*character count*/, 0x0040,
+    /*2828*/ 1 /*character count*/, 0x0041,
+    /*2830*/ 1 /*character count*/, 0x0042,
+    /*2832*/ 1 /*character count*/, 0x0043,
+    /*2834*/ 1 /*character count*/, 0x0044,
+    /*2836*/ 1 /*character count*/, 0x0045,
+    /*2838*/ 1 /*character count*/, 0x0046,
+    /*2840*/ 1 /*character count*/, 0x0047,
+    /*2842*/ 1 /*character count*/, 0x0048,
+    /*2844*/ 1 /*character count*/, 0x0049,
+    /*2846*/ 1 /*character count*/, 0x004a,
+    /*2848*/ 1 /*character count*/, 0x004b,
+    /*2850*/ 1 /*character count*/, 0x004c,
+    /*2852*/ 1 /*character count*/, 0x004d,
+    /*2854*/ 1 /*character count*/, 0x004e,
+    /*2856*/ 1 /*character count*/, 0x004f,
+    /*2858*/ 1 /*character count*/, 0x0050,
+    /*2860*/ 1 /*character count*/, 0x0051,
+    /*2862*/ 1 /*character count*/, 0x0052,
+    /*2864*/ 1 /*character count*/, 0x0053,
+    /*2866*/ 1 /*character count*/, 0x0054,
+    /*2868*/ 1 /*character count*/, 0x0055,
+    /*2870*/ 1 /*character count*/, 0x0056,
+    /*2872*/ 1 /*character count*/, 0x0057,
+    /*2874*/ 1 /*character count*/, 0x0058,
+    /*2876*/ 1 /*character count*/, 0x0059,
+    /*2878*/ 1 /*character count*/, 0x005a,
+    /*2880*/ 1 /*character count*/, 0x005b,
+    /*2882*/ 1 /*character count*/, 0x005c,
+    /*2884*/ 1 /*character count*/, 0x005d,
+    /*2886*/ 1 /*character count*/, 0x005e,
+    /*2888*/ 1 /*character count*/, 0x005f,
+    /*2890*/ 1 /*character count*/, 0x0060,
+    /*2892*/ 1 /*character count*/, 0x007b,
+    /*2894*/ 1 /*character count*/, 0x007c,
+    /*2896*/ 1 /*character count*/, 0x007d,
+    /*2898*/ 1 /*character count*/, 0x007e,
+    /*2900*/ 1 /*character count*/, 0x30fb,
+    /*2902*/ 1 /*character count*/, 0x30fc,
+    /*2904*/ 1 /*character count*/, 0x10428,
+    /*2906*/ 1 /*character count*/, 0x10429,
+    /*2908*/ 1 /*character count*/, 0x1042a,
+    /*2910*/ 1 /*character count*/, 0x1042b,
+    /*2912*/ 1 /*character count*/, 0x1042c,
+    /*2914*/ 1 /*character count*/, 0x1042d,
+    /*2916*/ 1 /*character count*/, 0x1042e,
+    /*2918*/ 1 /*character count*/, 0x1042f,
+    /*2920*/ 1 /*character count*/, 0x10430,
+    /*2922*/ 1 /*character count*/, 0x10431,
+    /*2924*/ 1 /*character count*/, 0x10432,
+    /*2926*/ 1 /*character count*/, 0x10433,
+    /*2928*/ 1 /*character count*/, 0x10434,
+    /*2930*/ 1 /*character count*/, 0x10435,
+    /*2932*/ 1 /*character count*/, 0x10436,
+    /*2934*/ 1 /*character count*/, 0x10437,
+    /*2936*/ 1 /*character count*/, 0x10438,
+    /*2938*/ 1 /*character count*/, 0x10439,
+    /*2940*/ 1 /*character count*/, 0x1043a,
+    /*2942*/ 1 /*character count*/, 0x1043b,
+    /*2944*/ 1 /*character count*/, 0x1043c,
+    /*2946*/ 1 /*character count*/, 0x1043d,
+    /*2948*/ 1 /*character count*/, 0x1043e,
+    /*2950*/ 1 /*character count*/, 0x1043f,
+    /*2952*/ 1 /*character count*/, 0x10440,
+    /*2954*/ 1 /*character count*/, 0x10441,
+    /*2956*/ 1 /*character count*/, 0x10442,
+    /*2958*/ 1 /*character count*/, 0x10443,
+    /*2960*/ 1 /*character count*/, 0x10444,
+    /*2962*/ 1 /*character count*/, 0x10445,
+    /*2964*/ 1 /*character count*/, 0x10446,
+    /*2966*/ 1 /*character count*/, 0x10447,
+    /*2968*/ 1 /*character count*/, 0x10448,
+    /*2970*/ 1 /*character count*/, 0x10449,
+    /*2972*/ 1 /*character count*/, 0x1044a,
+    /*2974*/ 1 /*character count*/, 0x1044b,
+    /*2976*/ 1 /*character count*/, 0x1044c,
+    /*2978*/ 1 /*character count*/, 0x1044d,
+    /*2980*/ 1 /*character count*/, 0x1044e,
+    /*2982*/ 1 /*character count*/, 0x1044f,
+};
+
+const UnicharNormalizationEntry UnicharNormalizationEntries[] =
+{
+    { { 0, 0, 0, 0, 0 } }, /*unchanged*/
+    { { 0, 1, 1, 1, 1 } }, /*1: U+0000*/
+    { { 0, 2, 2, 2, 2 } }, /*2: U+0041*/
+    { { 0, 4, 4, 4, 4 } }, /*3: U+0042*/
+    { { 0, 6, 6, 6, 6 } }, /*4: U+0043*/
+    { { 0, 8, 8, 8, 8 } }, /*5: U+0044*/
+    { { 0, 10, 10, 10, 10 } }, /*6: U+0045*/
+    { { 0, 12, 12, 12, 12 } }, /*7: U+0046*/
+    { { 0, 14, 14, 14, 14 } }, /*8: U+0047*/
+    { { 0, 16, 16, 16, 16 } }, /*9: U+0048*/
+    { { 0, 18, 18, 18, 18 } }, /*10: U+0049*/
+    { { 0, 20, 20, 20, 20 } }, /*11: U+004A*/
+    { { 0, 22, 22, 22, 22 } }, /*12: U+004B*/
+    { { 0, 24, 24, 24, 24 } }, /*13: U+004C*/
+    { { 0, 26, 26, 26, 26 } }, /*14: U+004D*/
+    { { 0, 28, 28, 28, 28 } }, /*15: U+004E*/
+    { { 0, 30, 30, 30, 30 } }, /*16: U+004F*/
+    { { 0, 32, 32, 32, 32 } }, /*17: U+0050*/
+    { { 0, 34, 34, 34, 34 } }, /*18: U+0051*/
+    { { 0, 36, 36, 36, 36 } }, /*19: U+0052*/
+    { { 0, 38, 38, 38, 38 } }, /*20: U+0053*/
+    { { 0, 40, 40, 40, 40 } }, /*21: U+0054*/
+    { { 0, 42, 42, 42, 42 } }, /*22: U+0055*/
+    { { 0, 44, 44, 44, 44 } }, /*23: U+0056*/
+    { { 0, 46, 46, 46, 46 } }, /*24: U+0057*/
+    { { 0, 48, 48, 48, 48 } }, /*25: U+0058*/
+    { { 0, 50, 50, 50, 50 } }, /*26: U+0059*/
+    { { 0, 52, 52, 52, 52 } }, /*27: U+005A*/
+    { { 54, 54, 54, 54, 54 } }, /*28: U+00A0*/
+    { { 56, 56, 54, 56, 54 } }, /*29: U+00A8*/
+    { { 2, 2, 2, 2, 2 } }, /*30: U+00AA*/
+    { { 59, 59, 54, 59, 54 } }, /*31: U+00AF*/
+    { { 62, 62, 62, 62, 62 } }, /*32: U+00B2*/
+    { { 64, 64, 64, 64, 64 } }, /*33: U+00B3*/
+    { { 66, 66, 54, 66, 54 } }, /*34: U+00B4*/
+    { { 69, 69, 69, 69, 69 } }, /*35: U+00B5*/
+    { { 71, 71, 54, 71, 54 } }, /*36: U+00B8*/
+    { { 74, 74, 74, 74, 74 } }, /*37: U+00B9*/
+    { { 30, 30, 30, 30, 30 } }, /*38: U+00BA*/
+    { { 76, 76, 76, 76, 76 } }, /*39: U+00BC*/
+    { { 80, 80, 80, 80, 80 } }, /*40: U+00BD*/
+    { { 84, 84, 84, 84, 84 } }, /*41: U+00BE*/
+    { { 88, 91, 2, 91, 2 } }, /*42: U+00C0*/
+    { { 94, 97, 2, 97, 2 } }, /*43: U+00C1*/
+    { { 100, 103, 2, 103, 2 } }, /*44: U+00C2*/
+    { { 106, 109, 2, 109, 2 } }, /*45: U+00C3*/
+    { { 112, 115, 2, 115, 2 } }, /*46: U+00C4*/
+    { { 118, 121, 2, 121, 2 } }, /*47: U+00C5*/
+    { { 0, 124, 124, 124, 124 } }, /*48: U+00C6*/
+    { { 126, 129, 6, 129, 6 } }, /*49: U+00C7*/
+    { { 132, 135, 10, 135, 10 } }, /*50: U+00C8*/
+    { { 138, 141, 10, 141, 10 } }, /*51: U+00C9*/
+    { { 144, 147, 10, 147, 10 } }, /*52: U+00CA*/
+    { { 150, 153, 10, 153, 10 } }, /*53: U+00CB*/
+    { { 156, 159, 18, 159, 18 } }, /*54: U+00CC*/
+    { { 162, 165, 18, 165, 18 } }, /*55: U+00CD*/
+    { { 168, 171, 18, 171, 18 } }, /*56: U+00CE*/
+    { { 174, 177, 18, 177, 18 } }, /*57: U+00CF*/
+    { { 0, 180, 180, 180, 180 } }, /*58: U+00D0*/
+    { { 182, 185, 28, 185, 28 } }, /*59: U+00D1*/
+    { { 188, 191, 30, 191, 30 } }, /*60: U+00D2*/
+    { { 194, 197, 30, 197, 30 } }, /*61: U+00D3*/
+    { { 200, 203, 30, 203, 30 } }, /*62: U+00D4*/
+    { { 206, 209, 30, 209, 30 } }, /*63: U+00D5*/
+    { { 212, 215, 30, 215, 30 } }, /*64: U+00D6*/
+    { { 0, 218, 218, 218, 218 } }, /*65: U+00D8*/
+    { { 220, 223, 42, 223, 42 } }, /*66: U+00D9*/
+    { { 226, 229, 42, 229, 42 } }, /*67: U+00DA*/
+    { { 232, 235, 42, 235, 42 } }, /*68: U+00DB*/
+    { { 238, 241, 42, 241, 42 } }, /*69: U+00DC*/
+    { { 244, 247, 50, 247, 50 } }, /*70: U+00DD*/
+    { { 0, 250, 250, 250, 250 } }, /*71: U+00DE*/
+    { { 91, 91, 2, 91, 2 } }, /*72: U+00E0*/
+    { { 97, 97, 2, 97, 2 } }, /*73: U+00E1*/
+    { { 103, 103, 2, 103, 2 } }, /*74: U+00E2*/
+    { { 109, 109, 2, 109, 2 } }, /*75: U+00E3*/
+    { { 115, 115, 2, 115, 2 } }, /*76: U+00E4*/
+    { { 121, 121, 2, 121, 2 } }, /*77: U+00E5*/
+    { { 129, 129, 6, 129, 6 } }, /*78: U+00E7*/
+    { { 135, 135, 10, 135, 10 } }, /*79: U+00E8*/
+    { { 141, 141, 10, 141, 10 } }, /*80: U+00E9*/
+    { { 147, 147, 10, 147, 10 } }, /*81: U+00EA*/
+    { { 153, 153, 10, 153, 10 } }, /*82: U+00EB*/
+    { { 159, 159, 18, 159, 18 } }, /*83: U+00EC*/
+    { { 165, 165, 18, 165, 18 } }, /*84: U+00ED*/
+    { { 171, 171, 18, 171, 18 } }, /*85: U+00EE*/
+    { { 177, 177, 18, 177, 18 } }, /*86: U+00EF*/
+    { { 185, 185, 28, 185, 28 } }, /*87: U+00F1*/
+    { { 191, 191, 30, 191, 30 } }, /*88: U+00F2*/
+    { { 197, 197, 30, 197, 30 } }, /*89: U+00F3*/
+    { { 203, 203, 30, 203, 30 } }, /*90: U+00F4*/
+    { { 209, 209, 30, 209, 30 } }, /*91: U+00F5*/
+    { { 215, 215, 30, 215, 30 } }, /*92: U+00F6*/
+    { { 223, 223, 42, 223, 42 } }, /*93: U+00F9*/
+    { { 229, 229, 42, 229, 42 } }, /*94: U+00FA*/
+    { { 235, 235, 42, 235, 42 } }, /*95: U+00FB*/
+    { { 241, 241, 42, 241, 42 } }, /*96: U+00FC*/
+    { { 247, 247, 50, 247, 50 } }, /*97: U+00FD*/
+    { { 252, 252, 50, 252, 50 } }, /*98: U+00FF*/
+    { { 255, 258, 2, 258, 2 } }, /*99: U+0100*/
+    { { 258, 258, 2, 258, 2 } }, /*100: U+0101*/
+    { { 261, 264, 2, 264, 2 } }, /*101: U+0102*/
+    { { 264, 264, 2, 264, 2 } }, /*102: U+0103*/
+    { { 267, 270, 2, 270, 2 } }, /*103: U+0104*/
+    { { 270, 270, 2, 270, 2 } }, /*104: U+0105*/
+    { { 273, 276, 6, 276, 6 } }, /*105: U+0106*/
+    { { 276, 276, 6, 276, 6 } }, /*106: U+0107*/
+    { { 279, 282, 6, 282, 6 } }, /*107: U+0108*/
+    { { 282, 282, 6, 282, 6 } }, /*108: U+0109*/
+    { { 285, 288, 6, 288, 6 } }, /*109: U+010A*/
+    { { 288, 288, 6, 288, 6 } }, /*110: U+010B*/
+    { { 291, 294, 6, 294, 6 } }, /*111: U+010C*/
+    { { 294, 294, 6, 294, 6 } }, /*112: U+010D*/
+    { { 297, 300, 8, 300, 8 } }, /*113: U+010E*/
+    { { 300, 300, 8, 300, 8 } }, /*114: U+010F*/
+    { { 0, 303, 303, 303, 303 } }, /*115: U+0110*/
+    { { 305, 308, 10, 308, 10 } }, /*116: U+0112*/
+    { { 308, 308, 10, 308, 10 } }, /*117: U+0113*/
+    { { 311, 314, 10, 314, 10 } }, /*118: U+0114*/
+    { { 314, 314, 10, 314, 10 } }, /*119: U+0115*/
+    { { 317, 320, 10, 320, 10 } }, /*120: U+0116*/
+    { { 320, 320, 10, 320, 10 } }, /*121: U+0117*/
+    { { 323, 326, 10, 326, 10 } }, /*122: U+0118*/
+    { { 326, 326, 10, 326, 10 } }, /*123: U+0119*/
+    { { 329, 332, 10, 332, 10 } }, /*124: U+011A*/
+    { { 332, 332, 10, 332, 10 } }, /*125: U+011B*/
+    { { 335, 338, 14, 338, 14 } }, /*126: U+011C*/
+    { { 338, 338, 14, 338, 14 } }, /*127: U+011D*/
+    { { 341, 344, 14, 344, 14 } }, /*128: U+011E*/
+    { { 344, 344, 14, 344, 14 } }, /*129: U+011F*/
+    { { 347, 350, 14, 350, 14 } }, /*130: U+0120*/
+    { { 350, 350, 14, 350, 14 } }, /*131: U+0121*/
+    { { 353, 356, 14, 356, 14 } }, /*132: U+0122*/
+    { { 356, 356, 14, 356, 14 } }, /*133: U+0123*/
+    { { 359, 362, 16, 362, 16 } }, /*134: U+0124*/
+    { { 362, 362, 16, 362, 16 } }, /*135: U+0125*/
+    { { 0, 365, 365, 365, 365 } }, /*136: U+0126*/
+    { { 367, 370, 18, 370, 18 } }, /*137: U+0128*/
+    { { 370, 370, 18, 370, 18 } }, /*138: U+0129*/
+    { { 373, 376, 18, 376, 18 } }, /*139: U+012A*/
+    { { 376, 376, 18, 376, 18 } }, /*140: U+012B*/
+    { { 379, 382, 18, 382, 18 } }, /*141: U+012C*/
+    { { 382, 382, 18, 382, 18 } }, /*142: U+012D*/
+    { { 385, 388, 18, 388, 18 } }, /*143: U+012E*/
+    { { 388, 388, 18, 388, 18 } }, /*144: U+012F*/
+    { { 391, 391, 18, 391, 18 } }, /*145: U+0130*/
+    { { 394, 397, 397, 397, 397 } }, /*146: U+0132*/
+    { { 397, 397, 397, 397, 397 } }, /*147: U+0133*/
+    { { 400, 403, 20, 403, 20 } }, /*148: U+0134*/
+    { { 403, 403, 20, 403, 20 } }, /*149: U+0135*/
+    { { 406, 409, 22, 409, 22 } }, /*150: U+0136*/
+    { { 409, 409, 22, 409, 22 } }, /*151: U+0137*/
+    { { 412, 415, 24, 415, 24 } }, /*152: U+0139*/
+    { { 415, 415, 24, 415, 24 } }, /*153: U+013A*/
+    { { 418, 421, 24, 421, 24 } }, /*154: U+013B*/
+    { { 421, 421, 24, 421, 24 } }, /*155: U+013C*/
+    { { 424, 427, 24, 427, 24 } }, /*156: U+013D*/
+    { { 427, 427, 24, 427, 24 } }, /*157: U+013E*/
+    { { 430, 433, 433, 433, 433 } }, /*158: U+013F*/
+    { { 433, 433, 433, 433, 433 } }, /*159: U+0140*/
+    { { 0, 436, 436, 436, 436 } }, /*160: U+0141*/
+    { { 438, 441, 28, 441, 28 } }, /*161: U+0143*/
+    { { 441, 441, 28, 441, 28 } }, /*162: U+0144*/
+    { { 444, 447, 28, 447, 28 } }, /*163: U+0145*/
+    { { 447, 447, 28, 447, 28 } }, /*164: U+0146*/
+    { { 450, 453, 28, 453, 28 } }, /*165: U+0147*/
+    { { 453, 453, 28, 453, 28 } }, /*166: U+0148*/
+    { { 456, 456, 456, 456, 456 } }, /*167: U+0149*/
+    { { 0, 459, 459, 459, 459 } }, /*168: U+014A*/
+    { { 461, 464, 30, 464, 30 } }, /*169: U+014C*/
+    { { 464, 464, 30, 464, 30 } }, /*170: U+014D*/
+    { { 467, 470, 30, 470, 30 } }, /*171: U+014E*/
+    { { 470, 470, 30, 470, 30 } }, /*172: U+014F*/
+    { { 473, 476, 30, 476, 30 } }, /*173: U+0150*/
+    { { 476, 476, 30, 476, 30 } }, /*174: U+0151*/
+    { { 0, 479, 479, 479, 479 } }, /*175: U+0152*/
+    { { 481, 484, 36, 484, 36 } }, /*176: U+0154*/
+    { { 484, 484, 36, 484, 36 } }, /*177: U+0155*/
+    { { 487, 490, 36, 490, 36 } }, /*178: U+0156*/
+    { { 490, 490, 36, 490, 36 } }, /*179: U+0157*/
+    { { 493, 496, 36, 496, 36 } }, /*180: U+0158*/
+    { { 496, 496, 36, 496, 36 } }, /*181: U+0159*/
+    { { 499, 502, 38, 502, 38 } }, /*182: U+015A*/
+    { { 502, 502, 38, 502, 38 } }, /*183: U+015B*/
+    { { 505, 508, 38, 508, 38 } }, /*184: U+015C*/
+    { { 508, 508, 38, 508, 38 } }, /*185: U+015D*/
+    { { 511, 514, 38, 514, 38 } }, /*186: U+015E*/
+    { { 514, 514, 38, 514, 38 } }, /*187: U+015F*/
+    { { 517, 520, 38, 520, 38 } }, /*188: U+0160*/
+    { { 520, 520, 38, 520, 38 } }, /*189: U+0161*/
+    { { 523, 526, 40, 526, 40 } }, /*190: U+0162*/
+    { { 526, 526, 40, 526, 40 } }, /*191: U+0163*/
+    { { 529, 532, 40, 532, 40 } }, /*192: U+0164*/
+    { { 532, 532, 40, 532, 40 } }, /*193: U+0165*/
+    { { 0, 535, 535, 535, 535 } }, /*194: U+0166*/
+    { { 537, 540, 42, 540, 42 } }, /*195: U+0168*/
+    { { 540, 540, 42, 540, 42 } }, /*196: U+0169*/
+    { { 543, 546, 42, 546, 42 } }, /*197: U+016A*/
+    { { 546, 546, 42, 546, 42 } }, /*198: U+016B*/
+    { { 549, 552, 42, 552, 42 } }, /*199: U+016C*/
+    { { 552, 552, 42, 552, 42 } }, /*200: U+016D*/
+    { { 555, 558, 42, 558, 42 } }, /*201: U+016E*/
+    { { 558, 558, 42, 558, 42 } }, /*202: U+016F*/
+    { { 561, 564, 42, 564, 42 } }, /*203: U+0170*/
+    { { 564, 564, 42, 564, 42 } }, /*204: U+0171*/
+    { { 567, 570, 42, 570, 42 } }, /*205: U+0172*/
+    { { 570, 570, 42, 570, 42 } }, /*206: U+0173*/
+    { { 573, 576, 46, 576, 46 } }, /*207: U+0174*/
+    { { 576, 576, 46, 576, 46 } }, /*208: U+0175*/
+    { { 579, 582, 50, 582, 50 } }, /*209: U+0176*/
+    { { 582, 582, 50, 582, 50 } }, /*210: U+0177*/
+    { { 585, 252, 50, 252, 50 } }, /*211: U+0178*/
+    { { 588, 591, 52, 591, 52 } }, /*212: U+0179*/
+    { { 591, 591, 52, 591, 52 } }, /*213: U+017A*/
+    { { 594, 597, 52, 597, 52 } }, /*214: U+017B*/
+    { { 597, 597, 52, 597, 52 } }, /*215: U+017C*/
+    { { 600, 603, 52, 603, 52 } }, /*216: U+017D*/
+    { { 603, 603, 52, 603, 52 } }, /*217: U+017E*/
+    { { 38, 38, 38, 38, 38 } }, /*218: U+017F*/
+    { { 0, 606, 606, 606, 606 } }, /*219: U+0181*/
+    { { 0, 608, 608, 608, 608 } }, /*220: U+0182*/
+    { { 0, 610, 610, 610, 610 } }, /*221: U+0184*/
+    { { 0, 612, 612, 612, 612 } }, /*222: U+0186*/
+    { { 0, 614, 614, 614, 614 } }, /*223: U+0187*/
+    { { 0, 616, 616, 616, 616 } }, /*224: U+0189*/
+    { { 0, 618, 618, 618, 618 } }, /*225: U+018A*/
+    { { 0, 620, 620, 620, 620 } }, /*226: U+018B*/
+    { { 0, 622, 622, 622, 622 } }, /*227: U+018E*/
+    { { 0, 624, 624, 624, 624 } }, /*228: U+018F*/
+    { { 0, 626, 626, 626, 626 } }, /*229: U+0190*/
+    { { 0, 628, 628, 628, 628 } }, /*230: U+0191*/
+    { { 0, 630, 630, 630, 630 } }, /*231: U+0193*/
+    { { 0, 632, 632, 632, 632 } }, /*232: U+0194*/
+    { { 0, 634, 634, 634, 634 } }, /*233: U+0196*/
+    { { 0, 636, 636, 636, 636 } }, /*234: U+0197*/
+    { { 0, 638, 638, 638, 638 } }, /*235: U+0198*/
+    { { 0, 640, 640, 640, 640 } }, /*236: U+019C*/
+    { { 0, 642, 642, 642, 642 } }, /*237: U+019D*/
+    { { 0, 644, 644, 644, 644 } }, /*238: U+019F*/
+    { { 646, 649, 30, 649, 30 } }, /*239: U+01A0*/
+    { { 649, 649, 30, 649, 30 } }, /*240: U+01A1*/
+    { { 0, 652, 652, 652, 652 } }, /*241: U+01A2*/
+    { { 0, 654, 654, 654, 654 } }, /*242: U+01A4*/
+    { { 0, 656, 656, 656, 656 } }, /*243: U+01A6*/
+    { { 0, 658, 658, 658, 658 } }, /*244: U+01A7*/
+    { { 0, 660, 660, 660, 660 } }, /*245: U+01A9*/
+    { { 0, 662, 662, 662, 662 } }, /*246: U+01AC*/
+    { { 0, 664, 664, 664, 664 } }, /*247: U+01AE*/
+    { { 666, 669, 42, 669, 42 } }, /*248: U+01AF*/
+    { { 669, 669, 42, 669, 42 } }, /*249: U+01B0*/
+    { { 0, 672, 672, 672, 672 } }, /*250: U+01B1*/
+    { { 0, 674, 674, 674, 674 } }, /*251: U+01B2*/
+    { { 0, 676, 676, 676, 676 } }, /*252: U+01B3*/
+    { { 0, 678, 678, 678, 678 } }, /*253: U+01B5*/
+    { { 0, 680, 680, 680, 680 } }, /*254: U+01B7*/
+    { { 0, 682, 682, 682, 682 } }, /*255: U+01B8*/
+    { { 0, 684, 684, 684, 684 } }, /*256: U+01BC*/
+    { { 686, 690, 694, 690, 694 } }, /*257: U+01C4*/
+    { { 697, 690, 694, 690, 694 } }, /*258: U+01C5*/
+    { { 690, 690, 694, 690, 694 } }, /*259: U+01C6*/
+    { { 701, 704, 704, 704, 704 } }, /*260: U+01C7*/
+    { { 707, 704, 704, 704, 704 } }, /*261: U+01C8*/
+    { { 704, 704, 704, 704, 704 } }, /*262: U+01C9*/
+    { { 710, 713, 713, 713, 713 } }, /*263: U+01CA*/
+    { { 716, 713, 713, 713, 713 } }, /*264: U+01CB*/
+    { { 713, 713, 713, 713, 713 } }, /*265: U+01CC*/
+    { { 719, 722, 2, 722, 2 } }, /*266: U+01CD*/
+    { { 722, 722, 2, 722, 2 } }, /*267: U+01CE*/
+    { { 725, 728, 18, 728, 18 } }, /*268: U+01CF*/
+    { { 728, 728, 18, 728, 18 } }, /*269: U+01D0*/
+    { { 731, 734, 30, 734, 30 } }, /*270: U+01D1*/
+    { { 734, 734, 30, 734, 30 } }, /*271: U+01D2*/
+    { { 737, 740, 42, 740, 42 } }, /*272: U+01D3*/
+    { { 740, 740, 42, 740, 42 } }, /*273: U+01D4*/
+    { { 743, 747, 42, 747, 42 } }, /*274: U+01D5*/
+    { { 747, 747, 42, 747, 42 } }, /*275: U+01D6*/
+    { { 751, 755, 42, 755, 42 } }, /*276: U+01D7*/
+    { { 755, 755, 42, 755, 42 } }, /*277: U+01D8*/
+    { { 759, 763, 42, 763, 42 } }, /*278: U+01D9*/
+    { { 763, 763, 42, 763, 42 } }, /*279: U+01DA*/
+    { { 767, 771, 42, 771, 42 } }, /*280: U+01DB*/
+    { { 771, 771, 42, 771, 42 } }, /*281: U+01DC*/
+    { { 775, 779, 2, 779, 2 } }, /*282: U+01DE*/
+    { { 779, 779, 2, 779, 2 } }, /*283: U+01DF*/
+    { { 783, 787, 2, 787, 2 } }, /*284: U+01E0*/
+    { { 787, 787, 2, 787, 2 } }, /*285: U+01E1*/
+    { { 791, 794, 124, 794, 124 } }, /*286: U+01E2*/
+    { { 794, 794, 124, 794, 124 } }, /*287: U+01E3*/
+    { { 0, 797, 797, 797, 797 } }, /*288: U+01E4*/
+    { { 799, 802, 14, 802, 14 } }, /*289: U+01E6*/
+    { { 802, 802, 14, 802, 14 } }, /*290: U+01E7*/
+    { { 805, 808, 22, 808, 22 } }, /*291: U+01E8*/
+    { { 808, 808, 22, 808, 22 } }, /*292: U+01E9*/
+    { { 811, 814, 30, 814, 30 } }, /*293: U+01EA*/
+    { { 814, 814, 30, 814, 30 } }, /*294: U+01EB*/
+    { { 817, 821, 30, 821, 30 } }, /*295: U+01EC*/
+    { { 821, 821, 30, 821, 30 } }, /*296: U+01ED*/
+    { { 825, 828, 680, 828, 680 } }, /*297: U+01EE*/
+    { { 828, 828, 680, 828, 680 } }, /*298: U+01EF*/
+    { { 831, 831, 20, 831, 20 } }, /*299: U+01F0*/
+    { { 834, 694, 694, 694, 694 } }, /*300: U+01F1*/
+    { { 837, 694, 694, 694, 694 } }, /*301: U+01F2*/
+    { { 694, 694, 694, 694, 694 } }, /*302: U+01F3*/
+    { { 840, 843, 14, 843, 14 } }, /*303: U+01F4*/
+    { { 843, 843, 14, 843, 14 } }, /*304: U+01F5*/
+    { { 0, 846, 846, 846, 846 } }, /*305: U+01F6*/
+    { { 0, 848, 848, 848, 848 } }, /*306: U+01F7*/
+    { { 850, 853, 28, 853, 28 } }, /*307: U+01F8*/
+    { { 853, 853, 28, 853, 28 } }, /*308: U+01F9*/
+    { { 856, 860, 2, 860, 2 } }, /*309: U+01FA*/
+    { { 860, 860, 2, 860, 2 } }, /*310: U+01FB*/
+    { { 864, 867, 124, 867, 124 } }, /*311: U+01FC*/
+    { { 867, 867, 124, 867, 124 } }, /*312: U+01FD*/
+    { { 870, 873, 218, 873, 218 } }, /*313: U+01FE*/
+    { { 873, 873, 218, 873, 218 } }, /*314: U+01FF*/
+    { { 876, 879, 2, 879, 2 } }, /*315: U+0200*/
+    { { 879, 879, 2, 879, 2 } }, /*316: U+0201*/
+    { { 882, 885, 2, 885, 2 } }, /*317: U+0202*/
+    { { 885, 885, 2, 885, 2 } }, /*318: U+0203*/
+    { { 888, 891, 10, 891, 10 } }, /*319: U+0204*/
+    { { 891, 891, 10, 891, 10 } }, /*320: U+0205*/
+    { { 894, 897, 10, 897, 10 } }, /*321: U+0206*/
+    { { 897, 897, 10, 897, 10 } }, /*322: U+0207*/
+    { { 900, 903, 18, 903, 18 } }, /*323: U+0208*/
+    { { 903, 903, 18, 903, 18 } }, /*324: U+0209*/
+    { { 906, 909, 18, 909, 18 } }, /*325: U+020A*/
+    { { 909, 909, 18, 909, 18 } }, /*326: U+020B*/
+    { { 912, 915, 30, 915, 30 } }, /*327: U+020C*/
+    { { 915, 915, 30, 915, 30 } }, /*328: U+020D*/
+    { { 918, 921, 30, 921, 30 } }, /*329: U+020E*/
+    { { 921, 921, 30, 921, 30 } }, /*330: U+020F*/
+    { { 924, 927, 36, 927, 36 } }, /*331: U+0210*/
+    { { 927, 927, 36, 927, 36 } }, /*332: U+0211*/
+    { { 930, 933, 36, 933, 36 } }, /*333: U+0212*/
+    { { 933, 933, 36, 933, 36 } }, /*334: U+0213*/
+    { { 936, 939, 42, 939, 42 } }, /*335: U+0214*/
+    { { 939, 939, 42, 939, 42 } }, /*336: U+0215*/
+    { { 942, 945, 42, 945, 42 } }, /*337: U+0216*/
+    { { 945, 945, 42, 945, 42 } }, /*338: U+0217*/
+    { { 948, 951, 38, 951, 38 } }, /*339: U+0218*/
+    { { 951, 951, 38, 951, 38 } }, /*340: U+0219*/
+    { { 954, 957, 40, 957, 40 } }, /*341: U+021A*/
+    { { 957, 957, 40, 957, 40 } }, /*342: U+021B*/
+    { { 0, 960, 960, 960, 960 } }, /*343: U+021C*/
+    { { 962, 965, 16, 965, 16 } }, /*344: U+021E*/
+    { { 965, 965, 16, 965, 16 } }, /*345: U+021F*/
+    { { 0, 968, 968, 968, 968 } }, /*346: U+0220*/
+    { { 0, 970, 970, 970, 970 } }, /*347: U+0222*/
+    { { 0, 972, 972, 972, 972 } }, /*348: U+0224*/
+    { { 974, 977, 2, 977, 2 } }, /*349: U+0226*/
+    { { 977, 977, 2, 977, 2 } }, /*350: U+0227*/
+    { { 980, 983, 10, 983, 10 } }, /*351: U+0228*/
+    { { 983, 983, 10, 983, 10 } }, /*352: U+0229*/
+    { { 986, 990, 30, 990, 30 } }, /*353: U+022A*/
+    { { 990, 990, 30, 990, 30 } }, /*354: U+022B*/
+    { { 994, 998, 30, 998, 30 } }, /*355: U+022C*/
+    { { 998, 998, 30, 998, 30 } }, /*356: U+022D*/
+    { { 1002, 1005, 30, 1005, 30 } }, /*357: U+022E*/
+    { { 1005, 1005, 30, 1005, 30 } }, /*358: U+022F*/
+    { { 1008, 1012, 30, 1012, 30 } }, /*359: U+0230*/
+    { { 1012, 1012, 30, 1012, 30 } }, /*360: U+0231*/
+    { { 1016, 1019, 50, 1019, 50 } }, /*361: U+0232*/
+    { { 1019, 1019, 50, 1019, 50 } }, /*362: U+0233*/
+    { { 0, 1022, 1022, 1022, 1022 } }, /*363: U+023A*/
+    { { 0, 1024, 1024, 1024, 1024 } }, /*364: U+023B*/
+    { { 0, 1026, 1026, 1026, 1026 } }, /*365: U+023D*/
+    { { 0, 1028, 1028, 1028, 1028 } }, /*366: U+023E*/
+    { { 0, 1030, 1030, 1030, 1030 } }, /*367: U+0241*/
+    { { 0, 1032, 1032, 1032, 1032 } }, /*368: U+0243*/
+    { { 0, 1034, 1034, 1034, 1034 } }, /*369: U+0244*/
+    { { 0, 1036, 1036, 1036, 1036 } }, /*370: U+0245*/
+    { { 0, 1038, 1038, 1038, 1038 } }, /*371: U+0246*/
+    { { 0, 1040, 1040, 1040, 1040 } }, /*372: U+0248*/
+    { { 0, 1042, 1042, 1042, 1042 } }, /*373: U+024A*/
+    { { 0, 1044, 1044, 1044, 1044 } }, /*374: U+024C*/
+    { { 0, 1046, 1046, 1046, 1046 } }, /*375: U+024E*/
+    { { 0, 0, 1, 0, 1 } }, /*376: U+0300*/
+    { { 0, 1048, 1048, 1048, 1048 } }, /*377: U+0345*/
+    { { 0, 1050, 1050, 1050, 1050 } }, /*378: U+0370*/
+    { { 0, 1052, 1052, 1052, 1052 } }, /*379: U+0372*/
+    { { 0, 1054, 1054, 1054, 1054 } }, /*380: U+0376*/
+    { { 0, 1056, 1056, 1056, 1056 } }, /*381: U+0386*/
+    { { 0, 1058, 1058, 1058, 1058 } }, /*382: U+0388*/
+    { { 0, 1060, 1060, 1060, 1060 } }, /*383: U+0389*/
+    { { 0, 1062, 1062, 1062, 1062 } }, /*384: U+038A*/
+    { { 0, 1064, 1064, 1064, 1064 } }, /*385: U+038C*/
+    { { 0, 1066, 1066, 1066, 1066 } }, /*386: U+038E*/
+    { { 0, 1068, 1068, 1068, 1068 } }, /*387: U+038F*/
+    { { 0, 1070, 1070, 1070, 1070 } }, /*388: U+0391*/
+    { { 0, 1072, 1072, 1072, 1072 } }, /*389: U+0392*/
+    { { 0, 1074, 1074, 1074, 1074 } }, /*390: U+0393*/
+    { { 0, 1076, 1076, 1076, 1076 } }, /*391: U+0394*/
+    { { 0, 1078, 1078, 1078, 1078 } }, /*392: U+0395*/
+    { { 0, 1080, 1080, 1080, 1080 } }, /*393: U+0396*/
+    { { 0, 1082, 1082, 1082, 1082 } }, /*394: U+0397*/
+    { { 0, 1084, 1084, 1084, 1084 } }, /*395: U+0398*/
+    { { 0, 1086, 1086, 1086, 1086 } }, /*396: U+039A*/
+    { { 0, 1088, 1088, 1088, 1088 } }, /*397: U+039B*/
+    { { 0, 69, 69, 69, 69 } }, /*398: U+039C*/
+    { { 0, 1090, 1090, 1090, 1090 } }, /*399: U+039D*/
+    { { 0, 1092, 1092, 1092, 1092 } }, /*400: U+039E*/
+    { { 0, 1094, 1094, 1094, 1094 } }, /*401: U+039F*/
+    { { 0, 1096, 1096, 1096, 1096 } }, /*402: U+03A0*/
+    { { 0, 1098, 1098, 1098, 1098 } }, /*403: U+03A1*/
+    { { 0, 1100, 1100, 1100, 1100 } }, /*404: U+03A3*/
+    { { 0, 1102, 1102, 1102, 1102 } }, /*405: U+03A4*/
+    { { 0, 1104, 1104, 1104, 1104 } }, /*406: U+03A5*/
+    { { 0, 1106, 1106, 1106, 1106 } }, /*407: U+03A6*/
+    { { 0, 1108, 1108, 1108, 1108 } }, /*408: U+03A7*/
+    { { 0, 1110, 1110, 1110, 1110 } }, /*409: U+03A8*/
+    { { 0, 1112, 1112, 1112, 1112 } }, /*410: U+03A9*/
+    { { 0, 1114, 1114, 1114, 1114 } }, /*411: U+03AA*/
+    { { 0, 1116, 1116, 1116, 1116 } }, /*412: U+03AB*/
+    { { 0, 1118, 1118, 1118, 1118 } }, /*413: U+03CF*/
+    { { 0, 1120, 1120, 1120, 1120 } }, /*414: U+03D8*/
+    { { 0, 1122, 1122, 1122, 1122 } }, /*415: U+03DA*/
+    { { 0, 1124, 1124, 1124, 1124 } }, /*416: U+03DC*/
+    { { 0, 1126, 1126, 1126, 1126 } }, /*417: U+03DE*/
+    { { 0, 1128, 1128, 1128, 1128 } }, /*418: U+03E0*/
+    { { 0, 1130, 1130, 1130, 1130 } }, /*419: U+03E2*/
+    { { 0, 1132, 1132, 1132, 1132 } }, /*420: U+03E4*/
+    { { 0, 1134, 1134, 1134, 1134 } }, /*421: U+03E6*/
+    { { 0, 1136, 1136, 1136, 1136 } }, /*422: U+03E8*/
+    { { 0, 1138, 1138, 1138, 1138 } }, /*423: U+03EA*/
+    { { 0, 1140, 1140, 1140, 1140 } }, /*424: U+03EC*/
+    { { 0, 1142, 1142, 1142, 1142 } }, /*425: U+03EE*/
+    { { 0, 1144, 1144, 1144, 1144 } }, /*426: U+03F7*/
+    { { 0, 1146, 1146, 1146, 1146 } }, /*427: U+03F9*/
+    { { 0, 1148, 1148, 1148, 1148 } }, /*428: U+03FA*/
+    { { 0, 1150, 1150, 1150, 1150 } }, /*429: U+03FD*/
+    { { 0, 1152, 1152, 1152, 1152 } }, /*430: U+03FE*/
+    { { 0, 1154, 1154, 1154, 1154 } }, /*431: U+03FF*/
+    { { 0, 1156, 1156, 1156, 1156 } }, /*432: U+0400*/
+    { { 0, 1158, 1158, 1158, 1158 } }, /*433: U+0401*/
+    { { 0, 1160, 1160, 1160, 1160 } }, /*434: U+0402*/
+    { { 0, 1162, 1162, 1162, 1162 } }, /*435: U+0403*/
+    { { 0, 1164, 1164, 1164, 1164 } }, /*436: U+0404*/
+    { { 0, 1166, 1166, 1166, 1166 } }, /*437: U+0405*/
+    { { 0, 1168, 1168, 1168, 1168 } }, /*438: U+0406*/
+    { { 0, 1170, 1170, 1170, 1170 } }, /*439: U+0407*/
+    { { 0, 1172, 1172, 1172, 1172 } }, /*440: U+0408*/
+    { { 0, 1174, 1174, 1174, 1174 } }, /*441: U+0409*/
+    { { 0, 1176, 1176, 1176, 1176 } }, /*442: U+040A*/
+    { { 0, 1178, 1178, 1178, 1178 } }, /*443: U+040B*/
+    { { 0, 1180, 1180, 1180, 1180 } }, /*444: U+040C*/
+    { { 0, 1182, 1182, 1182, 1182 } }, /*445: U+040D*/
+    { { 0, 1184, 1184, 1184, 1184 } }, /*446: U+040E*/
+    { { 0, 1186, 1186, 1186, 1186 } }, /*447: U+040F*/
+    { { 0, 1188, 1188, 1188, 1188 } }, /*448: U+0410*/
+    { { 0, 1190, 1190, 1190, 1190 } }, /*449: U+0411*/
+    { { 0, 1192, 1192, 1192, 1192 } }, /*450: U+0412*/
+    { { 0, 1194, 1194, 1194, 1194 } }, /*451: U+0413*/
+    { { 0, 1196, 1196, 1196, 1196 } }, /*452: U+0414*/
+    { { 0, 1198, 1198, 1198, 1198 } }, /*453: U+0415*/
+    { { 0, 1200, 1200, 1200, 1200 } }, /*454: U+0416*/
+    { { 0, 1202, 1202, 1202, 1202 } }, /*455: U+0417*/
+    { { 0, 1204, 1204, 1204, 1204 } }, /*456: U+0418*/
+    { { 0, 1206, 1206, 1206, 1206 } }, /*457: U+0419*/
+    { { 0, 1208, 1208, 1208, 1208 } }, /*458: U+041A*/
+    { { 0, 1210, 1210, 1210, 1210 } }, /*459: U+041B*/
+    { { 0, 1212, 1212, 1212, 1212 } }, /*460: U+041C*/
+    { { 0, 1214, 1214, 1214, 1214 } }, /*461: U+041D*/
+    { { 0, 1216, 1216, 1216, 1216 } }, /*462: U+041E*/
+    { { 0, 1218, 1218, 1218, 1218 } }, /*463: U+041F*/
+    { { 0, 1220, 1220, 1220, 1220 } }, /*464: U+0420*/
+    { { 0, 1222, 1222, 1222, 1222 } }, /*465: U+0421*/
+    { { 0, 1224, 1224, 1224, 1224 } }, /*466: U+0422*/
+    { { 0, 1226, 1226, 1226, 1226 } }, /*467: U+0423*/
+    { { 0, 1228, 1228, 1228, 1228 } }, /*468: U+0424*/
+    { { 0, 1230, 1230, 1230, 1230 } }, /*469: U+0425*/
+    { { 0, 1232, 1232, 1232, 1232 } }, /*470: U+0426*/
+    { { 0, 1234, 1234, 1234, 1234 } }, /*471: U+0427*/
+    { { 0, 1236, 1236, 1236, 1236 } }, /*472: U+0428*/
+    { { 0, 1238, 1238, 1238, 1238 } }, /*473: U+0429*/
+    { { 0, 1240, 1240, 1240, 1240 } }, /*474: U+042A*/
+    { { 0, 1242, 1242, 1242, 1242 } }, /*475: U+042B*/
+    { { 0, 1244, 1244, 1244, 1244 } }, /*476: U+042C*/
+    { { 0, 1246, 1246, 1246, 1246 } }, /*477: U+042D*/
+    { { 0, 1248, 1248, 1248, 1248 } }, /*478: U+042E*/
+    { { 0, 1250, 1250, 1250, 1250 } }, /*479: U+042F*/
+    { { 0, 1252, 1252, 1252, 1252 } }, /*480: U+0460*/
+    { { 0, 1254, 1254, 1254, 1254 } }, /*481: U+0462*/
+    { { 0, 1256, 1256, 1256, 1256 } }, /*482: U+0464*/
+    { { 0, 1258, 1258, 1258, 1258 } }, /*483: U+0466*/
+    { { 0, 1260, 1260, 1260, 1260 } }, /*484: U+0468*/
+    { { 0, 1262, 1262, 1262, 1262 } }, /*485: U+046A*/
+    { { 0, 1264, 1264, 1264, 1264 } }, /*486: U+046C*/
+    { { 0, 1266, 1266, 1266, 1266 } }, /*487: U+046E*/
+    { { 0, 1268, 1268, 1268, 1268 } }, /*488: U+0470*/
+    { { 0, 1270, 1270, 1270, 1270 } }, /*489: U+0472*/
+    { { 0, 1272, 1272, 1272, 1272 } }, /*490: U+0474*/
+    { { 0, 1274, 1274, 1274, 1274 } }, /*491: U+0476*/
+    { { 0, 1276, 1276, 1276, 1276 } }, /*492: U+0478*/
+    { { 0, 1278, 1278, 1278, 1278 } }, /*493: U+047A*/
+    { { 0, 1280, 1280, 1280, 1280 } }, /*494: U+047C*/
+    { { 0, 1282, 1282, 1282, 1282 } }, /*495: U+047E*/
+    { { 0, 1284, 1284, 1284, 1284 } }, /*496: U+0480*/
+    { { 0, 1286, 1286, 1286, 1286 } }, /*497: U+048A*/
+    { { 0, 1288, 1288, 1288, 1288 } }, /*498: U+048C*/
+    { { 0, 1290, 1290, 1290, 1290 } }, /*499: U+048E*/
+    { { 0, 1292, 1292, 1292, 1292 } }, /*500: U+0490*/
+    { { 0, 1294, 1294, 1294, 1294 } }, /*501: U+0492*/
+    { { 0, 1296, 1296, 1296, 1296 } }, /*502: U+0494*/
+    { { 0, 1298, 1298, 1298, 1298 } }, /*503: U+0496*/
+    { { 0, 1300, 1300, 1300, 1300 } }, /*504: U+0498*/
+    { { 0, 1302, 1302, 1302, 1302 } }, /*505: U+049A*/
+    { { 0, 1304, 1304, 1304, 1304 } }, /*506: U+049C*/
+    { { 0, 1306, 1306, 1306, 1306 } }, /*507: U+049E*/
+    { { 0, 1308, 1308, 1308, 1308 } }, /*508: U+04A0*/
+    { { 0, 1310, 1310, 1310, 1310 } }, /*509: U+04A2*/
+    { { 0, 1312, 1312, 1312, 1312 } }, /*510: U+04A4*/
+    { { 0, 1314, 1314, 1314, 1314 } }, /*511: U+04A6*/
+    { { 0, 1316, 1316, 1316, 1316 } }, /*512: U+04A8*/
+    { { 0, 1318, 1318, 1318, 1318 } }, /*513: U+04AA*/
+    { { 0, 1320, 1320, 1320, 1320 } }, /*514: U+04AC*/
+    { { 0, 1322, 1322, 1322, 1322 } }, /*515: U+04AE*/
+    { { 0, 1324, 1324, 1324, 1324 } }, /*516: U+04B0*/
+    { { 0, 1326, 1326, 1326, 1326 } }, /*517: U+04B2*/
+    { { 0, 1328, 1328, 1328, 1328 } }, /*518: U+04B4*/
+    { { 0, 1330, 1330, 1330, 1330 } }, /*519: U+04B6*/
+    { { 0, 1332, 1332, 1332, 1332 } }, /*520: U+04B8*/
+    { { 0, 1334, 1334, 1334, 1334 } }, /*521: U+04BA*/
+    { { 0, 1336, 1336, 1336, 1336 } }, /*522: U+04BC*/
+    { { 0, 1338, 1338, 1338, 1338 } }, /*523: U+04BE*/
+    { { 0, 1340, 1340, 1340, 1340 } }, /*524: U+04C0*/
+    { { 0, 1342, 1342, 1342, 1342 } }, /*525: U+04C1*/
+    { { 0, 1344, 1344, 1344, 1344 } }, /*526: U+04C3*/
+    { { 0, 1346, 1346, 1346, 1346 } }, /*527: U+04C5*/
+    { { 0, 1348, 1348, 1348, 1348 } }, /*528: U+04C7*/
+    { { 0, 1350, 1350, 1350, 1350 } }, /*529: U+04C9*/
+    { { 0, 1352, 1352, 1352, 1352 } }, /*530: U+04CB*/
+    { { 0, 1354, 1354, 1354, 1354 } }, /*531: U+04CD*/
+    { { 0, 1356, 1356, 1356, 1356 } }, /*532: U+04D0*/
+    { { 0, 1358, 1358, 1358, 1358 } }, /*533: U+04D2*/
+    { { 0, 1360, 1360, 1360, 1360 } }, /*534: U+04D4*/
+    { { 0, 1362, 1362, 1362, 1362 } }, /*535: U+04D6*/
+    { { 0, 1364, 1364, 1364, 1364 } }, /*536: U+04D8*/
+    { { 0, 1366, 1366, 1366, 1366 } }, /*537: U+04DA*/
+    { { 0, 1368, 1368, 1368, 1368 } }, /*538: U+04DC*/
+    { { 0, 1370, 1370, 1370, 1370 } }, /*539: U+04DE*/
+    { { 0, 1372, 1372, 1372, 1372 } }, /*540: U+04E0*/
+    { { 0, 1374, 1374, 1374, 1374 } }, /*541: U+04E2*/
+    { { 0, 1376, 1376, 1376, 1376 } }, /*542: U+04E4*/
+    { { 0, 1378, 1378, 1378, 1378 } }, /*543: U+04E6*/
+    { { 0, 1380, 1380, 1380, 1380 } }, /*544: U+04E8*/
+    { { 0, 1382, 1382, 1382, 1382 } }, /*545: U+04EA*/
+    { { 0, 1384, 1384, 1384, 1384 } }, /*546: U+04EC*/
+    { { 0, 1386, 1386, 1386, 1386 } }, /*547: U+04EE*/
+    { { 0, 1388, 1388, 1388, 1388 } }, /*548: U+04F0*/
+    { { 0, 1390, 1390, 1390, 1390 } }, /*549: U+04F2*/
+    { { 0, 1392, 1392, 1392, 1392 } }, /*550: U+04F4*/
+    { { 0, 1394, 1394, 1394, 1394 } }, /*551: U+04F6*/
+    { { 0, 1396, 1396, 1396, 1396 } }, /*552: U+04F8*/
+    { { 0, 1398, 1398, 1398, 1398 } }, /*553: U+04FA*/
+    { { 0, 1400, 1400, 1400, 1400 } }, /*554: U+04FC*/
+    { { 0, 1402, 1402, 1402, 1402 } }, /*555: U+04FE*/
+    { { 0, 1404, 1404, 1404, 1404 } }, /*556: U+0500*/
+    { { 0, 1406, 1406, 1406, 1406 } }, /*557: U+0502*/
+    { { 0, 1408, 1408, 1408, 1408 } }, /*558: U+0504*/
+    { { 0, 1410, 1410, 1410, 1410 } }, /*559: U+0506*/
+    { { 0, 1412, 1412, 1412, 1412 } }, /*560: U+0508*/
+    { { 0, 1414, 1414, 1414, 1414 } }, /*561: U+050A*/
+    { { 0, 1416, 1416, 1416, 1416 } }, /*562: U+050C*/
+    { { 0, 1418, 1418, 1418, 1418 } }, /*563: U+050E*/
+    { { 0, 1420, 1420, 1420, 1420 } }, /*564: U+0510*/
+    { { 0, 1422, 1422, 1422, 1422 } }, /*565: U+0512*/
+    { { 0, 1424, 1424, 1424, 1424 } }, /*566: U+0514*/
+    { { 0, 1426, 1426, 1426, 1426 } }, /*567: U+0516*/
+    { { 0, 1428, 1428, 1428, 1428 } }, /*568: U+0518*/
+    { { 0, 1430, 1430, 1430, 1430 } }, /*569: U+051A*/
+    { { 0, 1432, 1432, 1432, 1432 } }, /*570: U+051C*/
+    { { 0, 1434, 1434, 1434, 1434 } }, /*571: U+051E*/
+    { { 0, 1436, 1436, 1436, 1436 } }, /*572: U+0520*/
+    { { 0, 1438, 1438, 1438, 1438 } }, /*573: U+0522*/
+    { { 0, 1440, 1440, 1440, 1440 } }, /*574: U+0524*/
+    { { 0, 1442, 1442, 1442, 1442 } }, /*575: U+0526*/
+    { { 0, 1444, 1444, 1444, 1444 } }, /*576: U+0531*/
+    { { 0, 1446, 1446, 1446, 1446 } }, /*577: U+0532*/
+    { { 0, 1448, 1448, 1448, 1448 } }, /*578: U+0533*/
+    { { 0, 1450, 1450, 1450, 1450 } }, /*579: U+0534*/
+    { { 0, 1452, 1452, 1452, 1452 } }, /*580: U+0535*/
+    { { 0, 1454, 1454, 1454, 1454 } }, /*581: U+0536*/
+    { { 0, 1456, 1456, 1456, 1456 } }, /*582: U+0537*/
+    { { 0, 1458, 1458, 1458, 1458 } }, /*583: U+0538*/
+    { { 0, 1460, 1460, 1460, 1460 } }, /*584: U+0539*/
+    { { 0, 1462, 1462, 1462, 1462 } }, /*585: U+053A*/
+    { { 0, 1464, 1464, 1464, 1464 } }, /*586: U+053B*/
+    { { 0, 1466, 1466, 1466, 1466 } }, /*587: U+053C*/
+    { { 0, 1468, 1468, 1468, 1468 } }, /*588: U+053D*/
+    { { 0, 1470, 1470, 1470, 1470 } }, /*589: U+053E*/
+    { { 0, 1472, 1472, 1472, 1472 } }, /*590: U+053F*/
+    { { 0, 1474, 1474, 1474, 1474 } }, /*591: U+0540*/
+    { { 0, 1476, 1476, 1476, 1476 } }, /*592: U+0541*/
+    { { 0, 1478, 1478, 1478, 1478 } }, /*593: U+0542*/
+    { { 0, 1480, 1480, 1480, 1480 } }, /*594: U+0543*/
+    { { 0, 1482, 1482, 1482, 1482 } }, /*595: U+0544*/
+    { { 0, 1484, 1484, 1484, 1484 } }, /*596: U+0545*/
+    { { 0, 1486, 1486, 1486, 1486 } }, /*597: U+0546*/
+    { { 0, 1488, 1488, 1488, 1488 } }, /*598: U+0547*/
+    { { 0, 1490, 1490, 1490, 1490 } }, /*599: U+0548*/
+    { { 0, 1492, 1492, 1492, 1492 } }, /*600: U+0549*/
+    { { 0, 1494, 1494, 1494, 1494 } }, /*601: U+054A*/
+    { { 0, 1496, 1496, 1496, 1496 } }, /*602: U+054B*/
+    { { 0, 1498, 1498, 1498, 1498 } }, /*603: U+054C*/
+    { { 0, 1500, 1500, 1500, 1500 } }, /*604: U+054D*/
+    { { 0, 1502, 1502, 1502, 1502 } }, /*605: U+054E*/
+    { { 0, 1504, 1504, 1504, 1504 } }, /*606: U+054F*/
+    { { 0, 1506, 1506, 1506, 1506 } }, /*607: U+0550*/
+    { { 0, 1508, 1508, 1508, 1508 } }, /*608: U+0551*/
+    { { 0, 1510, 1510, 1510, 1510 } }, /*609: U+0552*/
+    { { 0, 1512, 1512, 1512, 1512 } }, /*610: U+0553*/
+    { { 0, 1514, 1514, 1514, 1514 } }, /*611: U+0554*/
+    { { 0, 1516, 1516, 1516, 1516 } }, /*612: U+0555*/
+    { { 0, 1518, 1518, 1518, 1518 } }, /*613: U+0556*/
+    { { 0, 1520, 1520, 1520, 1520 } }, /*614: U+10A0*/
+    { { 0, 1522, 1522, 1522, 1522 } }, /*615: U+10A1*/
+    { { 0, 1524, 1524, 1524, 1524 } }, /*616: U+10A2*/
+    { { 0, 1526, 1526, 1526, 1526 } }, /*617: U+10A3*/
+    { { 0, 1528, 1528, 1528, 1528 } }, /*618: U+10A4*/
+    { { 0, 1530, 1530, 1530, 1530 } }, /*619: U+10A5*/
+    { { 0, 1532, 1532, 1532, 1532 } }, /*620: U+10A6*/
+    { { 0, 1534, 1534, 1534, 1534 } }, /*621: U+10A7*/
+    { { 0, 1536, 1536, 1536, 1536 } }, /*622: U+10A8*/
+    { { 0, 1538, 1538, 1538, 1538 } }, /*623: U+10A9*/
+    { { 0, 1540, 1540, 1540, 1540 } }, /*624: U+10AA*/
+    { { 0, 1542, 1542, 1542, 1542 } }, /*625: U+10AB*/
+    { { 0, 1544, 1544, 1544, 1544 } }, /*626: U+10AC*/
+    { { 0, 1546, 1546, 1546, 1546 } }, /*627: U+10AD*/
+    { { 0, 1548, 1548, 1548, 1548 } }, /*628: U+10AE*/
+    { { 0, 1550, 1550, 1550, 1550 } }, /*629: U+10AF*/
+    { { 0, 1552, 1552, 1552, 1552 } }, /*630: U+10B0*/
+    { { 0, 1554, 1554, 1554, 1554 } }, /*631: U+10B1*/
+    { { 0, 1556, 1556, 1556, 1556 } }, /*632: U+10B2*/
+    { { 0, 1558, 1558, 1558, 1558 } }, /*633: U+10B3*/
+    { { 0, 1560, 1560, 1560, 1560 } }, /*634: U+10B4*/
+    { { 0, 1562, 1562, 1562, 1562 } }, /*635: U+10B5*/
+    { { 0, 1564, 1564, 1564, 1564 } }, /*636: U+10B6*/
+    { { 0, 1566, 1566, 1566, 1566 } }, /*637: U+10B7*/
+    { { 0, 1568, 1568, 1568, 1568 } }, /*638: U+10B8*/
+    { { 0, 1570, 1570, 1570, 1570 } }, /*639: U+10B9*/
+    { { 0, 1572, 1572, 1572, 1572 } }, /*640: U+10BA*/
+    { { 0, 1574, 1574, 1574, 1574 } }, /*641: U+10BB*/
+    { { 0, 1576, 1576, 1576, 1576 } }, /*642: U+10BC*/
+    { { 0, 1578, 1578, 1578, 1578 } }, /*643: U+10BD*/
+    { { 0, 1580, 1580, 1580, 1580 } }, /*644: U+10BE*/
+    { { 0, 1582, 1582, 1582, 1582 } }, /*645: U+10BF*/
+    { { 0, 1584, 1584, 1584, 1584 } }, /*646: U+10C0*/
+    { { 0, 1586, 1586, 1586, 1586 } }, /*647: U+10C1*/
+    { { 0, 1588, 1588, 1588, 1588 } }, /*648: U+10C2*/
+    { { 0, 1590, 1590, 1590, 1590 } }, /*649: U+10C3*/
+    { { 0, 1592, 1592, 1592, 1592 } }, /*650: U+10C4*/
+    { { 0, 1594, 1594, 1594, 1594 } }, /*651: U+10C5*/
+    { { 0, 1596, 1596, 1596, 1596 } }, /*652: U+10C7*/
+    { { 0, 1598, 1598, 1598, 1598 } }, /*653: U+10CD*/
+    { { 0, 1600, 2, 1600, 2 } }, /*654: U+1E00*/
+    { { 0, 0, 2, 0, 2 } }, /*655: U+1E01*/
+    { { 0, 1602, 4, 1602, 4 } }, /*656: U+1E02*/
+    { { 0, 0, 4, 0, 4 } }, /*657: U+1E03*/
+    { { 0, 1604, 4, 1604, 4 } }, /*658: U+1E04*/
+    { { 0, 1606, 4, 1606, 4 } }, /*659: U+1E06*/
+    { { 0, 1608, 1608, 1608, 1608 } }, /*660: U+1E08*/
+    { { 0, 1610, 8, 1610, 8 } }, /*661: U+1E0A*/
+    { { 0, 0, 8, 0, 8 } }, /*662: U+1E0B*/
+    { { 0, 1612, 8, 1612, 8 } }, /*663: U+1E0C*/
+    { { 0, 1614, 8, 1614, 8 } }, /*664: U+1E0E*/
+    { { 0, 1616, 8, 1616, 8 } }, /*665: U+1E10*/
+    { { 0, 1618, 8, 1618, 8 } }, /*666: U+1E12*/
+    { { 0, 1620, 1620, 1620, 1620 } }, /*667: U+1E14*/
+    { { 0, 1622, 1622, 1622, 1622 } }, /*668: U+1E16*/
+    { { 0, 1624, 10, 1624, 10 } }, /*669: U+1E18*/
+    { { 0, 0, 10, 0, 10 } }, /*670: U+1E19*/
+    { { 0, 1626, 10, 1626, 10 } }, /*671: U+1E1A*/
+    { { 0, 1628, 1628, 1628, 1628 } }, /*672: U+1E1C*/
+    { { 0, 1630, 12, 1630, 12 } }, /*673: U+1E1E*/
+    { { 0, 0, 12, 0, 12 } }, /*674: U+1E1F*/
+    { { 0, 1632, 14, 1632, 14 } }, /*675: U+1E20*/
+    { { 0, 0, 14, 0, 14 } }, /*676: U+1E21*/
+    { { 0, 1634, 16, 1634, 16 } }, /*677: U+1E22*/
+    { { 0, 0, 16, 0, 16 } }, /*678: U+1E23*/
+    { { 0, 1636, 16, 1636, 16 } }, /*679: U+1E24*/
+    { { 0, 1638, 16, 1638, 16 } }, /*680: U+1E26*/
+    { { 0, 1640, 16, 1640, 16 } }, /*681: U+1E28*/
+    { { 0, 1642, 16, 1642, 16 } }, /*682: U+1E2A*/
+    { { 0, 1644, 18, 1644, 18 } }, /*683: U+1E2C*/
+    { { 0, 0, 18, 0, 18 } }, /*684: U+1E2D*/
+    { { 0, 1646, 1646, 1646, 1646 } }, /*685: U+1E2E*/
+    { { 0, 1648, 22, 1648, 22 } }, /*686: U+1E30*/
+    { { 0, 0, 22, 0, 22 } }, /*687: U+1E31*/
+    { { 0, 1650, 22, 1650, 22 } }, /*688: U+1E32*/
+    { { 0, 1652, 22, 1652, 22 } }, /*689: U+1E34*/
+    { { 0, 1654, 24, 1654, 24 } }, /*690: U+1E36*/
+    { { 0, 0, 24, 0, 24 } }, /*691: U+1E37*/
+    { { 0, 1656, 1656, 1656, 1656 } }, /*692: U+1E38*/
+    { { 0, 1658, 24, 1658, 24 } }, /*693: U+1E3A*/
+    { { 0, 1660, 24, 1660, 24 } }, /*694: U+1E3C*/
+    { { 0, 1662, 26, 1662, 26 } }, /*695: U+1E3E*/
+    { { 0, 0, 26, 0, 26 } }, /*696: U+1E3F*/
+    { { 0, 1664, 26, 1664, 26 } }, /*697: U+1E40*/
+    { { 0, 1666, 26, 1666, 26 } }, /*698: U+1E42*/
+    { { 0, 1668, 28, 1668, 28 } }, /*699: U+1E44*/
+    { { 0, 0, 28, 0, 28 } }, /*700: U+1E45*/
+    { { 0, 1670, 28, 1670, 28 } }, /*701: U+1E46*/
+    { { 0, 1672, 28, 1672, 28 } }, /*702: U+1E48*/
+    { { 0, 1674, 28, 1674, 28 } }, /*703: U+1E4A*/
+    { { 0, 1676, 1676, 1676, 1676 } }, /*704: U+1E4C*/
+    { { 0, 1678, 1678, 1678, 1678 } }, /*705: U+1E4E*/
+    { { 0, 1680, 1680, 1680, 1680 } }, /*706: U+1E50*/
+    { { 0, 1682, 1682, 1682, 1682 } }, /*707: U+1E52*/
+    { { 0, 1684, 32, 1684, 32 } }, /*708: U+1E54*/
+    { { 0, 0, 32, 0, 32 } }, /*709: U+1E55*/
+    { { 0, 1686, 32, 1686, 32 } }, /*710: U+1E56*/
+    { { 0, 1688, 36, 1688, 36 } }, /*711: U+1E58*/
+    { { 0, 0, 36, 0, 36 } }, /*712: U+1E59*/
+    { { 0, 1690, 36, 1690, 36 } }, /*713: U+1E5A*/
+    { { 0, 1692, 1692, 1692, 1692 } }, /*714: U+1E5C*/
+    { { 0, 1694, 36, 1694, 36 } }, /*715: U+1E5E*/
+    { { 0, 1696, 38, 1696, 38 } }, /*716: U+1E60*/
+    { { 0, 0, 38, 0, 38 } }, /*717: U+1E61*/
+    { { 0, 1698, 38, 1698, 38 } }, /*718: U+1E62*/
+    { { 0, 1700, 1700, 1700, 1700 } }, /*719: U+1E64*/
+    { { 0, 1702, 1702, 1702, 1702 } }, /*720: U+1E66*/
+    { { 0, 1704, 1704, 1704, 1704 } }, /*721: U+1E68*/
+    { { 0, 1706, 40, 1706, 40 } }, /*722: U+1E6A*/
+    { { 0, 0, 40, 0, 40 } }, /*723: U+1E6B*/
+    { { 0, 1708, 40, 1708, 40 } }, /*724: U+1E6C*/
+    { { 0, 1710, 40, 1710, 40 } }, /*725: U+1E6E*/
+    { { 0, 1712, 40, 1712, 40 } }, /*726: U+1E70*/
+    { { 0, 1714, 42, 1714, 42 } }, /*727: U+1E72*/
+    { { 0, 0, 42, 0, 42 } }, /*728: U+1E73*/
+    { { 0, 1716, 42, 1716, 42 } }, /*729: U+1E74*/
+    { { 0, 1718, 42, 1718, 42 } }, /*730: U+1E76*/
+    { { 0, 1720, 1720, 1720, 1720 } }, /*731: U+1E78*/
+    { { 0, 1722, 1722, 1722, 1722 } }, /*732: U+1E7A*/
+    { { 0, 1724, 44, 1724, 44 } }, /*733: U+1E7C*/
+    { { 0, 0, 44, 0, 44 } }, /*734: U+1E7D*/
+    { { 0, 1726, 44, 1726, 44 } }, /*735: U+1E7E*/
+    { { 0, 1728, 46, 1728, 46 } }, /*736: U+1E80*/
+    { { 0, 0, 46, 0, 46 } }, /*737: U+1E81*/
+    { { 0, 1730, 46, 1730, 46 } }, /*738: U+1E82*/
+    { { 0, 1732, 46, 1732, 46 } }, /*739: U+1E84*/
+    { { 0, 1734, 46, 1734, 46 } }, /*740: U+1E86*/
+    { { 0, 1736, 46, 1736, 46 } }, /*741: U+1E88*/
+    { { 0, 1738, 48, 1738, 48 } }, /*742: U+1E8A*/
+    { { 0, 0, 48, 0, 48 } }, /*743: U+1E8B*/
+    { { 0, 1740, 48, 1740, 48 } }, /*744: U+1E8C*/
+    { { 0, 1742, 50, 1742, 50 } }, /*745: U+1E8E*/
+    { { 0, 0, 50, 0, 50 } }, /*746: U+1E8F*/
+    { { 0, 1744, 52, 1744, 52 } }, /*747: U+1E90*/
+    { { 0, 0, 52, 0, 52 } }, /*748: U+1E91*/
+    { { 0, 1746, 52, 1746, 52 } }, /*749: U+1E92*/
+    { { 0, 1748, 52, 1748, 52 } }, /*750: U+1E94*/
+    { { 0, 1750, 1750, 1750, 1750 } }, /*751: U+1E9E*/
+    { { 0, 1752, 2, 1752, 2 } }, /*752: U+1EA0*/
+    { { 0, 1754, 2, 1754, 2 } }, /*753: U+1EA2*/
+    { { 0, 1756, 1756, 1756, 1756 } }, /*754: U+1EA4*/
+    { { 0, 1758, 1758, 1758, 1758 } }, /*755: U+1EA6*/
+    { { 0, 1760, 1760, 1760, 1760 } }, /*756: U+1EA8*/
+    { { 0, 1762, 1762, 1762, 1762 } }, /*757: U+1EAA*/
+    { { 0, 1764, 1764, 1764, 1764 } }, /*758: U+1EAC*/
+    { { 0, 1766, 1766, 1766, 1766 } }, /*759: U+1EAE*/
+    { { 0, 1768, 1768, 1768, 1768 } }, /*760: U+1EB0*/
+    { { 0, 1770, 1770, 1770, 1770 } }, /*761: U+1EB2*/
+    { { 0, 1772, 1772, 1772, 1772 } }, /*762: U+1EB4*/
+    { { 0, 1774, 1774, 1774, 1774 } }, /*763: U+1EB6*/
+    { { 0, 1776, 10, 1776, 10 } }, /*764: U+1EB8*/
+    { { 0, 1778, 10, 1778, 10 } }, /*765: U+1EBA*/
+    { { 0, 1780, 10, 1780, 10 } }, /*766: U+1EBC*/
+    { { 0, 1782, 1782, 1782, 1782 } }, /*767: U+1EBE*/
+    { { 0, 1784, 1784, 1784, 1784 } }, /*768: U+1EC0*/
+    { { 0, 1786, 1786, 1786, 1786 } }, /*769: U+1EC2*/
+    { { 0, 1788, 1788, 1788, 1788 } }, /*770: U+1EC4*/
+    { { 0, 1790, 1790, 1790, 1790 } }, /*771: U+1EC6*/
+    { { 0, 1792, 18, 1792, 18 } }, /*772: U+1EC8*/
+    { { 0, 1794, 18, 1794, 18 } }, /*773: U+1ECA*/
+    { { 0, 1796, 30, 1796, 30 } }, /*774: U+1ECC*/
+    { { 0, 0, 30, 0, 30 } }, /*775: U+1ECD*/
+    { { 0, 1798, 30, 1798, 30 } }, /*776: U+1ECE*/
+    { { 0, 1800, 1800, 1800, 1800 } }, /*777: U+1ED0*/
+    { { 0, 1802, 1802, 1802, 1802 } }, /*778: U+1ED2*/
+    { { 0, 1804, 1804, 1804, 1804 } }, /*779: U+1ED4*/
+    { { 0, 1806, 1806, 1806, 1806 } }, /*780: U+1ED6*/
+    { { 0, 1808, 1808, 1808, 1808 } }, /*781: U+1ED8*/
+    { { 0, 1810, 1810, 1810, 1810 } }, /*782: U+1EDA*/
+    { { 0, 1812, 1812, 1812, 1812 } }, /*783: U+1EDC*/
+    { { 0, 1814, 1814, 1814, 1814 } }, /*784: U+1EDE*/
+    { { 0, 1816, 1816, 1816, 1816 } }, /*785: U+1EE0*/
+    { { 0, 1818, 1818, 1818, 1818 } }, /*786: U+1EE2*/
+    { { 0, 1820, 42, 1820, 42 } }, /*787: U+1EE4*/
+    { { 0, 1822, 42, 1822, 42 } }, /*788: U+1EE6*/
+    { { 0, 1824, 1824, 1824, 1824 } }, /*789: U+1EE8*/
+    { { 0, 1826, 1826, 1826, 1826 } }, /*790: U+1EEA*/
+    { { 0, 1828, 1828, 1828, 1828 } }, /*791: U+1EEC*/
+    { { 0, 1830, 1830, 1830, 1830 } }, /*792: U+1EEE*/
+    { { 0, 1832, 1832, 1832, 1832 } }, /*793: U+1EF0*/
+    { { 0, 1834, 50, 1834, 50 } }, /*794: U+1EF2*/
+    { { 0, 1836, 50, 1836, 50 } }, /*795: U+1EF4*/
+    { { 0, 1838, 50, 1838, 50 } }, /*796: U+1EF6*/
+    { { 0, 1840, 50, 1840, 50 } }, /*797: U+1EF8*/
+    { { 0, 1842, 1842, 1842, 1842 } }, /*798: U+1EFA*/
+    { { 0, 1844, 1844, 1844, 1844 } }, /*799: U+1EFC*/
+    { { 0, 1846, 1846, 1846, 1846 } }, /*800: U+1EFE*/
+    { { 0, 1848, 1848, 1848, 1848 } }, /*801: U+1F08*/
+    { { 0, 1850, 1850, 1850, 1850 } }, /*802: U+1F09*/
+    { { 0, 1852, 1852, 1852, 1852 } }, /*803: U+1F0A*/
+    { { 0, 1854, 1854, 1854, 1854 } }, /*804: U+1F0B*/
+    { { 0, 1856, 1856, 1856, 1856 } }, /*805: U+1F0C*/
+    { { 0, 1858, 1858, 1858, 1858 } }, /*806: U+1F0D*/
+    { { 0, 1860, 1860, 1860, 1860 } }, /*807: U+1F0E*/
+    { { 0, 1862, 1862, 1862, 1862 } }, /*808: U+1F0F*/
+    { { 0, 1864, 1864, 1864, 1864 } }, /*809: U+1F18*/
+    { { 0, 1866, 1866, 1866, 1866 } }, /*810: U+1F19*/
+    { { 0, 1868, 1868, 1868, 1868 } }, /*811: U+1F1A*/
+    { { 0, 1870, 1870, 1870, 1870 } }, /*812: U+1F1B*/
+    { { 0, 1872, 1872, 1872, 1872 } }, /*813: U+1F1C*/
+    { { 0, 1874, 1874, 1874, 1874 } }, /*814: U+1F1D*/
+    { { 0, 1876, 1876, 1876, 1876 } }, /*815: U+1F28*/
+    { { 0, 1878, 1878, 1878, 1878 } }, /*816: U+1F29*/
+    { { 0, 1880, 1880, 1880, 1880 } }, /*817: U+1F2A*/
+    { { 0, 1882, 1882, 1882, 1882 } }, /*818: U+1F2B*/
+    { { 0, 1884, 1884, 1884, 1884 } }, /*819: U+1F2C*/
+    { { 0, 1886, 1886, 1886, 1886 } }, /*820: U+1F2D*/
+    { { 0, 1888, 1888, 1888, 1888 } }, /*821: U+1F2E*/
+    { { 0, 1890, 1890, 1890, 1890 } }, /*822: U+1F2F*/
+    { { 0, 1892, 1892, 1892, 1892 } }, /*823: U+1F38*/
+    { { 0, 1894, 1894, 1894, 1894 } }, /*824: U+1F39*/
+    { { 0, 1896, 1896, 1896, 1896 } }, /*825: U+1F3A*/
+    { { 0, 1898, 1898, 1898, 1898 } }, /*826: U+1F3B*/
+    { { 0, 1900, 1900, 1900, 1900 } }, /*827: U+1F3C*/
+    { { 0, 1902, 1902, 1902, 1902 } }, /*828: U+1F3D*/
+    { { 0, 1904, 1904, 1904, 1904 } }, /*829: U+1F3E*/
+    { { 0, 1906, 1906, 1906, 1906 } }, /*830: U+1F3F*/
+    { { 0, 1908, 1908, 1908, 1908 } }, /*831: U+1F48*/
+    { { 0, 1910, 1910, 1910, 1910 } }, /*832: U+1F49*/
+    { { 0, 1912, 1912, 1912, 1912 } }, /*833: U+1F4A*/
+    { { 0, 1914, 1914, 1914, 1914 } }, /*834: U+1F4B*/
+    { { 0, 1916, 1916, 1916, 1916 } }, /*835: U+1F4C*/
+    { { 0, 1918, 1918, 1918, 1918 } }, /*836: U+1F4D*/
+    { { 0, 1920, 1920, 1920, 1920 } }, /*837: U+1F59*/
+    { { 0, 1922, 1922, 1922, 1922 } }, /*838: U+1F5B*/
+    { { 0, 1924, 1924, 1924, 1924 } }, /*839: U+1F5D*/
+    { { 0, 1926, 1926, 1926, 1926 } }, /*840: U+1F5F*/
+    { { 0, 1928, 1928, 1928, 1928 } }, /*841: U+1F68*/
+    { { 0, 1930, 1930, 1930, 1930 } }, /*842: U+1F69*/
+    { { 0, 1932, 1932, 1932, 1932 } }, /*843: U+1F6A*/
+    { { 0, 1934, 1934, 1934, 1934 } }, /*844: U+1F6B*/
+    { { 0, 1936, 1936, 1936, 1936 } }, /*845: U+1F6C*/
+    { { 0, 1938, 1938, 1938, 1938 } }, /*846: U+1F6D*/
+    { { 0, 1940, 1940, 1940, 1940 } }, /*847: U+1F6E*/
+    { { 0, 1942, 1942, 1942, 1942 } }, /*848: U+1F6F*/
+    { { 0, 1944, 1944, 1944, 1944 } }, /*849: U+1F88*/
+    { { 0, 1946, 1946, 1946, 1946 } }, /*850: U+1F89*/
+    { { 0, 1948, 1948, 1948, 1948 } }, /*851: U+1F8A*/
+    { { 0, 1950, 1950, 1950, 1950 } }, /*852: U+1F8B*/
+    { { 0, 1952, 1952, 1952, 1952 } }, /*853: U+1F8C*/
+    { { 0, 1954, 1954, 1954, 1954 } }, /*854: U+1F8D*/
+    { { 0, 1956, 1956, 1956, 1956 } }, /*855: U+1F8E*/
+    { { 0, 1958, 1958, 1958, 1958 } }, /*856: U+1F8F*/
+    { { 0, 1960, 1960, 1960, 1960 } }, /*857: U+1F98*/
+    { { 0, 1962, 1962, 1962, 1962 } }, /*858: U+1F99*/
+    { { 0, 1964, 1964, 1964, 1964 } }, /*859: U+1F9A*/
+    { { 0, 1966, 1966, 1966, 1966 } }, /*860: U+1F9B*/
+    { { 0, 1968, 1968, 1968, 1968 } }, /*861: U+1F9C*/
+    { { 0, 1970, 1970, 1970, 1970 } }, /*862: U+1F9D*/
+    { { 0, 1972, 1972, 1972, 1972 } }, /*863: U+1F9E*/
+    { { 0, 1974, 1974, 1974, 1974 } }, /*864: U+1F9F*/
+    { { 0, 1976, 1976, 1976, 1976 } }, /*865: U+1FA8*/
+    { { 0, 1978, 1978, 1978, 1978 } }, /*866: U+1FA9*/
+    { { 0, 1980, 1980, 1980, 1980 } }, /*867: U+1FAA*/
+    { { 0, 1982, 1982, 1982, 1982 } }, /*868: U+1FAB*/
+    { { 0, 1984, 1984, 1984, 1984 } }, /*869: U+1FAC*/
+    { { 0, 1986, 1986, 1986, 1986 } }, /*870: U+1FAD*/
+    { { 0, 1988, 1988, 1988, 1988 } }, /*871: U+1FAE*/
+    { { 0, 1990, 1990, 1990, 1990 } }, /*872: U+1FAF*/
+    { { 0, 1992, 1992, 1992, 1992 } }, /*873: U+1FB8*/
+    { { 0, 1994, 1994, 1994, 1994 } }, /*874: U+1FB9*/
+    { { 0, 1996, 1996, 1996, 1996 } }, /*875: U+1FBA*/
+    { { 0, 1998, 1998, 1998, 1998 } }, /*876: U+1FBB*/
+    { { 0, 2000, 2000, 2000, 2000 } }, /*877: U+1FBC*/
+    { { 0, 2002, 2002, 2002, 2002 } }, /*878: U+1FC8*/
+    { { 0, 2004, 2004, 2004, 2004 } }, /*879: U+1FC9*/
+    { { 0, 2006, 2006, 2006, 2006 } }, /*880: U+1FCA*/
+    { { 0, 2008, 2008, 2008, 2008 } }, /*881: U+1FCB*/
+    { { 0, 2010, 2010, 2010, 2010 } }, /*882: U+1FCC*/
+    { { 0, 2012, 2012, 2012, 2012 } }, /*883: U+1FD8*/
+    { { 0, 2014, 2014, 2014, 2014 } }, /*884: U+1FD9*/
+    { { 0, 2016, 2016, 2016, 2016 } }, /*885: U+1FDA*/
+    { { 0, 2018, 2018, 2018, 2018 } }, /*886: U+1FDB*/
+    { { 0, 2020, 2020, 2020, 2020 } }, /*887: U+1FE8*/
+    { { 0, 2022, 2022, 2022, 2022 } }, /*888: U+1FE9*/
+    { { 0, 2024, 2024, 2024, 2024 } }, /*889: U+1FEA*/
+    { { 0, 2026, 2026, 2026, 2026 } }, /*890: U+1FEB*/
+    { { 0, 2028, 2028, 2028, 2028 } }, /*891: U+1FEC*/
+    { { 0, 2030, 2030, 2030, 2030 } }, /*892: U+1FF8*/
+    { { 0, 2032, 2032, 2032, 2032 } }, /*893: U+1FF9*/
+    { { 0, 2034, 2034, 2034, 2034 } }, /*894: U+1FFA*/
+    { { 0, 2036, 2036, 2036, 2036 } }, /*895: U+1FFB*/
+    { { 0, 2038, 2038, 2038, 2038 } }, /*896: U+1FFC*/
+    { { 0, 121, 2, 121, 2 } }, /*897: U+212B*/
+    { { 0, 2040, 2040, 2040, 2040 } }, /*898: U+2132*/
+    { { 0, 2042, 2042, 2042, 2042 } }, /*899: U+2160*/
+    { { 0, 2044, 2044, 2044, 2044 } }, /*900: U+2161*/
+    { { 0, 2046, 2046, 2046, 2046 } }, /*901: U+2162*/
+    { { 0, 2048, 2048, 2048, 2048 } }, /*902: U+2163*/
+    { { 0, 2050, 2050, 2050, 2050 } }, /*903: U+2164*/
+    { { 0, 2052, 2052, 2052, 2052 } }, /*904: U+2165*/
+    { { 0, 2054, 2054, 2054, 2054 } }, /*905: U+2166*/
+    { { 0, 2056, 2056, 2056, 2056 } }, /*906: U+2167*/
+    { { 0, 2058, 2058, 2058, 2058 } }, /*907: U+2168*/
+    { { 0, 2060, 2060, 2060, 2060 } }, /*908: U+2169*/
+    { { 0, 2062, 2062, 2062, 2062 } }, /*909: U+216A*/
+    { { 0, 2064, 2064, 2064, 2064 } }, /*910: U+216B*/
+    { { 0, 2066, 2066, 2066, 2066 } }, /*911: U+216C*/
+    { { 0, 2068, 2068, 2068, 2068 } }, /*912: U+216D*/
+    { { 0, 2070, 2070, 2070, 2070 } }, /*913: U+216E*/
+    { { 0, 2072, 2072, 2072, 2072 } }, /*914: U+216F*/
+    { { 0, 2074, 2074, 2074, 2074 } }, /*915: U+2183*/
+    { { 0, 2076, 2076, 2076, 2076 } }, /*916: U+24B6*/
+    { { 0, 2078, 2078, 2078, 2078 } }, /*917: U+24B7*/
+    { { 0, 2080, 2080, 2080, 2080 } }, /*918: U+24B8*/
+    { { 0, 2082, 2082, 2082, 2082 } }, /*919: U+24B9*/
+    { { 0, 2084, 2084, 2084, 2084 } }, /*920: U+24BA*/
+    { { 0, 2086, 2086, 2086, 2086 } }, /*921: U+24BB*/
+    { { 0, 2088, 2088, 2088, 2088 } }, /*922: U+24BC*/
+    { { 0, 2090, 2090, 2090, 2090 } }, /*923: U+24BD*/
+    { { 0, 2092, 2092, 2092, 2092 } }, /*924: U+24BE*/
+    { { 0, 2094, 2094, 2094, 2094 } }, /*925: U+24BF*/
+    { { 0, 2096, 2096, 2096, 2096 } }, /*926: U+24C0*/
+    { { 0, 2098, 2098, 2098, 2098 } }, /*927: U+24C1*/
+    { { 0, 2100, 2100, 2100, 2100 } }, /*928: U+24C2*/
+    { { 0, 2102, 2102, 2102, 2102 } }, /*929: U+24C3*/
+    { { 0, 2104, 2104, 2104, 2104 } }, /*930: U+24C4*/
+    { { 0, 2106, 2106, 2106, 2106 } }, /*931: U+24C5*/
+    { { 0, 2108, 2108, 2108, 2108 } }, /*932: U+24C6*/
+    { { 0, 2110, 2110, 2110, 2110 } }, /*933: U+24C7*/
+    { { 0, 2112, 2112, 2112, 2112 } }, /*934: U+24C8*/
+    { { 0, 2114, 2114, 2114, 2114 } }, /*935: U+24C9*/
+    { { 0, 2116, 2116, 2116, 2116 } }, /*936: U+24CA*/
+    { { 0, 2118, 2118, 2118, 2118 } }, /*937: U+24CB*/
+    { { 0, 2120, 2120, 2120, 2120 } }, /*938: U+24CC*/
+    { { 0, 2122, 2122, 2122, 2122 } }, /*939: U+24CD*/
+    { { 0, 2124, 2124, 2124, 2124 } }, /*940: U+24CE*/
+    { { 0, 2126, 2126, 2126, 2126 } }, /*941: U+24CF*/
+    { { 0, 2128, 2128, 2128, 2128 } }, /*942: U+2C00*/
+    { { 0, 2130, 2130, 2130, 2130 } }, /*943: U+2C01*/
+    { { 0, 2132, 2132, 2132, 2132 } }, /*944: U+2C02*/
+    { { 0, 2134, 2134, 2134, 2134 } }, /*945: U+2C03*/
+    { { 0, 2136, 2136, 2136, 2136 } }, /*946: U+2C04*/
+    { { 0, 2138, 2138, 2138, 2138 } }, /*947: U+2C05*/
+    { { 0, 2140, 2140, 2140, 2140 } }, /*948: U+2C06*/
+    { { 0, 2142, 2142, 2142, 2142 } }, /*949: U+2C07*/
+    { { 0, 2144, 2144, 2144, 2144 } }, /*950: U+2C08*/
+    { { 0, 2146, 2146, 2146, 2146 } }, /*951: U+2C09*/
+    { { 0, 2148, 2148, 2148, 2148 } }, /*952: U+2C0A*/
+    { { 0, 2150, 2150, 2150, 2150 } }, /*953: U+2C0B*/
+    { { 0, 2152, 2152, 2152, 2152 } }, /*954: U+2C0C*/
+    { { 0, 2154, 2154, 2154, 2154 } }, /*955: U+2C0D*/
+    { { 0, 2156, 2156, 2156, 2156 } }, /*956: U+2C0E*/
+    { { 0, 2158, 2158, 2158, 2158 } }, /*957: U+2C0F*/
+    { { 0, 2160, 2160, 2160, 2160 } }, /*958: U+2C10*/
+    { { 0, 2162, 2162, 2162, 2162 } }, /*959: U+2C11*/
+    { { 0, 2164, 2164, 2164, 2164 } }, /*960: U+2C12*/
+    { { 0, 2166, 2166, 2166, 2166 } }, /*961: U+2C13*/
+    { { 0, 2168, 2168, 2168, 2168 } }, /*962: U+2C14*/
+    { { 0, 2170, 2170, 2170, 2170 } }, /*963: U+2C15*/
+    { { 0, 2172, 2172, 2172, 2172 } }, /*964: U+2C16*/
+    { { 0, 2174, 2174, 2174, 2174 } }, /*965: U+2C17*/
+    { { 0, 2176, 2176, 2176, 2176 } }, /*966: U+2C18*/
+    { { 0, 2178, 2178, 2178, 2178 } }, /*967: U+2C19*/
+    { { 0, 2180, 2180, 2180, 2180 } }, /*968: U+2C1A*/
+    { { 0, 2182, 2182, 2182, 2182 } }, /*969: U+2C1B*/
+    { { 0, 2184, 2184, 2184, 2184 } }, /*970: U+2C1C*/
+    { { 0, 2186, 2186, 2186, 2186 } }, /*971: U+2C1D*/
+    { { 0, 2188, 2188, 2188, 2188 } }, /*972: U+2C1E*/
+    { { 0, 2190, 2190, 2190, 2190 } }, /*973: U+2C1F*/
+    { { 0, 2192, 2192, 2192, 2192 } }, /*974: U+2C20*/
+    { { 0, 2194, 2194, 2194, 2194 } }, /*975: U+2C21*/
+    { { 0, 2196, 2196, 2196, 2196 } }, /*976: U+2C22*/
+    { { 0, 2198, 2198, 2198, 2198 } }, /*977: U+2C23*/
+    { { 0, 2200, 2200, 2200, 2200 } }, /*978: U+2C24*/
+    { { 0, 2202, 2202, 2202, 2202 } }, /*979: U+2C25*/
+    { { 0, 2204, 2204, 2204, 2204 } }, /*980: U+2C26*/
+    { { 0, 2206, 2206, 2206, 2206 } }, /*981: U+2C27*/
+    { { 0, 2208, 2208, 2208, 2208 } }, /*982: U+2C28*/
+    { { 0, 2210, 2210, 2210, 2210 } }, /*983: U+2C29*/
+    { { 0, 2212, 2212, 2212, 2212 } }, /*984: U+2C2A*/
+    { { 0, 2214, 2214, 2214, 2214 } }, /*985: U+2C2B*/
+    { { 0, 2216, 2216, 2216, 2216 } }, /*986: U+2C2C*/
+    { { 0, 2218, 2218, 2218, 2218 } }, /*987: U+2C2D*/
+    { { 0, 2220, 2220, 2220, 2220 } }, /*988: U+2C2E*/
+    { { 0, 2222, 2222, 2222, 2222 } }, /*989: U+2C60*/
+    { { 0, 2224, 2224, 2224, 2224 } }, /*990: U+2C62*/
+    { { 0, 2226, 2226, 2226, 2226 } }, /*991: U+2C63*/
+    { { 0, 2228, 2228, 2228, 2228 } }, /*992: U+2C64*/
+    { { 0, 2230, 2230, 2230, 2230 } }, /*993: U+2C67*/
+    { { 0, 2232, 2232, 2232, 2232 } }, /*994: U+2C69*/
+    { { 0, 2234, 2234, 2234, 2234 } }, /*995: U+2C6B*/
+    { { 0, 2236, 2236, 2236, 2236 } }, /*996: U+2C6D*/
+    { { 0, 2238, 2238, 2238, 2238 } }, /*997: U+2C6E*/
+    { { 0, 2240, 2240, 2240, 2240 } }, /*998: U+2C6F*/
+    { { 0, 2242, 2242, 2242, 2242 } }, /*999: U+2C70*/
+    { { 0, 2244, 2244, 2244, 2244 } }, /*1000: U+2C72*/
+    { { 0, 2246, 2246, 2246, 2246 } }, /*1001: U+2C75*/
+    { { 0, 2248, 2248, 2248, 2248 } }, /*1002: U+2C7E*/
+    { { 0, 2250, 2250, 2250, 2250 } }, /*1003: U+2C7F*/
+    { { 0, 2252, 2252, 2252, 2252 } }, /*1004: U+2C80*/
+    { { 0, 2254, 2254, 2254, 2254 } }, /*1005: U+2C82*/
+    { { 0, 2256, 2256, 2256, 2256 } }, /*1006: U+2C84*/
+    { { 0, 2258, 2258, 2258, 2258 } }, /*1007: U+2C86*/
+    { { 0, 2260, 2260, 2260, 2260 } }, /*1008: U+2C88*/
+    { { 0, 2262, 2262, 2262, 2262 } }, /*1009: U+2C8A*/
+    { { 0, 2264, 2264, 2264, 2264 } }, /*1010: U+2C8C*/
+    { { 0, 2266, 2266, 2266, 2266 } }, /*1011: U+2C8E*/
+    { { 0, 2268, 2268, 2268, 2268 } }, /*1012: U+2C90*/
+    { { 0, 2270, 2270, 2270, 2270 } }, /*1013: U+2C92*/
+    { { 0, 2272, 2272, 2272, 2272 } }, /*1014: U+2C94*/
+    { { 0, 2274, 2274, 2274, 2274 } }, /*1015: U+2C96*/
+    { { 0, 2276, 2276, 2276, 2276 } }, /*1016: U+2C98*/
+    { { 0, 2278, 2278, 2278, 2278 } }, /*1017: U+2C9A*/
+    { { 0, 2280, 2280, 2280, 2280 } }, /*1018: U+2C9C*/
+    { { 0, 2282, 2282, 2282, 2282 } }, /*1019: U+2C9E*/
+    { { 0, 2284, 2284, 2284, 2284 } }, /*1020: U+2CA0*/
+    { { 0, 2286, 2286, 2286, 2286 } }, /*1021: U+2CA2*/
+    { { 0, 2288, 2288, 2288, 2288 } }, /*1022: U+2CA4*/
+    { { 0, 2290, 2290, 2290, 2290 } }, /*1023: U+2CA6*/
+    { { 0, 2292, 2292, 2292, 2292 } }, /*1024: U+2CA8*/
+    { { 0, 2294, 2294, 2294, 2294 } }, /*1025: U+2CAA*/
+    { { 0, 2296, 2296, 2296, 2296 } }, /*1026: U+2CAC*/
+    { { 0, 2298, 2298, 2298, 2298 } }, /*1027: U+2CAE*/
+    { { 0, 2300, 2300, 2300, 2300 } }, /*1028: U+2CB0*/
+    { { 0, 2302, 2302, 2302, 2302 } }, /*1029: U+2CB2*/
+    { { 0, 2304, 2304, 2304, 2304 } }, /*1030: U+2CB4*/
+    { { 0, 2306, 2306, 2306, 2306 } }, /*1031: U+2CB6*/
+    { { 0, 2308, 2308, 2308, 2308 } }, /*1032: U+2CB8*/
+    { { 0, 2310, 2310, 2310, 2310 } }, /*1033: U+2CBA*/
+    { { 0, 2312, 2312, 2312, 2312 } }, /*1034: U+2CBC*/
+    { { 0, 2314, 2314, 2314, 2314 } }, /*1035: U+2CBE*/
+    { { 0, 2316, 2316, 2316, 2316 } }, /*1036: U+2CC0*/
+    { { 0, 2318, 2318, 2318, 2318 } }, /*1037: U+2CC2*/
+    { { 0, 2320, 2320, 2320, 2320 } }, /*1038: U+2CC4*/
+    { { 0, 2322, 2322, 2322, 2322 } }, /*1039: U+2CC6*/
+    { { 0, 2324, 2324, 2324, 2324 } }, /*1040: U+2CC8*/
+    { { 0, 2326, 2326, 2326, 2326 } }, /*1041: U+2CCA*/
+    { { 0, 2328, 2328, 2328, 2328 } }, /*1042: U+2CCC*/
+    { { 0, 2330, 2330, 2330, 2330 } }, /*1043: U+2CCE*/
+    { { 0, 2332, 2332, 2332, 2332 } }, /*1044: U+2CD0*/
+    { { 0, 2334, 2334, 2334, 2334 } }, /*1045: U+2CD2*/
+    { { 0, 2336, 2336, 2336, 2336 } }, /*1046: U+2CD4*/
+    { { 0, 2338, 2338, 2338, 2338 } }, /*1047: U+2CD6*/
+    { { 0, 2340, 2340, 2340, 2340 } }, /*1048: U+2CD8*/
+    { { 0, 2342, 2342, 2342, 2342 } }, /*1049: U+2CDA*/
+    { { 0, 2344, 2344, 2344, 2344 } }, /*1050: U+2CDC*/
+    { { 0, 2346, 2346, 2346, 2346 } }, /*1051: U+2CDE*/
+    { { 0, 2348, 2348, 2348, 2348 } }, /*1052: U+2CE0*/
+    { { 0, 2350, 2350, 2350, 2350 } }, /*1053: U+2CE2*/
+    { { 0, 2352, 2352, 2352, 2352 } }, /*1054: U+2CEB*/
+    { { 0, 2354, 2354, 2354, 2354 } }, /*1055: U+2CED*/
+    { { 0, 2356, 2356, 2356, 2356 } }, /*1056: U+2CF2*/
+    { { 2358, 2358, 2358, 2358, 2358 } }, /*1057: U+3041*/
+    { { 2360, 2360, 2360, 2360, 2360 } }, /*1058: U+3043*/
+    { { 2362, 2362, 2362, 2362, 2362 } }, /*1059: U+3045*/
+    { { 2364, 2364, 2364, 2364, 2364 } }, /*1060: U+3047*/
+    { { 2366, 2366, 2366, 2366, 2366 } }, /*1061: U+3049*/
+    { { 2368, 2368, 2371, 2368, 2371 } }, /*1062: U+304C*/
+    { { 2373, 2373, 2376, 2373, 2376 } }, /*1063: U+304E*/
+    { { 2378, 2378, 2381, 2378, 2381 } }, /*1064: U+3050*/
+    { { 2383, 2383, 2386, 2383, 2386 } }, /*1065: U+3052*/
+    { { 2388, 2388, 2391, 2388, 2391 } }, /*1066: U+3054*/
+    { { 2393, 2393, 2396, 2393, 2396 } }, /*1067: U+3056*/
+    { { 2398, 2398, 2401, 2398, 2401 } }, /*1068: U+3058*/
+    { { 2403, 2403, 2406, 2403, 2406 } }, /*1069: U+305A*/
+    { { 2408, 2408, 2411, 2408, 2411 } }, /*1070: U+305C*/
+    { { 2413, 2413, 2416, 2413, 2416 } }, /*1071: U+305E*/
+    { { 2418, 2418, 2421, 2418, 2421 } }, /*1072: U+3060*/
+    { { 2423, 2423, 2426, 2423, 2426 } }, /*1073: U+3062*/
+    { { 2428, 2428, 2428, 2428, 2428 } }, /*1074: U+3063*/
+    { { 2430, 2430, 2428, 2430, 2428 } }, /*1075: U+3065*/
+    { { 2433, 2433, 2436, 2433, 2436 } }, /*1076: U+3067*/
+    { { 2438, 2438, 2441, 2438, 2441 } }, /*1077: U+3069*/
+    { { 2443, 2443, 2446, 2443, 2446 } }, /*1078: U+3070*/
+    { { 2448, 2448, 2446, 2448, 2446 } }, /*1079: U+3071*/
+    { { 2451, 2451, 2454, 2451, 2454 } }, /*1080: U+3073*/
+    { { 2456, 2456, 2454, 2456, 2454 } }, /*1081: U+3074*/
+    { { 2459, 2459, 2462, 2459, 2462 } }, /*1082: U+3076*/
+    { { 2464, 2464, 2462, 2464, 2462 } }, /*1083: U+3077*/
+    { { 2467, 2467, 2470, 2467, 2470 } }, /*1084: U+3079*/
+    { { 2472, 2472, 2470, 2472, 2470 } }, /*1085: U+307A*/
+    { { 2475, 2475, 2478, 2475, 2478 } }, /*1086: U+307C*/
+    { { 2480, 2480, 2478, 2480, 2478 } }, /*1087: U+307D*/
+    { { 2483, 2483, 2483, 2483, 2483 } }, /*1088: U+3083*/
+    { { 2485, 2485, 2485, 2485, 2485 } }, /*1089: U+3085*/
+    { { 2487, 2487, 2487, 2487, 2487 } }, /*1090: U+3087*/
+    { { 2489, 2489, 2489, 2489, 2489 } }, /*1091: U+308E*/
+    { { 2491, 2491, 2362, 2491, 2362 } }, /*1092: U+3094*/
+    { { 2371, 2371, 2371, 2371, 2371 } }, /*1093: U+3095*/
+    { { 2386, 2386, 2386, 2386, 2386 } }, /*1094: U+3096*/
+    { { 2494, 2494, 54, 2497, 1 } }, /*1095: U+309B*/
+    { { 2499, 2499, 54, 2502, 1 } }, /*1096: U+309C*/
+    { { 2504, 2504, 2507, 2504, 2507 } }, /*1097: U+309E*/
+    { { 2509, 2509, 2509, 2509, 2509 } }, /*1098: U+309F*/
+    { { 2376, 2376, 2376, 2376, 2376 } }, /*1099: U+30AD*/
+    { { 2381, 2381, 2381, 2381, 2381 } }, /*1100: U+30AF*/
+    { { 2391, 2391, 2391, 2391, 2391 } }, /*1101: U+30B3*/
+    { { 2396, 2396, 2396, 2396, 2396 } }, /*1102: U+30B5*/
+    { { 2401, 2401, 2401, 2401, 2401 } }, /*1103: U+30B7*/
+    { { 2406, 2406, 2406, 2406, 2406 } }, /*1104: U+30B9*/
+    { { 2411, 2411, 2411, 2411, 2411 } }, /*1105: U+30BB*/
+    { { 2416, 2416, 2416, 2416, 2416 } }, /*1106: U+30BD*/
+    { { 2421, 2421, 2421, 2421, 2421 } }, /*1107: U+30BF*/
+    { { 2426, 2426, 2426, 2426, 2426 } }, /*1108: U+30C1*/
+    { { 2436, 2436, 2436, 2436, 2436 } }, /*1109: U+30C6*/
+    { { 2441, 2441, 2441, 2441, 2441 } }, /*1110: U+30C8*/
+    { { 2512, 2512, 2512, 2512, 2512 } }, /*1111: U+30CA*/
+    { { 2514, 2514, 2514, 2514, 2514 } }, /*1112: U+30CB*/
+    { { 2516, 2516, 2516, 2516, 2516 } }, /*1113: U+30CC*/
+    { { 2518, 2518, 2518, 2518, 2518 } }, /*1114: U+30CD*/
+    { { 2520, 2520, 2520, 2520, 2520 } }, /*1115: U+30CE*/
+    { { 2446, 2446, 2446, 2446, 2446 } }, /*1116: U+30CF*/
+    { { 2454, 2454, 2454, 2454, 2454 } }, /*1117: U+30D2*/
+    { { 2462, 2462, 2462, 2462, 2462 } }, /*1118: U+30D5*/
+    { { 2470, 2470, 2470, 2470, 2470 } }, /*1119: U+30D8*/
+    { { 2478, 2478, 2478, 2478, 2478 } }, /*1120: U+30DB*/
+    { { 2522, 2522, 2522, 2522, 2522 } }, /*1121: U+30DE*/
+    { { 2524, 2524, 2524, 2524, 2524 } }, /*1122: U+30DF*/
+    { { 2526, 2526, 2526, 2526, 2526 } }, /*1123: U+30E0*/
+    { { 2528, 2528, 2528, 2528, 2528 } }, /*1124: U+30E1*/
+    { { 2530, 2530, 2530, 2530, 2530 } }, /*1125: U+30E2*/
+    { { 2532, 2532, 2532, 2532, 2532 } }, /*1126: U+30E9*/
+    { { 2534, 2534, 2534, 2534, 2534 } }, /*1127: U+30EA*/
+    { { 2536, 2536, 2536, 2536, 2536 } }, /*1128: U+30EB*/
+    { { 2538, 2538, 2538, 2538, 2538 } }, /*1129: U+30EC*/
+    { { 2540, 2540, 2540, 2540, 2540 } }, /*1130: U+30ED*/
+    { { 2542, 2542, 2542, 2542, 2542 } }, /*1131: U+30F0*/
+    { { 2544, 2544, 2544, 2544, 2544 } }, /*1132: U+30F1*/
+    { { 2546, 2546, 2546, 2546, 2546 } }, /*1133: U+30F2*/
+    { { 2548, 2548, 2548, 2548, 2548 } }, /*1134: U+30F3*/
+    { { 2550, 2550, 2553, 2555, 2489 } }, /*1135: U+30F7*/
+    { { 2558, 2558, 2561, 2563, 2542 } }, /*1136: U+30F8*/
+    { { 2566, 2566, 2569, 2571, 2544 } }, /*1137: U+30F9*/
+    { { 2574, 2574, 2577, 2579, 2546 } }, /*1138: U+30FA*/
+    { { 2507, 2507, 2507, 2507, 2507 } }, /*1139: U+30FD*/
+    { { 2582, 2582, 2582, 2585, 2585 } }, /*1140: U+30FF*/
+    { { 0, 2588, 2588, 2588, 2588 } }, /*1141: U+A640*/
+    { { 0, 2590, 2590, 2590, 2590 } }, /*1142: U+A642*/
+    { { 0, 2592, 2592, 2592, 2592 } }, /*1143: U+A644*/
+    { { 0, 2594, 2594, 2594, 2594 } }, /*1144: U+A646*/
+    { { 0, 2596, 2596, 2596, 2596 } }, /*1145: U+A648*/
+    { { 0, 2598, 2598, 2598, 2598 } }, /*1146: U+A64A*/
+    { { 0, 2600, 2600, 2600, 2600 } }, /*1147: U+A64C*/
+    { { 0, 2602, 2602, 2602, 2602 } }, /*1148: U+A64E*/
+    { { 0, 2604, 2604, 2604, 2604 } }, /*1149: U+A650*/
+    { { 0, 2606, 2606, 2606, 2606 } }, /*1150: U+A652*/
+    { { 0, 2608, 2608, 2608, 2608 } }, /*1151: U+A654*/
+    { { 0, 2610, 2610, 2610, 2610 } }, /*1152: U+A656*/
+    { { 0, 2612, 2612, 2612, 2612 } }, /*1153: U+A658*/
+    { { 0, 2614, 2614, 2614, 2614 } }, /*1154: U+A65A*/
+    { { 0, 2616, 2616, 2616, 2616 } }, /*1155: U+A65C*/
+    { { 0, 2618, 2618, 2618, 2618 } }, /*1156: U+A65E*/
+    { { 0, 2620, 2620, 2620, 2620 } }, /*1157: U+A660*/
+    { { 0, 2622, 2622, 2622, 2622 } }, /*1158: U+A662*/
+    { { 0, 2624, 2624, 2624, 2624 } }, /*1159: U+A664*/
+    { { 0, 2626, 2626, 2626, 2626 } }, /*1160: U+A666*/
+    { { 0, 2628, 2628, 2628, 2628 } }, /*1161: U+A668*/
+    { { 0, 2630, 2630, 2630, 2630 } }, /*1162: U+A66A*/
+    { { 0, 2632, 2632, 2632, 2632 } }, /*1163: U+A66C*/
+    { { 0, 2634, 2634, 2634, 2634 } }, /*1164: U+A680*/
+    { { 0, 2636, 2636, 2636, 2636 } }, /*1165: U+A682*/
+    { { 0, 2638, 2638, 2638, 2638 } }, /*1166: U+A684*/
+    { { 0, 2640, 2640, 2640, 2640 } }, /*1167: U+A686*/
+    { { 0, 2642, 2642, 2642, 2642 } }, /*1168: U+A688*/
+    { { 0, 2644, 2644, 2644, 2644 } }, /*1169: U+A68A*/
+    { { 0, 2646, 2646, 2646, 2646 } }, /*1170: U+A68C*/
+    { { 0, 2648, 2648, 2648, 2648 } }, /*1171: U+A68E*/
+    { { 0, 2650, 2650, 2650, 2650 } }, /*1172: U+A690*/
+    { { 0, 2652, 2652, 2652, 2652 } }, /*1173: U+A692*/
+    { { 0, 2654, 2654, 2654, 2654 } }, /*1174: U+A694*/
+    { { 0, 2656, 2656, 2656, 2656 } }, /*1175: U+A696*/
+    { { 0, 2658, 2658, 2658, 2658 } }, /*1176: U+A722*/
+    { { 0, 2660, 2660, 2660, 2660 } }, /*1177: U+A724*/
+    { { 0, 2662, 2662, 2662, 2662 } }, /*1178: U+A726*/
+    { { 0, 2664, 2664, 2664, 2664 } }, /*1179: U+A728*/
+    { { 0, 2666, 2666, 2666, 2666 } }, /*1180: U+A72A*/
+    { { 0, 2668, 2668, 2668, 2668 } }, /*1181: U+A72C*/
+    { { 0, 2670, 2670, 2670, 2670 } }, /*1182: U+A72E*/
+    { { 0, 2672, 2672, 2672, 2672 } }, /*1183: U+A732*/
+    { { 0, 2674, 2674, 2674, 2674 } }, /*1184: U+A734*/
+    { { 0, 2676, 2676, 2676, 2676 } }, /*1185: U+A736*/
+    { { 0, 2678, 2678, 2678, 2678 } }, /*1186: U+A738*/
+    { { 0, 2680, 2680, 2680, 2680 } }, /*1187: U+A73A*/
+    { { 0, 2682, 2682, 2682, 2682 } }, /*1188: U+A73C*/
+    { { 0, 2684, 2684, 2684, 2684 } }, /*1189: U+A73E*/
+    { { 0, 2686, 2686, 2686, 2686 } }, /*1190: U+A740*/
+    { { 0, 2688, 2688, 2688, 2688 } }, /*1191: U+A742*/
+    { { 0, 2690, 2690, 2690, 2690 } }, /*1192: U+A744*/
+    { { 0, 2692, 2692, 2692, 2692 } }, /*1193: U+A746*/
+    { { 0, 2694, 2694, 2694, 2694 } }, /*1194: U+A748*/
+    { { 0, 2696, 2696, 2696, 2696 } }, /*1195: U+A74A*/
+    { { 0, 2698, 2698, 2698, 2698 } }, /*1196: U+A74C*/
+    { { 0, 2700, 2700, 2700, 2700 } }, /*1197: U+A74E*/
+    { { 0, 2702, 2702, 2702, 2702 } }, /*1198: U+A750*/
+    { { 0, 2704, 2704, 2704, 2704 } }, /*1199: U+A752*/
+    { { 0, 2706, 2706, 2706, 2706 } }, /*1200: U+A754*/
+    { { 0, 2708, 2708, 2708, 2708 } }, /*1201: U+A756*/
+    { { 0, 2710, 2710, 2710, 2710 } }, /*1202: U+A758*/
+    { { 0, 2712, 2712, 2712, 2712 } }, /*1203: U+A75A*/
+    { { 0, 2714, 2714, 2714, 2714 } }, /*1204: U+A75C*/
+    { { 0, 2716, 2716, 2716, 2716 } }, /*1205: U+A75E*/
+    { { 0, 2718, 2718, 2718, 2718 } }, /*1206: U+A760*/
+    { { 0, 2720, 2720, 2720, 2720 } }, /*1207: U+A762*/
+    { { 0, 2722, 2722, 2722, 2722 } }, /*1208: U+A764*/
+    { { 0, 2724, 2724, 2724, 2724 } }, /*1209: U+A766*/
+    { { 0, 2726, 2726, 2726, 2726 } }, /*1210: U+A768*/
+    { { 0, 2728, 2728, 2728, 2728 } }, /*1211: U+A76A*/
+    { { 0, 2730, 2730, 2730, 2730 } }, /*1212: U+A76C*/
+    { { 0, 2732, 2732, 2732, 2732 } }, /*1213: U+A76E*/
+    { { 0, 2734, 2734, 2734, 2734 } }, /*1214: U+A779*/
+    { { 0, 2736, 2736, 2736, 2736 } }, /*1215: U+A77B*/
+    { { 0, 2738, 2738, 2738, 2738 } }, /*1216: U+A77D*/
+    { { 0, 2740, 2740, 2740, 2740 } }, /*1217: U+A77E*/
+    { { 0, 2742, 2742, 2742, 2742 } }, /*1218: U+A780*/
+    { { 0, 2744, 2744, 2744, 2744 } }, /*1219: U+A782*/
+    { { 0, 2746, 2746, 2746, 2746 } }, /*1220: U+A784*/
+    { { 0, 2748, 2748, 2748, 2748 } }, /*1221: U+A786*/
+    { { 0, 2750, 2750, 2750, 2750 } }, /*1222: U+A78B*/
+    { { 0, 2752, 2752, 2752, 2752 } }, /*1223: U+A78D*/
+    { { 0, 2754, 2754, 2754, 2754 } }, /*1224: U+A790*/
+    { { 0, 2756, 2756, 2756, 2756 } }, /*1225: U+A792*/
+    { { 0, 2758, 2758, 2758, 2758 } }, /*1226: U+A7A0*/
+    { { 0, 2760, 2760, 2760, 2760 } }, /*1227: U+A7A2*/
+    { { 0, 2762, 2762, 2762, 2762 } }, /*1228: U+A7A4*/
+    { { 0, 2764, 2764, 2764, 2764 } }, /*1229: U+A7A6*/
+    { { 0, 2766, 2766, 2766, 2766 } }, /*1230: U+A7A8*/
+    { { 0, 2768, 2768, 2768, 2768 } }, /*1231: U+A7AA*/
+    { { 2770, 2770, 2770, 2770, 2770 } }, /*1232: U+FF01*/
+    { { 2772, 2772, 2772, 2772, 2772 } }, /*1233: U+FF02*/
+    { { 2774, 2774, 2774, 2774, 2774 } }, /*1234: U+FF03*/
+    { { 2776, 2776, 2776, 2776, 2776 } }, /*1235: U+FF04*/
+    { { 2778, 2778, 2778, 2778, 2778 } }, /*1236: U+FF05*/
+    { { 2780, 2780, 2780, 2780, 2780 } }, /*1237: U+FF06*/
+    { { 2782, 2782, 2782, 2782, 2782 } }, /*1238: U+FF07*/
+    { { 2784, 2784, 2784, 2784, 2784 } }, /*1239: U+FF08*/
+    { { 2786, 2786, 2786, 2786, 2786 } }, /*1240: U+FF09*/
+    { { 2788, 2788, 2788, 2788, 2788 } }, /*1241: U+FF0A*/
+    { { 2790, 2790, 2790, 2790, 2790 } }, /*1242: U+FF0B*/
+    { { 2792, 2792, 2792, 2792, 2792 } }, /*1243: U+FF0C*/
+    { { 2794, 2794, 2794, 2794, 2794 } }, /*1244: U+FF0D*/
+    { { 2796, 2796, 2796, 2796, 2796 } }, /*1245: U+FF0E*/
+    { { 2798, 2798, 2798, 2798, 2798 } }, /*1246: U+FF0F*/
+    { { 2800, 2800, 2800, 2800, 2800 } }, /*1247: U+FF10*/
+    { { 2802, 2802, 2802, 2802, 2802 } }, /*1248: U+FF14*/
+    { { 2804, 2804, 2804, 2804, 2804 } }, /*1249: U+FF15*/
+    { { 2806, 2806, 2806, 2806, 2806 } }, /*1250: U+FF16*/
+    { { 2808, 2808, 2808, 2808, 2808 } }, /*1251: U+FF17*/
+    { { 2810, 2810, 2810, 2810, 2810 } }, /*1252: U+FF18*/
+    { { 2812, 2812, 2812, 2812, 2812 } }, /*1253: U+FF19*/
+    { { 2814, 2814, 2814, 2814, 2814 } }, /*1254: U+FF1A*/
+    { { 2816, 2816, 2816, 2816, 2816 } }, /*1255: U+FF1B*/
+    { { 2818, 2818, 2818, 2818, 2818 } }, /*1256: U+FF1C*/
+    { { 2820, 2820, 2820, 2820, 2820 } }, /*1257: U+FF1D*/
+    { { 2822, 2822, 2822, 2822, 2822 } }, /*1258: U+FF1E*/
+    { { 2824, 2824, 2824, 2824, 2824 } }, /*1259: U+FF1F*/
+    { { 2826, 2826, 2826, 2826, 2826 } }, /*1260: U+FF20*/
+    { { 2828, 2, 2, 2, 2 } }, /*1261: U+FF21*/
+    { { 2830, 4, 4, 4, 4 } }, /*1262: U+FF22*/
+    { { 2832, 6, 6, 6, 6 } }, /*1263: U+FF23*/
+    { { 2834, 8, 8, 8, 8 } }, /*1264: U+FF24*/
+    { { 2836, 10, 10, 10, 10 } }, /*1265: U+FF25*/
+    { { 2838, 12, 12, 12, 12 } }, /*1266: U+FF26*/
+    { { 2840, 14, 14, 14, 14 } }, /*1267: U+FF27*/
+    { { 2842, 16, 16, 16, 16 } }, /*1268: U+FF28*/
+    { { 2844, 18, 18, 18, 18 } }, /*1269: U+FF29*/
+    { { 2846, 20, 20, 20, 20 } }, /*1270: U+FF2A*/
+    { { 2848, 22, 22, 22, 22 } }, /*1271: U+FF2B*/
+    { { 2850, 24, 24, 24, 24 } }, /*1272: U+FF2C*/
+    { { 2852, 26, 26, 26, 26 } }, /*1273: U+FF2D*/
+    { { 2854, 28, 28, 28, 28 } }, /*1274: U+FF2E*/
+    { { 2856, 30, 30, 30, 30 } }, /*1275: U+FF2F*/
+    { { 2858, 32, 32, 32, 32 } }, /*1276: U+FF30*/
+    { { 2860, 34, 34, 34, 34 } }, /*1277: U+FF31*/
+    { { 2862, 36, 36, 36, 36 } }, /*1278: U+FF32*/
+    { { 2864, 38, 38, 38, 38 } }, /*1279: U+FF33*/
+    { { 2866, 40, 40, 40, 40 } }, /*1280: U+FF34*/
+    { { 2868, 42, 42, 42, 42 } }, /*1281: U+FF35*/
+    { { 2870, 44, 44, 44, 44 } }, /*1282: U+FF36*/
+    { { 2872, 46, 46, 46, 46 } }, /*1283: U+FF37*/
+    { { 2874, 48, 48, 48, 48 } }, /*1284: U+FF38*/
+    { { 2876, 50, 50, 50, 50 } }, /*1285: U+FF39*/
+    { { 2878, 52, 52, 52, 52 } }, /*1286: U+FF3A*/
+    { { 2880, 2880, 2880, 2880, 2880 } }, /*1287: U+FF3B*/
+    { { 2882, 2882, 2882, 2882, 2882 } }, /*1288: U+FF3C*/
+    { { 2884, 2884, 2884, 2884, 2884 } }, /*1289: U+FF3D*/
+    { { 2886, 2886, 2886, 2886, 2886 } }, /*1290: U+FF3E*/
+    { { 2888, 2888, 2888, 2888, 2888 } }, /*1291: U+FF3F*/
+    { { 2890, 2890, 2890, 2890, 2890 } }, /*1292: U+FF40*/
+    { { 4, 4, 4, 4, 4 } }, /*1293: U+FF42*/
+    { { 6, 6, 6, 6, 6 } }, /*1294: U+FF43*/
+    { { 8, 8, 8, 8, 8 } }, /*1295: U+FF44*/
+    { { 10, 10, 10, 10, 10 } }, /*1296: U+FF45*/
+    { { 12, 12, 12, 12, 12 } }, /*1297: U+FF46*/
+    { { 14, 14, 14, 14, 14 } }, /*1298: U+FF47*/
+    { { 16, 16, 16, 16, 16 } }, /*1299: U+FF48*/
+    { { 18, 18, 18, 18, 18 } }, /*1300: U+FF49*/
+    { { 20, 20, 20, 20, 20 } }, /*1301: U+FF4A*/
+    { { 22, 22, 22, 22, 22 } }, /*1302: U+FF4B*/
+    { { 24, 24, 24, 24, 24 } }, /*1303: U+FF4C*/
+    { { 26, 26, 26, 26, 26 } }, /*1304: U+FF4D*/
+    { { 28, 28, 28, 28, 28 } }, /*1305: U+FF4E*/
+    { { 32, 32, 32, 32, 32 } }, /*1306: U+FF50*/
+    { { 34, 34, 34, 34, 34 } }, /*1307: U+FF51*/
+    { { 36, 36, 36, 36, 36 } }, /*1308: U+FF52*/
+    { { 40, 40, 40, 40, 40 } }, /*1309: U+FF54*/
+    { { 42, 42, 42, 42, 42 } }, /*1310: U+FF55*/
+    { { 44, 44, 44, 44, 44 } }, /*1311: U+FF56*/
+    { { 46, 46, 46, 46, 46 } }, /*1312: U+FF57*/
+    { { 48, 48, 48, 48, 48 } }, /*1313: U+FF58*/
+    { { 50, 50, 50, 50, 50 } }, /*1314: U+FF59*/
+    { { 52, 52, 52, 52, 52 } }, /*1315: U+FF5A*/
+    { { 2892, 2892, 2892, 2892, 2892 } }, /*1316: U+FF5B*/
+    { { 2894, 2894, 2894, 2894, 2894 } }, /*1317: U+FF5C*/
+    { { 2896, 2896, 2896, 2896, 2896 } }, /*1318: U+FF5D*/
+    { { 2898, 2898, 2898, 2898, 2898 } }, /*1319: U+FF5E*/
+    { { 2900, 2900, 2900, 2900, 2900 } }, /*1320: U+FF65*/
+    { { 2902, 2902, 2902, 2902, 2902 } }, /*1321: U+FF70*/
+    { { 2497, 2497, 1, 2497, 1 } }, /*1322: U+FF9E*/
+    { { 2502, 2502, 1, 2502, 1 } }, /*1323: U+FF9F*/
+    { { 0, 2904, 2904, 2904, 2904 } }, /*1324: U+10400*/
+    { { 0, 2906, 2906, 2906, 2906 } }, /*1325: U+10401*/
+    { { 0, 2908, 2908, 2908, 2908 } }, /*1326: U+10402*/
+    { { 0, 2910, 2910, 2910, 2910 } }, /*1327: U+10403*/
+    { { 0, 2912, 2912, 2912, 2912 } }, /*1328: U+10404*/
+    { { 0, 2914, 2914, 2914, 2914 } }, /*1329: U+10405*/
+    { { 0, 2916, 2916, 2916, 2916 } }, /*1330: U+10406*/
+    { { 0, 2918, 2918, 2918, 2918 } }, /*1331: U+10407*/
+    { { 0, 2920, 2920, 2920, 2920 } }, /*1332: U+10408*/
+    { { 0, 2922, 2922, 2922, 2922 } }, /*1333: U+10409*/
+    { { 0, 2924, 2924, 2924, 2924 } }, /*1334: U+1040A*/
+    { { 0, 2926, 2926, 2926, 2926 } }, /*1335: U+1040B*/
+    { { 0, 2928, 2928, 2928, 2928 } }, /*1336: U+1040C*/
+    { { 0, 2930, 2930, 2930, 2930 } }, /*1337: U+1040D*/
+    { { 0, 2932, 2932, 2932, 2932 } }, /*1338: U+1040E*/
+    { { 0, 2934, 2934, 2934, 2934 } }, /*1339: U+1040F*/
+    { { 0, 2936, 2936, 2936, 2936 } }, /*1340: U+10410*/
+    { { 0, 2938, 2938, 2938, 2938 } }, /*1341: U+10411*/
+    { { 0, 2940, 2940, 2940, 2940 } }, /*1342: U+10412*/
+    { { 0, 2942, 2942, 2942, 2942 } }, /*1343: U+10413*/
+    { { 0, 2944, 2944, 2944, 2944 } }, /*1344: U+10414*/
+    { { 0, 2946, 2946, 2946, 2946 } }, /*1345: U+10415*/
+    { { 0, 2948, 2948, 2948, 2948 } }, /*1346: U+10416*/
+    { { 0, 2950, 2950, 2950, 2950 } }, /*1347: U+10417*/
+    { { 0, 2952, 2952, 2952, 2952 } }, /*1348: U+10418*/
+    { { 0, 2954, 2954, 2954, 2954 } }, /*1349: U+10419*/
+    { { 0, 2956, 2956, 2956, 2956 } }, /*1350: U+1041A*/
+    { { 0, 2958, 2958, 2958, 2958 } }, /*1351: U+1041B*/
+    { { 0, 2960, 2960, 2960, 2960 } }, /*1352: U+1041C*/
+    { { 0, 2962, 2962, 2962, 2962 } }, /*1353: U+1041D*/
+    { { 0, 2964, 2964, 2964, 2964 } }, /*1354: U+1041E*/
+    { { 0, 2966, 2966, 2966, 2966 } }, /*1355: U+1041F*/
+    { { 0, 2968, 2968, 2968, 2968 } }, /*1356: U+10420*/
+    { { 0, 2970, 2970, 2970, 2970 } }, /*1357: U+10421*/
+    { { 0, 2972, 2972, 2972, 2972 } }, /*1358: U+10422*/
+    { { 0, 2974, 2974, 2974, 2974 } }, /*1359: U+10423*/
+    { { 0, 2976, 2976, 2976, 2976 } }, /*1360: U+10424*/
+    { { 0, 2978, 2978, 2978, 2978 } }, /*1361: U+10425*/
+    { { 0, 2980, 2980, 2980, 2980 } }, /*1362: U+10426*/
+    { { 0, 2982, 2982, 2982, 2982 } }, /*1363: U+10427*/
+};
+
+const unsigned short UnicharNormalizationBlocks[][UNICHAR_NORMALIZATION_BLOCK_SIZE] =
+{
+    { /*0: U+0000*/
+        1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+        17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    { /*1: U+0080*/
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        28, 0, 0, 0, 0, 0, 0, 0, 29, 0, 30, 0, 0, 0, 0, 31,
+        0, 0, 32, 33, 34, 35, 0, 0, 36, 37, 38, 0, 39, 40, 41, 0,
+        42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+        58, 59, 60, 61, 62, 63, 64, 0, 65, 66, 67, 68, 69, 70, 71, 0,
+        72, 73, 74, 75, 76, 77, 0, 78, 79, 80, 81, 82, 83, 84, 85, 86,
+        0, 87, 88, 89, 90, 91, 92, 0, 0, 93, 94, 95, 96, 97, 0, 98,
+    },
+    { /*2: U+0100*/
+        99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114,
+        115, 0, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129,
+        130, 131, 132, 133, 134, 135, 136, 0, 137, 138, 139, 140, 141, 142, 143, 144,
+        145, 0, 146, 147, 148, 149, 150, 151, 0, 152, 153, 154, 155, 156, 157, 158,
+        159, 160, 0, 161, 162, 163, 164, 165, 166, 167, 168, 0, 169, 170, 171, 172,
+        173, 174, 175, 0, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187,
+        188, 189, 190, 191, 192, 193, 194, 0, 195, 196, 197, 198, 199, 200, 201, 202,
+        203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218,
+    },
+    { /*3: U+0180*/
+        0, 219, 220, 0, 221, 0, 222, 223, 0, 224, 225, 226, 0, 0, 227, 228,
+        229, 230, 0, 231, 232, 0, 233, 234, 235, 0, 0, 0, 236, 237, 0, 238,
+        239, 240, 241, 0, 242, 0, 243, 244, 0, 245, 0, 0, 246, 0, 247, 248,
+        249, 250, 251, 252, 0, 253, 0, 254, 255, 0, 0, 0, 256, 0, 0, 0,
+        0, 0, 0, 0, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268,
+        269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 0, 282, 283,
+        284, 285, 286, 287, 288, 0, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298,
+        299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314,
+    },
+    { /*4: U+0200*/
+        315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330,
+        331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 0, 344, 345,
+        346, 0, 347, 0, 348, 0, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358,
+        359, 360, 361, 362, 0, 0, 0, 0, 0, 0, 363, 364, 0, 365, 366, 0,
+        0, 367, 0, 368, 369, 370, 371, 0, 372, 0, 373, 0, 374, 0, 375, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    { /*5: U+0280*/
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    { /*6: U+0300*/
+        376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376,
+        376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376,
+        376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376,
+        376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376,
+        376, 376, 376, 376, 376, 377, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376,
+        376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376,
+        376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376,
+        378, 0, 379, 0, 0, 0, 380, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    { /*7: U+0380*/
+        0, 0, 0, 0, 0, 0, 381, 0, 382, 383, 384, 0, 385, 0, 386, 387,
+        0, 388, 389, 390, 391, 392, 393, 394, 395, 377, 396, 397, 398, 399, 400, 401,
+        402, 403, 0, 404, 405, 406, 407, 408, 409, 410, 411, 412, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 404, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 413,
+        389, 395, 0, 0, 0, 407, 402, 0, 414, 0, 415, 0, 416, 0, 417, 0,
+        418, 0, 419, 0, 420, 0, 421, 0, 422, 0, 423, 0, 424, 0, 425, 0,
+        396, 403, 0, 0, 395, 392, 0, 426, 0, 427, 428, 0, 0, 429, 430, 431,
+    },
+    { /*8: U+0400*/
+        432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447,
+        448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463,
+        464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        480, 0, 481, 0, 482, 0, 483, 0, 484, 0, 485, 0, 486, 0, 487, 0,
+        488, 0, 489, 0, 490, 0, 491, 0, 492, 0, 493, 0, 494, 0, 495, 0,
+    },
+    { /*9: U+0480*/
+        496, 0, 0, 0, 0, 0, 0, 0, 0, 0, 497, 0, 498, 0, 499, 0,
+        500, 0, 501, 0, 502, 0, 503, 0, 504, 0, 505, 0, 506, 0, 507, 0,
+        508, 0, 509, 0, 510, 0, 511, 0, 512, 0, 513, 0, 514, 0, 515, 0,
+        516, 0, 517, 0, 518, 0, 519, 0, 520, 0, 521, 0, 522, 0, 523, 0,
+        524, 525, 0, 526, 0, 527, 0, 528, 0, 529, 0, 530, 0, 531, 0, 0,
+        532, 0, 533, 0, 534, 0, 535, 0, 536, 0, 537, 0, 538, 0, 539, 0,
+        540, 0, 541, 0, 542, 0, 543, 0, 544, 0, 545, 0, 546, 0, 547, 0,
+        548, 0, 549, 0, 550, 0, 551, 0, 552, 0, 553, 0, 554, 0, 555, 0,
+    },
+    { /*10: U+0500*/
+        556, 0, 557, 0, 558, 0, 559, 0, 560, 0, 561, 0, 562, 0, 563, 0,
+        564, 0, 565, 0, 566, 0, 567, 0, 568, 0, 569, 0, 570, 0, 571, 0,
+        572, 0, 573, 0, 574, 0, 575, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590,
+        591, 592, 593, 594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606,
+        607, 608, 609, 610, 611, 612, 613, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    { /*11: U+1080*/
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625, 626, 627, 628, 629,
+        630, 631, 632, 633, 634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644, 645,
+        646, 647, 648, 649, 650, 651, 0, 652, 0, 0, 0, 0, 0, 653, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    { /*12: U+1D80*/
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376,
+        376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376,
+        376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376,
+        376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376,
+    },
+    { /*13: U+1E00*/
+        654, 655, 656, 657, 658, 657, 659, 657, 660, 0, 661, 662, 663, 662, 664, 662,
+        665, 662, 666, 662, 667, 0, 668, 0, 669, 670, 671, 670, 672, 0, 673, 674,
+        675, 676, 677, 678, 679, 678, 680, 678, 681, 678, 682, 678, 683, 684, 685, 0,
+        686, 687, 688, 687, 689, 687, 690, 691, 692, 0, 693, 691, 694, 691, 695, 696,
+        697, 696, 698, 696, 699, 700, 701, 700, 702, 700, 703, 700, 704, 0, 705, 0,
+        706, 0, 707, 0, 708, 709, 710, 709, 711, 712, 713, 712, 714, 0, 715, 712,
+        716, 717, 718, 717, 719, 0, 720, 0, 721, 0, 722, 723, 724, 723, 725, 723,
+        726, 723, 727, 728, 729, 728, 730, 728, 731, 0, 732, 0, 733, 734, 735, 734,
+    },
+    { /*14: U+1E80*/
+        736, 737, 738, 737, 739, 737, 740, 737, 741, 737, 742, 743, 744, 743, 745, 746,
+        747, 748, 749, 748, 750, 748, 678, 723, 737, 746, 0, 716, 0, 0, 751, 0,
+        752, 655, 753, 655, 754, 0, 755, 0, 756, 0, 757, 0, 758, 0, 759, 0,
+        760, 0, 761, 0, 762, 0, 763, 0, 764, 670, 765, 670, 766, 670, 767, 0,
+        768, 0, 769, 0, 770, 0, 771, 0, 772, 684, 773, 684, 774, 775, 776, 775,
+        777, 0, 778, 0, 779, 0, 780, 0, 781, 0, 782, 0, 783, 0, 784, 0,
+        785, 0, 786, 0, 787, 728, 788, 728, 789, 0, 790, 0, 791, 0, 792, 0,
+        793, 0, 794, 746, 795, 746, 796, 746, 797, 746, 798, 0, 799, 0, 800, 0,
+    },
+    { /*15: U+1F00*/
+        0, 0, 0, 0, 0, 0, 0, 0, 801, 802, 803, 804, 805, 806, 807, 808,
+        0, 0, 0, 0, 0, 0, 0, 0, 809, 810, 811, 812, 813, 814, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 815, 816, 817, 818, 819, 820, 821, 822,
+        0, 0, 0, 0, 0, 0, 0, 0, 823, 824, 825, 826, 827, 828, 829, 830,
+        0, 0, 0, 0, 0, 0, 0, 0, 831, 832, 833, 834, 835, 836, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 837, 0, 838, 0, 839, 0, 840,
+        0, 0, 0, 0, 0, 0, 0, 0, 841, 842, 843, 844, 845, 846, 847, 848,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    { /*16: U+1F80*/
+        0, 0, 0, 0, 0, 0, 0, 0, 849, 850, 851, 852, 853, 854, 855, 856,
+        0, 0, 0, 0, 0, 0, 0, 0, 857, 858, 859, 860, 861, 862, 863, 864,
+        0, 0, 0, 0, 0, 0, 0, 0, 865, 866, 867, 868, 869, 870, 871, 872,
+        0, 0, 0, 0, 0, 0, 0, 0, 873, 874, 875, 876, 877, 0, 377, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 878, 879, 880, 881, 882, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 883, 884, 885, 886, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 887, 888, 889, 890, 891, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 892, 893, 894, 895, 896, 0, 0, 0,
+    },
+    { /*17: U+2080*/
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376,
+        376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376,
+        376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376,
+    },
+    { /*18: U+2100*/
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 410, 0, 0, 0, 12, 897, 0, 0, 0, 0,
+        0, 0, 898, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        899, 900, 901, 902, 903, 904, 905, 906, 907, 908, 909, 910, 911, 912, 913, 914,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    { /*19: U+2180*/
+        0, 0, 0, 915, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    { /*20: U+2480*/
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 916, 917, 918, 919, 920, 921, 922, 923, 924, 925,
+        926, 927, 928, 929, 930, 931, 932, 933, 934, 935, 936, 937, 938, 939, 940, 941,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    { /*21: U+2C00*/
+        942, 943, 944, 945, 946, 947, 948, 949, 950, 951, 952, 953, 954, 955, 956, 957,
+        958, 959, 960, 961, 962, 963, 964, 965, 966, 967, 968, 969, 970, 971, 972, 973,
+        974, 975, 976, 977, 978, 979, 980, 981, 982, 983, 984, 985, 986, 987, 988, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        989, 0, 990, 991, 992, 0, 0, 993, 0, 994, 0, 995, 0, 996, 997, 998,
+        999, 0, 1000, 0, 0, 1001, 0, 0, 0, 0, 0, 0, 0, 0, 1002, 1003,
+    },
+    { /*22: U+2C80*/
+        1004, 0, 1005, 0, 1006, 0, 1007, 0, 1008, 0, 1009, 0, 1010, 0, 1011, 0,
+        1012, 0, 1013, 0, 1014, 0, 1015, 0, 1016, 0, 1017, 0, 1018, 0, 1019, 0,
+        1020, 0, 1021, 0, 1022, 0, 1023, 0, 1024, 0, 1025, 0, 1026, 0, 1027, 0,
+        1028, 0, 1029, 0, 1030, 0, 1031, 0, 1032, 0, 1033, 0, 1034, 0, 1035, 0,
+        1036, 0, 1037, 0, 1038, 0, 1039, 0, 1040, 0, 1041, 0, 1042, 0, 1043, 0,
+        1044, 0, 1045, 0, 1046, 0, 1047, 0, 1048, 0, 1049, 0, 1050, 0, 1051, 0,
+        1052, 0, 1053, 0, 0, 0, 0, 0, 0, 0, 0, 1054, 0, 1055, 0, 0,
+        0, 0, 1056, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    { /*23: U+3000*/
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1057, 0, 1058, 0, 1059, 0, 1060, 0, 1061, 0, 0, 1062, 0, 1063, 0,
+        1064, 0, 1065, 0, 1066, 0, 1067, 0, 1068, 0, 1069, 0, 1070, 0, 1071, 0,
+        1072, 0, 1073, 1074, 0, 1075, 0, 1076, 0, 1077, 0, 0, 0, 0, 0, 0,
+        1078, 1079, 0, 1080, 1081, 0, 1082, 1083, 0, 1084, 1085, 0, 1086, 1087, 0, 0,
+    },
+    { /*24: U+3080*/
+        0, 0, 0, 1088, 0, 1089, 0, 1090, 0, 0, 0, 0, 0, 0, 1091, 0,
+        0, 0, 0, 0, 1092, 1093, 1094, 0, 0, 376, 376, 1095, 1096, 0, 1097, 1098,
+        0, 1057, 1057, 1058, 1058, 1059, 1059, 1060, 1060, 1061, 1061, 1093, 1062, 1099, 1063, 1100,
+        1064, 1094, 1065, 1101, 1066, 1102, 1067, 1103, 1068, 1104, 1069, 1105, 1070, 1106, 1071, 1107,
+        1072, 1108, 1073, 1074, 1074, 1075, 1109, 1076, 1110, 1077, 1111, 1112, 1113, 1114, 1115, 1116,
+        1078, 1079, 1117, 1080, 1081, 1118, 1082, 1083, 1119, 1084, 1085, 1120, 1086, 1087, 1121, 1122,
+        1123, 1124, 1125, 1088, 1088, 1089, 1089, 1090, 1090, 1126, 1127, 1128, 1129, 1130, 1091, 1091,
+        1131, 1132, 1133, 1134, 1092, 1093, 1094, 1135, 1136, 1137, 1138, 0, 0, 1139, 1097, 1140,
+    },
+    { /*25: U+3180*/
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1100, 1103, 1104, 1110, 1113, 1116, 1117, 1118, 1119, 1120, 1123, 1126, 1127, 1128, 1129, 1130,
+    },
+    { /*26: U+3280*/
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1057, 1058, 1059, 1060, 1061, 1093, 1099, 1100, 1094, 1101, 1102, 1103, 1104, 1105, 1106, 1107,
+        1108, 1074, 1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117, 1118, 1119, 1120, 1121, 1122,
+        1123, 1124, 1125, 1088, 1089, 1090, 1126, 1127, 1128, 1129, 1130, 1091, 1131, 1132, 1133, 0,
+    },
+    { /*27: U+A600*/
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1141, 0, 1142, 0, 1143, 0, 1144, 0, 1145, 0, 1146, 0, 1147, 0, 1148, 0,
+        1149, 0, 1150, 0, 1151, 0, 1152, 0, 1153, 0, 1154, 0, 1155, 0, 1156, 0,
+        1157, 0, 1158, 0, 1159, 0, 1160, 0, 1161, 0, 1162, 0, 1163, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    { /*28: U+A680*/
+        1164, 0, 1165, 0, 1166, 0, 1167, 0, 1168, 0, 1169, 0, 1170, 0, 1171, 0,
+        1172, 0, 1173, 0, 1174, 0, 1175, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    { /*29: U+A700*/
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1176, 0, 1177, 0, 1178, 0, 1179, 0, 1180, 0, 1181, 0, 1182, 0,
+        0, 0, 1183, 0, 1184, 0, 1185, 0, 1186, 0, 1187, 0, 1188, 0, 1189, 0,
+        1190, 0, 1191, 0, 1192, 0, 1193, 0, 1194, 0, 1195, 0, 1196, 0, 1197, 0,
+        1198, 0, 1199, 0, 1200, 0, 1201, 0, 1202, 0, 1203, 0, 1204, 0, 1205, 0,
+        1206, 0, 1207, 0, 1208, 0, 1209, 0, 1210, 0, 1211, 0, 1212, 0, 1213, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 1214, 0, 1215, 0, 1216, 1217, 0,
+    },
+    { /*30: U+A780*/
+        1218, 0, 1219, 0, 1220, 0, 1221, 0, 0, 0, 0, 1222, 0, 1223, 0, 0,
+        1224, 0, 1225, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1226, 0, 1227, 0, 1228, 0, 1229, 0, 1230, 0, 1231, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    { /*31: U+FE00*/
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    { /*32: U+FF00*/
+        0, 1232, 1233, 1234, 1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244, 1245, 1246,
+        1247, 37, 32, 33, 1248, 1249, 1250, 1251, 1252, 1253, 1254, 1255, 1256, 1257, 1258, 1259,
+        1260, 1261, 1262, 1263, 1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275,
+        1276, 1277, 1278, 1279, 1280, 1281, 1282, 1283, 1284, 1285, 1286, 1287, 1288, 1289, 1290, 1291,
+        1292, 30, 1293, 1294, 1295, 1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305, 38,
+        1306, 1307, 1308, 218, 1309, 1310, 1311, 1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 0,
+        0, 0, 0, 0, 0, 1320, 1133, 1057, 1058, 1059, 1060, 1061, 1088, 1089, 1090, 1074,
+        1321, 1057, 1058, 1059, 1060, 1061, 1093, 1099, 1100, 1094, 1101, 1102, 1103, 1104, 1105, 1106,
+    },
+    { /*33: U+FF80*/
+        1107, 1108, 1074, 1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117, 1118, 1119, 1120, 1121,
+        1122, 1123, 1124, 1125, 1088, 1089, 1090, 1126, 1127, 1128, 1129, 1130, 1091, 1134, 1322, 1323,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    { /*34: U+10400*/
+        1324, 1325, 1326, 1327, 1328, 1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339,
+        1340, 1341, 1342, 1343, 1344, 1345, 1346, 1347, 1348, 1349, 1350, 1351, 1352, 1353, 1354, 1355,
+        1356, 1357, 1358, 1359, 1360, 1361, 1362, 1363, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+};
+
+const unsigned char UnicharNormalizationIndex[UNICHAR_NORMALIZATION_LIMIT >> UNICHAR_NORMALIZATION_BLOCK_SHIFT] =
+{
+    /*U+0000*/ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 5, 5, 5, 5, 5,
+    /*U+0800*/ 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    /*U+1000*/ 5, 11, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    /*U+1800*/ 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 12, 13, 14, 15, 16,
+    /*U+2000*/ 5, 17, 18, 19, 5, 5, 5, 5, 5, 20, 5, 5, 5, 5, 5, 5,
+    /*U+2800*/ 5, 5, 5, 5, 5, 5, 5, 5, 21, 22, 5, 5, 5, 5, 5, 5,
+    /*U+3000*/ 23, 24, 5, 25, 5, 26, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    /*U+3800*/ 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    /*U+4000*/ 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    /*U+4800*/ 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    /*U+5000*/ 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    /*U+5800*/ 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    /*U+6000*/ 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    /*U+6800*/ 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    /*U+7000*/ 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    /*U+7800*/ 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    /*U+8000*/ 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    /*U+8800*/ 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    /*U+9000*/ 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    /*U+9800*/ 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    /*U+A000*/ 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 27, 28, 29, 30,
+    /*U+A800*/ 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    /*U+B000*/ 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    /*U+B800*/ 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    /*U+C000*/ 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    /*U+C800*/ 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    /*U+D000*/ 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    /*U+D800*/ 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    /*U+E000*/ 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    /*U+E800*/ 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    /*U+F000*/ 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    /*U+F800*/ 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 31, 5, 32, 33,
+    /*U+10000*/ 5, 5, 5, 5, 5, 5, 5, 5, 34,
+};
@@ -0,0 +1,55 @@
+#ifndef UNICHAR_NORMALIZATION_DATA_H
+#define UNICHAR_NORMALIZATION_DATA_H
+
+#include "unichar.h"
+#include "nds_extension_macros.h"
+
+/** Number of normalization forms described by the table, see UnicharNormalizationForm. */
+#define UNICHAR_NORMALIZATION_FORM_COUNT 5
+
+/** log2 of the number of characters described by one block. */
+#define UNICHAR_NORMALIZATION_BLOCK_SHIFT 7
+
+/** Number of characters described by one block. */
+#define UNICHAR_NORMALIZATION_BLOCK_SIZE (1 << UNICHAR_NORMALIZATION_BLOCK_SHIFT)
+
+/** All characters from this one on are not changed by any of the normalization forms. */
+#define UNICHAR_NORMALIZATION_LIMIT 0x10480
+
+/**
+ * Normalizations of a character.
+ */
+typedef struct
+{
+    /**
+     * Offset of the normalized sequence in UnicharNormalizationSequences for each form,
+     * 0 if the form doesn't change the character.
+     */
+    unsigned short sequence[UNICHAR_NORMALIZATION_FORM_COUNT];
+} UnicharNormalizationEntry;
+
+NDS_EXTENSION_BEGIN_DECLS
+
+/**
+ * Normalized sequences. Each consists of its length followed by the characters.
+ */
+extern const unichar UnicharNormalizationSequences[];
+
+/**
+ * Distinct normalizations; the entry 0 leaves the character unchanged in all forms.
+ */
+extern const UnicharNormalizationEntry UnicharNormalizationEntries[];
+
+/**
+ * Distinct blocks of indices into UnicharNormalizationEntries.
+ */
+extern const unsigned short UnicharNormalizationBlocks[][UNICHAR_NORMALIZATION_BLOCK_SIZE];
+
+/**
+ * Index of the block in UnicharNormalizationBlocks for each block of characters.
+ */
+extern const unsigned char UnicharNormalizationIndex[UNICHAR_NORMALIZATION_LIMIT >> UNICHAR_NORMALIZATION_BLOCK_SHIFT];
+
+NDS_EXTENSION_END_DECLS
+
+#endif /* UNICHAR_NORMALIZATION_DATA_H */
@@ -4,6 +4,7 @@
 #include "nds_bool.h"
 #include "unichar_utils.h"
 #include "unichar_decomposition_data.h"
+#include "unichar_normalization_data.h"
 
 nds_bool UnicharIsCombiningMark(unichar character)
 {
@@ -59,3 +60,24 @@ nds_bool UnicharDecompose(unichar character, unichar const** decomposed, unsigne
 
     return NDS_FALSE;
 }
+
+nds_bool UnicharNormalize(unichar character, UnicharNormalizationForm form,
+        unichar const** normalized, unsigned* normalizedLen)
+{
+    unsigned entry;
+    unsigned offset;
+
+    assert((unsigned)form < UNICHAR_NORMALIZATION_FORM_COUNT);
+    if (character >= UNICHAR_NORMALIZATION_LIMIT)
+        return NDS_FALSE;
+
+    entry = UnicharNormalizationBlocks[UnicharNormalizationIndex[character >> UNICHAR_NORMALIZATION_BLOCK_SHIFT]]
+            [character & (UNICHAR_NORMALIZATION_BLOCK_SIZE - 1)];
+    offset = UnicharNormalizationEntries[entry].sequence[form];
+    if (offset == 0)
+        return NDS_FALSE;
+
+    *normalizedLen = (unsigned)UnicharNormalizationSequences[offset];
+    *normalized = &UnicharNormalizationSequences[offset + 1];
+    return NDS_TRUE;
+}
@@ -5,6 +5,33 @@
 #include "unichar.h"
 #include "nds_extension_macros.h"
 
+/**
+ * Normalization forms provided by UnicharNormalize().
+ */
+typedef enum
+{
+    /** Decomposition only, as done by UnicharDecompose(). */
+    UnicharNormDecompose = 0,
+
+    /** Case folding followed by decomposition (ndsunicode61 tokenizer, remove_diacritics=0). */
+    UnicharNormFold = 1,
+
+    /**
+     * Case folding with diacritics removed, decomposition, and removal of combining marks
+     * (ndsunicode61 tokenizer, remove_diacritics=1).
+     */
+    UnicharNormFoldRemoveDiacritics = 2,
+
+    /**
+     * UnicharNormFold with kana folding: katakana becomes hiragana and the non-combining voiced
+     * sound marks become combining ones (ndsunicode61 tokenizer, kana_fold=1).
+     */
+    UnicharNormFoldKana = 3,
+
+    /** UnicharNormFoldRemoveDiacritics with kana folding (ndsunicode61 tokenizer, kana_fold=1). */
+    UnicharNormFoldRemoveDiacriticsKana = 4
+} UnicharNormalizationForm;
+
 NDS_EXTENSION_BEGIN_DECLS
 
 /**
@@ -28,6 +55,22 @@ nds_bool UnicharIsCombiningMark(unichar character);
  */
 nds_bool UnicharDecompose(unichar character, unichar const** decomposed, unsigned* decompositionLen);
 
+/**
+ * Normalize a unicode character using a precomputed table.
+ *
+ * This is a single table lookup, regardless of the form.
+ *
+ * \param[in] character      Unicode character to be normalized.
+ * \param[in] form           Normalization form to apply.
+ * \param[out] normalized    Address of a pointer that receives the normalized sequence.
+ * \param[out] normalizedLen Address of a variable that receives the number of elements present
+ *                           in the normalized sequence (0 if the character is to be dropped).
+ *
+ * \return True if the form changes the character. False if the character stays as it is.
+ */
+nds_bool UnicharNormalize(unichar character, UnicharNormalizationForm form,
+        unichar const** normalized, unsigned* normalizedLen);
+
 NDS_EXTENSION_END_DECLS
 
 #endif /* UNICHAR_UTILS_H */
@@ -59,10 +59,25 @@
 ** also able to do encryption/decryption using Rijndael AES encryption
 ** algorithm. This encryption is only included if this file is compiled with
 ** the NDS_ENABLE_AES macro defined.
+**
+** Any of the compression methods above may also be combined with a CRC32C
+** checksum of each stored page record, by appending "+crc" to the name
+** of the method (for example "zv=zlib+crc").  The checksums allow all
+** records of a downloaded database to be verified quickly, without a
+** password and without decompressing anything.  See the section on page
+** checksums and nds_compression_verify() below.
 */
 #include "nds_sqlite3.h"
 #include <string.h>
+#include <stdlib.h>
 #include <assert.h>
+#if SQLITE_THREADSAFE
+# if defined(_WIN32)
+#  include <windows.h>
+# else
+#  include <pthread.h>
+# endif
+#endif
 #ifdef NDS_ENABLE_ZLIB
 # include <zlib.h>
 #endif
@@ -77,6 +92,12 @@
 # include "rijndael.h"
 #endif
 
+/*
+** Maximum length of the algorithm name stored in bytes 3 through 16 of
+** the database header by ZIPVFS.
+*/
+#define NDS_ZIPVFS_MAX_NAME  13
+
 /*
 ** Forward declarations of structures
 */
@@ -113,6 +134,9 @@ typedef struct ZipvfsAlgorithm ZipvfsAlgorithm;
 ** The pCtx pointer is a copy of the original context pointer that was 
 ** passed in as the 3rd parameter to zipvfs_create_vfs_v3().  For the
 ** NDSeV DevKit, this is currently always a NULL pointer.
+**
+** If page checksums are in use, zHdr holds the algorithm name with the
+** "+crc" suffix, as written into the database header.
 */
 struct ZipvfsInst {
   void *pCtx;                     /* Context ptr to zipvfs_create_vfs_v3() */
@@ -121,6 +145,7 @@ struct ZipvfsInst {
   struct DecoderInst *pDecode;    /* Info used by decompression */
   const ZipvfsAlgorithm *pAlg;    /* Corresponding algorithm object */
   int iLevel;                     /* Compression level */
+  char zHdr[NDS_ZIPVFS_MAX_NAME+1]; /* Header name if checksums are used */
 };
 
 /*
@@ -696,6 +721,226 @@ static int bsrUncompress(
 /* End BSR compression routines
 ******************************************************************************/
 
+/******************************************************************************
+** Page checksums.
+**
+** If the name of the compression method in the database header carries the
+** "+crc" suffix, then a 4-byte big-endian CRC32C (Castagnoli) checksum is
+** appended to every page record after compression and encryption.  The
+** checksum is verified, and then removed, before the record is passed on
+** to the decryption and decompression routines.  A new database is created
+** with checksums either by using the suffix directly ("zv=lz4+crc") or by
+** adding the "crc=1" query parameter ("zv=lz4&crc=1").
+**
+** The checksum covers the record exactly as it is stored in the file.  This
+** allows nds_compression_verify() to check all records of a database with
+** several threads, straight from the file, without decompressing them and
+** without knowing the password of an encrypted database.
+**
+** On x86 and x86-64 CPUs that support SSE4.2 the CRC32 instruction is used
+** to compute the checksum.  Otherwise a portable slicing-by-8 table driven
+** implementation is used.
+*/
+#define NDS_CRC_SUFFIX      "+crc"
+#define NDS_CRC_SUFFIX_LEN  4
+#define NDS_CRC_SIZE        4
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) \
+ && (__GNUC__>4 || (__GNUC__==4 && __GNUC_MINOR__>=9) || defined(__clang__))
+# include <nmmintrin.h>
+# define NDS_CRC32C_HW 1
+# define NDS_CRC32C_TARGET __attribute__((target("sse4.2")))
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+# include <intrin.h>
+# define NDS_CRC32C_HW 1
+# define NDS_CRC32C_TARGET
+#endif
+
+/*
+** Lookup tables for the slicing-by-8 implementation and a flag that is set
+** once the tables have been filled in and the CPU has been examined.
+*/
+static unsigned int aCrc32c[8][256];
+static int crc32cHw = 0;
+static volatile int crc32cInitDone = 0;
+
+/*
+** Compute the tables used by crc32cSoft() and check whether or not the
+** CPU supports the SSE4.2 CRC32 instruction.  This routine must be called
+** at least once before nds_crc32c() is used.
+*/
+static void crc32cInit(void){
+  sqlite3_mutex *pMutex;
+  if( crc32cInitDone ) return;
+  pMutex = sqlite3_mutex_alloc(SQLITE_MUTEX_STATIC_MASTER);
+  sqlite3_mutex_enter(pMutex);
+  if( !crc32cInitDone ){
+    unsigned int i, j;
+    for(i=0; i<256; i++){
+      unsigned int c = i;
+      for(j=0; j<8; j++){
+        c = (c & 1) ? (c>>1) ^ 0x82f63b78 : (c>>1);
+      }
+      aCrc32c[0][i] = c;
+    }
+    for(i=0; i<256; i++){
+      for(j=1; j<8; j++){
+        unsigned int c = aCrc32c[j-1][i];
+        aCrc32c[j][i] = (c>>8) ^ aCrc32c[0][c & 0xff];
+      }
+    }
+#if defined(NDS_CRC32C_HW) && defined(__GNUC__)
+    crc32cHw = __builtin_cpu_supports("sse4.2");
+#elif defined(NDS_CRC32C_HW)
+    {
+      int aInfo[4];
+      __cpuid(aInfo, 1);
+      crc32cHw = (aInfo[2] & (1<<20))!=0;
+    }
+#endif
+    crc32cInitDone = 1;
+  }
+  sqlite3_mutex_leave(pMutex);
+}
+
+/*
+** Portable slicing-by-8 CRC32C.  Eight input bytes are consumed per step
+** using eight table lookups.
+*/
+static unsigned int crc32cSoft(
+  unsigned int c,
+  const unsigned char *a,
+  int n
+){
+  while( n>0 && ((size_t)a & 7)!=0 ){
+    c = (c>>8) ^ aCrc32c[0][(c ^ *a++) & 0xff];
+    n--;
+  }
+  while( n>=8 ){
+    unsigned int lo = c ^ ((unsigned int)a[0] | ((unsigned int)a[1]<<8)
+                        | ((unsigned int)a[2]<<16) | ((unsigned int)a[3]<<24));
+    c = aCrc32c[7][lo & 0xff] ^ aCrc32c[6][(lo>>8) & 0xff]
+      ^ aCrc32c[5][(lo>>16) & 0xff] ^ aCrc32c[4][lo>>24]
+      ^ aCrc32c[3][a[4]] ^ aCrc32c[2][a[5]]
+      ^ aCrc32c[1][a[6]] ^ aCrc32c[0][a[7]];
+    a += 8;
+    n -= 8;
+  }
+  while( n>0 ){
+    c = (c>>8) ^ aCrc32c[0][(c ^ *a++) & 0xff];
+    n--;
+  }
+  return c;
+}
+
+#ifdef NDS_CRC32C_HW
+/*
+** CRC32C using the SSE4.2 CRC32 instruction.  Only called if crc32cInit()
+** found that the CPU supports it.
+*/
+static NDS_CRC32C_TARGET unsigned int crc32cSse42(
+  unsigned int c,
+  const unsigned char *a,
+  int n
+){
+  while( n>0 && ((size_t)a & 7)!=0 ){
+    c = _mm_crc32_u8(c, *a++);
+    n--;
+  }
+#if defined(__x86_64__) || defined(_M_X64)
+  while( n>=8 ){
+    unsigned long long x;
+    memcpy(&x, a, 8);
+    c = (unsigned int)_mm_crc32_u64(c, x);
+    a += 8;
+    n -= 8;
+  }
+#endif
+  while( n>=4 ){
+    unsigned int x;
+    memcpy(&x, a, 4);
+    c = _mm_crc32_u32(c, x);
+    a += 4;
+    n -= 4;
+  }
+  while( n>0 ){
+    c = _mm_crc32_u8(c, *a++);
+    n--;
+  }
+  return c;
+}
+#endif
+
+/*
+** Return the CRC32C checksum of the n bytes in buffer a.
+*/
+static unsigned int nds_crc32c(const unsigned char *a, int n){
+  assert( crc32cInitDone );
+#ifdef NDS_CRC32C_HW
+  if( crc32cHw ) return ~crc32cSse42(0xffffffff, a, n);
+#endif
+  return ~crc32cSoft(0xffffffff, a, n);
+}
+
+/*
+** The following three routines wrap the xBound, xCompr and xDecmpr methods
+** of the underlying algorithm for databases that use page checksums.
+*/
+static int crcBound(void *pLocalCtx, int nByte){
+  ZipvfsInst *p = (ZipvfsInst*)pLocalCtx;
+  return p->pAlg->xBound(pLocalCtx, nByte) + NDS_CRC_SIZE;
+}
+
+static int crcCompress(
+  void *pLocalCtx,
+  char *aDest, int *pnDest,
+  const char *aSrc, int nSrc
+){
+  ZipvfsInst *p = (ZipvfsInst*)pLocalCtx;
+  int nDest = *pnDest - NDS_CRC_SIZE;
+  int rc;
+
+  rc = p->pAlg->xCompr(pLocalCtx, aDest, &nDest, aSrc, nSrc);
+  if( rc==SQLITE_OK ){
+    unsigned int iCrc = nds_crc32c((const unsigned char*)aDest, nDest);
+    aDest[nDest]   = (char)((iCrc>>24) & 0xff);
+    aDest[nDest+1] = (char)((iCrc>>16) & 0xff);
+    aDest[nDest+2] = (char)((iCrc>>8) & 0xff);
+    aDest[nDest+3] = (char)(iCrc & 0xff);
+    *pnDest = nDest + NDS_CRC_SIZE;
+  }
+  return rc;
+}
+
+/*
+** Report a page record that fails its checksum.  ZIPVFS turns any error
+** from xUncompress into its own corruption code, SQLITE_IOERR_ZIPVFS07, so
+** the cause is also written to the log as SQLITE_CORRUPT.
+*/
+static int crcCorrupt(void){
+  sqlite3_log(SQLITE_CORRUPT, "zipvfs page record fails its checksum");
+  return SQLITE_CORRUPT;
+}
+
+static int crcUncompress(
+  void *pLocalCtx,
+  char *aDest, int *pnDest,
+  const char *aSrc, int nSrc
+){
+  ZipvfsInst *p = (ZipvfsInst*)pLocalCtx;
+  const unsigned char *a = (const unsigned char*)aSrc;
+  unsigned int iCrc;
+
+  if( nSrc<NDS_CRC_SIZE ) return crcCorrupt();
+  nSrc -= NDS_CRC_SIZE;
+  iCrc = ((unsigned int)a[nSrc]<<24) | ((unsigned int)a[nSrc+1]<<16)
+       | ((unsigned int)a[nSrc+2]<<8) | (unsigned int)a[nSrc+3];
+  if( iCrc!=nds_crc32c(a, nSrc) ) return crcCorrupt();
+  return p->pAlg->xDecmpr(pLocalCtx, aDest, pnDest, aSrc, nSrc);
+}
+/* End page checksums
+******************************************************************************/
+
 /*
 ** The following is the array of available compression and encryption 
 ** algorithms.  To add new compression or encryption algorithms, make
@@ -837,6 +1082,11 @@ static int nds_compression_algorithm_close(void *pLocalCtx){
 ** file.  If the database was opened as URI, then sqlite3_uri_parameter()
 ** can be used with the zFile parameter to extract query parameters from
 ** the URI.
+**
+** A "+crc" suffix on the algorithm name, or a "crc=1" query parameter when
+** a new database is created, enables the page checksums described above.
+** SQLITE_ERROR is returned if the suffixed name does not fit into the
+** database header.
 */
 int nds_compression_algorithm_detector(
   void *pCtx,              /* Copy of pCtx from zipvfs_create_vfs_v3() */
@@ -844,21 +1094,39 @@ int nds_compression_algorithm_detector(
   const char *zHeader,     /* Algorithm name in the database header */
   ZipvfsMethods *pMethods  /* OUT: Write new pCtx and function pointers here */
 ){
+  int bCrc = 0;            /* True if page checksums are used */
+  int nHeader = 0;         /* Length of zHeader without the "+crc" suffix */
+
   /* If zHeader==0 that means we have a new database file.
   ** Look to the zv query parameter (if there is one) as a
   ** substitute for the database header.
   */
   if( zHeader==0 ){
     const char *zZv = sqlite3_uri_parameter(zFile, "zv");
-    if( zZv ) zHeader = zZv;
+    if( zZv ){
+      zHeader = zZv;
+      bCrc = sqlite3_uri_boolean(zFile, "crc", 0);
+    }
+  }
+
+  if( zHeader ){
+    nHeader = (int)strlen(zHeader);
+    if( nHeader>NDS_CRC_SUFFIX_LEN
+     && strcmp(&zHeader[nHeader-NDS_CRC_SUFFIX_LEN], NDS_CRC_SUFFIX)==0
+    ){
+      bCrc = 1;
+      nHeader -= NDS_CRC_SUFFIX_LEN;
+    }
   }
 
   /* Look for a compression algorithm that matches zHeader.
   */
-  if( zHeader ){
+  if( zHeader && nHeader<(int)sizeof(aZipvfs[0].zName) ){
     int i;
     for(i=0; i<(int)(sizeof(aZipvfs)/sizeof(aZipvfs[0])); i++){
-      if( strcmp(aZipvfs[i].zName, zHeader)==0 ){
+      if( strncmp(aZipvfs[i].zName, zHeader, nHeader)==0
+       && aZipvfs[i].zName[nHeader]==0
+      ){
         ZipvfsInst *pInst = sqlite3_malloc( sizeof(*pInst) );
         int rc = SQLITE_OK;
         if( pInst==0 ) return SQLITE_NOMEM;
@@ -866,10 +1134,29 @@ int nds_compression_algorithm_detector(
         pInst->pCtx = pCtx;
         pInst->pAlg = &aZipvfs[i];
         pInst->iLevel = (int)sqlite3_uri_int64(zFile, "level", -1);
-        pMethods->zHdr = aZipvfs[i].zName;
-        pMethods->xCompressBound = aZipvfs[i].xBound;
-        pMethods->xCompress = aZipvfs[i].xCompr;
-        pMethods->xUncompress = aZipvfs[i].xDecmpr;
+        if( bCrc ){
+          /* The "+crc" suffixed name must fit into the database header.
+          ** Fail rather than create a database without checksums.  */
+          if( strlen(aZipvfs[i].zName)+NDS_CRC_SUFFIX_LEN
+                >NDS_ZIPVFS_MAX_NAME
+          ){
+            sqlite3_free(pInst);
+            memset(pMethods, 0, sizeof(*pMethods));
+            return SQLITE_ERROR;
+          }
+          crc32cInit();
+          sqlite3_snprintf(sizeof(pInst->zHdr), pInst->zHdr, "%s%s",
+                           aZipvfs[i].zName, NDS_CRC_SUFFIX);
+          pMethods->zHdr = pInst->zHdr;
+          pMethods->xCompressBound = crcBound;
+          pMethods->xCompress = crcCompress;
+          pMethods->xUncompress = crcUncompress;
+        }else{
+          pMethods->zHdr = aZipvfs[i].zName;
+          pMethods->xCompressBound = aZipvfs[i].xBound;
+          pMethods->xCompress = aZipvfs[i].xCompr;
+          pMethods->xUncompress = aZipvfs[i].xDecmpr;
+        }
         pMethods->xCompressClose = nds_compression_algorithm_close;
         pMethods->pCtx = pInst;
         if( aZipvfs[i].xCryptoSetup ){
@@ -898,3 +1185,447 @@ int nds_compression_algorithm_detector(
   memset(pMethods, 0, sizeof(*pMethods));
   return SQLITE_OK;
 }
+
+/******************************************************************************
+** Verification of page checksums.
+**
+** nds_compression_verify() checks the CRC32C checksum of every page record
+** of a database that was created with page checksums.  The offsets and
+** sizes of all records are first obtained from ZIPVFS, while holding a read
+** transaction so that the database cannot change underneath.  The records
+** are then sorted by offset, split into up to nThread contiguous ranges and
+** each range is checked by its own thread.  Each thread opens its own
+** handle on the database file using the VFS below ZIPVFS and reads it in
+** large sequential windows, so that almost all of the work is sequential
+** I/O and checksumming.
+*/
+
+/* Size of the buffer used by each thread to read the database file */
+#define NDS_VERIFY_BUFFER   (1024*1024)
+
+/* Size of the slot header that precedes each record in a ZIPVFS file */
+#define NDS_VERIFY_SLOT_HDR 6
+
+/* Byte offsets of fields in the ZIPVFS file header */
+#define NDS_VERIFY_HDR_SIZE 200
+#define NDS_VERIFY_OFF_SIZE 140
+#define NDS_VERIFY_OFF_PGSZ 172
+#define NDS_VERIFY_OFF_VERS 176
+
+/* The locking page of the underlying file. Matches PENDING_BYTE */
+#define NDS_VERIFY_PENDING  ((sqlite3_int64)0x40000000)
+
+/* Largest single xRead() request. The unix VFS of this devkit rejects
+** reads of more than 0x1ffff bytes. */
+#define NDS_VERIFY_READ_MAX 65536
+
+/* The extended error code (SQLITE_IOERR_ZIPVFS07) returned by ZIPVFS when
+** a page record cannot be decoded, for example because of a bad checksum */
+#define NDS_VERIFY_IOERR_CORRUPT (SQLITE_IOERR | (137479<<8))
+
+typedef struct VerifyRecord VerifyRecord;
+typedef struct VerifyTask VerifyTask;
+
+/*
+** One page record of the database file.
+*/
+struct VerifyRecord {
+  sqlite3_int64 iOff;          /* Offset of the record payload */
+  int nByte;                   /* Size of the payload, including checksum */
+  unsigned int iPg;            /* Page number */
+  int bBad;                    /* Set to true if the checksum is wrong */
+};
+
+/*
+** A contiguous range of records checked by a single thread.
+*/
+struct VerifyTask {
+  sqlite3_vfs *pVfs;           /* VFS used to open the database file */
+  const char *zFile;           /* Full path of the database file */
+  sqlite3_int64 iSkip;         /* Bytes skipped by ZIPVFS at PENDING_BYTE */
+  VerifyRecord *aRec;          /* First record to check */
+  int nRec;                    /* Number of records in aRec[] */
+  int nBad;                    /* OUT: Number of bad records found */
+  int rc;                      /* OUT: SQLite error code */
+  int bThread;                 /* True if running in a separate thread */
+#if SQLITE_THREADSAFE && defined(_WIN32)
+  HANDLE hThread;              /* Thread running this task */
+#elif SQLITE_THREADSAFE
+  pthread_t tid;               /* Thread running this task */
+#endif
+};
+
+/*
+** Read nByte bytes from offset iOff of the ZIPVFS file into aBuf.  ZIPVFS
+** does not use the locking page of the underlying file, so offsets at or
+** beyond it are shifted by iSkip bytes.  Any part of the buffer beyond
+** the end of the file is zeroed.  Large reads are split into requests of
+** at most NDS_VERIFY_READ_MAX bytes.
+*/
+static int verifyRead(
+  sqlite3_file *pFd,
+  sqlite3_int64 iSkip,
+  unsigned char *aBuf,
+  int nByte,
+  sqlite3_int64 iOff
+){
+  int rc = SQLITE_OK;
+  if( iOff<NDS_VERIFY_PENDING && iOff+nByte>NDS_VERIFY_PENDING ){
+    int n = (int)(NDS_VERIFY_PENDING - iOff);
+    rc = verifyRead(pFd, iSkip, aBuf, n, iOff);
+    if( rc==SQLITE_OK ){
+      rc = verifyRead(pFd, iSkip, &aBuf[n], nByte-n, NDS_VERIFY_PENDING);
+    }
+    return rc;
+  }
+  if( iOff>=NDS_VERIFY_PENDING ) iOff += iSkip;
+  while( rc==SQLITE_OK && nByte>0 ){
+    int n = nByte<NDS_VERIFY_READ_MAX ? nByte : NDS_VERIFY_READ_MAX;
+    rc = pFd->pMethods->xRead(pFd, aBuf, n, iOff);
+    if( rc==SQLITE_IOERR_SHORT_READ ){
+      memset(&aBuf[n], 0, nByte-n);
+      return SQLITE_OK;
+    }
+    aBuf += n;
+    nByte -= n;
+    iOff += n;
+  }
+  return rc;
+}
+
+/*
+** Open the database file using the VFS below ZIPVFS.  The returned handle
+** must be passed to verifyClose().
+*/
+static int verifyOpen(
+  sqlite3_vfs *pVfs,
+  const char *zFile,
+  sqlite3_file **ppFd
+){
+  sqlite3_file *pFd;
+  int flags = SQLITE_OPEN_READONLY|SQLITE_OPEN_MAIN_DB;
+  int rc;
+
+  *ppFd = 0;
+  pFd = (sqlite3_file*)sqlite3_malloc(pVfs->szOsFile);
+  if( pFd==0 ) return SQLITE_NOMEM;
+  memset(pFd, 0, pVfs->szOsFile);
+  rc = pVfs->xOpen(pVfs, zFile, pFd, flags, &flags);
+  if( rc!=SQLITE_OK ){
+    if( pFd->pMethods ) pFd->pMethods->xClose(pFd);
+    sqlite3_free(pFd);
+    return rc;
+  }
+  *ppFd = pFd;
+  return SQLITE_OK;
+}
+
+static void verifyClose(sqlite3_file *pFd){
+  if( pFd ){
+    if( pFd->pMethods ) pFd->pMethods->xClose(pFd);
+    sqlite3_free(pFd);
+  }
+}
+
+/*
+** Check all records of a single task.  Records are read in windows of up
+** to NDS_VERIFY_BUFFER bytes, each window covering as many consecutive
+** records as fit into it.
+*/
+static void verifyTaskRun(VerifyTask *p){
+  sqlite3_file *pFd = 0;
+  unsigned char *aBuf = 0;
+  int i = 0;
+
+  p->rc = verifyOpen(p->pVfs, p->zFile, &pFd);
+  if( p->rc==SQLITE_OK ){
+    aBuf = (unsigned char*)sqlite3_malloc(NDS_VERIFY_BUFFER);
+    if( aBuf==0 ) p->rc = SQLITE_NOMEM;
+  }
+  while( p->rc==SQLITE_OK && i<p->nRec ){
+    sqlite3_int64 iStart = p->aRec[i].iOff;
+    sqlite3_int64 iEnd = iStart + p->aRec[i].nByte;
+    int j;
+    for(j=i+1; j<p->nRec; j++){
+      sqlite3_int64 iRecEnd = p->aRec[j].iOff + p->aRec[j].nByte;
+      if( iRecEnd-iStart>NDS_VERIFY_BUFFER ) break;
+      if( iRecEnd>iEnd ) iEnd = iRecEnd;
+    }
+    p->rc = verifyRead(pFd, p->iSkip, aBuf, (int)(iEnd-iStart), iStart);
+    for(; p->rc==SQLITE_OK && i<j; i++){
+      VerifyRecord *pRec = &p->aRec[i];
+      const unsigned char *a = &aBuf[pRec->iOff - iStart];
+      int n = pRec->nByte - NDS_CRC_SIZE;
+      unsigned int iCrc;
+      if( n<0 ){
+        pRec->bBad = 1;
+      }else{
+        iCrc = ((unsigned int)a[n]<<24) | ((unsigned int)a[n+1]<<16)
+             | ((unsigned int)a[n+2]<<8) | (unsigned int)a[n+3];
+        pRec->bBad = (iCrc!=nds_crc32c(a, n));
+      }
+      p->nBad += pRec->bBad;
+    }
+  }
+  sqlite3_free(aBuf);
+  verifyClose(pFd);
+}
+
+#if SQLITE_THREADSAFE && defined(_WIN32)
+static DWORD WINAPI verifyThread(void *pArg){
+  verifyTaskRun((VerifyTask*)pArg);
+  return 0;
+}
+#elif SQLITE_THREADSAFE
+static void *verifyThread(void *pArg){
+  verifyTaskRun((VerifyTask*)pArg);
+  return 0;
+}
+#endif
+
+/*
+** Start a thread to run task p.  If no thread can be started, the task is
+** run immediately in the calling thread instead.
+*/
+static void verifyTaskStart(VerifyTask *p){
+#if SQLITE_THREADSAFE && defined(_WIN32)
+  p->hThread = CreateThread(0, 0, verifyThread, p, 0, 0);
+  p->bThread = (p->hThread!=0);
+#elif SQLITE_THREADSAFE
+  p->bThread = (pthread_create(&p->tid, 0, verifyThread, p)==0);
+#endif
+  if( p->bThread ) return;
+  verifyTaskRun(p);
+}
+
+/*
+** Wait for a task started by verifyTaskStart() to finish.
+*/
+static void verifyTaskJoin(VerifyTask *p){
+  if( !p->bThread ) return;
+#if SQLITE_THREADSAFE && defined(_WIN32)
+  WaitForSingleObject(p->hThread, INFINITE);
+  CloseHandle(p->hThread);
+#elif SQLITE_THREADSAFE
+  pthread_join(p->tid, 0);
+#endif
+}
+
+static int verifyCompareRecord(const void *a, const void *b){
+  const VerifyRecord *p1 = (const VerifyRecord*)a;
+  const VerifyRecord *p2 = (const VerifyRecord*)b;
+  return p1->iOff<p2->iOff ? -1 : p1->iOff>p2->iOff;
+}
+
+/*
+** Find the VFS immediately below ZIPVFS for database zDb of connection db.
+** Return SQLITE_NOTFOUND if the database does not use ZIPVFS.
+*/
+static int verifyFindVfs(sqlite3 *db, const char *zDb, sqlite3_vfs **ppVfs){
+  char *zName = 0;
+  int rc;
+
+  *ppVfs = 0;
+  rc = sqlite3_file_control(db, zDb, SQLITE_FCNTL_VFSNAME, (void*)&zName);
+  if( rc==SQLITE_OK && zName && strncmp(zName, "zipvfs/", 7)==0 ){
+    char *zParent = &zName[7];
+    char *zEnd = strchr(zParent, '/');
+    if( zEnd ) *zEnd = 0;
+    *ppVfs = sqlite3_vfs_find(zParent);
+  }
+  sqlite3_free(zName);
+  return *ppVfs ? SQLITE_OK : SQLITE_NOTFOUND;
+}
+
+/*
+** Read the ZIPVFS header of the database file.  Return SQLITE_NOTFOUND if
+** the database does not use page checksums.  Otherwise set *piSkip to the
+** number of bytes ZIPVFS skips at the locking page of the file and *pnPage
+** to the number of pages in the database.
+*/
+static int verifyReadHeader(
+  sqlite3_vfs *pVfs,
+  const char *zFile,
+  sqlite3_int64 *piSkip,
+  sqlite3_int64 *pnPage
+){
+  unsigned char aHdr[NDS_VERIFY_HDR_SIZE];
+  sqlite3_file *pFd = 0;
+  int rc;
+
+  rc = verifyOpen(pVfs, zFile, &pFd);
+  if( rc==SQLITE_OK ){
+    memset(aHdr, 0, sizeof(aHdr));
+    rc = verifyRead(pFd, 0, aHdr, sizeof(aHdr), 0);
+    verifyClose(pFd);
+  }
+  if( rc==SQLITE_OK ){
+    char zName[NDS_ZIPVFS_MAX_NAME+1];
+    int n;
+    unsigned int iVersion, nPgsz;
+    sqlite3_int64 iSize = 0;
+    memcpy(zName, &aHdr[3], NDS_ZIPVFS_MAX_NAME);
+    zName[NDS_ZIPVFS_MAX_NAME] = 0;
+    n = (int)strlen(zName);
+    if( memcmp(aHdr, "ZV-", 3)!=0
+     || n<=NDS_CRC_SUFFIX_LEN
+     || strcmp(&zName[n-NDS_CRC_SUFFIX_LEN], NDS_CRC_SUFFIX)!=0
+    ){
+      return SQLITE_NOTFOUND;
+    }
+    nPgsz = ((unsigned int)aHdr[NDS_VERIFY_OFF_PGSZ]<<24)
+          | ((unsigned int)aHdr[NDS_VERIFY_OFF_PGSZ+1]<<16)
+          | ((unsigned int)aHdr[NDS_VERIFY_OFF_PGSZ+2]<<8)
+          | (unsigned int)aHdr[NDS_VERIFY_OFF_PGSZ+3];
+    iVersion = ((unsigned int)aHdr[NDS_VERIFY_OFF_VERS]<<24)
+             | ((unsigned int)aHdr[NDS_VERIFY_OFF_VERS+1]<<16)
+             | ((unsigned int)aHdr[NDS_VERIFY_OFF_VERS+2]<<8)
+             | (unsigned int)aHdr[NDS_VERIFY_OFF_VERS+3];
+    for(n=0; n<8; n++){
+      iSize = (iSize<<8) | aHdr[NDS_VERIFY_OFF_SIZE+n];
+    }
+    *piSkip = iVersion ? 65536 : nPgsz;
+    *pnPage = nPgsz ? iSize/nPgsz : 0;
+  }
+  return rc;
+}
+
+/*
+** Verify the page checksums of database zDb ("main" if NULL) of connection
+** db, using up to nThread threads.  For each page whose checksum is wrong,
+** xBad (if not NULL) is invoked with pBadArg and the page number.  If
+** pnRecord is not NULL, *pnRecord is set to the number of records checked.
+**
+** Return SQLITE_OK if all checksums are correct, SQLITE_CORRUPT if any
+** are not, SQLITE_NOTFOUND if the database is not a ZIPVFS database with
+** page checksums, or another SQLite error code if an error occurs.
+*/
+int nds_compression_verify(
+  sqlite3 *db,                        /* Database connection */
+  const char *zDb,                    /* Database name, or NULL for "main" */
+  int nThread,                        /* Number of threads to use */
+  void (*xBad)(void*, unsigned int),  /* Callback for each bad page */
+  void *pBadArg,                      /* First argument passed to xBad */
+  sqlite3_int64 *pnRecord             /* OUT: Number of records checked */
+){
+  sqlite3_vfs *pVfs = 0;
+  const char *zFile;
+  sqlite3_int64 iSkip = 0;
+  sqlite3_int64 nPage = 0;
+  sqlite3_int64 nHdrPage = 0;
+  VerifyRecord *aRec = 0;
+  VerifyTask *aTask = 0;
+  int nRec = 0;
+  int bBegin = 0;
+  int nBad = 0;
+  int rc;
+  int i;
+
+  if( zDb==0 ) zDb = "main";
+  if( pnRecord ) *pnRecord = 0;
+  if( nThread<1 ) nThread = 1;
+  zFile = sqlite3_db_filename(db, zDb);
+  if( zFile==0 || zFile[0]==0 ) return SQLITE_NOTFOUND;
+  rc = verifyFindVfs(db, zDb, &pVfs);
+  if( rc==SQLITE_OK ) rc = verifyReadHeader(pVfs, zFile, &iSkip, &nHdrPage);
+  if( rc!=SQLITE_OK ) return rc;
+  crc32cInit();
+
+  /* Open a read transaction, so that the database does not change while
+  ** it is being verified, and find the number of pages in it.  */
+  if( sqlite3_get_autocommit(db) ){
+    rc = sqlite3_exec(db, "BEGIN", 0, 0, 0);
+    bBegin = (rc==SQLITE_OK);
+  }
+  if( rc==SQLITE_OK ){
+    char *zSql = sqlite3_mprintf("PRAGMA \"%w\".page_count", zDb);
+    sqlite3_stmt *pStmt = 0;
+    if( zSql==0 ){
+      rc = SQLITE_NOMEM;
+    }else{
+      rc = sqlite3_prepare_v2(db, zSql, -1, &pStmt, 0);
+      sqlite3_free(zSql);
+    }
+    if( rc==SQLITE_OK && sqlite3_step(pStmt)==SQLITE_ROW ){
+      nPage = sqlite3_column_int64(pStmt, 0);
+    }
+    if( rc==SQLITE_OK ) rc = sqlite3_finalize(pStmt);
+
+    /* Finding the page count reads page 1.  If its record is damaged, use
+    ** the page count from the ZIPVFS header instead, so that the record
+    ** is checked and reported like any other.  */
+    if( rc!=SQLITE_OK
+     && sqlite3_extended_errcode(db)==NDS_VERIFY_IOERR_CORRUPT
+    ){
+      nPage = nHdrPage;
+      rc = SQLITE_OK;
+    }
+  }
+
+  /* Collect the offset and size of each page record. */
+  if( rc==SQLITE_OK && nPage>0 ){
+    if( nPage>0x7fffffff/(sqlite3_int64)sizeof(VerifyRecord) ){
+      rc = SQLITE_NOMEM;
+    }else{
+      aRec = (VerifyRecord*)sqlite3_malloc((int)(sizeof(VerifyRecord)*nPage));
+      if( aRec==0 ) rc = SQLITE_NOMEM;
+    }
+  }
+  for(i=1; rc==SQLITE_OK && i<=nPage; i++){
+    sqlite3_int64 x[2];
+    x[0] = i;
+    x[1] = 0;
+    rc = sqlite3_file_control(db, zDb, ZIPVFS_CTRL_OFFSET_AND_SIZE, x);
+    if( rc==SQLITE_OK && x[0]>0 ){
+      aRec[nRec].iOff = x[0] + NDS_VERIFY_SLOT_HDR;
+      aRec[nRec].nByte = (int)x[1];
+      aRec[nRec].iPg = (unsigned int)i;
+      aRec[nRec].bBad = 0;
+      nRec++;
+    }
+  }
+
+  /* Check the records in nThread contiguous ranges of the file. */
+  if( rc==SQLITE_OK && nRec>0 ){
+    if( nThread>nRec ) nThread = nRec;
+    aTask = (VerifyTask*)sqlite3_malloc(sizeof(VerifyTask)*nThread);
+    if( aTask==0 ) rc = SQLITE_NOMEM;
+  }
+  if( rc==SQLITE_OK && nRec>0 ){
+    qsort(aRec, nRec, sizeof(VerifyRecord), verifyCompareRecord);
+    memset(aTask, 0, sizeof(VerifyTask)*nThread);
+    for(i=0; i<nThread; i++){
+      int iFirst = (int)(((sqlite3_int64)nRec * i) / nThread);
+      int iLast = (int)(((sqlite3_int64)nRec * (i+1)) / nThread);
+      aTask[i].pVfs = pVfs;
+      aTask[i].zFile = zFile;
+      aTask[i].iSkip = iSkip;
+      aTask[i].aRec = &aRec[iFirst];
+      aTask[i].nRec = iLast - iFirst;
+    }
+    for(i=1; i<nThread; i++) verifyTaskStart(&aTask[i]);
+    verifyTaskRun(&aTask[0]);
+    for(i=1; i<nThread; i++) verifyTaskJoin(&aTask[i]);
+    for(i=0; i<nThread; i++){
+      if( rc==SQLITE_OK ) rc = aTask[i].rc;
+      nBad += aTask[i].nBad;
+    }
+  }
+
+  if( bBegin ) sqlite3_exec(db, "COMMIT", 0, 0, 0);
+
+  if( rc==SQLITE_OK ){
+    if( xBad && nBad>0 ){
+      for(i=0; i<nRec; i++){
+        if( aRec[i].bBad ) xBad(pBadArg, aRec[i].iPg);
+      }
+    }
+    if( pnRecord ) *pnRecord = nRec;
+    if( nBad>0 ) rc = SQLITE_CORRUPT;
+  }
+  sqlite3_free(aTask);
+  sqlite3_free(aRec);
+  return rc;
+}
+/* End verification of page checksums
+******************************************************************************/
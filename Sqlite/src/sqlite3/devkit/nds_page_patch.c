@@ -0,0 +1,657 @@
+/*
+** This version of SQLite is specially prepared for the
+** Navigation Data Standard e.V.  Use by license only.
+**
+** This file implements a command-line program that creates and applies
+** page-level delta patches for ZIPVFS databases.  A map update usually
+** changes only a small part of the pages of a database, so shipping the
+** changed pages instead of the complete new file reduces both the download
+** size and the time needed to install the update on the device.
+**
+** Usage:
+**
+**    nds_page_patch diff ?-level N? BASE TARGET PATCH
+**    nds_page_patch apply DATABASE PATCH
+**
+** "diff" compares the uncompressed pages of BASE and TARGET and writes
+** every page of TARGET that differs from BASE to PATCH.  The pages are
+** stored already compressed with the codec of BASE (at compression level
+** N if given), which is the codec of the file they will be written to.
+**
+** "apply" writes the pages of PATCH into DATABASE, which must be a copy
+** of BASE (or a copy on which the same patch has already been applied).
+** The compressed pages are handed to ZIPVFS as they are, so the device
+** only decompresses each page once to check it and never compresses it.
+** All pages are written in a single ZIPVFS write transaction, which is
+** journaled by ZIPVFS itself: if the process or the device dies while a
+** patch is applied, the database is rolled back to BASE the next time it
+** is opened, and the patch can simply be applied again.
+**
+** Patch file format.  All integers are big-endian.  The header is:
+**
+**      0   8  "NDSPATCH"
+**      8   4  Format version (1)
+**     12   4  Page size
+**     16   4  Number of pages of BASE
+**     20   4  Number of pages of TARGET
+**     24   4  Number of page records that follow the header
+**     28  16  Codec name as stored in the ZIPVFS file header
+**     44   4  Checksum of bytes 0 to 43
+**
+** Each page record is:
+**
+**      0   4  Page number
+**      4   4  Checksum of the page in BASE (0 if beyond the end of BASE)
+**      8   4  Checksum of the page in TARGET
+**     12   4  Size of the compressed page image
+**     16   *  The compressed page image
+**
+** Checksums are 32-bit FNV-1a hashes of the uncompressed page.
+*/
+#include "nds_sqlite3.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+extern int nds_compression_algorithm_detector(
+  void *pCtx,
+  const char *zFile,
+  const char *zHeader,
+  ZipvfsMethods *pMethods
+);
+
+/* Names of the ZIPVFS instances registered by this program.  ZIPVFS
+** limits names to 13 bytes. */
+#define PATCH_VFS_BASE    "zipvfs_pbase"
+#define PATCH_VFS_TARGET  "zipvfs_ptgt"
+
+#define PATCH_MAGIC       "NDSPATCH"
+#define PATCH_VERSION     1
+#define PATCH_HDR_SIZE    48
+#define PATCH_REC_SIZE    16
+#define PATCH_CODEC_SIZE  16
+
+/*
+** One database file opened by this program.  The xAutoDetect callback of
+** the ZIPVFS instance used to open the file stores the methods of the real
+** codec here, so that pages can be compressed and decompressed directly.
+** While a page is written by "apply", aImage and aPayload are set to the
+** uncompressed page and its compressed image from the patch, and the
+** xCompress method returns the compressed image instead of compressing
+** the page again.
+*/
+typedef struct PatchFile PatchFile;
+struct PatchFile {
+  const char *zVfs;               /* Name of the ZIPVFS instance */
+  ZipvfsMethods inner;            /* Methods returned by the real detector */
+  int bCodec;                     /* True if inner is valid */
+  const char *aImage;             /* Page being written, or NULL */
+  const char *aPayload;           /* Compressed image of aImage */
+  int nPayload;                   /* Size of aPayload in bytes */
+  int nReuse;                     /* Number of times aPayload was used */
+  sqlite3 *db;                    /* Database connection */
+  sqlite3_file *pFd;              /* ZIPVFS file handle of "main" */
+  int pgsz;                       /* Page size */
+  int nPage;                      /* Number of pages */
+};
+
+static PatchFile gBase;
+static PatchFile gTarget;
+
+static int patchBound(void *pCtx, int nByte){
+  PatchFile *p = (PatchFile*)pCtx;
+  return p->inner.xCompressBound(p->inner.pCtx, nByte);
+}
+
+static int patchCompress(
+  void *pCtx,
+  char *aDest, int *pnDest,
+  const char *aSrc, int nSrc
+){
+  PatchFile *p = (PatchFile*)pCtx;
+  /* ZIPVFS compresses each page synchronously from within xWrite(), so the
+  ** buffer passed to xWrite() is the one that arrives here. */
+  if( p->aImage && nSrc==p->pgsz && p->nPayload<=*pnDest
+   && (aSrc==p->aImage || memcmp(aSrc, p->aImage, nSrc)==0)
+  ){
+    memcpy(aDest, p->aPayload, p->nPayload);
+    *pnDest = p->nPayload;
+    p->nReuse++;
+    return SQLITE_OK;
+  }
+  return p->inner.xCompress(p->inner.pCtx, aDest, pnDest, aSrc, nSrc);
+}
+
+static int patchUncompress(
+  void *pCtx,
+  char *aDest, int *pnDest,
+  const char *aSrc, int nSrc
+){
+  PatchFile *p = (PatchFile*)pCtx;
+  return p->inner.xUncompress(p->inner.pCtx, aDest, pnDest, aSrc, nSrc);
+}
+
+static int patchClose(void *pCtx){
+  PatchFile *p = (PatchFile*)pCtx;
+  int rc = SQLITE_OK;
+  if( p->bCodec && p->inner.xCompressClose ){
+    rc = p->inner.xCompressClose(p->inner.pCtx);
+  }
+  p->bCodec = 0;
+  return rc;
+}
+
+/*
+** xAutoDetect callback for both ZIPVFS instances.  pCtx is the PatchFile
+** of the instance.  Use the regular detector to find the codec, then
+** interpose the methods above.
+*/
+static int patchDetector(
+  void *pCtx,
+  const char *zFile,
+  const char *zHeader,
+  ZipvfsMethods *pMethods
+){
+  PatchFile *p = (PatchFile*)pCtx;
+  int rc = nds_compression_algorithm_detector(0, zFile, zHeader, pMethods);
+  if( rc!=SQLITE_OK || pMethods->xUncompress==0 ) return rc;
+  if( p->bCodec ){
+    /* Each instance is used for a single database file only */
+    if( pMethods->xCompressClose ) pMethods->xCompressClose(pMethods->pCtx);
+    memset(pMethods, 0, sizeof(*pMethods));
+    return SQLITE_CANTOPEN;
+  }
+  p->inner = *pMethods;
+  p->bCodec = 1;
+  pMethods->pCtx = (void*)p;
+  pMethods->xCompressBound = patchBound;
+  pMethods->xCompress = patchCompress;
+  pMethods->xUncompress = patchUncompress;
+  pMethods->xCompressClose = patchClose;
+  return SQLITE_OK;
+}
+
+static void patchPut32(unsigned char *a, unsigned int v){
+  a[0] = (unsigned char)(v>>24);
+  a[1] = (unsigned char)(v>>16);
+  a[2] = (unsigned char)(v>>8);
+  a[3] = (unsigned char)v;
+}
+
+static unsigned int patchGet32(const unsigned char *a){
+  return ((unsigned int)a[0]<<24) | ((unsigned int)a[1]<<16)
+       | ((unsigned int)a[2]<<8) | (unsigned int)a[3];
+}
+
+/*
+** Return the 32-bit FNV-1a hash of the n bytes at a.
+*/
+static unsigned int patchChecksum(const void *a, int n){
+  const unsigned char *z = (const unsigned char*)a;
+  unsigned int h = 2166136261u;
+  int i;
+  for(i=0; i<n; i++){
+    h = (h ^ z[i]) * 16777619u;
+  }
+  return h;
+}
+
+/*
+** Return the current time in milliseconds from a monotonic clock.
+*/
+static double patchNow(void){
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec*1000.0 + ts.tv_nsec/1000000.0;
+}
+
+/*
+** Return the result of the single-value SQL statement zSql, or -1.
+*/
+static sqlite3_int64 patchQueryInt(sqlite3 *db, const char *zSql){
+  sqlite3_stmt *pStmt = 0;
+  sqlite3_int64 iRet = -1;
+  if( sqlite3_prepare_v2(db, zSql, -1, &pStmt, 0)==SQLITE_OK
+   && sqlite3_step(pStmt)==SQLITE_ROW
+  ){
+    iRet = sqlite3_column_int64(pStmt, 0);
+  }
+  sqlite3_finalize(pStmt);
+  return iRet;
+}
+
+/*
+** Open database zFile through the ZIPVFS instance of p and start a
+** transaction on it (an exclusive one if bWrite is true).  zUri, if not
+** NULL, is the URI used to open the file instead of zFile.
+*/
+static int patchOpen(PatchFile *p, const char *zFile, const char *zUri,
+                     int bWrite){
+  int flags = bWrite ? SQLITE_OPEN_READWRITE : SQLITE_OPEN_READONLY;
+  int rc;
+
+  rc = sqlite3_open_v2(zUri ? zUri : zFile, &p->db, flags|SQLITE_OPEN_URI,
+                       p->zVfs);
+  if( rc==SQLITE_OK ){
+    rc = sqlite3_exec(p->db, bWrite ? "BEGIN EXCLUSIVE" : "BEGIN", 0, 0, 0);
+  }
+  if( rc==SQLITE_OK ){
+    /* Read the schema so that a read lock is held from here on */
+    rc = sqlite3_exec(p->db, "SELECT count(*) FROM sqlite_master", 0, 0, 0);
+  }
+  if( rc==SQLITE_OK ){
+    rc = sqlite3_file_control(p->db, "main", SQLITE_FCNTL_FILE_POINTER,
+                              (void*)&p->pFd);
+  }
+  if( rc!=SQLITE_OK ){
+    fprintf(stderr, "cannot open \"%s\": %s\n", zFile, sqlite3_errmsg(p->db));
+    return rc;
+  }
+  if( !p->bCodec ){
+    fprintf(stderr, "\"%s\" is not a compressed ZIPVFS database\n", zFile);
+    return SQLITE_ERROR;
+  }
+  p->pgsz = (int)patchQueryInt(p->db, "PRAGMA page_size");
+  p->nPage = (int)patchQueryInt(p->db, "PRAGMA page_count");
+  if( p->pgsz<=0 || p->nPage<0 ){
+    fprintf(stderr, "cannot read \"%s\": %s\n", zFile, sqlite3_errmsg(p->db));
+    return SQLITE_ERROR;
+  }
+  return SQLITE_OK;
+}
+
+static void patchCloseDb(PatchFile *p){
+  if( p->db ){
+    if( !sqlite3_get_autocommit(p->db) ){
+      sqlite3_exec(p->db, "ROLLBACK", 0, 0, 0);
+    }
+    sqlite3_close(p->db);
+    p->db = 0;
+  }
+  p->pFd = 0;
+}
+
+/*
+** Read page iPg of database p into aBuf.
+*/
+static int patchReadPage(PatchFile *p, unsigned int iPg, char *aBuf){
+  sqlite3_int64 iOff = (sqlite3_int64)(iPg-1) * p->pgsz;
+  return p->pFd->pMethods->xRead(p->pFd, aBuf, p->pgsz, iOff);
+}
+
+/*
+** Implementation of "diff".
+*/
+static int patchDiff(const char *zBase, const char *zTarget,
+                     const char *zPatch, int iLevel){
+  unsigned char aHdr[PATCH_HDR_SIZE];
+  char *zUri = 0;
+  char *aOld = 0;
+  char *aNew = 0;
+  char *aOut = 0;
+  FILE *out = 0;
+  sqlite3_int64 nByte = PATCH_HDR_SIZE;
+  double tStart = patchNow();
+  unsigned int nRec = 0;
+  unsigned int iPg;
+  int nOut = 0;
+  int rc;
+
+  if( iLevel>=0 ){
+    zUri = sqlite3_mprintf("file:%s?level=%d", zBase, iLevel);
+    if( zUri==0 ) return SQLITE_NOMEM;
+  }
+  rc = patchOpen(&gBase, zBase, zUri, 0);
+  sqlite3_free(zUri);
+  if( rc==SQLITE_OK ) rc = patchOpen(&gTarget, zTarget, 0, 0);
+  if( rc==SQLITE_OK && gBase.pgsz!=gTarget.pgsz ){
+    fprintf(stderr, "page sizes differ (%d and %d)\n",
+            gBase.pgsz, gTarget.pgsz);
+    rc = SQLITE_ERROR;
+  }
+  if( rc==SQLITE_OK ){
+    nOut = gBase.inner.xCompressBound(gBase.inner.pCtx, gBase.pgsz);
+    aOld = (char*)malloc(gBase.pgsz);
+    aNew = (char*)malloc(gBase.pgsz);
+    aOut = (char*)malloc(nOut);
+    if( aOld==0 || aNew==0 || aOut==0 ) rc = SQLITE_NOMEM;
+  }
+  if( rc==SQLITE_OK ){
+    out = fopen(zPatch, "wb");
+    if( out==0 ){
+      fprintf(stderr, "cannot open \"%s\"\n", zPatch);
+      rc = SQLITE_CANTOPEN;
+    }
+  }
+  if( rc==SQLITE_OK ){
+    memset(aHdr, 0, sizeof(aHdr));
+    if( fwrite(aHdr, sizeof(aHdr), 1, out)!=1 ) rc = SQLITE_IOERR;
+  }
+
+  for(iPg=1; rc==SQLITE_OK && iPg<=(unsigned int)gTarget.nPage; iPg++){
+    unsigned char aRec[PATCH_REC_SIZE];
+    unsigned int hOld = 0;
+    int n = nOut;
+
+    rc = patchReadPage(&gTarget, iPg, aNew);
+    if( rc==SQLITE_OK && iPg<=(unsigned int)gBase.nPage ){
+      rc = patchReadPage(&gBase, iPg, aOld);
+      if( rc==SQLITE_OK && memcmp(aOld, aNew, gBase.pgsz)==0 ) continue;
+      hOld = patchChecksum(aOld, gBase.pgsz);
+    }
+    if( rc!=SQLITE_OK ) break;
+
+    rc = gBase.inner.xCompress(gBase.inner.pCtx, aOut, &n, aNew, gBase.pgsz);
+    if( rc!=SQLITE_OK ) break;
+    patchPut32(&aRec[0], iPg);
+    patchPut32(&aRec[4], hOld);
+    patchPut32(&aRec[8], patchChecksum(aNew, gBase.pgsz));
+    patchPut32(&aRec[12], (unsigned int)n);
+    if( fwrite(aRec, sizeof(aRec), 1, out)!=1
+     || fwrite(aOut, n, 1, out)!=1
+    ){
+      rc = SQLITE_IOERR;
+    }
+    nByte += sizeof(aRec) + n;
+    nRec++;
+  }
+
+  if( rc==SQLITE_OK ){
+    const char *zCodec = gBase.inner.zHdr ? gBase.inner.zHdr : "";
+    memcpy(aHdr, PATCH_MAGIC, 8);
+    patchPut32(&aHdr[8], PATCH_VERSION);
+    patchPut32(&aHdr[12], (unsigned int)gBase.pgsz);
+    patchPut32(&aHdr[16], (unsigned int)gBase.nPage);
+    patchPut32(&aHdr[20], (unsigned int)gTarget.nPage);
+    patchPut32(&aHdr[24], nRec);
+    strncpy((char*)&aHdr[28], zCodec, PATCH_CODEC_SIZE-1);
+    patchPut32(&aHdr[44], patchChecksum(aHdr, 44));
+    if( fseek(out, 0, SEEK_SET)!=0
+     || fwrite(aHdr, sizeof(aHdr), 1, out)!=1
+    ){
+      rc = SQLITE_IOERR;
+    }
+  }
+  if( out && fclose(out)!=0 && rc==SQLITE_OK ) rc = SQLITE_IOERR;
+
+  if( rc==SQLITE_OK ){
+    printf("%u of %d pages changed, patch is %lld KiB (%.1f%% of %d KiB),"
+           " %.1f s\n", nRec, gTarget.nPage, nByte/1024,
+           gTarget.nPage ? 100.0*nRec/gTarget.nPage : 0.0,
+           (int)(((sqlite3_int64)gTarget.nPage*gTarget.pgsz)/1024),
+           (patchNow()-tStart)/1000.0);
+  }else{
+    if( out ) unlink(zPatch);
+    fprintf(stderr, "diff failed: %s\n", sqlite3_errstr(rc));
+  }
+  free(aOld);
+  free(aNew);
+  free(aOut);
+  patchCloseDb(&gTarget);
+  patchCloseDb(&gBase);
+  return rc;
+}
+
+/*
+** Read the whole of file zFile into memory obtained from malloc().
+*/
+static unsigned char *patchReadFile(const char *zFile, long *pnByte){
+  FILE *in = fopen(zFile, "rb");
+  unsigned char *a = 0;
+  long n = -1;
+  if( in==0 ) return 0;
+  if( fseek(in, 0, SEEK_END)==0 ) n = ftell(in);
+  if( n>=0 && fseek(in, 0, SEEK_SET)==0 ){
+    a = (unsigned char*)malloc(n>0 ? n : 1);
+    if( a && n>0 && fread(a, n, 1, in)!=1 ){
+      free(a);
+      a = 0;
+    }
+  }
+  fclose(in);
+  *pnByte = n;
+  return a;
+}
+
+/*
+** Implementation of "apply".
+*/
+static int patchApply(const char *zDb, const char *zPatch){
+  unsigned char *aPatch;
+  unsigned char *aWrite = 0;
+  const unsigned char *aRec;
+  char *aCur = 0;
+  char *aImage = 0;
+  char zCodec[PATCH_CODEC_SIZE];
+  unsigned int pgsz, nBasePage, nTargetPage, nRec;
+  unsigned int nWrite = 0;
+  unsigned int iCounter = 0;
+  double tStart = patchNow();
+  long nPatch = 0;
+  long iOff;
+  unsigned int i;
+  int rc = SQLITE_OK;
+
+  aPatch = patchReadFile(zPatch, &nPatch);
+  if( aPatch==0 ){
+    fprintf(stderr, "cannot read \"%s\"\n", zPatch);
+    return SQLITE_CANTOPEN;
+  }
+  if( nPatch<PATCH_HDR_SIZE
+   || memcmp(aPatch, PATCH_MAGIC, 8)!=0
+   || patchGet32(&aPatch[44])!=patchChecksum(aPatch, 44)
+  ){
+    fprintf(stderr, "\"%s\" is not a page patch\n", zPatch);
+    free(aPatch);
+    return SQLITE_CORRUPT;
+  }
+  if( patchGet32(&aPatch[8])!=PATCH_VERSION ){
+    fprintf(stderr, "unsupported patch version %u\n", patchGet32(&aPatch[8]));
+    free(aPatch);
+    return SQLITE_ERROR;
+  }
+  pgsz = patchGet32(&aPatch[12]);
+  nBasePage = patchGet32(&aPatch[16]);
+  nTargetPage = patchGet32(&aPatch[20]);
+  nRec = patchGet32(&aPatch[24]);
+  memcpy(zCodec, &aPatch[28], PATCH_CODEC_SIZE);
+  zCodec[PATCH_CODEC_SIZE-1] = 0;
+
+  rc = patchOpen(&gTarget, zDb, 0, 1);
+  if( rc==SQLITE_OK
+   && (strcmp(gTarget.inner.zHdr ? gTarget.inner.zHdr : "", zCodec)!=0
+       || (unsigned int)gTarget.pgsz!=pgsz)
+  ){
+    fprintf(stderr, "patch is for codec \"%s\" and page size %u\n",
+            zCodec, pgsz);
+    rc = SQLITE_ERROR;
+  }
+  if( rc==SQLITE_OK ){
+    aCur = (char*)malloc(pgsz);
+    aImage = (char*)malloc(pgsz);
+    aWrite = (unsigned char*)malloc(nRec ? nRec : 1);
+    if( aCur==0 || aImage==0 || aWrite==0 ) rc = SQLITE_NOMEM;
+  }
+
+  /* First pass: check that every record is intact and that the page it
+  ** replaces is the page of the base database, or already the page of
+  ** the target database.  Nothing is written before all records have
+  ** been checked. */
+  iOff = PATCH_HDR_SIZE;
+  for(i=0; rc==SQLITE_OK && i<nRec; i++){
+    unsigned int iPg, hOld, hNew, nPayload;
+    int n = (int)pgsz;
+    if( nPatch-iOff<PATCH_REC_SIZE ){
+      rc = SQLITE_CORRUPT;
+      break;
+    }
+    aRec = &aPatch[iOff];
+    iPg = patchGet32(&aRec[0]);
+    hOld = patchGet32(&aRec[4]);
+    hNew = patchGet32(&aRec[8]);
+    nPayload = patchGet32(&aRec[12]);
+    if( iPg==0 || iPg>nTargetPage
+     || nPayload>(unsigned long)(nPatch-iOff-PATCH_REC_SIZE)
+    ){
+      rc = SQLITE_CORRUPT;
+      break;
+    }
+    rc = gTarget.inner.xUncompress(gTarget.inner.pCtx, aImage, &n,
+                                   (const char*)&aRec[PATCH_REC_SIZE],
+                                   (int)nPayload);
+    if( rc!=SQLITE_OK || n!=(int)pgsz || patchChecksum(aImage, n)!=hNew ){
+      rc = SQLITE_CORRUPT;
+      break;
+    }
+    aWrite[i] = 1;
+    if( iPg<=(unsigned int)gTarget.nPage ){
+      unsigned int hCur;
+      rc = patchReadPage(&gTarget, iPg, aCur);
+      if( rc!=SQLITE_OK ) break;
+      hCur = patchChecksum(aCur, pgsz);
+      if( hCur==hNew && memcmp(aCur, aImage, pgsz)==0 ){
+        aWrite[i] = 0;
+      }else if( iPg>nBasePage || hCur!=hOld ){
+        fprintf(stderr, "page %u of \"%s\" does not match the patch\n",
+                iPg, zDb);
+        rc = SQLITE_MISMATCH;
+        break;
+      }
+    }
+    nWrite += aWrite[i];
+    iOff += PATCH_REC_SIZE + nPayload;
+  }
+  if( rc==SQLITE_CORRUPT ){
+    fprintf(stderr, "\"%s\" is damaged (record %u)\n", zPatch, i);
+  }
+  if( rc==SQLITE_OK && gTarget.nPage!=(int)nBasePage
+   && (nWrite>0 || gTarget.nPage!=(int)nTargetPage)
+  ){
+    fprintf(stderr, "\"%s\" has %d pages, the patch expects %u\n",
+            zDb, gTarget.nPage, nBasePage);
+    rc = SQLITE_MISMATCH;
+  }
+  if( rc==SQLITE_OK && nWrite==0 && gTarget.nPage==(int)nTargetPage ){
+    printf("patch is already applied\n");
+    goto apply_done;
+  }
+  if( rc==SQLITE_OK ){
+    rc = patchReadPage(&gTarget, 1, aCur);
+    iCounter = patchGet32((unsigned char*)&aCur[24]);
+  }
+
+  /* Second pass: write the pages.  Each compressed image from the patch
+  ** is passed to ZIPVFS through patchCompress(). */
+  iOff = PATCH_HDR_SIZE;
+  for(i=0; rc==SQLITE_OK && i<nRec; i++){
+    unsigned int iPg;
+    unsigned int nPayload;
+    int n = (int)pgsz;
+    aRec = &aPatch[iOff];
+    iPg = patchGet32(&aRec[0]);
+    nPayload = patchGet32(&aRec[12]);
+    iOff += PATCH_REC_SIZE + nPayload;
+    if( !aWrite[i] ) continue;
+    rc = gTarget.inner.xUncompress(gTarget.inner.pCtx, aImage, &n,
+                                   (const char*)&aRec[PATCH_REC_SIZE],
+                                   (int)nPayload);
+    if( rc!=SQLITE_OK ) break;
+    gTarget.aImage = aImage;
+    gTarget.aPayload = (const char*)&aRec[PATCH_REC_SIZE];
+    gTarget.nPayload = (int)nPayload;
+    rc = gTarget.pFd->pMethods->xWrite(gTarget.pFd, aImage, (int)pgsz,
+                                       (sqlite3_int64)(iPg-1)*pgsz);
+    gTarget.aImage = 0;
+  }
+  if( rc==SQLITE_OK && nTargetPage<(unsigned int)gTarget.nPage ){
+    rc = gTarget.pFd->pMethods->xTruncate(gTarget.pFd,
+                                          (sqlite3_int64)nTargetPage*pgsz);
+  }
+
+  /* If the change counter on page 1 is unchanged, increment it so that
+  ** other connections discard any pages they have cached. */
+  if( rc==SQLITE_OK ){
+    rc = patchReadPage(&gTarget, 1, aCur);
+  }
+  if( rc==SQLITE_OK && patchGet32((unsigned char*)&aCur[24])==iCounter ){
+    patchPut32((unsigned char*)&aCur[24], iCounter+1);
+    patchPut32((unsigned char*)&aCur[92], iCounter+1);
+    rc = gTarget.pFd->pMethods->xWrite(gTarget.pFd, aCur, (int)pgsz, 0);
+  }
+
+  /* Commit the ZIPVFS write transaction */
+  if( rc==SQLITE_OK ){
+    rc = gTarget.pFd->pMethods->xFileControl(gTarget.pFd, SQLITE_FCNTL_SYNC,
+                                             0);
+  }
+  if( rc==SQLITE_OK ){
+    rc = sqlite3_exec(gTarget.db, "COMMIT", 0, 0, 0);
+  }
+
+  if( rc==SQLITE_OK ){
+    printf("%u pages written (%u already up to date, %d reused as is),"
+           " %.1f s\n", nWrite, nRec-nWrite, gTarget.nReuse,
+           (patchNow()-tStart)/1000.0);
+  }else{
+    fprintf(stderr, "apply failed, \"%s\" is unchanged: %s\n",
+            zDb, sqlite3_errstr(rc));
+  }
+
+apply_done:
+  free(aCur);
+  free(aImage);
+  free(aWrite);
+  free(aPatch);
+  patchCloseDb(&gTarget);
+  return rc;
+}
+
+static void usage(const char *zArgv0){
+  fprintf(stderr,
+    "Usage: %s diff ?-level N? BASE TARGET PATCH\n"
+    "       %s apply DATABASE PATCH\n",
+    zArgv0, zArgv0);
+  exit(1);
+}
+
+int main(int argc, char **argv){
+  int iLevel = -1;
+  int rc;
+  int i = 2;
+
+  if( argc<2 ) usage(argv[0]);
+  gBase.zVfs = PATCH_VFS_BASE;
+  gTarget.zVfs = PATCH_VFS_TARGET;
+  rc = sqlite3_initialize();
+  if( rc==SQLITE_OK ){
+    rc = zipvfs_create_vfs_v3(PATCH_VFS_BASE, "unix", &gBase, patchDetector);
+  }
+  if( rc==SQLITE_OK ){
+    rc = zipvfs_create_vfs_v3(PATCH_VFS_TARGET, "unix", &gTarget,
+                              patchDetector);
+  }
+  if( rc!=SQLITE_OK ){
+    fprintf(stderr, "cannot register the ZIPVFS: %d\n", rc);
+    return 1;
+  }
+
+  if( strcmp(argv[1], "diff")==0 ){
+    if( i+1<argc && strcmp(argv[i], "-level")==0 ){
+      iLevel = atoi(argv[i+1]);
+      i += 2;
+    }
+    if( argc-i!=3 ) usage(argv[0]);
+    rc = patchDiff(argv[i], argv[i+1], argv[i+2], iLevel);
+  }else if( strcmp(argv[1], "apply")==0 ){
+    if( argc-i!=2 ) usage(argv[0]);
+    rc = patchApply(argv[i], argv[i+1]);
+  }else{
+    usage(argv[0]);
+  }
+
+  zipvfs_destroy_vfs(PATCH_VFS_TARGET);
+  zipvfs_destroy_vfs(PATCH_VFS_BASE);
+  return rc==SQLITE_OK ? 0 : 1;
+}
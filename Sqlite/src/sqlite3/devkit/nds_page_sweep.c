@@ -0,0 +1,633 @@
+/*
+** This version of SQLite is specially prepared for the
+** Navigation Data Standard e.V.  Use by license only.
+**
+** This file implements a command-line program that helps to choose the
+** page size and compression method of a product database.  The database
+** is rebuilt once for every combination of page size and codec given on
+** the command line.  A recorded set of queries is then replayed against
+** each variant, and one table is printed with the file size, the number
+** of page records read and decompressed, and the query latency of every
+** variant.
+**
+** Usage:
+**
+**    nds_page_sweep ?OPTIONS? DATABASE QUERYFILE
+**
+** QUERYFILE has the same format as for nds_vfs_bench: one SQL statement
+** per line, empty lines and lines starting with "--" are ignored.  Each
+** statement is run on a freshly opened read-only connection, so that the
+** page counts are not affected by the page cache of earlier queries.
+**
+** Options:
+**
+**    -pagesize LIST   Comma separated list of page sizes.  A "k" suffix
+**                     multiplies by 1024.  The default is
+**                     "1k,2k,4k,8k,16k,32k,64k".
+**    -codec LIST      Comma separated list of codecs as accepted by the
+**                     "zv=" URI parameter, each optionally followed by
+**                     ":LEVEL" (for example "zlib:9,lz4hc:12,ndsc:4").
+**                     The default is "zlib,lz4,lz4hc,ndsc,bsr".
+**    -repeat N        Run the whole query file N times per variant
+**                     (default 3).
+**    -warm            Do not evict the variant from the page cache of the
+**                     operating system before each query.
+**    -dir DIR         Directory for the rebuilt databases (default ".").
+**    -keep            Do not delete the rebuilt databases when done.
+**
+** The databases are rebuilt by copying the schema and the content of all
+** tables, including the shadow tables of virtual tables, in rowid order.
+** Indexes are created after the tables have been filled.
+*/
+#include "nds_sqlite3.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+extern int nds_compression_algorithm_detector(
+  void *pCtx,
+  const char *zFile,
+  const char *zHeader,
+  ZipvfsMethods *pMethods
+);
+
+/* Name of the ZIPVFS instance registered by this program */
+#define SWEEP_VFS_NAME  "zipvfs_sweep"
+
+#define SWEEP_MAX_PGSZ   16
+#define SWEEP_MAX_CODEC  16
+
+/*
+** Counters updated by the ZIPVFS methods below.  This program runs all
+** queries in a single thread, so no locking is needed.
+*/
+static struct SweepCounters {
+  sqlite3_int64 nRecord;          /* Number of records decompressed */
+  sqlite3_int64 nByteIn;          /* Bytes of compressed data read */
+  sqlite3_int64 nByteOut;         /* Bytes of decompressed data produced */
+} gCount;
+
+/*
+** The ZIPVFS methods of the real codec, wrapped by the sweep methods so
+** that decompressed records can be counted.
+*/
+typedef struct SweepCodec SweepCodec;
+struct SweepCodec {
+  ZipvfsMethods inner;            /* Methods returned by the real detector */
+};
+
+/*
+** One codec to measure, as parsed from the -codec option.
+*/
+typedef struct SweepSpec SweepSpec;
+struct SweepSpec {
+  char zName[16];                 /* Value of the "zv=" parameter */
+  int iLevel;                     /* Value of the "level=" parameter or -1 */
+};
+
+/*
+** Results collected for one variant of the database.
+*/
+typedef struct SweepResult SweepResult;
+struct SweepResult {
+  double *aLatency;               /* Latency of each query in milliseconds */
+  int nLatency;                   /* Number of valid entries in aLatency[] */
+  int nErr;                       /* Number of failed queries */
+  sqlite3_int64 nRecord;          /* Total records decompressed */
+  sqlite3_int64 nByteOut;         /* Total bytes decompressed */
+};
+
+static int sweepBound(void *pCtx, int nByte){
+  SweepCodec *p = (SweepCodec*)pCtx;
+  return p->inner.xCompressBound(p->inner.pCtx, nByte);
+}
+
+static int sweepCompress(
+  void *pCtx,
+  char *aDest, int *pnDest,
+  const char *aSrc, int nSrc
+){
+  SweepCodec *p = (SweepCodec*)pCtx;
+  return p->inner.xCompress(p->inner.pCtx, aDest, pnDest, aSrc, nSrc);
+}
+
+static int sweepUncompress(
+  void *pCtx,
+  char *aDest, int *pnDest,
+  const char *aSrc, int nSrc
+){
+  SweepCodec *p = (SweepCodec*)pCtx;
+  int rc = p->inner.xUncompress(p->inner.pCtx, aDest, pnDest, aSrc, nSrc);
+  if( rc==SQLITE_OK ){
+    gCount.nRecord++;
+    gCount.nByteIn += nSrc;
+    gCount.nByteOut += *pnDest;
+  }
+  return rc;
+}
+
+static int sweepClose(void *pCtx){
+  SweepCodec *p = (SweepCodec*)pCtx;
+  int rc = SQLITE_OK;
+  if( p->inner.xCompressClose ) rc = p->inner.xCompressClose(p->inner.pCtx);
+  sqlite3_free(p);
+  return rc;
+}
+
+/*
+** xAutoDetect callback for the "zipvfs_sweep" VFS.  Use the regular
+** detector to find the codec, then interpose the counting methods.
+*/
+static int sweepDetector(
+  void *pCtx,
+  const char *zFile,
+  const char *zHeader,
+  ZipvfsMethods *pMethods
+){
+  SweepCodec *p;
+  int rc = nds_compression_algorithm_detector(pCtx, zFile, zHeader, pMethods);
+  if( rc!=SQLITE_OK || pMethods->xUncompress==0 ) return rc;
+  p = (SweepCodec*)sqlite3_malloc(sizeof(SweepCodec));
+  if( p==0 ){
+    if( pMethods->xCompressClose ) pMethods->xCompressClose(pMethods->pCtx);
+    memset(pMethods, 0, sizeof(*pMethods));
+    return SQLITE_NOMEM;
+  }
+  p->inner = *pMethods;
+  pMethods->pCtx = (void*)p;
+  pMethods->xCompressBound = sweepBound;
+  pMethods->xCompress = sweepCompress;
+  pMethods->xUncompress = sweepUncompress;
+  pMethods->xCompressClose = sweepClose;
+  return SQLITE_OK;
+}
+
+/*
+** Return the current time in milliseconds from a monotonic clock.
+*/
+static double sweepNow(void){
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec*1000.0 + ts.tv_nsec/1000000.0;
+}
+
+/*
+** Evict file zFile from the page cache.
+*/
+static void sweepEvict(const char *zFile){
+  int fd = open(zFile, O_RDONLY);
+  if( fd>=0 ){
+    fdatasync(fd);
+    posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+    close(fd);
+  }
+}
+
+/*
+** Read the query file into an array of NUL-terminated strings.
+*/
+static char **sweepReadQueries(const char *zFile, int *pnQuery){
+  FILE *in = fopen(zFile, "rb");
+  char zLine[4096];
+  char **azQuery = 0;
+  int nQuery = 0;
+  if( in==0 ){
+    fprintf(stderr, "cannot open \"%s\"\n", zFile);
+    exit(1);
+  }
+  while( fgets(zLine, sizeof(zLine), in) ){
+    int n = (int)strlen(zLine);
+    while( n>0 && (zLine[n-1]=='\n' || zLine[n-1]=='\r') ) zLine[--n] = 0;
+    if( n==0 || strncmp(zLine, "--", 2)==0 ) continue;
+    azQuery = realloc(azQuery, (nQuery+1)*sizeof(char*));
+    if( azQuery==0 ){
+      fprintf(stderr, "out of memory\n");
+      exit(1);
+    }
+    azQuery[nQuery++] = strdup(zLine);
+  }
+  fclose(in);
+  *pnQuery = nQuery;
+  return azQuery;
+}
+
+/*
+** Run SQL statement zSql and report any error.  Return an SQLite error
+** code.
+*/
+static int sweepExec(sqlite3 *db, const char *zSql){
+  char *zErr = 0;
+  int rc = sqlite3_exec(db, zSql, 0, 0, &zErr);
+  if( rc!=SQLITE_OK ){
+    fprintf(stderr, "%s\n  [%s]\n", zErr ? zErr : sqlite3_errstr(rc), zSql);
+  }
+  sqlite3_free(zErr);
+  return rc;
+}
+
+/*
+** Run query zSql and call sweepExec() on each value of the first result
+** column.  If zFmt is not NULL, each value is first formatted into an SQL
+** statement using zFmt, which may use the value in up to three "%w"
+** conversions.
+*/
+static int sweepExecEach(sqlite3 *db, const char *zSql, const char *zFmt){
+  sqlite3_stmt *pStmt = 0;
+  int rc = sqlite3_prepare_v2(db, zSql, -1, &pStmt, 0);
+  if( rc!=SQLITE_OK ){
+    fprintf(stderr, "%s\n  [%s]\n", sqlite3_errmsg(db), zSql);
+    return rc;
+  }
+  while( rc==SQLITE_OK && sqlite3_step(pStmt)==SQLITE_ROW ){
+    const char *z = (const char*)sqlite3_column_text(pStmt, 0);
+    if( z==0 ) continue;
+    if( zFmt ){
+      char *zExec = sqlite3_mprintf(zFmt, z, z, z);
+      if( zExec==0 ){
+        rc = SQLITE_NOMEM;
+      }else{
+        rc = sweepExec(db, zExec);
+        sqlite3_free(zExec);
+      }
+    }else{
+      rc = sweepExec(db, z);
+    }
+  }
+  if( rc==SQLITE_OK ){
+    rc = sqlite3_finalize(pStmt);
+  }else{
+    sqlite3_finalize(pStmt);
+  }
+  return rc;
+}
+
+/*
+** Rebuild database zSrc as zDest, with page size nPgsz and the codec
+** described by pSpec.  Return an SQLite error code.
+*/
+static int sweepBuild(
+  const char *zSrc,
+  const char *zDest,
+  int nPgsz,
+  const SweepSpec *pSpec
+){
+  sqlite3 *db = 0;
+  char *zUri;
+  char *zSql;
+  int rc;
+
+  if( pSpec->iLevel>=0 ){
+    zUri = sqlite3_mprintf("file:%s?zv=%s&level=%d",
+                           zDest, pSpec->zName, pSpec->iLevel);
+  }else{
+    zUri = sqlite3_mprintf("file:%s?zv=%s", zDest, pSpec->zName);
+  }
+  if( zUri==0 ) return SQLITE_NOMEM;
+  rc = sqlite3_open_v2(zUri, &db,
+      SQLITE_OPEN_READWRITE|SQLITE_OPEN_CREATE|SQLITE_OPEN_URI,
+      SWEEP_VFS_NAME);
+  sqlite3_free(zUri);
+  if( rc!=SQLITE_OK ){
+    fprintf(stderr, "cannot create \"%s\": %s\n", zDest, sqlite3_errmsg(db));
+    sqlite3_close(db);
+    return rc;
+  }
+
+  zSql = sqlite3_mprintf(
+      "PRAGMA main.page_size=%d;"
+      "PRAGMA main.synchronous=OFF;"
+      "ATTACH 'file:%q?mode=ro' AS src;"
+      "BEGIN;", nPgsz, zSrc);
+  rc = zSql ? sweepExec(db, zSql) : SQLITE_NOMEM;
+  sqlite3_free(zSql);
+
+  /* Virtual tables first, as they create their own shadow tables. Then
+  ** all other tables, except for those created automatically.  */
+  if( rc==SQLITE_OK ){
+    rc = sweepExecEach(db,
+        "SELECT sql FROM src.sqlite_master"
+        " WHERE type='table' AND sql LIKE 'CREATE VIRTUAL TABLE%'", 0);
+  }
+  if( rc==SQLITE_OK ){
+    rc = sweepExecEach(db,
+        "SELECT sql FROM src.sqlite_master AS s"
+        " WHERE type='table' AND sql NOT LIKE 'CREATE VIRTUAL TABLE%'"
+        "   AND name NOT GLOB 'sqlite_*'"
+        "   AND NOT EXISTS (SELECT 1 FROM main.sqlite_master AS m"
+        "                   WHERE m.name=s.name)", 0);
+  }
+
+  /* Copy the content of all tables that have storage, including the
+  ** shadow tables of virtual tables.  Then the content of the internal
+  ** sqlite_stat and sqlite_sequence tables, replacing whatever was written
+  ** to them while the other tables were being filled.  */
+  if( rc==SQLITE_OK ){
+    rc = sweepExecEach(db,
+        "SELECT s.name FROM src.sqlite_master AS s, main.sqlite_master AS m"
+        " WHERE s.type='table' AND s.rootpage>0 AND m.name=s.name"
+        "   AND s.name NOT GLOB 'sqlite_*'"
+        " ORDER BY s.rootpage",
+        "INSERT OR REPLACE INTO main.\"%w\" SELECT * FROM src.\"%w\"");
+  }
+  if( rc==SQLITE_OK ){
+    rc = sweepExecEach(db,
+        "SELECT 1 FROM src.sqlite_master WHERE name='sqlite_stat1'",
+        "ANALYZE sqlite_master");
+  }
+  if( rc==SQLITE_OK ){
+    rc = sweepExecEach(db,
+        "SELECT s.name FROM src.sqlite_master AS s, main.sqlite_master AS m"
+        " WHERE s.type='table' AND m.name=s.name AND s.name GLOB 'sqlite_*'",
+        "DELETE FROM main.\"%w\";"
+        "INSERT INTO main.\"%w\" SELECT * FROM src.\"%w\"");
+  }
+
+  /* Indexes, views and triggers last. */
+  if( rc==SQLITE_OK ){
+    rc = sweepExecEach(db,
+        "SELECT sql FROM src.sqlite_master"
+        " WHERE type IN ('index','view','trigger') AND sql IS NOT NULL"
+        " ORDER BY CASE type WHEN 'index' THEN 0"
+        " WHEN 'view' THEN 1 ELSE 2 END", 0);
+  }
+  if( rc==SQLITE_OK ){
+    rc = sweepExec(db, "COMMIT");
+  }
+  sqlite3_close(db);
+  return rc;
+}
+
+/*
+** Run a single query on a new connection and return its latency in
+** milliseconds, or a negative value on error.
+*/
+static double sweepRunQuery(const char *zDb, const char *zSql){
+  sqlite3 *db = 0;
+  sqlite3_stmt *pStmt = 0;
+  double tStart = sweepNow();
+  double tEnd;
+  int rc;
+
+  rc = sqlite3_open_v2(zDb, &db, SQLITE_OPEN_READONLY, SWEEP_VFS_NAME);
+  if( rc==SQLITE_OK ){
+    rc = sqlite3_prepare_v2(db, zSql, -1, &pStmt, 0);
+  }
+  if( rc==SQLITE_OK ){
+    while( (rc = sqlite3_step(pStmt))==SQLITE_ROW ){}
+    if( rc==SQLITE_DONE ) rc = SQLITE_OK;
+  }
+  tEnd = sweepNow();
+  if( rc!=SQLITE_OK ){
+    fprintf(stderr, "%s: %s\n  [%s]\n", zDb, sqlite3_errmsg(db), zSql);
+  }
+  sqlite3_finalize(pStmt);
+  sqlite3_close(db);
+  return rc==SQLITE_OK ? tEnd-tStart : -1.0;
+}
+
+static int sweepCompareDouble(const void *a, const void *b){
+  double x = *(const double*)a;
+  double y = *(const double*)b;
+  return x<y ? -1 : x>y;
+}
+
+/*
+** Parse a comma separated list of page sizes.  Return the number of
+** entries written to aPgsz[], or -1 if the list is malformed.
+*/
+static int sweepParsePgsz(const char *z, int *aPgsz){
+  int n = 0;
+  while( *z ){
+    char *zEnd;
+    long v = strtol(z, &zEnd, 10);
+    if( zEnd==z ) return -1;
+    if( *zEnd=='k' || *zEnd=='K' ){
+      v *= 1024;
+      zEnd++;
+    }
+    if( v<512 || v>65536 || (v & (v-1))!=0 || n>=SWEEP_MAX_PGSZ ) return -1;
+    aPgsz[n++] = (int)v;
+    z = zEnd;
+    if( *z==',' ) z++;
+    else if( *z ) return -1;
+  }
+  return n;
+}
+
+/*
+** Parse a comma separated list of codecs, each optionally followed by
+** ":LEVEL".  Return the number of entries written to aSpec[], or -1 if
+** the list is malformed.
+*/
+static int sweepParseCodec(const char *z, SweepSpec *aSpec){
+  int n = 0;
+  while( *z ){
+    int i = 0;
+    if( n>=SWEEP_MAX_CODEC ) return -1;
+    while( z[i] && z[i]!=',' && z[i]!=':' ) i++;
+    if( i==0 || i>=(int)sizeof(aSpec[n].zName) ) return -1;
+    memcpy(aSpec[n].zName, z, i);
+    aSpec[n].zName[i] = 0;
+    aSpec[n].iLevel = -1;
+    z += i;
+    if( *z==':' ){
+      char *zEnd;
+      aSpec[n].iLevel = (int)strtol(z+1, &zEnd, 10);
+      if( zEnd==z+1 ) return -1;
+      z = zEnd;
+    }
+    n++;
+    if( *z==',' ) z++;
+    else if( *z ) return -1;
+  }
+  return n;
+}
+
+static void usage(const char *zArgv0){
+  fprintf(stderr,
+    "Usage: %s ?OPTIONS? DATABASE QUERYFILE\n"
+    "Options:\n"
+    "   -pagesize LIST   page sizes to measure, e.g. \"1k,4k,64k\"\n"
+    "   -codec LIST      codecs to measure, e.g. \"zlib:9,lz4,ndsc:4\"\n"
+    "   -repeat N        run the query file N times per variant\n"
+    "   -warm            do not evict the database from the page cache\n"
+    "   -dir DIR         directory for the rebuilt databases\n"
+    "   -keep            keep the rebuilt databases\n",
+    zArgv0);
+  exit(1);
+}
+
+int main(int argc, char **argv){
+  const char *zDb = 0;
+  const char *zQueryFile = 0;
+  const char *zDir = ".";
+  const char *zBase;
+  int aPgsz[SWEEP_MAX_PGSZ];
+  SweepSpec aSpec[SWEEP_MAX_CODEC];
+  SweepResult res;
+  struct stat sStat;
+  sqlite3_int64 szSrc = 0;
+  char **azQuery;
+  int nQuery;
+  int nPgsz;
+  int nSpec;
+  int nRepeat = 3;
+  int bWarm = 0;
+  int bKeep = 0;
+  int rc;
+  int i, j, k, q;
+
+  nPgsz = sweepParsePgsz("1k,2k,4k,8k,16k,32k,64k", aPgsz);
+  nSpec = sweepParseCodec("zlib,lz4,lz4hc,ndsc,bsr", aSpec);
+  for(i=1; i<argc; i++){
+    const char *z = argv[i];
+    if( z[0]=='-' && z[1]=='-' ) z++;
+    if( strcmp(z, "-pagesize")==0 && i+1<argc ){
+      nPgsz = sweepParsePgsz(argv[++i], aPgsz);
+      if( nPgsz<=0 ) usage(argv[0]);
+    }else if( strcmp(z, "-codec")==0 && i+1<argc ){
+      nSpec = sweepParseCodec(argv[++i], aSpec);
+      if( nSpec<=0 ) usage(argv[0]);
+    }else if( strcmp(z, "-repeat")==0 && i+1<argc ){
+      nRepeat = atoi(argv[++i]);
+      if( nRepeat<1 ) nRepeat = 1;
+    }else if( strcmp(z, "-dir")==0 && i+1<argc ){
+      zDir = argv[++i];
+    }else if( strcmp(z, "-warm")==0 ){
+      bWarm = 1;
+    }else if( strcmp(z, "-keep")==0 ){
+      bKeep = 1;
+    }else if( z[0]=='-' ){
+      usage(argv[0]);
+    }else if( zDb==0 ){
+      zDb = z;
+    }else if( zQueryFile==0 ){
+      zQueryFile = z;
+    }else{
+      usage(argv[0]);
+    }
+  }
+  if( zDb==0 || zQueryFile==0 ) usage(argv[0]);
+  if( stat(zDb, &sStat)!=0 ){
+    fprintf(stderr, "cannot open \"%s\"\n", zDb);
+    return 1;
+  }
+  szSrc = sStat.st_size;
+  zBase = strrchr(zDb, '/');
+  zBase = zBase ? zBase+1 : zDb;
+
+  rc = sqlite3_initialize();
+  if( rc==SQLITE_OK ){
+    rc = zipvfs_create_vfs_v3(SWEEP_VFS_NAME, "unix", 0, sweepDetector);
+  }
+  if( rc!=SQLITE_OK ){
+    fprintf(stderr, "cannot register the ZIPVFS: %d\n", rc);
+    return 1;
+  }
+
+  azQuery = sweepReadQueries(zQueryFile, &nQuery);
+  if( nQuery==0 ){
+    fprintf(stderr, "no queries in \"%s\"\n", zQueryFile);
+    return 1;
+  }
+  res.aLatency = malloc(sizeof(double)*nQuery*nRepeat);
+  if( res.aLatency==0 ){
+    fprintf(stderr, "out of memory\n");
+    return 1;
+  }
+
+  printf("%s: %lld KiB, %d queries x %d repeats, %s cache\n",
+         zDb, szSrc/1024, nQuery, nRepeat, bWarm ? "warm" : "cold");
+  printf("%-10s %6s %10s %6s %8s %9s %10s %10s %10s %10s %5s\n",
+         "codec", "pgsz", "KiB", "ratio", "build_s", "pages/q", "KiB/q",
+         "p50_ms", "p90_ms", "p99_ms", "err");
+
+  for(j=0; j<nSpec; j++){
+    for(i=0; i<nPgsz; i++){
+      const SweepSpec *pSpec = &aSpec[j];
+      char zCodec[32];
+      char zTag[32];
+      char *zFile;
+      double tBuild;
+      sqlite3_int64 szFile = 0;
+
+      if( pSpec->iLevel>=0 ){
+        sqlite3_snprintf(sizeof(zCodec), zCodec, "%s:%d",
+                         pSpec->zName, pSpec->iLevel);
+        sqlite3_snprintf(sizeof(zTag), zTag, "%s-L%d",
+                         pSpec->zName, pSpec->iLevel);
+      }else{
+        sqlite3_snprintf(sizeof(zCodec), zCodec, "%s", pSpec->zName);
+        sqlite3_snprintf(sizeof(zTag), zTag, "%s", pSpec->zName);
+      }
+      zFile = sqlite3_mprintf("%s/%s-%s-%d.db", zDir, zBase, zTag, aPgsz[i]);
+      if( zFile==0 ){
+        fprintf(stderr, "out of memory\n");
+        return 1;
+      }
+      unlink(zFile);
+
+      tBuild = sweepNow();
+      rc = sweepBuild(zDb, zFile, aPgsz[i], pSpec);
+      tBuild = (sweepNow() - tBuild) / 1000.0;
+      if( rc!=SQLITE_OK ){
+        printf("%-10s %6d  build failed (%s)\n",
+               zCodec, aPgsz[i], sqlite3_errstr(rc));
+        fflush(stdout);
+        unlink(zFile);
+        sqlite3_free(zFile);
+        continue;
+      }
+      if( stat(zFile, &sStat)==0 ) szFile = sStat.st_size;
+
+      memset(&gCount, 0, sizeof(gCount));
+      res.nLatency = 0;
+      res.nErr = 0;
+      for(k=0; k<nRepeat; k++){
+        for(q=0; q<nQuery; q++){
+          double rMs;
+          if( !bWarm ) sweepEvict(zFile);
+          rMs = sweepRunQuery(zFile, azQuery[q]);
+          if( rMs<0.0 ){
+            res.nErr++;
+          }else{
+            res.aLatency[res.nLatency++] = rMs;
+          }
+        }
+      }
+      res.nRecord = gCount.nRecord;
+      res.nByteOut = gCount.nByteOut;
+
+      if( res.nLatency>0 ){
+        int n = res.nLatency;
+        int nRun = nQuery*nRepeat;
+        qsort(res.aLatency, n, sizeof(double), sweepCompareDouble);
+        printf("%-10s %6d %10lld %6.2f %8.1f %9.1f %10.1f"
+               " %10.3f %10.3f %10.3f %5d\n",
+               zCodec, aPgsz[i], szFile/1024,
+               szFile>0 ? (double)szSrc/szFile : 0.0, tBuild,
+               (double)res.nRecord/nRun, res.nByteOut/1024.0/nRun,
+               res.aLatency[n/2], res.aLatency[(n*9)/10],
+               res.aLatency[(n*99)/100], res.nErr);
+      }else{
+        printf("%-10s %6d %10lld %6.2f %8.1f  no successful queries"
+               " (%d errors)\n",
+               zCodec, aPgsz[i], szFile/1024,
+               szFile>0 ? (double)szSrc/szFile : 0.0, tBuild, res.nErr);
+      }
+      fflush(stdout);
+      if( !bKeep ) unlink(zFile);
+      sqlite3_free(zFile);
+    }
+  }
+
+  free(res.aLatency);
+  for(q=0; q<nQuery; q++) free(azQuery[q]);
+  free(azQuery);
+  zipvfs_destroy_vfs(SWEEP_VFS_NAME);
+  return 0;
+}
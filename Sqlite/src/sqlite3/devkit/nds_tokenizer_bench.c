@@ -0,0 +1,652 @@
+/*
+** This version of SQLite is specially prepared for the
+** Navigation Data Standard e.V.  Use by license only.
+**
+** This file implements a command-line program that measures the
+** throughput of the ndsunicode61 full-text tokenizer.  Two corpora shaped
+** like the content of the POI and name full-text tables are generated
+** (Latin, Chinese, Japanese, Korean and Thai names, categories and streets,
+** and phone numbers), or one is read from a file.  Every corpus is
+** tokenized with each set of tokenizer options, and one line is printed
+** per script with the number of texts, bytes, tokens and allocations, the
+** time taken and the resulting tokens/s and bytes/s.
+**
+** Usage:
+**
+**    nds_tokenizer_bench ?OPTIONS?
+**
+** Options:
+**
+**    -options LIST    Tokenizer options separated by spaces, for example
+**                     "remove_diacritics=0 edge_ngrams=2:5".  May be
+**                     repeated; replaces the built-in list of option sets.
+**    -corpus FILE     Tokenize the lines of FILE, one text per line, each
+**                     classified by its script, instead of the generated
+**                     corpora.
+**    -count N         Number of texts per generated corpus (default 20000).
+**    -seed N          Seed of the generated corpora (default 1).
+**    -repeat N        Tokenize every corpus N times per option set and
+**                     report the fastest run (default 5).
+**    -query           Tokenize the texts as MATCH expressions instead of
+**                     documents.
+**
+** The corpora only depend on the seed and the count, so the counts of
+** texts, bytes, tokens and allocations are the same from run to run and
+** changes of the tokenizer can be compared on them as well as on time.
+** Allocations are those of the last run made through sqlite3_malloc() and
+** sqlite3_realloc(), counted by wrapping the allocator of SQLite.  The
+** tokenizer allocates its cursors and buffers with the allocator of the C
+** library, which is not counted.  They are shown as "-" if the allocator
+** could not be wrapped.
+*/
+#include "nds_sqlite3.h"
+#include "extensions/nds_extensions.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/*
+** Count the allocations made through sqlite3_malloc() and
+** sqlite3_realloc().  The default allocator of SQLite is wrapped before
+** the library is initialized.
+*/
+static sqlite3_mem_methods benchDefaultMem;
+static int bCountAllocations = 0;
+static sqlite3_int64 nAllocation = 0;
+
+static void *benchMemMalloc(int n){
+  nAllocation++;
+  return benchDefaultMem.xMalloc(n);
+}
+static void *benchMemRealloc(void *p, int n){
+  nAllocation++;
+  return benchDefaultMem.xRealloc(p, n);
+}
+
+/*
+** Install the counting allocator.  Allocations are not counted if SQLite
+** does not accept it.
+*/
+static void benchCountAllocations(void){
+  sqlite3_mem_methods m;
+  if( sqlite3_config(SQLITE_CONFIG_GETMALLOC, &benchDefaultMem)!=SQLITE_OK ){
+    return;
+  }
+  m = benchDefaultMem;
+  m.xMalloc = benchMemMalloc;
+  m.xRealloc = benchMemRealloc;
+  bCountAllocations = sqlite3_config(SQLITE_CONFIG_MALLOC, &m)==SQLITE_OK;
+}
+
+#define BENCH_MAX_OPTIONS  32
+#define BENCH_MAX_ARGS     16
+
+/*
+** Scripts the texts are grouped by.  BENCH_PHONE is for texts made of
+** digits and punctuation only.
+*/
+#define BENCH_LATIN     0
+#define BENCH_CHINESE   1
+#define BENCH_JAPANESE  2
+#define BENCH_KOREAN    3
+#define BENCH_THAI      4
+#define BENCH_PHONE     5
+#define BENCH_N_SCRIPT  6
+
+static const char *const azScriptName[BENCH_N_SCRIPT] = {
+  "latin", "chinese", "japanese", "korean", "thai", "phone"
+};
+
+/*
+** Words the generated texts are made of.  The strings are UTF-8.
+*/
+static const char *const LATIN_NAMES[] = {
+  "Hauptbahnhof", "Caf\xc3\xa9 Central", "B\xc3\xa4" "ckerei M\xc3\xbcller",
+  "Saint-\xc3\x89tienne", "Gasthof zur Post", "Stadtmuseum", "Marienplatz",
+  "H\xc3\xb4tel de Ville", "Apotheke am Markt", "Pizzeria Roma", "Sparkasse",
+  "Kr\xc3\xa4mer", "Brasserie du Nord", "Fu\xc3\x9f" "ballstadion",
+  "Ni\xc3\xb1o Bonito"
+};
+static const char *const LATIN_CATEGORIES[] = {
+  "restaurant", "petrol station", "parking", "pharmacy", "hotel",
+  "supermarket", "bank", "museum", "railway station", "bakery"
+};
+static const char *const LATIN_STREETS[] = {
+  "Hauptstra\xc3\x9f" "e", "Bahnhofstra\xc3\x9f" "e", "Rue de la Paix",
+  "Avenue Foch", "Schillerplatz", "Goethestra\xc3\x9f" "e", "Via Roma",
+  "Calle Mayor"
+};
+static const char *const CHINESE_NAMES[] = {
+  "\xe5\x8c\x97\xe4\xba\xac\xe7\x81\xab\xe8\xbd\xa6\xe7\xab\x99",
+  "\xe4\xb8\x8a\xe6\xb5\xb7\xe5\xa4\xa7\xe9\xa5\xad\xe5\xba\x97",
+  "\xe4\xb8\xad\xe5\x9b\xbd\xe9\x93\xb6\xe8\xa1\x8c",
+  "\xe4\xba\xba\xe6\xb0\x91\xe5\xb9\xbf\xe5\x9c\xba",
+  "\xe5\x8f\x8b\xe8\xb0\x8a\xe5\x8c\xbb\xe9\x99\xa2",
+  "\xe5\x8d\x8e\xe8\x81\x94\xe8\xb6\x85\xe5\xb8\x82",
+  "\xe5\xa4\xa9\xe5\xae\x89\xe9\x97\xa8",
+  "\xe8\xa5\xbf\xe6\xb9\x96\xe5\x85\xac\xe5\x9b\xad"
+};
+static const char *const CHINESE_CATEGORIES[] = {
+  "\xe9\xa4\x90\xe5\x8e\x85", "\xe5\x8a\xa0\xe6\xb2\xb9\xe7\xab\x99",
+  "\xe5\x81\x9c\xe8\xbd\xa6\xe5\x9c\xba", "\xe8\x8d\xaf\xe5\xba\x97",
+  "\xe5\xae\xbe\xe9\xa6\x86", "\xe9\x93\xb6\xe8\xa1\x8c"
+};
+static const char *const CHINESE_STREETS[] = {
+  "\xe4\xb8\xad\xe5\xb1\xb1\xe8\xb7\xaf",
+  "\xe4\xba\xba\xe6\xb0\x91\xe5\xa4\xa7\xe9\x81\x93",
+  "\xe5\xbb\xba\xe5\x9b\xbd\xe9\x97\xa8\xe5\xa4\x96\xe5\xa4\xa7\xe8\xa1\x97",
+  "\xe5\x8d\x97\xe4\xba\xac\xe4\xb8\x9c\xe8\xb7\xaf"
+};
+static const char *const JAPANESE_NAMES[] = {
+  "\xe6\x9d\xb1\xe4\xba\xac\xe9\xa7\x85",
+  "\xe3\x81\x95\xe3\x81\x8f\xe3\x82\x89\xe3\x83\x9b\xe3\x83\x86\xe3\x83\xab",
+  "\xe6\xb8\x8b\xe8\xb0\xb7\xe9\x83\xb5\xe4\xbe\xbf\xe5\xb1\x80",
+  "\xe3\x83\xa9\xe3\x83\xbc\xe3\x83\xa1\xe3\x83\xb3\xe4\xb8\x80\xe7\x95\xaa",
+  "\xe3\x82\xbb\xe3\x83\x96\xe3\x83\xb3\xe3\x82\xa4\xe3\x83\xac\xe3\x83\x96\xe3\x83\xb3",
+  "\xe3\x81\xb2\xe3\x81\xbe\xe3\x82\x8f\xe3\x82\x8a\xe5\xb9\xbc\xe7\xa8\x9a\xe5\x9c\x92",
+  "\xef\xbe\x8a\xef\xbe\x9d\xef\xbe\x8a\xef\xbe\x9e\xef\xbd\xb0\xef\xbd\xb6\xef\xbe\x9e\xef\xbd\xb0"
+};
+static const char *const JAPANESE_CATEGORIES[] = {
+  "\xe3\x83\xac\xe3\x82\xb9\xe3\x83\x88\xe3\x83\xa9\xe3\x83\xb3",
+  "\xe3\x82\xac\xe3\x82\xbd\xe3\x83\xaa\xe3\x83\xb3\xe3\x82\xb9\xe3\x82\xbf\xe3\x83\xb3\xe3\x83\x89",
+  "\xe9\xa7\x90\xe8\xbb\x8a\xe5\xa0\xb4", "\xe8\x96\xac\xe5\xb1\x80",
+  "\xe3\x82\xb3\xe3\x83\xb3\xe3\x83\x93\xe3\x83\x8b"
+};
+static const char *const JAPANESE_STREETS[] = {
+  "\xe4\xb8\xb8\xe3\x81\xae\xe5\x86\x85\xe4\xb8\x80\xe4\xb8\x81\xe7\x9b\xae",
+  "\xe5\x8d\x83\xe4\xbb\xa3\xe7\x94\xb0\xe5\x8c\xba",
+  "\xe6\x96\xb0\xe5\xae\xbf\xe9\x80\x9a\xe3\x82\x8a",
+  "\xe8\xa1\xa8\xe5\x8f\x82\xe9\x81\x93"
+};
+static const char *const KOREAN_NAMES[] = {
+  "\xec\x84\x9c\xec\x9a\xb8\xec\x97\xad",
+  "\xea\xb0\x95\xeb\x82\xa8\xeb\xb3\x91\xec\x9b\x90",
+  "\xec\x8b\xa0\xed\x95\x9c\xec\x9d\x80\xed\x96\x89",
+  "\xed\x95\x9c\xea\xb0\x95\xea\xb3\xb5\xec\x9b\x90",
+  "\xeb\xaa\x85\xeb\x8f\x99\xec\xb9\xbc\xea\xb5\xad\xec\x88\x98",
+  "\xeb\xa1\xaf\xeb\x8d\xb0\xeb\xa7\x88\xed\x8a\xb8"
+};
+static const char *const KOREAN_CATEGORIES[] = {
+  "\xec\x8b\x9d\xeb\x8b\xb9", "\xec\xa3\xbc\xec\x9c\xa0\xec\x86\x8c",
+  "\xec\xa3\xbc\xec\xb0\xa8\xec\x9e\xa5", "\xec\x95\xbd\xea\xb5\xad",
+  "\xed\x98\xb8\xed\x85\x94", "\xec\xb9\xb4\xed\x8e\x98"
+};
+static const char *const KOREAN_STREETS[] = {
+  "\xed\x85\x8c\xed\x97\xa4\xeb\x9e\x80\xeb\xa1\x9c",
+  "\xec\x84\xb8\xec\xa2\x85\xeb\x8c\x80\xeb\xa1\x9c",
+  "\xec\x98\xac\xeb\xa6\xbc\xed\x94\xbd\xeb\xa1\x9c"
+};
+static const char *const THAI_NAMES[] = {
+
+  "\xe0\xb8\xaa\xe0\xb8\x96\xe0\xb8\xb2\xe0\xb8\x99\xe0\xb8\xb5\xe0\xb8\x81\xe0\xb8\xa3\xe0\xb8\xb8\xe0\xb8\x87\xe0\xb9\x80\xe0\xb8\x97\xe0\xb8\x9e",
+  "\xe0\xb9\x82\xe0\xb8\xa3\xe0\xb8\x87\xe0\xb9\x81\xe0\xb8\xa3\xe0\xb8\xa1\xe0\xb8\xaa\xe0\xb8\xa2\xe0\xb8\xb2\xe0\xb8\xa1",
+  "\xe0\xb8\x98\xe0\xb8\x99\xe0\xb8\xb2\xe0\xb8\x84\xe0\xb8\xb2\xe0\xb8\xa3\xe0\xb8\x81\xe0\xb8\xa3\xe0\xb8\xb8\xe0\xb8\x87\xe0\xb9\x84\xe0\xb8\x97\xe0\xb8\xa2",
+  "\xe0\xb8\x95\xe0\xb8\xa5\xe0\xb8\xb2\xe0\xb8\x94\xe0\xb8\x99\xe0\xb8\xb1\xe0\xb8\x94\xe0\xb8\x88\xe0\xb8\x95\xe0\xb8\xb8\xe0\xb8\x88\xe0\xb8\xb1\xe0\xb8\x81\xe0\xb8\xa3"
+};
+static const char *const THAI_CATEGORIES[] = {
+
+  "\xe0\xb8\xa3\xe0\xb9\x89\xe0\xb8\xb2\xe0\xb8\x99\xe0\xb8\xad\xe0\xb8\xb2\xe0\xb8\xab\xe0\xb8\xb2\xe0\xb8\xa3",
+  "\xe0\xb8\x9b\xe0\xb8\xb1\xe0\xb9\x8a\xe0\xb8\xa1\xe0\xb8\x99\xe0\xb9\x89\xe0\xb8\xb3\xe0\xb8\xa1\xe0\xb8\xb1\xe0\xb8\x99",
+  "\xe0\xb8\x97\xe0\xb8\xb5\xe0\xb9\x88\xe0\xb8\x88\xe0\xb8\xad\xe0\xb8\x94\xe0\xb8\xa3\xe0\xb8\x96",
+  "\xe0\xb9\x82\xe0\xb8\xa3\xe0\xb8\x87\xe0\xb8\x9e\xe0\xb8\xa2\xe0\xb8\xb2\xe0\xb8\x9a\xe0\xb8\xb2\xe0\xb8\xa5"
+};
+static const char *const THAI_STREETS[] = {
+
+  "\xe0\xb8\x96\xe0\xb8\x99\xe0\xb8\x99\xe0\xb8\xaa\xe0\xb8\xb8\xe0\xb8\x82\xe0\xb8\xb8\xe0\xb8\xa1\xe0\xb8\xa7\xe0\xb8\xb4\xe0\xb8\x97",
+  "\xe0\xb8\x96\xe0\xb8\x99\xe0\xb8\x99\xe0\xb8\xaa\xe0\xb8\xb5\xe0\xb8\xa5\xe0\xb8\xa1",
+  "\xe0\xb8\x96\xe0\xb8\x99\xe0\xb8\x99\xe0\xb8\x9e\xe0\xb8\xa3\xe0\xb8\xb0\xe0\xb8\xa3\xe0\xb8\xb2\xe0\xb8\xa1\xe0\xb9\x80\xe0\xb8\x81\xe0\xb9\x89\xe0\xb8\xb2"
+};
+
+#define BENCH_WORDS(X) X, (int)(sizeof(X)/sizeof(X[0]))
+
+/*
+** Words and phone number prefix of one script.
+*/
+typedef struct BenchWords BenchWords;
+struct BenchWords {
+  const char *const *azName;      /* Names of POIs */
+  int nName;
+  const char *const *azCategory;  /* Categories of POIs */
+  int nCategory;
+  const char *const *azStreet;    /* Streets */
+  int nStreet;
+  const char *zPhonePrefix;       /* Country code of the phone numbers */
+};
+
+static const BenchWords aWords[BENCH_PHONE] = {
+  { BENCH_WORDS(LATIN_NAMES), BENCH_WORDS(LATIN_CATEGORIES),
+    BENCH_WORDS(LATIN_STREETS), "+49" },
+  { BENCH_WORDS(CHINESE_NAMES), BENCH_WORDS(CHINESE_CATEGORIES),
+    BENCH_WORDS(CHINESE_STREETS), "+86" },
+  { BENCH_WORDS(JAPANESE_NAMES), BENCH_WORDS(JAPANESE_CATEGORIES),
+    BENCH_WORDS(JAPANESE_STREETS), "+81" },
+  { BENCH_WORDS(KOREAN_NAMES), BENCH_WORDS(KOREAN_CATEGORIES),
+    BENCH_WORDS(KOREAN_STREETS), "+82" },
+  { BENCH_WORDS(THAI_NAMES), BENCH_WORDS(THAI_CATEGORIES),
+    BENCH_WORDS(THAI_STREETS), "+66" },
+};
+
+/*
+** Option sets measured unless -options is given.
+*/
+static const char *const azDefaultOptions[] = {
+  "",
+  "remove_diacritics=0",
+  "kana_fold=1",
+  "edge_ngrams=2:5",
+  "cjk_ngram=1,2",
+  "query_bigram_cover=1",
+  "hangul_choseong=1",
+  "phone_numbers=1",
+  "token_cache=4096",
+};
+
+/*
+** The texts of one script of a corpus.
+*/
+typedef struct BenchGroup BenchGroup;
+struct BenchGroup {
+  char **azText;                  /* NUL-terminated texts */
+  int nText;                      /* Number of entries in azText[] */
+  int nAlloc;                     /* Allocated size of azText[] */
+  sqlite3_int64 nByte;            /* Total size of the texts in bytes */
+};
+
+/*
+** A corpus, its texts grouped by script.
+*/
+typedef struct BenchCorpus BenchCorpus;
+struct BenchCorpus {
+  const char *zName;
+  BenchGroup aGroup[BENCH_N_SCRIPT];
+};
+
+/*
+** Return the current time in milliseconds from a monotonic clock.
+*/
+static double benchNow(void){
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec*1000.0 + ts.tv_nsec/1000000.0;
+}
+
+/*
+** Return a pseudo-random number in the range 0..32767.  The same seed
+** always gives the same sequence, on all platforms.
+*/
+static int benchRand(unsigned int *pSeed){
+  *pSeed = *pSeed*1103515245 + 12345;
+  return (int)((*pSeed>>16) & 0x7fff);
+}
+
+static const char *benchPick(unsigned int *pSeed, const char *const *az, int n){
+  return az[benchRand(pSeed) % n];
+}
+
+static void *benchMalloc(size_t n){
+  void *p = malloc(n);
+  if( p==0 ){
+    fprintf(stderr, "out of memory\n");
+    exit(1);
+  }
+  return p;
+}
+
+/*
+** Add a copy of a text to a group.
+*/
+static void benchAddText(BenchGroup *p, const char *zText){
+  int n = (int)strlen(zText);
+  if( p->nText==p->nAlloc ){
+    p->nAlloc = p->nAlloc ? p->nAlloc*2 : 256;
+    p->azText = realloc(p->azText, p->nAlloc*sizeof(char*));
+    if( p->azText==0 ){
+      fprintf(stderr, "out of memory\n");
+      exit(1);
+    }
+  }
+  p->azText[p->nText] = benchMalloc(n+1);
+  memcpy(p->azText[p->nText], zText, n+1);
+  p->nText++;
+  p->nByte += n;
+}
+
+/*
+** Write a phone number in one of a few national and international formats.
+*/
+static void benchPhone(unsigned int *pSeed, const char *zPrefix, char *zOut){
+  int a = 10 + benchRand(pSeed)%90;
+  int b = 1000 + benchRand(pSeed)%9000;
+  int c = benchRand(pSeed)%1000;
+  switch( benchRand(pSeed)%4 ){
+    case 0:  sprintf(zOut, "%s %d %d-%03d", zPrefix, a, b, c); break;
+    case 1:  sprintf(zOut, "(0%d) %d %03d", a, b, c); break;
+    case 2:  sprintf(zOut, "00%s-%d-%d%03d", zPrefix+1, a, b, c); break;
+    default: sprintf(zOut, "0%d/%d%03d", a, b, c); break;
+  }
+}
+
+/*
+** Generate the POI corpus (name, category, street and house number, and
+** sometimes a phone number) or the name corpus (a name, sometimes with its
+** street).  The scripts take turns, phone numbers are one text in six.
+*/
+static void benchGenerate(BenchCorpus *p, int bPoi, int nText, unsigned int iSeed){
+  char zText[512];
+  char zPhone[64];
+  int i;
+  for(i=0; i<nText; i++){
+    int iScript = i % BENCH_N_SCRIPT;
+    const BenchWords *pW = &aWords[iScript];
+    if( iScript==BENCH_PHONE ){
+      benchPhone(&iSeed, aWords[benchRand(&iSeed)%BENCH_PHONE].zPhonePrefix, zText);
+    }else if( bPoi ){
+      sprintf(zText, "%s %s %s %d",
+              benchPick(&iSeed, pW->azName, pW->nName),
+              benchPick(&iSeed, pW->azCategory, pW->nCategory),
+              benchPick(&iSeed, pW->azStreet, pW->nStreet),
+              1 + benchRand(&iSeed)%200);
+      if( benchRand(&iSeed)%3==0 ){
+        benchPhone(&iSeed, pW->zPhonePrefix, zPhone);
+        strcat(zText, " ");
+        strcat(zText, zPhone);
+      }
+    }else if( benchRand(&iSeed)%2==0 ){
+      sprintf(zText, "%s", benchPick(&iSeed, pW->azName, pW->nName));
+    }else{
+      sprintf(zText, "%s %s",
+              benchPick(&iSeed, pW->azName, pW->nName),
+              benchPick(&iSeed, pW->azStreet, pW->nStreet));
+    }
+    benchAddText(&p->aGroup[iScript], zText);
+  }
+}
+
+/*
+** Return the script of a text: the first of Korean, Japanese (kana),
+** Thai, Chinese (ideographs) and Latin that the text has a letter of, or
+** BENCH_PHONE if it has none.
+*/
+static int benchClassify(const char *zText){
+  const unsigned char *z = (const unsigned char*)zText;
+  int aSeen[BENCH_N_SCRIPT];
+  int i;
+  memset(aSeen, 0, sizeof(aSeen));
+  while( *z ){
+    unsigned int c = *z++;
+    if( c>=0xc0 ){
+      int nExtra = c>=0xf0 ? 3 : c>=0xe0 ? 2 : 1;
+      c &= (0x3f >> nExtra);
+      while( nExtra-- && (*z & 0xc0)==0x80 ) c = (c<<6) | (*z++ & 0x3f);
+    }
+    if( (c>='a' && c<='z') || (c>='A' && c<='Z') || (c>=0xc0 && c<0x250) ){
+      aSeen[BENCH_LATIN] = 1;
+    }else if( (c>=0x1100 && c<0x1200) || (c>=0x3130 && c<0x3190)
+           || (c>=0xac00 && c<0xd7b0) ){
+      aSeen[BENCH_KOREAN] = 1;
+    }else if( (c>=0x3040 && c<0x3100) || (c>=0xff66 && c<0xffa0) ){
+      aSeen[BENCH_JAPANESE] = 1;
+    }else if( c>=0xe00 && c<0xe80 ){
+      aSeen[BENCH_THAI] = 1;
+    }else if( (c>=0x3400 && c<0xa000) || (c>=0xf900 && c<0xfb00) ){
+      aSeen[BENCH_CHINESE] = 1;
+    }
+  }
+  {
+    static const int aOrder[] = {
+      BENCH_KOREAN, BENCH_JAPANESE, BENCH_THAI, BENCH_CHINESE, BENCH_LATIN
+    };
+    for(i=0; i<(int)(sizeof(aOrder)/sizeof(aOrder[0])); i++){
+      if( aSeen[aOrder[i]] ) return aOrder[i];
+    }
+  }
+  return BENCH_PHONE;
+}
+
+/*
+** Read the lines of a file into a corpus.
+*/
+static void benchLoad(BenchCorpus *p, const char *zFile){
+  FILE *in = fopen(zFile, "rb");
+  char zLine[4096];
+  if( in==0 ){
+    fprintf(stderr, "cannot open \"%s\"\n", zFile);
+    exit(1);
+  }
+  while( fgets(zLine, sizeof(zLine), in) ){
+    int n = (int)strlen(zLine);
+    while( n>0 && (zLine[n-1]=='\n' || zLine[n-1]=='\r') ) zLine[--n] = 0;
+    if( n==0 ) continue;
+    benchAddText(&p->aGroup[benchClassify(zLine)], zLine);
+  }
+  fclose(in);
+}
+
+/*
+** Create a tokenizer from a list of options separated by spaces.
+*/
+static sqlite3_tokenizer *benchCreateTokenizer(
+  const sqlite3_tokenizer_module *pModule,
+  const char *zOptions
+){
+  char zCopy[1024];
+  const char *azArg[BENCH_MAX_ARGS];
+  sqlite3_tokenizer *pTokenizer = 0;
+  char *z;
+  int nArg = 0;
+  int rc;
+
+  if( strlen(zOptions)>=sizeof(zCopy) ){
+    fprintf(stderr, "options too long: \"%s\"\n", zOptions);
+    exit(1);
+  }
+  strcpy(zCopy, zOptions);
+  for(z=strtok(zCopy, " "); z; z=strtok(0, " ")){
+    if( nArg==BENCH_MAX_ARGS ){
+      fprintf(stderr, "too many options: \"%s\"\n", zOptions);
+      exit(1);
+    }
+    azArg[nArg++] = z;
+  }
+  rc = pModule->xCreate(nArg, azArg, &pTokenizer);
+  if( rc!=SQLITE_OK ){
+    fprintf(stderr, "invalid tokenizer options: \"%s\"\n", zOptions);
+    exit(1);
+  }
+  pTokenizer->pModule = pModule;
+  return pTokenizer;
+}
+
+/*
+** Tokenize all texts of a group as FTS does, and return the number of
+** tokens.
+*/
+static sqlite3_int64 benchTokenize(
+  sqlite3_tokenizer *pTokenizer,
+  const BenchGroup *p,
+  int bQuery
+){
+  const sqlite3_tokenizer_module *pModule = pTokenizer->pModule;
+  sqlite3_int64 nToken = 0;
+  int i;
+  for(i=0; i<p->nText; i++){
+    const char *zText = p->azText[i];
+    sqlite3_tokenizer_cursor *pCsr = 0;
+    const char *zToken;
+    int nToken1, iStart, iEnd, iPos;
+    int rc = pModule->xOpen(pTokenizer, zText,
+                            bQuery ? (int)strlen(zText) : -1, &pCsr);
+    if( rc!=SQLITE_OK ){
+      fprintf(stderr, "cannot tokenize \"%s\": %d\n", zText, rc);
+      exit(1);
+    }
+    pCsr->pTokenizer = pTokenizer;
+    while( (rc = pModule->xNext(pCsr, &zToken, &nToken1, &iStart, &iEnd,
+                                &iPos))==SQLITE_OK ){
+      nToken++;
+    }
+    pModule->xClose(pCsr);
+    if( rc!=SQLITE_DONE ){
+      fprintf(stderr, "cannot tokenize \"%s\": %d\n", zText, rc);
+      exit(1);
+    }
+  }
+  return nToken;
+}
+
+/*
+** Print one line of results.
+*/
+static void benchReport(
+  const char *zCorpus,
+  const char *zScript,
+  int nText,
+  sqlite3_int64 nByte,
+  sqlite3_int64 nToken,
+  sqlite3_int64 nAlloc,
+  double rMs
+){
+  char zAlloc[32];
+  double rSec = rMs>0.0 ? rMs/1000.0 : 1e-9;
+  if( bCountAllocations ){
+    sprintf(zAlloc, "%lld", nAlloc);
+  }else{
+    strcpy(zAlloc, "-");
+  }
+  printf("%-6s %-9s %8d %10lld %10lld %9s %9.3f %10.0f %8.2f\n",
+         zCorpus, zScript, nText, nByte, nToken, zAlloc, rMs,
+         nToken/rSec, nByte/rSec/1000000.0);
+}
+
+/*
+** Measure one option set on one corpus.
+*/
+static void benchRun(
+  sqlite3_tokenizer *pTokenizer,
+  const BenchCorpus *pCorpus,
+  int nRepeat,
+  int bQuery
+){
+  int nText = 0;
+  sqlite3_int64 nByte = 0, nToken = 0, nAlloc = 0;
+  double rMs = 0.0;
+  int i, k;
+  for(i=0; i<BENCH_N_SCRIPT; i++){
+    const BenchGroup *p = &pCorpus->aGroup[i];
+    sqlite3_int64 nToken1 = 0, nAlloc1 = 0;
+    double rBest = 0.0;
+    if( p->nText==0 ) continue;
+    for(k=0; k<nRepeat; k++){
+      sqlite3_int64 iAlloc = nAllocation;
+      double tStart = benchNow();
+      double rMs1;
+      nToken1 = benchTokenize(pTokenizer, p, bQuery);
+      rMs1 = benchNow() - tStart;
+      nAlloc1 = nAllocation - iAlloc;
+      if( k==0 || rMs1<rBest ) rBest = rMs1;
+    }
+    benchReport(pCorpus->zName, azScriptName[i], p->nText, p->nByte,
+                nToken1, nAlloc1, rBest);
+    nText += p->nText;
+    nByte += p->nByte;
+    nToken += nToken1;
+    nAlloc += nAlloc1;
+    rMs += rBest;
+  }
+  benchReport(pCorpus->zName, "total", nText, nByte, nToken, nAlloc, rMs);
+}
+
+static void usage(const char *zArgv0){
+  fprintf(stderr,
+    "Usage: %s ?OPTIONS?\n"
+    "Options:\n"
+    "   -options LIST    tokenizer options separated by spaces (may be repeated)\n"
+    "   -corpus FILE     tokenize the lines of FILE instead of generated texts\n"
+    "   -count N         number of texts per generated corpus\n"
+    "   -seed N          seed of the generated corpora\n"
+    "   -repeat N        report the fastest of N runs\n"
+    "   -query           tokenize the texts as MATCH expressions\n",
+    zArgv0);
+  exit(1);
+}
+
+int main(int argc, char **argv){
+  const char *azOptions[BENCH_MAX_OPTIONS];
+  const char *zCorpus = 0;
+  const sqlite3_tokenizer_module *pModule = 0;
+  BenchCorpus aCorpus[2];
+  int nCorpus;
+  int nOptions = 0;
+  int nText = 20000;
+  unsigned int iSeed = 1;
+  int nRepeat = 5;
+  int bQuery = 0;
+  int i, j, k;
+
+  benchCountAllocations();
+  for(i=1; i<argc; i++){
+    const char *z = argv[i];
+    if( z[0]=='-' && z[1]=='-' ) z++;
+    if( strcmp(z, "-options")==0 && i+1<argc ){
+      if( nOptions>=BENCH_MAX_OPTIONS ) usage(argv[0]);
+      azOptions[nOptions++] = argv[++i];
+    }else if( strcmp(z, "-corpus")==0 && i+1<argc ){
+      zCorpus = argv[++i];
+    }else if( strcmp(z, "-count")==0 && i+1<argc ){
+      nText = atoi(argv[++i]);
+      if( nText<1 ) nText = 1;
+    }else if( strcmp(z, "-seed")==0 && i+1<argc ){
+      iSeed = (unsigned int)strtoul(argv[++i], 0, 10);
+    }else if( strcmp(z, "-repeat")==0 && i+1<argc ){
+      nRepeat = atoi(argv[++i]);
+      if( nRepeat<1 ) nRepeat = 1;
+    }else if( strcmp(z, "-query")==0 ){
+      bQuery = 1;
+    }else{
+      usage(argv[0]);
+    }
+  }
+  if( nOptions==0 ){
+    for(i=0; i<(int)(sizeof(azDefaultOptions)/sizeof(azDefaultOptions[0])); i++){
+      azOptions[nOptions++] = azDefaultOptions[i];
+    }
+  }
+
+  memset(aCorpus, 0, sizeof(aCorpus));
+  if( zCorpus ){
+    aCorpus[0].zName = "file";
+    benchLoad(&aCorpus[0], zCorpus);
+    nCorpus = 1;
+  }else{
+    aCorpus[0].zName = "poi";
+    benchGenerate(&aCorpus[0], 1, nText, iSeed);
+    aCorpus[1].zName = "name";
+    benchGenerate(&aCorpus[1], 0, nText, iSeed);
+    nCorpus = 2;
+  }
+
+  sqlite3Fts3NdsUnicodeTokenizer(&pModule);
+
+  printf("%s, best of %d runs, time in ms\n",
+         bQuery ? "queries" : "documents", nRepeat);
+  for(j=0; j<nOptions; j++){
+    sqlite3_tokenizer *pTokenizer = benchCreateTokenizer(pModule, azOptions[j]);
+    printf("\noptions: %s\n", azOptions[j][0] ? azOptions[j] : "(defaults)");
+    printf("%-6s %-9s %8s %10s %10s %9s %9s %10s %8s\n",
+           "corpus", "script", "texts", "bytes", "tokens", "allocs", "ms",
+           "tokens/s", "MB/s");
+    for(k=0; k<nCorpus; k++){
+      benchRun(pTokenizer, &aCorpus[k], nRepeat, bQuery);
+    }
+    pModule->xDestroy(pTokenizer);
+  }
+
+  for(k=0; k<nCorpus; k++){
+    for(i=0; i<BENCH_N_SCRIPT; i++){
+      for(j=0; j<aCorpus[k].aGroup[i].nText; j++) free(aCorpus[k].aGroup[i].azText[j]);
+      free(aCorpus[k].aGroup[i].azText);
+    }
+  }
+  return 0;
+}
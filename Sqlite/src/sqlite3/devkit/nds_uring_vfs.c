@@ -0,0 +1,1064 @@
+/*
+** This version of SQLite is specially prepared for the
+** Navigation Data Standard e.V.  Use by license only.
+**
+** This file implements a shim VFS that sits underneath ZIPVFS and reads
+** database pages using the Linux io_uring interface.
+**
+** The default unix VFS services every xRead() request with a single
+** pread() system call.  On a cold page cache each of those calls blocks
+** on a random read from flash, so a full-text query that touches a few
+** hundred pages spends most of its time waiting for one read at a time.
+** The shim in this file improves on that in three ways:
+**
+**   (1) All chunks of a read-ahead window, including the one that a read
+**       is waiting for, are submitted to an io_uring instance in a single
+**       io_uring_enter() call, so the device sees several outstanding
+**       requests at once instead of one pread() after another.
+**
+**   (2) Reads that land close to one of the last few reads are treated
+**       as part of a local stream.  ZIPVFS alternates between the page map
+**       near the start of the file and the compressed page records, and
+**       records of neighbouring b-tree pages are usually stored close to
+**       each other, so up to NDS_URING_STREAMS such streams are tracked.
+**       For a local read, whole NDS_URING_CHUNK byte chunks are fetched
+**       into read-ahead slots.  The window doubles on each further local
+**       read of the stream and collapses again on a random read.
+**
+**   (3) The kernel is told via posix_fadvise(POSIX_FADV_RANDOM) not to do
+**       its own read-ahead on the descriptor used by the shim, so that
+**       random page reads do not drag in unwanted neighbouring blocks.
+**
+** Only reads of the main database file go through io_uring.  Writes,
+** locking, journals and everything else are passed unchanged to the
+** parent VFS.  If io_uring is not available (older kernels, seccomp
+** filters, or builds without NDS_ENABLE_IO_URING) the shim falls back to
+** the parent's xRead() method, which is the ordinary pread() path.
+**
+** The read-ahead buffers are discarded whenever the file is written or
+** truncated and whenever a new read transaction starts (a transition out
+** of SQLITE_LOCK_NONE or a WAL-mode xShmLock()), so that content written
+** by other connections is never served from a stale buffer.
+**
+** The shim reads through a second read-only descriptor for each database
+** file.  Since closing any descriptor drops all POSIX advisory locks held
+** by the process on that file, these descriptors are shared per inode
+** and are only closed after the last shim file for that inode has been
+** closed.  As with the other SQLite VFSes, the same database file should
+** not be opened through this shim and through an unrelated VFS at the
+** same time from within one process.
+**
+** Use nds_uring_initialize() to register the shim as "uring" together
+** with a ZIPVFS instance named "zipvfs_uring" that uses the shim as its
+** parent.  The benchmark in nds_vfs_bench.c compares "zipvfs_uring" with
+** the regular "zipvfsonly" VFS on cold-cache FTS queries.
+*/
+#include "nds_sqlite3.h"
+#include "nds_uring_vfs.h"
+#include <string.h>
+#include <assert.h>
+
+#if defined(NDS_ENABLE_IO_URING) && defined(__linux__)
+# include <sys/types.h>
+# include <sys/stat.h>
+# include <sys/mman.h>
+# include <sys/syscall.h>
+# include <sys/uio.h>
+# include <fcntl.h>
+# include <unistd.h>
+# include <errno.h>
+# include <linux/io_uring.h>
+# define NDS_URING_AVAILABLE 1
+#endif
+
+/*
+** Names under which the shim and the ZIPVFS instance layered on top of
+** it are registered by nds_uring_initialize().
+*/
+#define NDS_URING_VFS_NAME      "uring"
+#define NDS_URING_ZIPVFS_NAME   "zipvfs_uring"
+
+/*
+** Size of a single read-ahead request and the maximum number of them that
+** may be outstanding (or cached) per database file at any one time.
+*/
+#ifndef NDS_URING_CHUNK
+# define NDS_URING_CHUNK  (16*1024)
+#endif
+#ifndef NDS_URING_SLOTS
+# define NDS_URING_SLOTS  16
+#endif
+
+/*
+** Number of independent read streams tracked per database file.  A single
+** stream may use at most half of the read-ahead slots.
+*/
+#ifndef NDS_URING_STREAMS
+# define NDS_URING_STREAMS  4
+#endif
+
+/*
+** Forward declarations of structures
+*/
+typedef struct UringFile UringFile;
+typedef struct UringInode UringInode;
+typedef struct UringRing UringRing;
+typedef struct UringSlot UringSlot;
+typedef struct UringStream UringStream;
+
+/*
+** The following global holds the state of the shim VFS.  The sqlite3_vfs
+** object "base" is the one that is registered with SQLite.
+*/
+static struct {
+  sqlite3_vfs base;               /* The shim VFS object */
+  sqlite3_vfs *pParent;           /* The VFS that does the real work */
+  sqlite3_io_methods aMethods[3]; /* Methods for io_methods versions 1..3 */
+  sqlite3_mutex *pMutex;          /* Protects pInodeList */
+  UringInode *pInodeList;         /* Shared read-only descriptors */
+  int isInit;                     /* True once the shim is registered */
+} gUring;
+
+/*
+** Every database file that is opened through the shim shares a single
+** read-only descriptor with all other shim files for the same inode.
+** See the header comment for the reason.
+*/
+struct UringInode {
+  sqlite3_uint64 dev;             /* Device holding the file */
+  sqlite3_uint64 ino;             /* Inode number of the file */
+  int fd;                         /* Read-only descriptor */
+  int nRef;                       /* Number of UringFile objects using it */
+  UringInode *pNext;              /* Next entry in gUring.pInodeList */
+};
+
+#ifdef NDS_URING_AVAILABLE
+/*
+** An io_uring instance.  The submission and completion rings are shared
+** with the kernel through the three mmap()ed regions.
+*/
+struct UringRing {
+  int fd;                         /* Descriptor returned by io_uring_setup() */
+  unsigned nEntry;                /* Number of submission queue entries */
+  unsigned *pSqHead;              /* Submission queue head (kernel owned) */
+  unsigned *pSqTail;              /* Submission queue tail (ours) */
+  unsigned *pSqMask;              /* Submission queue ring mask */
+  unsigned *aSqArray;             /* Submission queue index array */
+  struct io_uring_sqe *aSqe;      /* Submission queue entries */
+  unsigned *pCqHead;              /* Completion queue head (ours) */
+  unsigned *pCqTail;              /* Completion queue tail (kernel owned) */
+  unsigned *pCqMask;              /* Completion queue ring mask */
+  struct io_uring_cqe *aCqe;      /* Completion queue entries */
+  unsigned nPrepared;             /* SQEs filled in but not yet published */
+  void *pSqMap; size_t nSqMap;    /* Submission ring mapping */
+  void *pCqMap; size_t nCqMap;    /* Completion ring mapping (or NULL) */
+  size_t nSqeMap;                 /* Size of the aSqe[] mapping */
+};
+#endif
+
+/*
+** One read-ahead buffer.  iOfst is always a multiple of NDS_URING_CHUNK.
+*/
+#define URING_SLOT_EMPTY    0     /* Slot is not in use */
+#define URING_SLOT_PENDING  1     /* A read into the slot is in flight */
+#define URING_SLOT_READY    2     /* Slot holds nData bytes from iOfst */
+
+struct UringSlot {
+  int eState;                     /* One of the URING_SLOT_* values */
+  int nData;                      /* Bytes of valid data in aData[] */
+  sqlite3_int64 iOfst;            /* File offset of aData[0] */
+  unsigned char *aData;           /* NDS_URING_CHUNK bytes of buffer space */
+#ifdef NDS_URING_AVAILABLE
+  struct iovec iov;               /* Passed to IORING_OP_READV */
+#endif
+};
+
+/*
+** A stream of reads that are close to each other in the file.
+*/
+struct UringStream {
+  sqlite3_int64 iEnd;             /* End offset of the last read, or -1 */
+  int nAhead;                     /* Read-ahead window in chunks */
+};
+
+/*
+** The user_data value attached to the one synchronous read request that
+** may be outstanding at a time.  Read-ahead requests use the index of
+** their slot in UringFile.aSlot[].
+*/
+#define URING_DEMAND_TAG  0xffffffff
+
+/*
+** An open file.  The parent's sqlite3_file object is allocated directly
+** after this structure.
+*/
+struct UringFile {
+  sqlite3_file base;              /* Base class.  Must be first */
+  sqlite3_file *pReal;            /* The file opened by the parent VFS */
+  UringInode *pInode;             /* Shared descriptor, or NULL */
+#ifdef NDS_URING_AVAILABLE
+  UringRing *pRing;               /* io_uring instance, or NULL */
+  struct iovec iovDemand;         /* Buffer for the synchronous read */
+#endif
+  int bDemandDone;                /* True once the synchronous read finished */
+  int nDemandRes;                 /* Result of the synchronous read */
+  int nPending;                   /* Number of requests in flight */
+  int eLock;                      /* Current lock held on pReal */
+  int iNextStream;                /* Next aStream[] entry to recycle */
+  UringStream aStream[NDS_URING_STREAMS];
+  unsigned char *aBuf;            /* Space for all slots, or NULL */
+  UringSlot aSlot[NDS_URING_SLOTS];
+};
+
+#define REALFILE(p)  (((UringFile*)(p))->pReal)
+#define REALMETHOD(p)  (((UringFile*)(p))->pReal->pMethods)
+
+#ifdef NDS_URING_AVAILABLE
+/*****************************************************************************
+** io_uring helpers.
+**
+** liburing is not used so that the shim has no additional build time
+** dependencies.  The system calls are made directly and the ring memory
+** barriers follow the rules documented in io_uring(7).
+*/
+
+/*
+** Tear down an io_uring instance created by uringRingCreate().
+*/
+static void uringRingDestroy(UringRing *pRing){
+  if( pRing->aSqe ) munmap(pRing->aSqe, pRing->nSqeMap);
+  if( pRing->pCqMap ) munmap(pRing->pCqMap, pRing->nCqMap);
+  if( pRing->pSqMap ) munmap(pRing->pSqMap, pRing->nSqMap);
+  if( pRing->fd>=0 ) close(pRing->fd);
+  sqlite3_free(pRing);
+}
+
+/*
+** Create a new io_uring instance with at least nEntry submission queue
+** entries.  Return NULL if io_uring is not available.
+*/
+static UringRing *uringRingCreate(unsigned nEntry){
+  struct io_uring_params prm;
+  UringRing *pRing;
+  unsigned char *pSq;
+  unsigned char *pCq;
+
+  pRing = sqlite3_malloc( sizeof(*pRing) );
+  if( pRing==0 ) return 0;
+  memset(pRing, 0, sizeof(*pRing));
+  memset(&prm, 0, sizeof(prm));
+  pRing->fd = (int)syscall(__NR_io_uring_setup, nEntry, &prm);
+  if( pRing->fd<0 ){
+    sqlite3_free(pRing);
+    return 0;
+  }
+  pRing->nEntry = prm.sq_entries;
+  pRing->nSqMap = prm.sq_off.array + prm.sq_entries*sizeof(unsigned);
+  pRing->nCqMap = prm.cq_off.cqes + prm.cq_entries*sizeof(struct io_uring_cqe);
+#ifdef IORING_FEAT_SINGLE_MMAP
+  if( prm.features & IORING_FEAT_SINGLE_MMAP ){
+    if( pRing->nCqMap>pRing->nSqMap ) pRing->nSqMap = pRing->nCqMap;
+  }
+#endif
+  pRing->pSqMap = mmap(0, pRing->nSqMap, PROT_READ|PROT_WRITE,
+                       MAP_SHARED|MAP_POPULATE, pRing->fd, IORING_OFF_SQ_RING);
+  if( pRing->pSqMap==MAP_FAILED ){
+    pRing->pSqMap = 0;
+    uringRingDestroy(pRing);
+    return 0;
+  }
+  pSq = (unsigned char*)pRing->pSqMap;
+#ifdef IORING_FEAT_SINGLE_MMAP
+  if( prm.features & IORING_FEAT_SINGLE_MMAP ){
+    pCq = pSq;
+  }else
+#endif
+  {
+    pRing->pCqMap = mmap(0, pRing->nCqMap, PROT_READ|PROT_WRITE,
+                         MAP_SHARED|MAP_POPULATE, pRing->fd,
+                         IORING_OFF_CQ_RING);
+    if( pRing->pCqMap==MAP_FAILED ){
+      pRing->pCqMap = 0;
+      uringRingDestroy(pRing);
+      return 0;
+    }
+    pCq = (unsigned char*)pRing->pCqMap;
+  }
+  pRing->nSqeMap = prm.sq_entries*sizeof(struct io_uring_sqe);
+  pRing->aSqe = mmap(0, pRing->nSqeMap, PROT_READ|PROT_WRITE,
+                     MAP_SHARED|MAP_POPULATE, pRing->fd, IORING_OFF_SQES);
+  if( pRing->aSqe==MAP_FAILED ){
+    pRing->aSqe = 0;
+    uringRingDestroy(pRing);
+    return 0;
+  }
+  pRing->pSqHead = (unsigned*)(pSq + prm.sq_off.head);
+  pRing->pSqTail = (unsigned*)(pSq + prm.sq_off.tail);
+  pRing->pSqMask = (unsigned*)(pSq + prm.sq_off.ring_mask);
+  pRing->aSqArray = (unsigned*)(pSq + prm.sq_off.array);
+  pRing->pCqHead = (unsigned*)(pCq + prm.cq_off.head);
+  pRing->pCqTail = (unsigned*)(pCq + prm.cq_off.tail);
+  pRing->pCqMask = (unsigned*)(pCq + prm.cq_off.ring_mask);
+  pRing->aCqe = (struct io_uring_cqe*)(pCq + prm.cq_off.cqes);
+  return pRing;
+}
+
+/*
+** Queue a readv request for nByte bytes at iOfst into the buffer described
+** by pIov.  The request is not submitted to the kernel until the next call
+** to uringRingEnter().  Return SQLITE_OK, or SQLITE_FULL if the submission
+** queue has no free entries.
+*/
+static int uringRingPrepRead(
+  UringRing *pRing,
+  int fd,
+  struct iovec *pIov,
+  sqlite3_int64 iOfst,
+  unsigned iTag
+){
+  unsigned iTail = *pRing->pSqTail + pRing->nPrepared;
+  unsigned iHead = __atomic_load_n(pRing->pSqHead, __ATOMIC_ACQUIRE);
+  unsigned idx;
+  struct io_uring_sqe *pSqe;
+
+  if( iTail-iHead>=pRing->nEntry ) return SQLITE_FULL;
+  idx = iTail & *pRing->pSqMask;
+  pSqe = &pRing->aSqe[idx];
+  memset(pSqe, 0, sizeof(*pSqe));
+  pSqe->opcode = IORING_OP_READV;
+  pSqe->fd = fd;
+  pSqe->off = (unsigned long long)iOfst;
+  pSqe->addr = (unsigned long long)(size_t)pIov;
+  pSqe->len = 1;
+  pSqe->user_data = iTag;
+  pRing->aSqArray[idx] = idx;
+  pRing->nPrepared++;
+  return SQLITE_OK;
+}
+
+/*
+** Publish all prepared requests to the kernel and submit them.  If
+** bWait is true, also block until at least one completion is available.
+** Return SQLITE_OK on success or SQLITE_IOERR if the ring is unusable.
+*/
+static int uringRingEnter(UringRing *pRing, int bWait){
+  unsigned iTail = *pRing->pSqTail + pRing->nPrepared;
+  __atomic_store_n(pRing->pSqTail, iTail, __ATOMIC_RELEASE);
+  pRing->nPrepared = 0;
+  while( 1 ){
+    unsigned iHead = __atomic_load_n(pRing->pSqHead, __ATOMIC_ACQUIRE);
+    unsigned nSubmit = iTail - iHead;
+    unsigned flags = bWait ? IORING_ENTER_GETEVENTS : 0;
+    long rc;
+    if( nSubmit==0 && !bWait ) return SQLITE_OK;
+    rc = syscall(__NR_io_uring_enter, pRing->fd, nSubmit, bWait ? 1 : 0,
+                 flags, (void*)0, (size_t)0);
+    if( rc>=0 ) return SQLITE_OK;
+    if( errno!=EINTR && errno!=EAGAIN && errno!=EBUSY ) return SQLITE_IOERR;
+  }
+}
+
+/*
+** Process all available completions for file p.
+*/
+static void uringReap(UringFile *p){
+  UringRing *pRing = p->pRing;
+  unsigned iHead = *pRing->pCqHead;
+  unsigned iTail = __atomic_load_n(pRing->pCqTail, __ATOMIC_ACQUIRE);
+  while( iHead!=iTail ){
+    struct io_uring_cqe *pCqe = &pRing->aCqe[iHead & *pRing->pCqMask];
+    if( pCqe->user_data==URING_DEMAND_TAG ){
+      p->bDemandDone = 1;
+      p->nDemandRes = pCqe->res;
+    }else{
+      UringSlot *pSlot = &p->aSlot[pCqe->user_data];
+      assert( pSlot->eState==URING_SLOT_PENDING );
+      if( pCqe->res>=0 ){
+        pSlot->eState = URING_SLOT_READY;
+        pSlot->nData = pCqe->res;
+      }else{
+        pSlot->eState = URING_SLOT_EMPTY;
+      }
+    }
+    p->nPending--;
+    iHead++;
+  }
+  __atomic_store_n(pRing->pCqHead, iHead, __ATOMIC_RELEASE);
+}
+
+/*
+** Wait until the slot passed as the second argument is no longer pending,
+** or until the synchronous read has finished if pSlot is NULL.  If the
+** ring fails, it is abandoned and the shim falls back to the parent VFS.
+*/
+static int uringWait(UringFile *p, UringSlot *pSlot){
+  while( 1 ){
+    uringReap(p);
+    if( pSlot ? pSlot->eState!=URING_SLOT_PENDING : p->bDemandDone ){
+      return SQLITE_OK;
+    }
+    if( uringRingEnter(p->pRing, 1)!=SQLITE_OK ) return SQLITE_IOERR;
+  }
+}
+
+/*
+** Wait for all outstanding requests on file p.
+*/
+static int uringDrain(UringFile *p){
+  while( p->nPending>0 ){
+    uringReap(p);
+    if( p->nPending==0 ) break;
+    if( uringRingEnter(p->pRing, 1)!=SQLITE_OK ) return SQLITE_IOERR;
+  }
+  return SQLITE_OK;
+}
+
+/*
+** Stop using io_uring for file p after an unexpected ring error.  If
+** requests may still be in flight, the slot buffers are leaked rather than
+** freed, as the kernel might still write into them.
+*/
+static void uringAbandon(UringFile *p){
+  if( p->nPending>0 ) p->aBuf = 0;
+  uringRingDestroy(p->pRing);
+  p->pRing = 0;
+}
+#endif /* NDS_URING_AVAILABLE */
+
+/*
+** Discard the contents of all read-ahead slots.  This is called whenever
+** the content of the underlying file may have changed.
+*/
+static void uringInvalidate(UringFile *p){
+  int i;
+#ifdef NDS_URING_AVAILABLE
+  if( p->pRing && uringDrain(p)!=SQLITE_OK ) uringAbandon(p);
+#endif
+  for(i=0; i<NDS_URING_SLOTS; i++){
+    p->aSlot[i].eState = URING_SLOT_EMPTY;
+  }
+  for(i=0; i<NDS_URING_STREAMS; i++){
+    p->aStream[i].iEnd = -1;
+    p->aStream[i].nAhead = 0;
+  }
+}
+
+#ifdef NDS_URING_AVAILABLE
+/*
+** Return the slot holding (or about to hold) the chunk that starts at
+** offset iChunk, or NULL if there is no such slot.
+*/
+static UringSlot *uringFindSlot(UringFile *p, sqlite3_int64 iChunk){
+  int i;
+  for(i=0; i<NDS_URING_SLOTS; i++){
+    UringSlot *pSlot = &p->aSlot[i];
+    if( pSlot->eState!=URING_SLOT_EMPTY && pSlot->iOfst==iChunk ) return pSlot;
+  }
+  return 0;
+}
+
+/*
+** Try to satisfy a read entirely from the read-ahead slots.  Return
+** SQLITE_OK if successful, or SQLITE_NOTFOUND if any part of the requested
+** range is not covered.
+*/
+static int uringReadFromSlots(
+  UringFile *p,
+  unsigned char *zBuf,
+  int iAmt,
+  sqlite3_int64 iOfst
+){
+  sqlite3_int64 iEnd = iOfst + iAmt;
+  sqlite3_int64 iFirst = iOfst - (iOfst%NDS_URING_CHUNK);
+  sqlite3_int64 iChunk;
+
+  for(iChunk=iFirst; iChunk<iEnd; iChunk+=NDS_URING_CHUNK){
+    UringSlot *pSlot = uringFindSlot(p, iChunk);
+    sqlite3_int64 iTo = iChunk + NDS_URING_CHUNK;
+    if( iTo>iEnd ) iTo = iEnd;
+    if( pSlot==0 ) return SQLITE_NOTFOUND;
+    if( pSlot->eState==URING_SLOT_PENDING ){
+      if( uringWait(p, pSlot)!=SQLITE_OK ) return SQLITE_IOERR;
+      if( pSlot->eState!=URING_SLOT_READY ) return SQLITE_NOTFOUND;
+    }
+    if( iChunk+pSlot->nData<iTo ) return SQLITE_NOTFOUND;
+  }
+  for(iChunk=iFirst; iChunk<iEnd; iChunk+=NDS_URING_CHUNK){
+    UringSlot *pSlot = uringFindSlot(p, iChunk);
+    sqlite3_int64 iFrom = iOfst>iChunk ? iOfst : iChunk;
+    sqlite3_int64 iTo = iChunk + NDS_URING_CHUNK;
+    if( iTo>iEnd ) iTo = iEnd;
+    memcpy(&zBuf[iFrom-iOfst], &pSlot->aData[iFrom-iChunk],
+           (size_t)(iTo-iFrom));
+  }
+  return SQLITE_OK;
+}
+
+/*
+** Queue read-ahead requests for up to nAhead chunks starting with the
+** chunk that contains offset iFrom.  Chunks that are already cached or in
+** flight are skipped.  Slots holding chunks outside of the new window are
+** recycled, those with the lowest offsets first.
+*/
+static void uringQueueReadAhead(
+  UringFile *p,
+  sqlite3_int64 iFrom,
+  int nAhead
+){
+  sqlite3_int64 iBase = iFrom - (iFrom%NDS_URING_CHUNK);
+  sqlite3_int64 iLimit = iBase + (sqlite3_int64)nAhead*NDS_URING_CHUNK;
+  sqlite3_int64 iChunk = iBase;
+  int n;
+  if( p->aBuf==0 ){
+    int i;
+    p->aBuf = sqlite3_malloc(NDS_URING_CHUNK*NDS_URING_SLOTS);
+    if( p->aBuf==0 ) return;
+    for(i=0; i<NDS_URING_SLOTS; i++){
+      p->aSlot[i].aData = &p->aBuf[i*NDS_URING_CHUNK];
+      p->aSlot[i].eState = URING_SLOT_EMPTY;
+    }
+  }
+  for(n=0; n<nAhead; n++, iChunk+=NDS_URING_CHUNK){
+    UringSlot *pVictim = 0;
+    int i;
+    if( uringFindSlot(p, iChunk) ) continue;
+    for(i=0; i<NDS_URING_SLOTS; i++){
+      UringSlot *pSlot = &p->aSlot[i];
+      if( pSlot->eState==URING_SLOT_EMPTY ){
+        pVictim = pSlot;
+        break;
+      }
+      if( pSlot->eState==URING_SLOT_READY
+       && (pSlot->iOfst<iBase || pSlot->iOfst>=iLimit)
+       && (pVictim==0 || pSlot->iOfst<pVictim->iOfst)
+      ){
+        pVictim = pSlot;
+      }
+    }
+    if( pVictim==0 ) break;
+    pVictim->iOfst = iChunk;
+    pVictim->nData = 0;
+    pVictim->iov.iov_base = pVictim->aData;
+    pVictim->iov.iov_len = NDS_URING_CHUNK;
+    if( uringRingPrepRead(p->pRing, p->pInode->fd, &pVictim->iov, iChunk,
+                          (unsigned)(pVictim - p->aSlot))!=SQLITE_OK ){
+      pVictim->eState = URING_SLOT_EMPTY;
+      break;
+    }
+    pVictim->eState = URING_SLOT_PENDING;
+    p->nPending++;
+  }
+}
+
+/*
+** Read data through io_uring.  Local reads are served from read-ahead
+** slots.  Other reads are submitted as a single synchronous request.
+*/
+static int uringReadRing(
+  UringFile *p,
+  void *zBuf,
+  int iAmt,
+  sqlite3_int64 iOfst
+){
+  sqlite3_int64 iEnd = iOfst + iAmt;
+  UringStream *pStream = 0;
+  int nAhead;
+  int rc;
+  int i;
+
+  /* Find the stream this read belongs to and adjust its read-ahead
+  ** window.  A read that does not belong to any stream starts a new one,
+  ** replacing the least recently started stream. */
+  for(i=0; i<NDS_URING_STREAMS; i++){
+    UringStream *pIter = &p->aStream[i];
+    if( pIter->iEnd>=0 && iOfst+NDS_URING_CHUNK>pIter->iEnd
+     && iOfst<pIter->iEnd+NDS_URING_CHUNK ){
+      pStream = pIter;
+      break;
+    }
+  }
+  if( pStream ){
+    pStream->nAhead = pStream->nAhead ? pStream->nAhead*2 : 2;
+    if( pStream->nAhead>NDS_URING_SLOTS/2 ){
+      pStream->nAhead = NDS_URING_SLOTS/2;
+    }
+  }else{
+    pStream = &p->aStream[p->iNextStream];
+    p->iNextStream = (p->iNextStream+1) % NDS_URING_STREAMS;
+    pStream->nAhead = 0;
+  }
+  pStream->iEnd = iEnd;
+  nAhead = pStream->nAhead;
+
+  rc = uringReadFromSlots(p, (unsigned char*)zBuf, iAmt, iOfst);
+  if( rc==SQLITE_OK && nAhead ){
+    uringQueueReadAhead(p, iOfst, nAhead);
+    if( uringRingEnter(p->pRing, 0)!=SQLITE_OK ) return SQLITE_IOERR;
+  }
+  if( rc==SQLITE_NOTFOUND && nAhead ){
+    /* A local read that misses.  Fetch the chunks that hold it together
+    ** with the rest of the window in one batch and wait for them. */
+    uringQueueReadAhead(p, iOfst, nAhead);
+    if( uringRingEnter(p->pRing, 0)!=SQLITE_OK ) return SQLITE_IOERR;
+    rc = uringReadFromSlots(p, (unsigned char*)zBuf, iAmt, iOfst);
+  }
+  if( rc!=SQLITE_NOTFOUND ) return rc;
+
+  /* A random read, or one that does not fit into the read-ahead window.
+  ** Read exactly the requested range into the caller's buffer. */
+  p->iovDemand.iov_base = zBuf;
+  p->iovDemand.iov_len = iAmt;
+  p->bDemandDone = 0;
+  rc = uringRingPrepRead(p->pRing, p->pInode->fd, &p->iovDemand, iOfst,
+                         URING_DEMAND_TAG);
+  if( rc!=SQLITE_OK ){
+    if( uringRingEnter(p->pRing, 0)!=SQLITE_OK ) return SQLITE_IOERR;
+    rc = uringRingPrepRead(p->pRing, p->pInode->fd, &p->iovDemand, iOfst,
+                           URING_DEMAND_TAG);
+    if( rc!=SQLITE_OK ) return SQLITE_IOERR;
+  }
+  p->nPending++;
+  if( uringRingEnter(p->pRing, 1)!=SQLITE_OK ) return SQLITE_IOERR;
+  if( uringWait(p, 0)!=SQLITE_OK ) return SQLITE_IOERR;
+
+  if( p->nDemandRes<0 ) return SQLITE_IOERR_READ;
+  if( p->nDemandRes<iAmt ){
+    /* Unread parts of the buffer must be zero-filled, as in the unix VFS */
+    memset(&((char*)zBuf)[p->nDemandRes], 0, iAmt-p->nDemandRes);
+    return SQLITE_IOERR_SHORT_READ;
+  }
+  return SQLITE_OK;
+}
+#endif /* NDS_URING_AVAILABLE */
+
+/*****************************************************************************
+** sqlite3_io_methods for the shim.
+*/
+
+/*
+** Release the shared descriptor held by p, if any.
+*/
+static void uringInodeRelease(UringFile *p){
+  UringInode *pInode = p->pInode;
+  if( pInode==0 ) return;
+  sqlite3_mutex_enter(gUring.pMutex);
+  if( --pInode->nRef==0 ){
+    UringInode **pp;
+    for(pp=&gUring.pInodeList; *pp!=pInode; pp=&(*pp)->pNext);
+    *pp = pInode->pNext;
+#ifdef NDS_URING_AVAILABLE
+    close(pInode->fd);
+#endif
+    sqlite3_free(pInode);
+  }
+  sqlite3_mutex_leave(gUring.pMutex);
+  p->pInode = 0;
+}
+
+static int uringClose(sqlite3_file *pFile){
+  UringFile *p = (UringFile*)pFile;
+  int rc;
+#ifdef NDS_URING_AVAILABLE
+  if( p->pRing ){
+    if( uringDrain(p)!=SQLITE_OK ){
+      uringAbandon(p);
+    }else{
+      uringRingDestroy(p->pRing);
+      p->pRing = 0;
+    }
+  }
+#endif
+  sqlite3_free(p->aBuf);
+  p->aBuf = 0;
+  rc = REALMETHOD(pFile)->xClose(REALFILE(pFile));
+  uringInodeRelease(p);
+  return rc;
+}
+
+static int uringRead(
+  sqlite3_file *pFile,
+  void *zBuf,
+  int iAmt,
+  sqlite3_int64 iOfst
+){
+#ifdef NDS_URING_AVAILABLE
+  UringFile *p = (UringFile*)pFile;
+  if( p->pRing ){
+    int rc = uringReadRing(p, zBuf, iAmt, iOfst);
+    if( rc!=SQLITE_IOERR ) return rc;
+    uringAbandon(p);
+  }
+#endif
+  return REALMETHOD(pFile)->xRead(REALFILE(pFile), zBuf, iAmt, iOfst);
+}
+
+static int uringWrite(
+  sqlite3_file *pFile,
+  const void *zBuf,
+  int iAmt,
+  sqlite3_int64 iOfst
+){
+  uringInvalidate((UringFile*)pFile);
+  return REALMETHOD(pFile)->xWrite(REALFILE(pFile), zBuf, iAmt, iOfst);
+}
+
+static int uringTruncate(sqlite3_file *pFile, sqlite3_int64 size){
+  uringInvalidate((UringFile*)pFile);
+  return REALMETHOD(pFile)->xTruncate(REALFILE(pFile), size);
+}
+
+static int uringSync(sqlite3_file *pFile, int flags){
+  return REALMETHOD(pFile)->xSync(REALFILE(pFile), flags);
+}
+
+static int uringFileSize(sqlite3_file *pFile, sqlite3_int64 *pSize){
+  return REALMETHOD(pFile)->xFileSize(REALFILE(pFile), pSize);
+}
+
+static int uringLock(sqlite3_file *pFile, int eLock){
+  UringFile *p = (UringFile*)pFile;
+  int rc;
+  if( p->eLock==SQLITE_LOCK_NONE ) uringInvalidate(p);
+  rc = REALMETHOD(pFile)->xLock(REALFILE(pFile), eLock);
+  if( rc==SQLITE_OK ) p->eLock = eLock;
+  return rc;
+}
+
+static int uringUnlock(sqlite3_file *pFile, int eLock){
+  UringFile *p = (UringFile*)pFile;
+  int rc = REALMETHOD(pFile)->xUnlock(REALFILE(pFile), eLock);
+  if( rc==SQLITE_OK ) p->eLock = eLock;
+  return rc;
+}
+
+static int uringCheckReservedLock(sqlite3_file *pFile, int *pResOut){
+  return REALMETHOD(pFile)->xCheckReservedLock(REALFILE(pFile), pResOut);
+}
+
+static int uringFileControl(sqlite3_file *pFile, int op, void *pArg){
+  int rc = REALMETHOD(pFile)->xFileControl(REALFILE(pFile), op, pArg);
+  if( op==SQLITE_FCNTL_VFSNAME && rc==SQLITE_OK ){
+    *(char**)pArg = sqlite3_mprintf("%s/%z", NDS_URING_VFS_NAME,
+                                    *(char**)pArg);
+  }
+  return rc;
+}
+
+static int uringSectorSize(sqlite3_file *pFile){
+  return REALMETHOD(pFile)->xSectorSize(REALFILE(pFile));
+}
+
+static int uringDeviceCharacteristics(sqlite3_file *pFile){
+  return REALMETHOD(pFile)->xDeviceCharacteristics(REALFILE(pFile));
+}
+
+static int uringShmMap(
+  sqlite3_file *pFile,
+  int iPg,
+  int pgsz,
+  int bExtend,
+  void volatile **pp
+){
+  return REALMETHOD(pFile)->xShmMap(REALFILE(pFile), iPg, pgsz, bExtend, pp);
+}
+
+static int uringShmLock(sqlite3_file *pFile, int ofst, int n, int flags){
+  /* In WAL mode a read transaction starts with a shared-memory lock rather
+  ** than with xLock(), so this is where stale read-ahead is dropped. */
+  uringInvalidate((UringFile*)pFile);
+  return REALMETHOD(pFile)->xShmLock(REALFILE(pFile), ofst, n, flags);
+}
+
+static void uringShmBarrier(sqlite3_file *pFile){
+  REALMETHOD(pFile)->xShmBarrier(REALFILE(pFile));
+}
+
+static int uringShmUnmap(sqlite3_file *pFile, int deleteFlag){
+  return REALMETHOD(pFile)->xShmUnmap(REALFILE(pFile), deleteFlag);
+}
+
+static int uringFetch(
+  sqlite3_file *pFile,
+  sqlite3_int64 iOfst,
+  int iAmt,
+  void **pp
+){
+  return REALMETHOD(pFile)->xFetch(REALFILE(pFile), iOfst, iAmt, pp);
+}
+
+static int uringUnfetch(sqlite3_file *pFile, sqlite3_int64 iOfst, void *p){
+  return REALMETHOD(pFile)->xUnfetch(REALFILE(pFile), iOfst, p);
+}
+
+/*****************************************************************************
+** sqlite3_vfs methods for the shim.
+*/
+
+/*
+** Find or create the shared read-only descriptor for the file zName and
+** attach it to p.  Failure is not an error; the shim then simply passes
+** all reads to the parent VFS.
+*/
+static void uringInodeAttach(UringFile *p, const char *zName){
+#ifdef NDS_URING_AVAILABLE
+  struct stat st;
+  UringInode *pInode;
+  int fd;
+
+  fd = open(zName, O_RDONLY|O_CLOEXEC);
+  if( fd<0 ) return;
+  if( fstat(fd, &st)!=0 ){
+    close(fd);
+    return;
+  }
+  sqlite3_mutex_enter(gUring.pMutex);
+  for(pInode=gUring.pInodeList; pInode; pInode=pInode->pNext){
+    if( pInode->dev==(sqlite3_uint64)st.st_dev
+     && pInode->ino==(sqlite3_uint64)st.st_ino ){
+      break;
+    }
+  }
+  if( pInode ){
+    /* Closing a descriptor cannot drop any locks here, since the parent
+    ** VFS does not know about it and none have been taken through it. */
+    close(fd);
+  }else{
+    pInode = sqlite3_malloc( sizeof(*pInode) );
+    if( pInode ){
+      memset(pInode, 0, sizeof(*pInode));
+      pInode->dev = st.st_dev;
+      pInode->ino = st.st_ino;
+      pInode->fd = fd;
+#ifdef POSIX_FADV_RANDOM
+      posix_fadvise(fd, 0, 0, POSIX_FADV_RANDOM);
+#endif
+      pInode->pNext = gUring.pInodeList;
+      gUring.pInodeList = pInode;
+    }else{
+      close(fd);
+    }
+  }
+  if( pInode ){
+    pInode->nRef++;
+    p->pInode = pInode;
+  }
+  sqlite3_mutex_leave(gUring.pMutex);
+#else
+  (void)p;
+  (void)zName;
+#endif
+}
+
+static int uringOpen(
+  sqlite3_vfs *pVfs,
+  const char *zName,
+  sqlite3_file *pFile,
+  int flags,
+  int *pOutFlags
+){
+  UringFile *p = (UringFile*)pFile;
+  sqlite3_vfs *pParent = gUring.pParent;
+  int rc;
+
+  (void)pVfs;
+  memset(p, 0, sizeof(*p));
+  p->pReal = (sqlite3_file*)&p[1];
+  uringInvalidate(p);
+  rc = pParent->xOpen(pParent, zName, p->pReal, flags, pOutFlags);
+  if( rc!=SQLITE_OK ){
+    return rc;
+  }
+  assert( p->pReal->pMethods->iVersion>=1 && p->pReal->pMethods->iVersion<=3 );
+  p->base.pMethods = &gUring.aMethods[p->pReal->pMethods->iVersion-1];
+
+  /* Only the main database file is read through io_uring.  Journals and
+  ** temporary files are short lived and mostly written sequentially. */
+  if( zName && (flags & SQLITE_OPEN_MAIN_DB) ){
+    uringInodeAttach(p, zName);
+#ifdef NDS_URING_AVAILABLE
+    if( p->pInode ){
+      p->pRing = uringRingCreate(NDS_URING_SLOTS+1);
+    }
+#endif
+  }
+  return SQLITE_OK;
+}
+
+static int uringDelete(sqlite3_vfs *pVfs, const char *zPath, int dirSync){
+  (void)pVfs;
+  return gUring.pParent->xDelete(gUring.pParent, zPath, dirSync);
+}
+
+static int uringAccess(
+  sqlite3_vfs *pVfs,
+  const char *zPath,
+  int flags,
+  int *pResOut
+){
+  (void)pVfs;
+  return gUring.pParent->xAccess(gUring.pParent, zPath, flags, pResOut);
+}
+
+static int uringFullPathname(
+  sqlite3_vfs *pVfs,
+  const char *zPath,
+  int nOut,
+  char *zOut
+){
+  (void)pVfs;
+  return gUring.pParent->xFullPathname(gUring.pParent, zPath, nOut, zOut);
+}
+
+static void *uringDlOpen(sqlite3_vfs *pVfs, const char *zPath){
+  (void)pVfs;
+  return gUring.pParent->xDlOpen(gUring.pParent, zPath);
+}
+
+static void uringDlError(sqlite3_vfs *pVfs, int nByte, char *zErrMsg){
+  (void)pVfs;
+  gUring.pParent->xDlError(gUring.pParent, nByte, zErrMsg);
+}
+
+static void (*uringDlSym(sqlite3_vfs *pVfs, void *p, const char *zSym))(void){
+  (void)pVfs;
+  return gUring.pParent->xDlSym(gUring.pParent, p, zSym);
+}
+
+static void uringDlClose(sqlite3_vfs *pVfs, void *pHandle){
+  (void)pVfs;
+  gUring.pParent->xDlClose(gUring.pParent, pHandle);
+}
+
+static int uringRandomness(sqlite3_vfs *pVfs, int nByte, char *zBufOut){
+  (void)pVfs;
+  return gUring.pParent->xRandomness(gUring.pParent, nByte, zBufOut);
+}
+
+static int uringSleep(sqlite3_vfs *pVfs, int nMicro){
+  (void)pVfs;
+  return gUring.pParent->xSleep(gUring.pParent, nMicro);
+}
+
+static int uringCurrentTime(sqlite3_vfs *pVfs, double *pTimeOut){
+  (void)pVfs;
+  return gUring.pParent->xCurrentTime(gUring.pParent, pTimeOut);
+}
+
+static int uringGetLastError(sqlite3_vfs *pVfs, int nErr, char *zErr){
+  (void)pVfs;
+  return gUring.pParent->xGetLastError(gUring.pParent, nErr, zErr);
+}
+
+static int uringCurrentTimeInt64(sqlite3_vfs *pVfs, sqlite3_int64 *pTime){
+  (void)pVfs;
+  return gUring.pParent->xCurrentTimeInt64(gUring.pParent, pTime);
+}
+
+/*
+** Register the shim VFS under the name "uring", using the VFS named
+** zParent (or the default VFS if zParent is NULL) for all real work.
+** Then create a ZIPVFS instance named "zipvfs_uring" on top of it.  If
+** makeDefault is true, "zipvfs_uring" becomes the default VFS.
+**
+** It is harmless to call this routine more than once.  When this file is
+** compiled without NDS_ENABLE_IO_URING, or on a system where io_uring is
+** not available, both VFSes are still registered but all reads go
+** through the parent's xRead() method.
+*/
+int nds_uring_initialize(const char *zParent, int makeDefault){
+  extern int nds_compression_algorithm_detector(
+    void *pCtx,
+    const char *zFile,
+    const char *zHeader,
+    ZipvfsMethods *pMethods
+  );
+  sqlite3_vfs *pParent;
+  int rc;
+  int i;
+
+  if( gUring.isInit ){
+    if( makeDefault ){
+      sqlite3_vfs_register(sqlite3_vfs_find(NDS_URING_ZIPVFS_NAME), 1);
+    }
+    return SQLITE_OK;
+  }
+  rc = sqlite3_initialize();
+  if( rc!=SQLITE_OK ) return rc;
+  pParent = sqlite3_vfs_find(zParent);
+  if( pParent==0 ) return SQLITE_ERROR;
+  gUring.pMutex = sqlite3_mutex_alloc(SQLITE_MUTEX_FAST);
+  if( gUring.pMutex==0 ) return SQLITE_NOMEM;
+
+  gUring.pParent = pParent;
+  gUring.base.iVersion = pParent->iVersion<2 ? pParent->iVersion : 2;
+  gUring.base.szOsFile = sizeof(UringFile) + pParent->szOsFile;
+  gUring.base.mxPathname = pParent->mxPathname;
+  gUring.base.zName = NDS_URING_VFS_NAME;
+  gUring.base.xOpen = uringOpen;
+  gUring.base.xDelete = uringDelete;
+  gUring.base.xAccess = uringAccess;
+  gUring.base.xFullPathname = uringFullPathname;
+  gUring.base.xDlOpen = uringDlOpen;
+  gUring.base.xDlError = uringDlError;
+  gUring.base.xDlSym = uringDlSym;
+  gUring.base.xDlClose = uringDlClose;
+  gUring.base.xRandomness = uringRandomness;
+  gUring.base.xSleep = uringSleep;
+  gUring.base.xCurrentTime = uringCurrentTime;
+  gUring.base.xGetLastError = uringGetLastError;
+  gUring.base.xCurrentTimeInt64 = uringCurrentTimeInt64;
+
+  for(i=0; i<3; i++){
+    sqlite3_io_methods *pMethods = &gUring.aMethods[i];
+    pMethods->iVersion = i+1;
+    pMethods->xClose = uringClose;
+    pMethods->xRead = uringRead;
+    pMethods->xWrite = uringWrite;
+    pMethods->xTruncate = uringTruncate;
+    pMethods->xSync = uringSync;
+    pMethods->xFileSize = uringFileSize;
+    pMethods->xLock = uringLock;
+    pMethods->xUnlock = uringUnlock;
+    pMethods->xCheckReservedLock = uringCheckReservedLock;
+    pMethods->xFileControl = uringFileControl;
+    pMethods->xSectorSize = uringSectorSize;
+    pMethods->xDeviceCharacteristics = uringDeviceCharacteristics;
+    pMethods->xShmMap = uringShmMap;
+    pMethods->xShmLock = uringShmLock;
+    pMethods->xShmBarrier = uringShmBarrier;
+    pMethods->xShmUnmap = uringShmUnmap;
+    pMethods->xFetch = uringFetch;
+    pMethods->xUnfetch = uringUnfetch;
+  }
+
+  rc = sqlite3_vfs_register(&gUring.base, 0);
+  if( rc==SQLITE_OK ){
+    rc = zipvfs_create_vfs_v3(NDS_URING_ZIPVFS_NAME, NDS_URING_VFS_NAME, 0,
+                              nds_compression_algorithm_detector);
+    if( rc!=SQLITE_OK ) sqlite3_vfs_unregister(&gUring.base);
+  }
+  if( rc!=SQLITE_OK ){
+    sqlite3_mutex_free(gUring.pMutex);
+    gUring.pMutex = 0;
+    return rc;
+  }
+  gUring.isInit = 1;
+  if( makeDefault ){
+    sqlite3_vfs_register(sqlite3_vfs_find(NDS_URING_ZIPVFS_NAME), 1);
+  }
+  return SQLITE_OK;
+}
+
+/*
+** Undo the work of nds_uring_initialize().  All database connections
+** that use either VFS must have been closed before this is called.
+*/
+void nds_uring_shutdown(void){
+  if( gUring.isInit==0 ) return;
+  assert( gUring.pInodeList==0 );
+  zipvfs_destroy_vfs(NDS_URING_ZIPVFS_NAME);
+  sqlite3_vfs_unregister(&gUring.base);
+  sqlite3_mutex_free(gUring.pMutex);
+  gUring.pMutex = 0;
+  gUring.isInit = 0;
+}
@@ -0,0 +1,37 @@
+/*
+** This version of SQLite is specially prepared for the
+** Navigation Data Standard e.V.  Use by license only.
+**
+** Interface to the io_uring read shim VFS implemented in nds_uring_vfs.c.
+*/
+#ifndef _NDS_URING_VFS_H
+#define _NDS_URING_VFS_H 1
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+** Register the shim VFS as "uring" on top of the VFS named zParent (or
+** the default VFS if zParent is NULL), and a ZIPVFS instance named
+** "zipvfs_uring" on top of the shim.  If makeDefault is true,
+** "zipvfs_uring" becomes the default VFS.  Return SQLITE_OK on success
+** or an SQLite error code.
+**
+** Builds without NDS_ENABLE_IO_URING (the WITH_IO_URING option of the
+** build) still register both VFSes, but all reads then go through the
+** parent's xRead() method.
+*/
+int nds_uring_initialize(const char *zParent, int makeDefault);
+
+/*
+** Unregister the VFSes registered by nds_uring_initialize().  All database
+** connections that use them must have been closed.
+*/
+void nds_uring_shutdown(void);
+
+#ifdef __cplusplus
+}  /* end of the 'extern "C"' block */
+#endif
+
+#endif /* _NDS_URING_VFS_H */
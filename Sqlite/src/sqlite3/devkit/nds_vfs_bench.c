@@ -0,0 +1,283 @@
+/*
+** This version of SQLite is specially prepared for the
+** Navigation Data Standard e.V.  Use by license only.
+**
+** This file implements a small command-line program that measures the
+** latency of full-text queries against a database on a cold page cache,
+** once for each of a list of VFSes.  It is used to compare the io_uring
+** read shim in nds_uring_vfs.c ("zipvfs_uring") with the ordinary
+** pread() based ZIPVFS ("zipvfsonly").
+**
+** Usage:
+**
+**    nds_vfs_bench ?OPTIONS? DATABASE QUERYFILE
+**
+** QUERYFILE contains one SQL statement per line, typically something like
+** "SELECT rowid FROM poi_fts WHERE poi_fts MATCH 'bahnhof*'".  Empty lines
+** and lines starting with "--" are ignored.  Each statement is run on a
+** freshly opened read-only connection after the database file has been
+** evicted from the operating system page cache, and the time taken to
+** open the connection, prepare the statement and step through all result
+** rows is recorded.
+**
+** Options:
+**
+**    -vfs NAME        Add NAME to the list of VFSes to measure.  The
+**                     default list is "zipvfsonly" and "zipvfs_uring".
+**    -repeat N        Run the whole query file N times per VFS (default 3).
+**    -drop-caches     Also write to /proc/sys/vm/drop_caches before each
+**                     query (requires root).  Without this option only the
+**                     pages of DATABASE are evicted, via posix_fadvise().
+**    -warm            Do not evict anything; measures the warm-cache case.
+*/
+#include "nds_sqlite3.h"
+#include "nds_uring_vfs.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#define BENCH_MAX_VFS  8
+
+/*
+** Latency samples collected for one VFS.
+*/
+typedef struct BenchResult BenchResult;
+struct BenchResult {
+  const char *zVfs;               /* Name of the VFS */
+  double *aLatency;               /* Latency of each query in milliseconds */
+  int nLatency;                   /* Number of valid entries in aLatency[] */
+  sqlite3_int64 nRow;             /* Total number of rows returned */
+  int nErr;                       /* Number of failed queries */
+};
+
+/*
+** Return the current time in milliseconds from a monotonic clock.
+*/
+static double benchNow(void){
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec*1000.0 + ts.tv_nsec/1000000.0;
+}
+
+/*
+** Evict the database file from the page cache.
+*/
+static void benchEvict(const char *zDb, int bDropCaches){
+  int fd = open(zDb, O_RDONLY);
+  if( fd>=0 ){
+    fdatasync(fd);
+    posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+    close(fd);
+  }
+  if( bDropCaches ){
+    FILE *f;
+    sync();
+    f = fopen("/proc/sys/vm/drop_caches", "w");
+    if( f ){
+      fputs("3\n", f);
+      fclose(f);
+    }
+  }
+}
+
+/*
+** Read the query file into an array of NUL-terminated strings.
+*/
+static char **benchReadQueries(const char *zFile, int *pnQuery){
+  FILE *in = fopen(zFile, "rb");
+  char zLine[4096];
+  char **azQuery = 0;
+  int nQuery = 0;
+  if( in==0 ){
+    fprintf(stderr, "cannot open \"%s\"\n", zFile);
+    exit(1);
+  }
+  while( fgets(zLine, sizeof(zLine), in) ){
+    int n = (int)strlen(zLine);
+    while( n>0 && (zLine[n-1]=='\n' || zLine[n-1]=='\r') ) zLine[--n] = 0;
+    if( n==0 || strncmp(zLine, "--", 2)==0 ) continue;
+    azQuery = realloc(azQuery, (nQuery+1)*sizeof(char*));
+    if( azQuery==0 ){
+      fprintf(stderr, "out of memory\n");
+      exit(1);
+    }
+    azQuery[nQuery++] = strdup(zLine);
+  }
+  fclose(in);
+  *pnQuery = nQuery;
+  return azQuery;
+}
+
+/*
+** Run a single query on a new connection and return its latency in
+** milliseconds, or a negative value on error.
+*/
+static double benchRunQuery(
+  const char *zDb,
+  const char *zVfs,
+  const char *zSql,
+  sqlite3_int64 *pnRow
+){
+  sqlite3 *db = 0;
+  sqlite3_stmt *pStmt = 0;
+  double tStart = benchNow();
+  double tEnd;
+  int rc;
+
+  rc = sqlite3_open_v2(zDb, &db, SQLITE_OPEN_READONLY|SQLITE_OPEN_URI, zVfs);
+  if( rc==SQLITE_OK ){
+    rc = sqlite3_prepare_v2(db, zSql, -1, &pStmt, 0);
+  }
+  if( rc==SQLITE_OK ){
+    while( (rc = sqlite3_step(pStmt))==SQLITE_ROW ) (*pnRow)++;
+    if( rc==SQLITE_DONE ) rc = SQLITE_OK;
+  }
+  tEnd = benchNow();
+  if( rc!=SQLITE_OK ){
+    fprintf(stderr, "%s: %s\n  [%s]\n", zVfs, sqlite3_errmsg(db), zSql);
+  }
+  sqlite3_finalize(pStmt);
+  sqlite3_close(db);
+  return rc==SQLITE_OK ? tEnd-tStart : -1.0;
+}
+
+static int benchCompareDouble(const void *a, const void *b){
+  double x = *(const double*)a;
+  double y = *(const double*)b;
+  return x<y ? -1 : x>y;
+}
+
+/*
+** Print a summary line for one VFS.
+*/
+static void benchReport(BenchResult *p){
+  double rSum = 0.0;
+  int i;
+  int n = p->nLatency;
+  if( n==0 ){
+    printf("%-14s no successful queries (%d errors)\n", p->zVfs, p->nErr);
+    return;
+  }
+  qsort(p->aLatency, n, sizeof(double), benchCompareDouble);
+  for(i=0; i<n; i++) rSum += p->aLatency[i];
+  printf("%-14s %6d %10.3f %10.3f %10.3f %10.3f %10.3f %10lld %5d\n",
+         p->zVfs, n, p->aLatency[0], p->aLatency[n/2],
+         p->aLatency[(n*9)/10], p->aLatency[n-1], rSum/n, p->nRow, p->nErr);
+}
+
+static void usage(const char *zArgv0){
+  fprintf(stderr,
+    "Usage: %s ?OPTIONS? DATABASE QUERYFILE\n"
+    "Options:\n"
+    "   -vfs NAME        measure VFS NAME (may be repeated)\n"
+    "   -repeat N        run the query file N times per VFS\n"
+    "   -drop-caches     also drop all kernel caches before each query\n"
+    "   -warm            do not evict the database from the page cache\n",
+    zArgv0);
+  exit(1);
+}
+
+int main(int argc, char **argv){
+  const char *zDb = 0;
+  const char *zQueryFile = 0;
+  const char *azVfs[BENCH_MAX_VFS];
+  BenchResult aResult[BENCH_MAX_VFS];
+  char **azQuery;
+  int nQuery;
+  int nVfs = 0;
+  int nRepeat = 3;
+  int bDropCaches = 0;
+  int bWarm = 0;
+  int rc;
+  int i, j, k;
+
+  for(i=1; i<argc; i++){
+    const char *z = argv[i];
+    if( z[0]=='-' && z[1]=='-' ) z++;
+    if( strcmp(z, "-vfs")==0 && i+1<argc ){
+      if( nVfs>=BENCH_MAX_VFS ) usage(argv[0]);
+      azVfs[nVfs++] = argv[++i];
+    }else if( strcmp(z, "-repeat")==0 && i+1<argc ){
+      nRepeat = atoi(argv[++i]);
+      if( nRepeat<1 ) nRepeat = 1;
+    }else if( strcmp(z, "-drop-caches")==0 ){
+      bDropCaches = 1;
+    }else if( strcmp(z, "-warm")==0 ){
+      bWarm = 1;
+    }else if( z[0]=='-' ){
+      usage(argv[0]);
+    }else if( zDb==0 ){
+      zDb = z;
+    }else if( zQueryFile==0 ){
+      zQueryFile = z;
+    }else{
+      usage(argv[0]);
+    }
+  }
+  if( zDb==0 || zQueryFile==0 ) usage(argv[0]);
+  if( nVfs==0 ){
+    azVfs[nVfs++] = "zipvfsonly";
+    azVfs[nVfs++] = "zipvfs_uring";
+  }
+
+  rc = nds_uring_initialize("unix", 0);
+  if( rc!=SQLITE_OK ){
+    fprintf(stderr, "cannot register the io_uring VFS: %d\n", rc);
+    return 1;
+  }
+  for(i=0; i<nVfs; i++){
+    if( sqlite3_vfs_find(azVfs[i])==0 ){
+      fprintf(stderr, "no such VFS: \"%s\"\n", azVfs[i]);
+      return 1;
+    }
+  }
+
+  azQuery = benchReadQueries(zQueryFile, &nQuery);
+  if( nQuery==0 ){
+    fprintf(stderr, "no queries in \"%s\"\n", zQueryFile);
+    return 1;
+  }
+
+  for(i=0; i<nVfs; i++){
+    memset(&aResult[i], 0, sizeof(BenchResult));
+    aResult[i].zVfs = azVfs[i];
+    aResult[i].aLatency = malloc(sizeof(double)*nQuery*nRepeat);
+    if( aResult[i].aLatency==0 ){
+      fprintf(stderr, "out of memory\n");
+      return 1;
+    }
+  }
+
+  /* Interleave the VFSes query by query so that slow drift in the state
+  ** of the device affects all of them equally. */
+  for(k=0; k<nRepeat; k++){
+    for(j=0; j<nQuery; j++){
+      for(i=0; i<nVfs; i++){
+        BenchResult *p = &aResult[i];
+        double rMs;
+        if( !bWarm ) benchEvict(zDb, bDropCaches);
+        rMs = benchRunQuery(zDb, p->zVfs, azQuery[j], &p->nRow);
+        if( rMs<0.0 ){
+          p->nErr++;
+        }else{
+          p->aLatency[p->nLatency++] = rMs;
+        }
+      }
+    }
+  }
+
+  printf("%d queries x %d repeats, %s cache, latency in ms\n",
+         nQuery, nRepeat, bWarm ? "warm" : "cold");
+  printf("%-14s %6s %10s %10s %10s %10s %10s %10s %5s\n",
+         "vfs", "n", "min", "median", "p90", "max", "avg", "rows", "err");
+  for(i=0; i<nVfs; i++){
+    benchReport(&aResult[i]);
+    free(aResult[i].aLatency);
+  }
+  for(j=0; j<nQuery; j++) free(azQuery[j]);
+  free(azQuery);
+  return 0;
+}
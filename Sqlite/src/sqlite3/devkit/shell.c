@@ -1624,6 +1624,7 @@ static char zHelp[] =
   ".timeout MS            Try opening locked tables for MS milliseconds\n"
   ".trace FILE|off        Output each SQL statement as it is run\n"
   ".vfsname ?AUX?         Print the name of the VFS stack\n"
+  ".verify ?DB? ?N?       Verify page checksums of DB using N threads\n"
   ".width NUM1 NUM2 ...   Set column widths for \"column\" mode\n"
 ;
 
@@ -2139,6 +2140,15 @@ static void tryToClone(struct callback_data *p, const char *zNewDb){
   sqlite3_close(newDb);
 }
 
+/*
+** Callback invoked by the ".verify" command for each page with a bad
+** checksum.
+*/
+static void verify_bad_page_callback(void *pArg, unsigned int iPg){
+  struct callback_data *p = (struct callback_data*)pArg;
+  fprintf(p->out, "page %u: checksum mismatch\n", iPg);
+}
+
 /*
 ** If an input line begins with "." then invoke this routine to
 ** process that line.
@@ -3175,6 +3185,31 @@ static int do_meta_command(char *zLine, struct callback_data *p){
     }
   }else
 
+  if( c=='v' && n>=4 && strncmp(azArg[0], "verify", n)==0 && nArg<=3 ){
+    extern int nds_compression_verify(sqlite3*, const char*, int,
+                                      void(*)(void*,unsigned int), void*,
+                                      sqlite3_int64*);
+    const char *zDbName = nArg>=2 ? azArg[1] : "main";
+    int nThread = nArg==3 ? (int)integerValue(azArg[2]) : 4;
+    sqlite3_int64 nRecord = 0;
+    int rc2;
+    open_db(p, 0);
+    rc2 = nds_compression_verify(p->db, zDbName, nThread,
+                                 verify_bad_page_callback, p, &nRecord);
+    if( rc2==SQLITE_OK ){
+      fprintf(p->out, "ok (%lld pages)\n", nRecord);
+    }else if( rc2==SQLITE_NOTFOUND ){
+      fprintf(stderr, "Error: database has no page checksums\n");
+      rc = 1;
+    }else if( rc2==SQLITE_CORRUPT ){
+      fprintf(stderr, "Error: checksum mismatch\n");
+      rc = 1;
+    }else{
+      fprintf(stderr, "Error: verify failed with error code %d\n", rc2);
+      rc = 1;
+    }
+  }else
+
 #if defined(SQLITE_DEBUG) && defined(SQLITE_ENABLE_WHERETRACE)
   if( c=='w' && strncmp(azArg[0], "wheretrace", n)==0 ){
     extern int sqlite3WhereTrace;
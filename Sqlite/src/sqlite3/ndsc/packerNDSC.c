@@ -10,6 +10,158 @@
 
 #define NSDC_HASH_LEN 4096  /* # of hash table entries (must be a power of 2) */
 
+#define NDSC_RUN_MAX  (4096+3-1)        /* max. length of a run-length sequence */
+#define NDSC_PAT_MAX  (256+16-1)        /* max. length of a pattern */
+#define NDSC_PAT_DIST (4096+256+16-1)   /* max. distance of a pattern */
+
+#define NDSC_LARGE_HNUM 32  /* from this # of hash pages per entry on, the hash table
+                             * is cleared lazily and its buckets are prefetched */
+
+
+/* compare 8 bytes at a time in the scan loops of PackNDSC() where the
+ * compiler provides a count-trailing/leading-zeros primitive
+ *
+ */
+
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+    typedef unsigned long long ndsc_word;
+    #define NDSC_WORD_SCAN
+    #define NDSC_FIRST_DIFF(x) ((unsigned int)__builtin_ctzll(x) >> 3)
+#elif defined(__GNUC__) && defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    typedef unsigned long long ndsc_word;
+    #define NDSC_WORD_SCAN
+    #define NDSC_FIRST_DIFF(x) ((unsigned int)__builtin_clzll(x) >> 3)
+#elif defined(_MSC_VER) && defined(_M_X64)
+    #include <intrin.h>
+    typedef unsigned __int64 ndsc_word;
+    #define NDSC_WORD_SCAN
+    static unsigned int NdscFirstDiff( ndsc_word x )
+    {
+        unsigned long i;
+        _BitScanForward64(&i, x);
+        return( (unsigned int)i >> 3 );
+    }
+    #define NDSC_FIRST_DIFF(x) NdscFirstDiff(x)
+#endif
+
+#if defined(__GNUC__)
+    #define NDSC_PREFETCH(p) __builtin_prefetch(p)
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <xmmintrin.h>
+    #define NDSC_PREFETCH(p) _mm_prefetch((const char *)(p), _MM_HINT_T0)
+#else
+    #define NDSC_PREFETCH(p)
+#endif
+
+
+/* insert pos at the front of a hash bucket, shifting the first nmove
+ * entries back by one (the hash bucket holds the most recent positions
+ * first)
+ *
+ */
+
+static void NdscBucketInsert( unsigned char **bucket, unsigned int nmove, unsigned char *pos )
+{
+    if( nmove >= 8 )   /* memmove() pays off for all but the smallest buckets */
+    {
+        memmove(&bucket[1], &bucket[0], nmove*sizeof(*bucket));
+    }
+    else
+    {
+        while( nmove > 0 )
+        {
+            bucket[nmove] = bucket[nmove-1];
+            nmove--;
+        }
+    }
+
+    bucket[0] = pos;
+}
+
+
+/* return the number of bytes at src_ofs (up to end_ofs) that are equal to c
+ *
+ */
+
+static unsigned int NdscRunLength( const unsigned char *src_ofs, const unsigned char *end_ofs, unsigned char c )
+{
+    const unsigned char *start_ofs = src_ofs;
+
+#ifdef NDSC_WORD_SCAN
+    ndsc_word pattern = c * (((ndsc_word)-1) / 0xFF);   /* c in every byte */
+
+    /* most runs end at the first byte */
+    if( (src_ofs < end_ofs) && (*src_ofs != c) )
+    {
+        return( 0 );
+    }
+
+    while( (end_ofs - src_ofs) >= (long)sizeof(ndsc_word) )
+    {
+        ndsc_word data;
+
+        memcpy(&data, src_ofs, sizeof(data));
+
+        if( (data ^= pattern) != 0 )
+        {
+            return( (unsigned int)(src_ofs - start_ofs) + NDSC_FIRST_DIFF(data) );
+        }
+
+        src_ofs += sizeof(ndsc_word);
+    }
+#endif
+
+    while( (src_ofs < end_ofs) && (*src_ofs == c) )
+    {
+        src_ofs++;
+    }
+
+    return( (unsigned int)(src_ofs - start_ofs) );
+}
+
+
+/* return the number of bytes at src_ofs (up to end_ofs) that are equal to
+ * the bytes at pat_ofs
+ *
+ */
+
+static unsigned int NdscMatchLength( const unsigned char *src_ofs, const unsigned char *end_ofs, const unsigned char *pat_ofs )
+{
+    const unsigned char *start_ofs = src_ofs;
+
+#ifdef NDSC_WORD_SCAN
+    /* most candidates differ at the first byte */
+    if( (src_ofs < end_ofs) && (*src_ofs != *pat_ofs) )
+    {
+        return( 0 );
+    }
+
+    while( (end_ofs - src_ofs) >= (long)sizeof(ndsc_word) )
+    {
+        ndsc_word data, pattern;
+
+        memcpy(&data, src_ofs, sizeof(data));
+        memcpy(&pattern, pat_ofs, sizeof(pattern));
+
+        if( (data ^= pattern) != 0 )
+        {
+            return( (unsigned int)(src_ofs - start_ofs) + NDSC_FIRST_DIFF(data) );
+        }
+
+        src_ofs += sizeof(ndsc_word);
+        pat_ofs += sizeof(ndsc_word);
+    }
+#endif
+
+    while( (src_ofs < end_ofs) && (*src_ofs == *pat_ofs) )
+    {
+        src_ofs++;
+        pat_ofs++;
+    }
+
+    return( (unsigned int)(src_ofs - start_ofs) );
+}
+
 
 /* return maximum compressed length
  *
@@ -42,7 +194,9 @@ int PackNDSC( unsigned char *src_ptr, unsigned int src_len, unsigned char *dst_p
 
     unsigned char *out_ofs = dst_ptr + sizeof(ctrl_data);
     unsigned char *dst_end = dst_ptr + dst_len;
-    unsigned int i;
+    unsigned char **bucket;
+    unsigned char bucket_used[NSDC_HASH_LEN/CHAR_BIT];  /* buckets cleared so far */
+    unsigned int i, nmove;
 
     unsigned char *(*hash_tbl)[];   /* hash table for quickly identifying matching patterns */
 
@@ -53,7 +207,19 @@ int PackNDSC( unsigned char *src_ptr, unsigned int src_len, unsigned char *dst_p
 
     hnum = 1 << mode;   /* # of hash pages per entry */
 
-    if( hash_tbl = calloc(NSDC_HASH_LEN*hnum, sizeof(unsigned char *)) )
+    /* a large hash table (up to 8 MB) is not cleared up front; instead each
+     * bucket is cleared when it is used for the first time */
+    if( hnum >= NDSC_LARGE_HNUM )
+    {
+        memset(bucket_used, 0, sizeof(bucket_used));
+        hash_tbl = malloc(NSDC_HASH_LEN*hnum*sizeof(unsigned char *));
+    }
+    else
+    {
+        hash_tbl = calloc(NSDC_HASH_LEN*hnum, sizeof(unsigned char *));
+    }
+
+    if( hash_tbl )
     {
         /* scan through the data stream */
         while( src_ofs < src_end )
@@ -74,7 +240,7 @@ failure:
             {
                 src_ofs = cur_ofs;
 
-                end_ofs = src_ofs+4096+3-1;
+                end_ofs = src_ofs+NDSC_RUN_MAX;
 
                 if( src_end < end_ofs )
                 {
@@ -84,16 +250,13 @@ failure:
                 c = *(cur_ofs - 1);
 
                 /* run-length scan core function */
-                while( (src_ofs < end_ofs) && (*src_ofs == c) )
-                {
-                    src_ofs++;
-                }
+                src_ofs += NdscRunLength(src_ofs, end_ofs, c);
 
                 /* decide whether it is beneficial to use run-length compression */
                 if( (cnt = (unsigned int)(src_ofs - cur_ofs)) > 1 )
                 {
                     /* examine extra char at the beginning of the run-length sequence */
-                    cnt += ext = (unc_ofs != NULL) && ((cur_ofs - src_ptr) > 1) && (*(cur_ofs-2) == c) && (cnt < (4096+3-1));
+                    cnt += ext = (unc_ofs != NULL) && ((cur_ofs - src_ptr) > 1) && (*(cur_ofs-2) == c) && (cnt < NDSC_RUN_MAX);
 
                     /* test for minimum length */
                     if( cnt > 2 )
@@ -183,34 +346,53 @@ failure:
                 lst_ofs = cur_ofs;
 
                 hash = ((lst_ofs[0] << 4) ^ lst_ofs[1]) & (NSDC_HASH_LEN - 1);
+                bucket = &(*hash_tbl)[hash*hnum];
 
-                if( ((cur_ofs - src_ptr) & 1) == 0 )
+                if( (hnum >= NDSC_LARGE_HNUM) && ((bucket_used[hash/CHAR_BIT] & (1 << (hash%CHAR_BIT))) == 0) )
                 {
-                    for(i=0;i<hnum;i++)
-                    {
-                        pat_ofs = (*hash_tbl)[hash*hnum+i];
-                        (*hash_tbl)[hash*hnum+i] = lst_ofs;
-                        lst_ofs = pat_ofs;
-                    }
+                    bucket_used[hash/CHAR_BIT] |= 1 << (hash%CHAR_BIT);
+                    memset(bucket, 0, hnum*sizeof(*bucket));
                 }
-                else
+
+                /* prefetch the hash bucket of the next position */
+                if( (hnum >= NDSC_LARGE_HNUM) && ((src_end - cur_ofs) > 2) )
+                {
+                    NDSC_PREFETCH(&(*hash_tbl)[(((cur_ofs[1] << 4) ^ cur_ofs[2]) & (NSDC_HASH_LEN - 1))*hnum]);
+                }
+
+                /* the current position is inserted at the front of the hash
+                 * bucket, the last entry is dropped */
+                nmove = hnum - 1;
+
+                if( ((cur_ofs - src_ptr) & 1) != 0 )
                 {
                     mcnt = 0;
 
                     for(i=0;i<hnum;i++)
                     {
-                        pat_ofs = (*hash_tbl)[hash*hnum+i];
-                        (*hash_tbl)[hash*hnum+i] = lst_ofs;
+                        pat_ofs = bucket[i];
+
+                        /* small hash buckets are shifted while they are scanned */
+                        if( hnum < NDSC_LARGE_HNUM )
+                        {
+                            bucket[i] = lst_ofs;
+                        }
 
                         /* locate a possible pattern */
-                        if( lst_ofs = pat_ofs )
+                        if( (lst_ofs = pat_ofs) != NULL )
                         {
                             /* compare characters if we are within the pattern scan range */
-                            if( (cur_ofs - pat_ofs) < (4096+256+16-1) )
+                            if( (cur_ofs - pat_ofs) < NDSC_PAT_DIST )
                             {
+                                /* no later pattern can be longer than the maximum */
+                                if( mcnt >= NDSC_PAT_MAX )
+                                {
+                                    continue;
+                                }
+
                                 src_ofs = cur_ofs;
 
-                                end_ofs = src_ofs+256+16-1;
+                                end_ofs = src_ofs+NDSC_PAT_MAX;
 
                                 if( src_end < end_ofs )
                                 {
@@ -223,19 +405,17 @@ failure:
                                 }
 
                                 /* pattern scan core function */
-                                while( (src_ofs < end_ofs) && (*src_ofs == *pat_ofs) )
-                                {
-                                    src_ofs++;
-                                    pat_ofs++;
-                                }
+                                cnt = NdscMatchLength(src_ofs, end_ofs, pat_ofs);
+                                src_ofs += cnt;
+                                pat_ofs += cnt;
 
                                 /* decide whether it is beneficial to use pattern compression */
-                                if( (cnt = (unsigned int)(src_ofs - cur_ofs)) > 1 )
+                                if( cnt > 1 )
                                 {
                                     if( (gap = (unsigned int)(cur_ofs - pat_ofs)) < 4096 )
                                     {
                                         /* examine extra char at the beginning of the pattern sequence */
-                                        cnt += ext = (unc_ofs != NULL) && (gap > 0) && ((lst_ofs - src_ptr) > 0) && (*(cur_ofs-1) == *(lst_ofs-1)) && (cnt < (256+16-1));
+                                        cnt += ext = (unc_ofs != NULL) && (gap > 0) && ((lst_ofs - src_ptr) > 0) && (*(cur_ofs-1) == *(lst_ofs-1)) && (cnt < NDSC_PAT_MAX);
 
                                         /* find matching pattern with maximum length */
                                         if( cnt > mcnt )
@@ -249,11 +429,19 @@ failure:
                             }
                             else
                             {
-                                break;  /* the distance of the remaining patterns is too large */
+                                /* the distance of the remaining patterns is too large;
+                                 * this entry is dropped, the ones after it are kept */
+                                nmove = i;
+                                break;
                             }
                         }
                     }
 
+                    if( hnum >= NDSC_LARGE_HNUM )
+                    {
+                        NdscBucketInsert(bucket, nmove, cur_ofs);
+                    }
+
                     /* test for minimum length */
                     if( mcnt > 2 )
                     {
@@ -352,6 +540,10 @@ failure:
                         }
                     }
                 }
+                else
+                {
+                    NdscBucketInsert(bucket, nmove, cur_ofs);
+                }
             }
 
             if( unc_ofs == NULL )